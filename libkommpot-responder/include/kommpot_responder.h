@@ -0,0 +1,112 @@
+#ifndef KOMMPOT_RESPONDER_H
+#define KOMMPOT_RESPONDER_H
+
+#pragma once
+
+#include <libkommpot.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace kommpot {
+    /**
+     * @brief describes identity that the responder advertises in discovery replies.
+     */
+    struct discovery_responder_configuration
+    {
+        std::string name = "";
+        std::string mac = "";
+
+        /**
+         * @brief service endpoint of the device that kommpot opens after discovery.
+         */
+        ethernet_protocol_type protocol = ethernet_protocol_type::TCP;
+        uint16_t port = 0;
+
+        /**
+         * @brief UDP port the responder listens on, 0 selects the default kommpot discovery port.
+         */
+        uint16_t discovery_port = 0;
+
+        /**
+         * @attention broadcasts are only delivered to sockets bound to the wildcard address.
+         */
+        std::string bind_address = "0.0.0.0";
+    };
+
+    /**
+     * @brief answers kommpot UDP discovery probes, meant to be embedded into device firmware and
+     * device simulators.
+     */
+    class discovery_responder
+    {
+    public:
+        explicit discovery_responder(discovery_responder_configuration configuration);
+        ~discovery_responder();
+
+        /**
+         * @warning states class is non-copyable.
+         */
+        discovery_responder(const discovery_responder &obj) = delete;
+        auto operator=(const discovery_responder &obj) -> discovery_responder & = delete;
+
+        /**
+         * @warning states class is non-movable.
+         */
+        discovery_responder(discovery_responder &&obj) = delete;
+        auto operator=(discovery_responder &&obj) -> discovery_responder & = delete;
+
+        /**
+         * @brief binds the discovery socket and starts answering probes on a background thread.
+         * @return true if started successfully, false if any error happened.
+         */
+        auto start() -> bool;
+
+        /**
+         * @brief stops the background thread and closes the discovery socket.
+         */
+        auto stop() -> void;
+
+        [[nodiscard]] auto is_running() const -> bool;
+
+        /**
+         * @brief states UDP port the responder is bound to, useful when discovery_port is 0.
+         * @return port number or 0 if responder is not running.
+         */
+        [[nodiscard]] auto port() const -> uint16_t;
+
+        /**
+         * @brief builds reply to a received datagram, for firmware that runs its own socket loop.
+         * @param data states received datagram.
+         * @param size_bytes states received datagram size.
+         * @param reply states buffer the reply datagram is written to.
+         * @return true if datagram is a valid probe and reply has to be sent back to its source.
+         */
+        [[nodiscard]] auto handle_datagram(const uint8_t *data, const size_t size_bytes,
+            std::vector<uint8_t> &reply) const -> bool;
+
+    private:
+        discovery_responder_configuration m_configuration;
+        std::thread m_thread;
+        std::atomic_bool m_is_running = false;
+        uint16_t m_bound_port = 0;
+
+#ifdef _WIN32
+        static constexpr uint64_t M_INVALID_SOCKET = ~0;
+#else
+        static constexpr uint64_t M_INVALID_SOCKET = -1;
+#endif
+        static constexpr uint32_t M_POLL_INTERVAL_MSEC = 100;
+
+        uint64_t m_handle = M_INVALID_SOCKET;
+
+        auto run() -> void;
+        auto close_socket() -> void;
+    };
+} // namespace kommpot
+
+#endif // KOMMPOT_RESPONDER_H
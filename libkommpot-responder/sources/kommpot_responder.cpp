@@ -0,0 +1,222 @@
+#include <kommpot_responder.h>
+
+#include <communications/ethernet/ethernet_discovery_protocol.h>
+
+#include <array>
+#include <utility>
+
+#ifdef _WIN32
+// clang-format off
+#    include <winsock2.h>
+#    include <ws2tcpip.h>
+#    pragma comment(lib, "ws2_32.lib")
+// clang-format on
+#else
+#    include <arpa/inet.h>
+#    include <netinet/in.h>
+#    include <sys/select.h>
+#    include <sys/socket.h>
+#    include <unistd.h>
+#endif
+
+kommpot::discovery_responder::discovery_responder(discovery_responder_configuration configuration)
+    : m_configuration(std::move(configuration))
+{}
+
+kommpot::discovery_responder::~discovery_responder()
+{
+    stop();
+}
+
+auto kommpot::discovery_responder::start() -> bool
+{
+    if (m_is_running)
+    {
+        return true;
+    }
+
+#ifdef _WIN32
+    WSADATA wsa_data = {};
+    if (WSAStartup(MAKEWORD(2, 2), &wsa_data) != NO_ERROR)
+    {
+        return false;
+    }
+#endif
+
+    const bool is_ipv6 = m_configuration.bind_address.find(':') != std::string::npos;
+    const int family = is_ipv6 ? AF_INET6 : AF_INET;
+
+    m_handle = socket(family, SOCK_DGRAM, IPPROTO_UDP);
+    if (m_handle == M_INVALID_SOCKET)
+    {
+        /**
+         * @attention close_socket() balances WSAStartup() only for a valid handle.
+         */
+#ifdef _WIN32
+        WSACleanup();
+#endif
+        return false;
+    }
+
+    const int reuse = 1;
+    setsockopt(m_handle, SOL_SOCKET, SO_REUSEADDR, (const char *)&reuse, sizeof(reuse));
+
+    const uint16_t discovery_port = (m_configuration.discovery_port != 0)
+                                        ? m_configuration.discovery_port
+                                        : ethernet_discovery_protocol::DEFAULT_PORT;
+
+    sockaddr_storage address = {};
+    socklen_t address_length_bytes = 0;
+    if (is_ipv6)
+    {
+        auto *ipv6 = reinterpret_cast<sockaddr_in6 *>(&address);
+        ipv6->sin6_family = AF_INET6;
+        ipv6->sin6_port = htons(discovery_port);
+        if (inet_pton(AF_INET6, m_configuration.bind_address.c_str(), &ipv6->sin6_addr) != 1)
+        {
+            close_socket();
+            return false;
+        }
+        address_length_bytes = sizeof(sockaddr_in6);
+    }
+    else
+    {
+        auto *ipv4 = reinterpret_cast<sockaddr_in *>(&address);
+        ipv4->sin_family = AF_INET;
+        ipv4->sin_port = htons(discovery_port);
+        if (inet_pton(AF_INET, m_configuration.bind_address.c_str(), &ipv4->sin_addr) != 1)
+        {
+            close_socket();
+            return false;
+        }
+        address_length_bytes = sizeof(sockaddr_in);
+    }
+
+    if (bind(m_handle, (const sockaddr *)&address, address_length_bytes) != 0)
+    {
+        close_socket();
+        return false;
+    }
+
+    sockaddr_storage bound_address = {};
+    socklen_t bound_address_length_bytes = sizeof(bound_address);
+    if (getsockname(m_handle, (sockaddr *)&bound_address, &bound_address_length_bytes) != 0)
+    {
+        close_socket();
+        return false;
+    }
+
+    m_bound_port = is_ipv6 ? ntohs(reinterpret_cast<sockaddr_in6 *>(&bound_address)->sin6_port)
+                           : ntohs(reinterpret_cast<sockaddr_in *>(&bound_address)->sin_port);
+
+    m_is_running = true;
+    m_thread = std::thread(&discovery_responder::run, this);
+
+    return true;
+}
+
+auto kommpot::discovery_responder::stop() -> void
+{
+    m_is_running = false;
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+
+    close_socket();
+}
+
+auto kommpot::discovery_responder::is_running() const -> bool
+{
+    return m_is_running;
+}
+
+auto kommpot::discovery_responder::port() const -> uint16_t
+{
+    return m_is_running ? m_bound_port : 0;
+}
+
+auto kommpot::discovery_responder::handle_datagram(
+    const uint8_t *data, const size_t size_bytes, std::vector<uint8_t> &reply) const -> bool
+{
+    const auto probe = ethernet_discovery_protocol::decode(data, size_bytes);
+    if (!probe || probe->type != ethernet_discovery_message_type::PROBE)
+    {
+        return false;
+    }
+
+    ethernet_discovery_message message;
+    message.type = ethernet_discovery_message_type::REPLY;
+    message.transaction_id = probe->transaction_id;
+    message.name = m_configuration.name;
+    message.mac = m_configuration.mac;
+    message.port = m_configuration.port;
+    message.protocol = static_cast<uint8_t>(m_configuration.protocol);
+
+    reply = ethernet_discovery_protocol::encode(message);
+
+    return true;
+}
+
+auto kommpot::discovery_responder::run() -> void
+{
+    std::array<uint8_t, ethernet_discovery_protocol::MAX_MESSAGE_SIZE_BYTES> buffer = {};
+    std::vector<uint8_t> reply;
+
+    while (m_is_running)
+    {
+        fd_set read_set;
+        FD_ZERO(&read_set);
+        FD_SET(m_handle, &read_set);
+
+        /**
+         * @attention wake up regularly so stop() does not have to close the socket under select().
+         */
+        timeval timeout = {};
+        timeout.tv_sec = 0;
+        timeout.tv_usec = M_POLL_INTERVAL_MSEC * 1000;
+
+        if (select(static_cast<int>(m_handle) + 1, &read_set, nullptr, nullptr, &timeout) <= 0)
+        {
+            continue;
+        }
+
+        sockaddr_storage source_address = {};
+        socklen_t source_address_length_bytes = sizeof(source_address);
+
+        const auto received_size_bytes =
+            recvfrom(m_handle, (char *)buffer.data(), static_cast<int>(buffer.size()), 0,
+                (sockaddr *)&source_address, &source_address_length_bytes);
+        if (received_size_bytes <= 0)
+        {
+            continue;
+        }
+
+        if (!handle_datagram(buffer.data(), static_cast<size_t>(received_size_bytes), reply))
+        {
+            continue;
+        }
+
+        sendto(m_handle, (const char *)reply.data(), static_cast<int>(reply.size()), 0,
+            (const sockaddr *)&source_address, source_address_length_bytes);
+    }
+}
+
+auto kommpot::discovery_responder::close_socket() -> void
+{
+    if (m_handle == M_INVALID_SOCKET)
+    {
+        return;
+    }
+
+#ifdef _WIN32
+    closesocket(m_handle);
+    WSACleanup();
+#else
+    close(static_cast<int>(m_handle));
+#endif
+
+    m_handle = M_INVALID_SOCKET;
+    m_bound_port = 0;
+}
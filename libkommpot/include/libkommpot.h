@@ -5,11 +5,17 @@
 
 #include "export_definitions.h"
 
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 
@@ -185,6 +191,35 @@ namespace kommpot {
     auto EXPORTED communication_type_to_string(const communication_type &type) noexcept
         -> std::string;
 
+    /**
+     * @brief states how Ethernet sockets are tuned when they are created.
+     */
+    enum class ethernet_socket_profile
+    {
+        /**
+         * @brief leaves all socket options at OS defaults.
+         */
+        DEFAULT = 0,
+
+        /**
+         * @brief request / response devices: Nagle's algorithm off, immediate ACKs, busy polling,
+         * DSCP EF and a short keepalive.
+         */
+        LOW_LATENCY = 1,
+
+        /**
+         * @brief streaming devices: large socket buffers, DSCP AF11 and a relaxed keepalive.
+         */
+        BULK_THROUGHPUT = 2,
+    };
+
+    /**
+     * @brief gets ethernet_socket_profile as string.
+     * @return ethernet_socket_profile as string.
+     */
+    auto EXPORTED ethernet_socket_profile_to_string(const ethernet_socket_profile &profile) noexcept
+        -> std::string;
+
     /**
      * @brief states specific configuration required for opening the device communication.
      */
@@ -195,6 +230,55 @@ namespace kommpot {
          */
         uint8_t bit_mode = 0;
         uint8_t bit_mask = 0;
+
+        /**
+         * Ethernet connection settings
+         * @attention TCP Fast Open sends the first write together with the SYN once the peer handed
+         * out a cookie, it is only used if the host resolves to a single address.
+         * @attention connection_attempt_delay_msecs states how long an IPv6 / IPv4 candidate may
+         * stay unanswered before the next one is tried in parallel (RFC 8305).
+         * @attention io_uring submits every connect, read and write together with its timeout in a
+         * single system call, it falls back to plain system calls where it is not available.
+         */
+        bool is_tcp_fast_open_enabled = false;
+        uint32_t connection_attempt_delay_msecs = 250;
+        ethernet_socket_profile socket_profile = ethernet_socket_profile::DEFAULT;
+        bool is_io_uring_enabled = false;
+
+        /**
+         * @brief write_zero_copy() copies smaller writes as usual, pinning pages and reading
+         * completions costs more than copying a few kilobytes. 0 never copies.
+         */
+        uint32_t zero_copy_threshold_bytes = 16 * 1024;
+
+        /**
+         * @brief read_view() maps whole pages of received TCP payload into memory instead of
+         * copying them (Linux 4.18+), the rest is copied. Pages are only mapped if the sender's
+         * payload lands page-aligned in the receive queue, e.g. MTU 4096 + headers or TCP
+         * header-data split on the NIC.
+         */
+        bool is_zero_copy_receive_enabled = false;
+
+        /**
+         * @brief UDP offload (Linux 4.18+ / 5.0+): write_messages() hands runs of equally sized
+         * datagrams to the OS as one UDP_SEGMENT send, the OS coalesces received datagrams of a
+         * flow with UDP_GRO and read_messages() splits them again.
+         */
+        bool is_udp_offload_enabled = false;
+
+        /**
+         * @brief datagrams a multicast device may fall behind its group before the oldest ones
+         * are dropped.
+         */
+        uint32_t multicast_queue_datagrams = 4096;
+
+        /**
+         * @brief read_timestamped() / write_timestamped() report when the OS received and sent
+         * the data (SO_TIMESTAMPING, Linux). Hardware timestamps are taken by the NIC if it was
+         * configured for them, e.g. by ptp4l or hwstamp_ctl, software ones are reported otherwise.
+         */
+        bool is_timestamping_enabled = false;
+        bool is_hardware_timestamping_enabled = false;
     };
 
     struct communication_error
@@ -239,6 +323,11 @@ namespace kommpot {
         UNKNOWN = 0,
         TCP = 1,
         UDP = 2,
+
+        /**
+         * @brief Ethernet frames of one EtherType on one interface, below IP (Linux only).
+         */
+        RAW = 3,
     };
 
     /**
@@ -248,6 +337,166 @@ namespace kommpot {
     auto EXPORTED ethernet_protocol_type_to_string(const ethernet_protocol_type &type) noexcept
         -> std::string;
 
+    /**
+     * @brief states how Ethernet devices are searched for when no fixed IP address is given.
+     */
+    enum class ethernet_discovery_type
+    {
+        UNKNOWN = 0,
+
+        /**
+         * @brief connects to every host address of the network (O(hosts) TCP connects).
+         */
+        TCP_SWEEP = 1,
+
+        /**
+         * @brief sends one kommpot discovery probe per interface and collects the replies of
+         * devices running the kommpot responder.
+         */
+        UDP_BROADCAST = 2,
+
+        /**
+         * @brief pings the IPv6 all-nodes address per interface and connects only to the hosts
+         * found in the neighbor discovery cache afterwards (O(live hosts) TCP connects).
+         */
+        IPV6_NEIGHBOR_DISCOVERY = 3,
+    };
+
+    /**
+     * @brief gets ethernet_discovery_type as string.
+     * @return ethernet_discovery_type as string.
+     */
+    auto EXPORTED ethernet_discovery_type_to_string(const ethernet_discovery_type &type) noexcept
+        -> std::string;
+
+    /**
+     * @brief inclusive range of TCP ports, first value 0 states an empty range.
+     */
+    struct ethernet_port_range
+    {
+        uint16_t first = 0;
+        uint16_t last = 0;
+    };
+
+    /**
+     * @brief describes how far a TCP sweep has progressed.
+     */
+    struct ethernet_scan_progress
+    {
+        uint64_t scanned_hosts = 0;
+        uint64_t total_hosts = 0;
+        uint64_t found_devices = 0;
+        uint64_t elapsed_msecs = 0;
+
+        /**
+         * @brief estimated time until the sweep finishes, extrapolated from the probe rate so far.
+         */
+        uint64_t remaining_msecs = 0;
+    };
+
+    using ethernet_scan_progress_callback = std::function<void(const ethernet_scan_progress &)>;
+
+    /**
+     * @brief tunes the TCP sweep used when searching for Ethernet devices with IP "*".
+     */
+    struct ethernet_scan_configuration
+    {
+        /**
+         * @brief reads the OS neighbor table (ARP/ND) once before the sweep, known neighbors are
+         * probed first and the ones whose MAC does not match the search MAC are skipped.
+         */
+        bool is_neighbor_table_enabled = true;
+
+        /**
+         * @brief probes only hosts listed in the neighbor table, fast but misses hosts the OS has
+         * not talked to recently.
+         */
+        bool is_neighbor_table_only = false;
+
+        /**
+         * @brief keeps the probe connection of every found device in an idle pool for a few
+         * seconds, open() adopts it instead of connecting again.
+         * @attention connections which carried a probe payload are not kept.
+         */
+        bool is_connection_reuse_enabled = false;
+
+        /**
+         * @brief shrinks connect timeout of the remaining probes to a multiple of the 95th
+         * percentile of round trip times measured on hosts that answered so far.
+         * @attention a refused connection is an answer as well, so dead ports help the estimate.
+         */
+        bool is_adaptive_timeout_enabled = true;
+        uint32_t adaptive_timeout_multiplier = 4;
+        uint32_t min_connect_timeout_msecs = 50;
+
+        /**
+         * @brief probes hosts that did not answer within the adaptive timeout once more with the
+         * full timeout.
+         */
+        bool is_retry_pass_enabled = false;
+
+        /**
+         * @category large network parameters.
+         * @brief limits connection attempts per second of the whole sweep, 0 disables pacing.
+         */
+        uint32_t max_probes_per_second = 0;
+
+        /**
+         * @brief limits concurrent connection attempts, 0 selects the default. Concurrency is
+         * always capped to half of the OS ephemeral port range.
+         */
+        uint32_t max_concurrent_probes = 0;
+
+        /**
+         * @brief resets probe connections (SO_LINGER 0) instead of closing them gracefully, so
+         * large sweeps do not leave thousands of sockets in TIME_WAIT.
+         */
+        bool is_abortive_close_enabled = false;
+
+        /**
+         * @brief connects all ports of a host with one io_uring submission instead of a thread per
+         * port, falls back to plain system calls where io_uring is not available (Linux only).
+         */
+        bool is_io_uring_enabled = false;
+
+        /**
+         * @brief called from a scan worker about twice a second and once when the sweep ends.
+         */
+        ethernet_scan_progress_callback progress_callback = nullptr;
+    };
+
+    using ethernet_probe_response_callback = std::function<bool(const std::string &response)>;
+
+    /**
+     * @brief request sent on the search connection of every reachable TCP host, only hosts whose
+     * response passes all configured matchers are reported.
+     * @attention UDP discovery replies are not probed.
+     */
+    struct ethernet_probe_configuration
+    {
+        /**
+         * @brief request bytes, e.g. "*IDN?\n". Empty disables probing.
+         */
+        std::string payload = "";
+
+        /**
+         * @category response matchers, empty ones accept any response.
+         */
+        std::string response_prefix = "";
+
+        /**
+         * @brief ECMAScript regular expression searched in the response.
+         */
+        std::string response_regex = "";
+        ethernet_probe_response_callback response_callback = nullptr;
+
+        /**
+         * @brief time the host has to answer after the request was written.
+         */
+        uint32_t response_timeout_msecs = 200;
+        uint32_t max_response_size_bytes = 1024;
+    };
+
     struct ethernet_device_identification
     {
         /**
@@ -262,6 +511,12 @@ namespace kommpot {
          */
         std::string ip = "*";
 
+        /**
+         * @brief interface index a link-local IPv6 address is reached through, 0 for other
+         * addresses. Searches fill it in for link-local hosts.
+         */
+        uint32_t scope_id = 0;
+
         /**
          * @attention wildcards are supported.
          */
@@ -269,11 +524,132 @@ namespace kommpot {
 
         ethernet_protocol_type protocol = ethernet_protocol_type::UNKNOWN;
         uint16_t port = 0;
+
+        /**
+         * @brief further ports a search probes on every host next to port, each responding port is
+         * reported as a separate device.
+         * @attention ignored by open(), a device always connects to port.
+         */
+        std::vector<uint16_t> ports = {};
+        ethernet_port_range port_range;
+
+        /**
+         * @category discovery parameters.
+         * @attention discovery_port value 0 selects the default kommpot discovery port.
+         */
+        ethernet_discovery_type discovery = ethernet_discovery_type::TCP_SWEEP;
+        uint16_t discovery_port = 0;
+
+        ethernet_scan_configuration scan;
+        ethernet_probe_configuration probe;
+
+        /**
+         * @category multicast parameters.
+         * @brief a multicast_group turns the device into a receiver of the group's UDP datagrams
+         * on port, ip is ignored then. multicast_source restricts it to a single sender
+         * (source-specific multicast), multicast_interface states the index of the interface to
+         * join on, 0 lets the OS choose by route.
+         * @attention devices of the same group share one socket and each gets every datagram.
+         */
+        std::string multicast_group = "";
+        std::string multicast_source = "";
+        uint32_t multicast_interface = 0;
+
+        /**
+         * @category raw Ethernet parameters.
+         * @brief with protocol RAW the device exchanges frames of ether_type on raw_interface,
+         * ip and port are ignored then. A mac without wildcards states the peer, writes are sent
+         * to it and reads only return its frames, otherwise writes are broadcast and reads return
+         * frames of every sender.
+         * @attention needs CAP_NET_RAW.
+         */
+        std::string raw_interface = "";
+        uint16_t ether_type = 0;
     };
 
     using device_identification =
         std::variant<usb_device_identification, ethernet_device_identification>;
 
+    /**
+     * @brief one datagram of device_communication::read_messages() / write_messages() in caller
+     * memory, size_bytes states the buffer capacity for reads and the datagram size for writes.
+     */
+    struct message_buffer
+    {
+        void *data = nullptr;
+        size_t size_bytes = 0;
+
+        /**
+         * @category set by reads, is_truncated states that the datagram did not fit and its end
+         * was dropped.
+         */
+        size_t received_size_bytes = 0;
+        bool is_truncated = false;
+    };
+
+    /**
+     * @brief OS timestamps of a transfer in nanoseconds, std::nullopt if none was taken.
+     * Reads state when the last packet entered the network stack, writes when the last byte was
+     * handed to the driver (software) or left the NIC (hardware).
+     * @attention software timestamps use CLOCK_REALTIME, hardware ones the clock of the NIC, which
+     * only compares to CLOCK_REALTIME if it is synchronized, e.g. by phc2sys.
+     */
+    struct transfer_timestamps
+    {
+        std::optional<uint64_t> software_nsecs = std::nullopt;
+        std::optional<uint64_t> hardware_nsecs = std::nullopt;
+    };
+
+    /**
+     * @brief outcome of device_communication::read_timestamped() / write_timestamped().
+     */
+    struct transfer_result
+    {
+        size_t size_bytes = 0;
+        transfer_timestamps timestamps;
+    };
+
+    /**
+     * @brief called once the buffer passed to write_zero_copy() may be modified or released.
+     */
+    using write_completion_callback = std::function<void()>;
+
+    /**
+     * @brief bytes handed out by device_communication::read_view(), they stay valid until the view
+     * is released or destroyed, even if the communication is closed before.
+     * @attention views of mapped socket pages keep the connection open until they are released.
+     */
+    class EXPORTED received_view
+    {
+    public:
+        received_view() = default;
+        received_view(const uint8_t *data, size_t size_bytes, std::function<void()> release);
+        ~received_view();
+
+        /**
+         * @warning states class is non-copyable.
+         */
+        received_view(const received_view &obj) = delete;
+        auto operator=(const received_view &obj) -> received_view & = delete;
+
+        received_view(received_view &&obj) noexcept;
+        auto operator=(received_view &&obj) noexcept -> received_view &;
+
+        [[nodiscard]] auto data() const -> const uint8_t *;
+        [[nodiscard]] auto size() const -> size_t;
+        [[nodiscard]] auto empty() const -> bool;
+
+        /**
+         * @brief hands the bytes back to the communication, the view is empty afterwards.
+         */
+        auto release() -> void;
+
+    private:
+        const uint8_t *m_data = nullptr;
+        size_t m_size_bytes = 0;
+        std::function<void()> m_release = nullptr;
+    };
+
     class EXPORTED device_communication
     {
     public:
@@ -335,6 +711,14 @@ namespace kommpot {
          */
         virtual auto is_open() -> bool = 0;
 
+        /**
+         * @brief states without blocking if the device can still deliver data, tells a read that
+         * timed out on an idle link apart from one that failed.
+         * @return true if device is open and was not closed by the peer.
+         * @attention communications which cannot tell report is_open().
+         */
+        virtual auto is_alive() -> bool;
+
         /**
          * @brief closes opened device, has no effect on not opened devices.
          */
@@ -356,6 +740,46 @@ namespace kommpot {
         virtual auto read(
             const transfer_configuration &configuration, void *data, size_t size_bytes) -> bool = 0;
 
+        /**
+         * @brief reads whatever the device delivers first, at most size_bytes.
+         * @param received_size_bytes states number of bytes written to data.
+         * @return true if any data was read, false on timeout or if any error happened.
+         * @attention communications without partial reads fill the whole buffer like read().
+         */
+        virtual auto read_some(const transfer_configuration &configuration, void *data,
+            size_t size_bytes, size_t &received_size_bytes) -> bool;
+
+        /**
+         * @brief reads whatever the device delivers first like read_some(), at most
+         * max_size_bytes, without copying where the communication supports it.
+         * @param view receives the data, a view it held before is released.
+         * @return true if any data was read, false on timeout or if any error happened.
+         * @attention communications without zero-copy receive read into a buffer owned by the
+         * view, so the data is copied once like with read_some().
+         */
+        virtual auto read_view(const transfer_configuration &configuration,
+            size_t max_size_bytes, received_view &view) -> bool;
+
+        /**
+         * @brief reads up to messages.size() datagrams at once, each keeping its boundaries.
+         * Waits for the first one only and takes the others already received.
+         * @param received_count states number of messages filled from the front.
+         * @return true if any message was read, false on timeout or if any error happened.
+         * @attention stream communications fill the first message like read_some().
+         */
+        virtual auto read_messages(const transfer_configuration &configuration,
+            std::vector<message_buffer> &messages, size_t &received_count) -> bool;
+
+        /**
+         * @brief reads like read_some() and reports when the OS received the data.
+         * @param result states number of bytes written to data and the receive timestamps.
+         * @return true if any data was read, false on timeout or if any error happened.
+         * @attention communications without timestamping read like read_some() and leave the
+         * timestamps empty.
+         */
+        virtual auto read_timestamped(const transfer_configuration &configuration, void *data,
+            size_t size_bytes, transfer_result &result) -> bool;
+
         /**
          * @brief writes data to specified endpoint.
          * @param endpoint_address states address as int.
@@ -366,6 +790,45 @@ namespace kommpot {
         virtual auto write(
             const transfer_configuration &configuration, void *data, size_t size_bytes) -> bool = 0;
 
+        /**
+         * @brief writes every message as a datagram of its own, in as few system calls as the
+         * communication allows.
+         * @return true if all messages were written, false if any error happened.
+         * @attention stream communications write the messages one after another like write().
+         */
+        virtual auto write_messages(const transfer_configuration &configuration,
+            const std::vector<message_buffer> &messages) -> bool;
+
+        /**
+         * @brief writes like write() and waits until the OS reports when it sent the data.
+         * @param result states number of bytes written and the transmit timestamps.
+         * @return true if write was successful, false if any error happened. A timestamp the OS
+         * did not report in time is left empty.
+         * @attention communications without timestamping write like write() and leave the
+         * timestamps empty.
+         */
+        virtual auto write_timestamped(const transfer_configuration &configuration,
+            const void *data, size_t size_bytes, transfer_result &result) -> bool;
+
+        /**
+         * @brief writes large buffers without copying them into OS buffers where the communication
+         * supports it, the data has to stay unchanged until the callback was called.
+         * @param callback called once the OS released the buffer, possibly before returning.
+         * @return true if the data was queued, false if any error happened, the callback is not
+         * called then.
+         * @attention completions are collected by later write_zero_copy() calls, by
+         * flush_zero_copy() and by close(). Communications without zero-copy support write like
+         * write() and call the callback before returning.
+         */
+        virtual auto write_zero_copy(const transfer_configuration &configuration, const void *data,
+            size_t size_bytes, write_completion_callback callback) -> bool;
+
+        /**
+         * @brief waits until the callbacks of all zero-copy writes were called.
+         * @return false if writes are still pending after the timeout.
+         */
+        virtual auto flush_zero_copy(uint32_t timeout_msecs) -> bool;
+
         /**
          * @brief get human-readable error text from native error code.
          * @param native_error_code as uint32_t.
@@ -393,6 +856,621 @@ namespace kommpot {
         device_identification m_identification_variant;
     };
 
+    /**
+     * @brief read-ahead layer over device_communication::read_some() for protocols that parse
+     * small fields: every device read fetches up to the read-ahead size, small reads are served
+     * from the buffer afterwards.
+     * @attention the device_communication has to outlive the reader, bytes still buffered are lost
+     * when the reader is destroyed.
+     */
+    class EXPORTED buffered_reader
+    {
+    public:
+        static constexpr size_t M_DEFAULT_READ_AHEAD_SIZE_BYTES = 64 * 1024;
+
+        buffered_reader(device_communication &communication,
+            transfer_configuration configuration = {},
+            size_t read_ahead_size_bytes = M_DEFAULT_READ_AHEAD_SIZE_BYTES);
+
+        /**
+         * @brief copies the next size_bytes without consuming them.
+         * @return true if enough data arrived, false on timeout or if any error happened.
+         */
+        auto peek(void *data, size_t size_bytes) -> bool;
+
+        /**
+         * @brief reads exactly size_bytes, reads larger than the read-ahead size bypass the buffer.
+         * @return true if enough data arrived, false on timeout or if any error happened.
+         */
+        auto read_exact(void *data, size_t size_bytes) -> bool;
+
+        /**
+         * @brief reads up to and including the delimiter.
+         * @param max_size_bytes states longest accepted line including delimiter, 0 is unlimited.
+         * @return true if the delimiter arrived, false on timeout, on overlong line or if any
+         * error happened, data read so far stays buffered.
+         */
+        auto read_until(const std::string &delimiter, std::string &data, size_t max_size_bytes = 0)
+            -> bool;
+
+        /**
+         * @brief states number of bytes read ahead and not consumed yet.
+         */
+        [[nodiscard]] auto buffered_size() const -> size_t;
+
+        /**
+         * @brief drops buffered bytes, e.g. after the device was reopened.
+         */
+        auto discard() -> void;
+
+        /**
+         * @brief states number of device reads issued so far.
+         */
+        [[nodiscard]] auto device_read_count() const -> uint64_t;
+
+    private:
+        device_communication &m_communication;
+        transfer_configuration m_configuration;
+        size_t m_read_ahead_size_bytes = 0;
+        std::vector<uint8_t> m_buffer;
+        size_t m_begin = 0;
+        size_t m_end = 0;
+        uint64_t m_device_read_count = 0;
+
+        auto fill(size_t size_bytes) -> bool;
+    };
+
+    /**
+     * @brief write-combining layer over device_communication::write(): small writes are collected
+     * and sent as one device write once flush_size_bytes are buffered, the oldest buffered byte
+     * waited flush_deadline_usecs or flush() is called.
+     * @attention a failed background flush drops the buffered bytes and is reported by the next
+     * write() or flush(). The device_communication has to outlive the writer, the destructor
+     * flushes remaining bytes.
+     */
+    class EXPORTED buffered_writer
+    {
+    public:
+        static constexpr size_t M_DEFAULT_FLUSH_SIZE_BYTES = 16 * 1024;
+        static constexpr uint32_t M_DEFAULT_FLUSH_DEADLINE_USECS = 200;
+
+        /**
+         * @param flush_deadline_usecs value 0 disables the deadline, bytes are sent on size
+         * threshold or flush() only.
+         */
+        buffered_writer(device_communication &communication,
+            transfer_configuration configuration = {},
+            size_t flush_size_bytes = M_DEFAULT_FLUSH_SIZE_BYTES,
+            uint32_t flush_deadline_usecs = M_DEFAULT_FLUSH_DEADLINE_USECS);
+        ~buffered_writer();
+
+        /**
+         * @warning states class is non-copyable.
+         */
+        buffered_writer(const buffered_writer &obj) = delete;
+        auto operator=(const buffered_writer &obj) -> buffered_writer & = delete;
+
+        /**
+         * @brief buffers data, writes at least flush_size_bytes bypass the buffer after the bytes
+         * buffered before them were sent.
+         * @return false if a write failed since the last call.
+         */
+        auto write(const void *data, size_t size_bytes) -> bool;
+
+        /**
+         * @brief sends buffered bytes now.
+         * @return false if a write failed since the last call.
+         */
+        auto flush() -> bool;
+
+        [[nodiscard]] auto buffered_size() const -> size_t;
+
+        /**
+         * @brief states number of device writes issued so far.
+         */
+        [[nodiscard]] auto device_write_count() const -> uint64_t;
+
+    private:
+        using clock = std::chrono::steady_clock;
+
+        device_communication &m_communication;
+        transfer_configuration m_configuration;
+        size_t m_flush_size_bytes = 0;
+        std::chrono::microseconds m_flush_deadline = {};
+        std::vector<uint8_t> m_buffer;
+        clock::time_point m_deadline = {};
+        uint64_t m_device_write_count = 0;
+        bool m_is_failed = false;
+        bool m_is_running = false;
+        mutable std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::thread m_flush_thread;
+
+        auto flush_locked() -> void;
+        auto run() -> void;
+    };
+
+    /**
+     * @brief SCPI session over a byte stream, e.g. raw TCP on port 5025: messages are newline
+     * terminated and up to max_pipeline_depth queries stay unanswered, so a batch of queries costs
+     * about one round trip instead of one per query.
+     * @attention the device_communication has to outlive the session.
+     */
+    class EXPORTED scpi_session
+    {
+    public:
+        static constexpr uint16_t M_DEFAULT_PORT = 5025;
+        static constexpr size_t M_DEFAULT_PIPELINE_DEPTH = 32;
+        static constexpr size_t M_MAX_RESPONSE_SIZE_BYTES = 1024 * 1024;
+
+        explicit scpi_session(device_communication &communication,
+            transfer_configuration configuration = {},
+            size_t max_pipeline_depth = M_DEFAULT_PIPELINE_DEPTH);
+
+        /**
+         * @brief queues a command without response, sent with the next flush() or read.
+         */
+        auto command(const std::string &command) -> bool;
+
+        /**
+         * @brief queues a query, its response has to be fetched by read_response() or
+         * read_block() in the order the queries were sent.
+         * @return false if max_pipeline_depth responses are pending already.
+         */
+        auto send_query(const std::string &query) -> bool;
+
+        /**
+         * @brief flushes queued messages and reads the next response without terminator, a
+         * block response is returned as its payload.
+         */
+        auto read_response(std::string &response) -> bool;
+
+        /**
+         * @brief flushes queued messages and reads the next response as IEEE 488.2 block
+         * (#<digits><length><payload> or #0<payload>), the payload is read straight into data.
+         * @param block_size_bytes states payload size.
+         * @return false if the response is no block or does not fit, the stream stays in sync.
+         */
+        auto read_block(void *data, size_t size_bytes, size_t &block_size_bytes) -> bool;
+
+        auto query(const std::string &query, std::string &response) -> bool;
+
+        /**
+         * @brief pipelines the queries through a sliding window of max_pipeline_depth.
+         */
+        auto query(const std::vector<std::string> &queries, std::vector<std::string> &responses)
+            -> bool;
+
+        auto query_block(const std::string &query, void *data, size_t size_bytes,
+            size_t &block_size_bytes) -> bool;
+
+        auto flush() -> bool;
+
+        [[nodiscard]] auto pending_responses() const -> size_t;
+
+    private:
+        buffered_reader m_reader;
+        buffered_writer m_writer;
+        size_t m_max_pipeline_depth = 0;
+        size_t m_pending_responses = 0;
+
+        auto send_line(const std::string &line) -> bool;
+        auto read_block_header(size_t &block_size_bytes, bool &is_indefinite) -> bool;
+        auto read_terminator() -> bool;
+        auto skip(size_t size_bytes) -> bool;
+        auto complete_response() -> void;
+    };
+
+    /**
+     * @brief states Modbus function codes supported by modbus_tcp_client.
+     */
+    enum class modbus_function : uint8_t
+    {
+        READ_HOLDING_REGISTERS = 0x03,
+        READ_INPUT_REGISTERS = 0x04,
+        WRITE_SINGLE_REGISTER = 0x06,
+        WRITE_MULTIPLE_REGISTERS = 0x10
+    };
+
+    /**
+     * @brief converts modbus_function to a readable string value.
+     * @param function code.
+     * @return string.
+     */
+    auto EXPORTED modbus_function_to_string(const modbus_function &function) noexcept
+        -> std::string;
+
+    /**
+     * @brief states one register read of a batch, values and status are filled by
+     * modbus_tcp_client::read().
+     */
+    struct EXPORTED modbus_read_request
+    {
+        modbus_function function = modbus_function::READ_HOLDING_REGISTERS;
+        uint16_t address = 0;
+        uint16_t count = 0;
+        std::vector<uint16_t> values = {};
+
+        /**
+         * @brief states exception code returned by the device, 0 if there was none.
+         */
+        uint8_t exception_code = 0;
+        bool is_succeeded = false;
+    };
+
+    /**
+     * @brief Modbus/TCP client which keeps up to max_pending_requests transactions in flight and
+     * matches the responses by MBAP transaction ID, so a device answering out of order is fine and
+     * a batch of register reads costs about one round trip instead of one per read.
+     * @attention the device_communication has to outlive the client.
+     */
+    class EXPORTED modbus_tcp_client
+    {
+    public:
+        static constexpr uint16_t M_DEFAULT_PORT = 502;
+        static constexpr size_t M_DEFAULT_MAX_PENDING_REQUESTS = 16;
+        static constexpr uint16_t M_MAX_READ_REGISTERS = 125;
+        static constexpr uint16_t M_MAX_WRITE_REGISTERS = 123;
+
+        explicit modbus_tcp_client(device_communication &communication,
+            transfer_configuration configuration = {}, uint8_t unit_id = 1,
+            size_t max_pending_requests = M_DEFAULT_MAX_PENDING_REQUESTS);
+
+        /**
+         * @brief reads of the same function at most merge_gap_registers apart are merged into one
+         * PDU, registers in between are read and dropped. 0 merges adjacent and overlapping reads.
+         */
+        auto set_merge_gap(uint16_t merge_gap_registers) -> void;
+
+        /**
+         * @brief reads all requests, adjacent ones are merged and reads beyond
+         * M_MAX_READ_REGISTERS are split into pipelined PDUs.
+         * @attention a merged PDU rejected with an exception is repeated per request, so one
+         * invalid address does not fail its neighbours.
+         * @return true if every request succeeded.
+         */
+        auto read(std::vector<modbus_read_request> &requests) -> bool;
+
+        auto read_holding_registers(uint16_t address, uint16_t count,
+            std::vector<uint16_t> &values) -> bool;
+        auto read_input_registers(uint16_t address, uint16_t count, std::vector<uint16_t> &values)
+            -> bool;
+        auto write_single_register(uint16_t address, uint16_t value) -> bool;
+        auto write_multiple_registers(uint16_t address, const std::vector<uint16_t> &values)
+            -> bool;
+
+        /**
+         * @brief gets exception code of the last failed transaction, 0 if there was none.
+         */
+        [[nodiscard]] auto last_exception_code() const -> uint8_t;
+
+        /**
+         * @brief gets number of PDUs sent since construction.
+         */
+        [[nodiscard]] auto transaction_count() const -> size_t;
+
+    private:
+        struct transaction
+        {
+            std::vector<uint8_t> request = {};
+            std::vector<uint8_t> response = {};
+        };
+
+        static constexpr size_t M_MBAP_HEADER_SIZE_BYTES = 7;
+
+        buffered_reader m_reader;
+        buffered_writer m_writer;
+        uint8_t m_unit_id = 1;
+        size_t m_max_pending_requests = 0;
+        uint16_t m_merge_gap_registers = 0;
+        uint16_t m_next_transaction_id = 0;
+        uint8_t m_last_exception_code = 0;
+        size_t m_transaction_count = 0;
+
+        auto read_batch(std::vector<modbus_read_request> &requests, const bool &is_merging)
+            -> bool;
+        auto execute(std::vector<transaction> &transactions) -> bool;
+        auto send(const uint16_t &transaction_id, const std::vector<uint8_t> &pdu) -> bool;
+        auto receive(uint16_t &transaction_id, uint8_t &unit_id, std::vector<uint8_t> &pdu)
+            -> bool;
+        auto check_write(const transaction &transaction) -> bool;
+    };
+
+    /**
+     * @brief states how an RPC request was completed.
+     */
+    enum class rpc_status : uint8_t
+    {
+        UNKNOWN = 0,
+        SUCCEEDED = 1,
+        TIMED_OUT = 2,
+        FAILED = 3,
+        CANCELLED = 4
+    };
+
+    /**
+     * @brief converts rpc_status to a readable string value.
+     * @param status of request.
+     * @return string.
+     */
+    auto EXPORTED rpc_status_to_string(const rpc_status &status) noexcept -> std::string;
+
+    /**
+     * @brief frames RPC requests and extracts request ID of replies, implemented per device
+     * protocol and plugged into rpc_multiplexer.
+     */
+    class EXPORTED rpc_codec
+    {
+    public:
+        virtual ~rpc_codec() = default;
+
+        /**
+         * @brief appends frame carrying request_id and payload to frame.
+         */
+        virtual auto encode(const uint32_t &request_id, const std::vector<uint8_t> &payload,
+            std::vector<uint8_t> &frame) const -> void = 0;
+
+        /**
+         * @brief decodes first frame at data.
+         * @return number of consumed bytes, 0 if the frame is incomplete, std::nullopt if data is
+         * malformed.
+         */
+        virtual auto decode(const uint8_t *data, size_t size_bytes, uint32_t &request_id,
+            std::vector<uint8_t> &payload) const -> std::optional<size_t> = 0;
+
+        /**
+         * @brief states largest request ID the frame can carry, IDs wrap around after it.
+         */
+        [[nodiscard]] virtual auto max_request_id() const -> uint32_t
+        {
+            return UINT32_MAX;
+        }
+    };
+
+    /**
+     * @brief frames as 32-bit big-endian length of the rest, 32-bit big-endian request ID and
+     * payload.
+     */
+    class EXPORTED length_prefixed_rpc_codec : public rpc_codec
+    {
+    public:
+        static constexpr size_t M_HEADER_SIZE_BYTES = 8;
+        static constexpr size_t M_MAX_FRAME_SIZE_BYTES = 16 * 1024 * 1024;
+
+        auto encode(const uint32_t &request_id, const std::vector<uint8_t> &payload,
+            std::vector<uint8_t> &frame) const -> void override;
+        auto decode(const uint8_t *data, size_t size_bytes, uint32_t &request_id,
+            std::vector<uint8_t> &payload) const -> std::optional<size_t> override;
+    };
+
+    using rpc_callback = std::function<void(rpc_status, std::vector<uint8_t>)>;
+
+    /**
+     * @brief pipelined request/response layer: up to max_in_flight requests are outstanding and a
+     * single receive thread hands every reply to the callback of its request ID, so throughput is
+     * bound by bandwidth instead of round trips.
+     * @attention callbacks run on the receive or deadline thread and must not block on submit()
+     * of a full window. A read timeout of the communication only waits again, deadlines are
+     * independent of it. The device_communication has to outlive the multiplexer.
+     */
+    class EXPORTED rpc_multiplexer
+    {
+    public:
+        static constexpr size_t M_DEFAULT_MAX_IN_FLIGHT = 64;
+        static constexpr uint32_t M_DEFAULT_TIMEOUT_MSEC = 1000;
+
+        rpc_multiplexer(device_communication &communication, std::shared_ptr<const rpc_codec> codec,
+            size_t max_in_flight = M_DEFAULT_MAX_IN_FLIGHT,
+            transfer_configuration configuration = {});
+        ~rpc_multiplexer();
+
+        rpc_multiplexer(const rpc_multiplexer &obj) = delete;
+        auto operator=(const rpc_multiplexer &obj) -> rpc_multiplexer & = delete;
+
+        /**
+         * @brief sends request and returns right away, callback is called exactly once with the
+         * reply, on deadline or on failure of the link.
+         * @attention blocks while max_in_flight requests are outstanding. Frames of requests
+         * submitted close together are coalesced into one write.
+         * @return false if request could not be sent, callback is not called then.
+         */
+        auto submit(const std::vector<uint8_t> &request, rpc_callback callback,
+            uint32_t timeout_msecs = M_DEFAULT_TIMEOUT_MSEC) -> bool;
+
+        /**
+         * @brief sends request right away and waits for its completion.
+         */
+        auto call(const std::vector<uint8_t> &request, std::vector<uint8_t> &response,
+            uint32_t timeout_msecs = M_DEFAULT_TIMEOUT_MSEC) -> rpc_status;
+
+        /**
+         * @brief sends requests coalesced so far without waiting for the flush deadline.
+         */
+        auto flush() -> bool;
+
+        [[nodiscard]] auto in_flight() const -> size_t;
+
+    private:
+        using clock = std::chrono::steady_clock;
+
+        struct pending_request
+        {
+            rpc_callback callback = nullptr;
+            clock::time_point deadline = {};
+        };
+
+        static constexpr size_t M_RECEIVE_SIZE_BYTES = 64 * 1024;
+
+        device_communication &m_communication;
+        transfer_configuration m_configuration;
+        std::shared_ptr<const rpc_codec> m_codec = nullptr;
+        buffered_writer m_writer;
+        size_t m_max_in_flight = 0;
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::unordered_map<uint32_t, pending_request> m_pending;
+        uint32_t m_next_request_id = 0;
+        bool m_is_running = false;
+        std::thread m_receive_thread;
+        std::thread m_deadline_thread;
+
+        auto receive() -> void;
+        auto expire() -> void;
+        auto complete(const uint32_t &request_id, std::vector<uint8_t> &&response) -> void;
+        auto fail_all(const rpc_status &status) -> void;
+    };
+
+    /**
+     * @brief computes CRC-16/CCITT-FALSE (polynomial 0x1021, initial value 0xFFFF).
+     * @param value result of the previous call to continue over several buffers.
+     */
+    auto EXPORTED crc16(const void *data, size_t size_bytes, uint16_t value = 0xFFFF) noexcept
+        -> uint16_t;
+
+    /**
+     * @brief computes CRC-32C (Castagnoli), on the crc32 instruction of the CPU where available.
+     * @param value result of the previous call to continue over several buffers.
+     */
+    auto EXPORTED crc32c(const void *data, size_t size_bytes, uint32_t value = 0) noexcept
+        -> uint32_t;
+
+    /**
+     * @brief states types of framing over a byte stream.
+     */
+    enum class framing_type : uint8_t
+    {
+        UNKNOWN = 0,
+        LENGTH_PREFIXED = 1,
+        COBS = 2,
+        SLIP = 3
+    };
+
+    /**
+     * @brief converts framing_type to a readable string value.
+     * @param type of framing.
+     * @return string.
+     */
+    auto EXPORTED framing_type_to_string(const framing_type &type) noexcept -> std::string;
+
+    /**
+     * @brief states integrity checks appended to a frame.
+     */
+    enum class frame_check_type : uint8_t
+    {
+        NONE = 0,
+        CRC16 = 1,
+        CRC32C = 2
+    };
+
+    /**
+     * @brief converts frame_check_type to a readable string value.
+     * @param type of check.
+     * @return string.
+     */
+    auto EXPORTED frame_check_type_to_string(const frame_check_type &type) noexcept
+        -> std::string;
+
+    using pooled_buffer = std::shared_ptr<std::vector<uint8_t>>;
+
+    /**
+     * @brief recycles byte buffers, a released buffer keeps its capacity and goes back to the pool
+     * as long as the pool exists.
+     */
+    class EXPORTED buffer_pool : public std::enable_shared_from_this<buffer_pool>
+    {
+    public:
+        static constexpr size_t M_DEFAULT_MAX_IDLE_BUFFERS = 32;
+
+        [[nodiscard]] static auto create(size_t max_idle_buffers = M_DEFAULT_MAX_IDLE_BUFFERS)
+            -> std::shared_ptr<buffer_pool>;
+
+        /**
+         * @brief gets a buffer resized to size_bytes, its content is unspecified.
+         */
+        [[nodiscard]] auto acquire(size_t size_bytes) -> pooled_buffer;
+
+        [[nodiscard]] auto idle_count() const -> size_t;
+
+        /**
+         * @brief gets number of buffers allocated since creation.
+         */
+        [[nodiscard]] auto allocation_count() const -> uint64_t;
+
+    private:
+        mutable std::mutex m_mutex;
+        std::vector<std::unique_ptr<std::vector<uint8_t>>> m_idle_buffers;
+        size_t m_max_idle_buffers = 0;
+        uint64_t m_allocation_count = 0;
+
+        explicit buffer_pool(size_t max_idle_buffers);
+
+        auto release(std::vector<uint8_t> *buffer) -> void;
+    };
+
+    /**
+     * @brief message framing over a device_communication. LENGTH_PREFIXED precedes a frame with
+     * its 32-bit big-endian size, COBS ends a frame with 0x00 and SLIP encloses it in 0xC0. The
+     * check is appended big-endian to the payload before encoding. Frames are decoded straight
+     * into pooled buffers.
+     * @attention SLIP skips empty frames, so SLIP without check cannot carry an empty payload.
+     */
+    class EXPORTED frame_channel
+    {
+    public:
+        static constexpr size_t M_DEFAULT_MAX_FRAME_SIZE_BYTES = 64 * 1024;
+
+        frame_channel(device_communication &communication, framing_type type,
+            frame_check_type check = frame_check_type::NONE,
+            size_t max_frame_size_bytes = M_DEFAULT_MAX_FRAME_SIZE_BYTES,
+            std::shared_ptr<buffer_pool> pool = nullptr, transfer_configuration configuration = {});
+
+        auto write_frame(const void *data, size_t size_bytes) -> bool;
+
+        /**
+         * @brief reads next frame without check.
+         * @return false on failed read or check, a frame failing its check is dropped and the
+         * stream stays in sync.
+         */
+        auto read_frame(pooled_buffer &frame) -> bool;
+
+        [[nodiscard]] auto pool() const -> std::shared_ptr<buffer_pool>;
+
+        /**
+         * @brief gets number of frames dropped due to failed check, malformed encoding or size.
+         */
+        [[nodiscard]] auto dropped_frame_count() const -> uint64_t;
+
+    private:
+        static constexpr size_t M_LENGTH_SIZE_BYTES = 4;
+        static constexpr size_t M_RECEIVE_SIZE_BYTES = 64 * 1024;
+
+        device_communication &m_communication;
+        transfer_configuration m_configuration;
+        framing_type m_type = framing_type::UNKNOWN;
+        frame_check_type m_check = frame_check_type::NONE;
+        size_t m_max_frame_size_bytes = 0;
+        std::shared_ptr<buffer_pool> m_pool = nullptr;
+
+        std::vector<uint8_t> m_receive_buffer;
+        size_t m_receive_begin = 0;
+        size_t m_receive_end = 0;
+        size_t m_scanned_size_bytes = 0;
+        bool m_is_discarding = false;
+        pooled_buffer m_partial_frame = nullptr;
+        size_t m_partial_size_bytes = 0;
+        std::vector<uint8_t> m_transmit_buffer;
+        uint64_t m_dropped_frame_count = 0;
+
+        auto check_size() const -> size_t;
+        auto append_check(const uint8_t *data, size_t size_bytes, std::vector<uint8_t> &output)
+            const -> void;
+        auto verify_check(std::vector<uint8_t> &frame) -> bool;
+        auto read_length_prefixed(pooled_buffer &frame) -> bool;
+        auto read_delimited(pooled_buffer &frame) -> bool;
+        auto fill() -> bool;
+    };
+
     /**
      * Provides list of devices according to specified identifications.
      * Returns all devices if device_id is not specified.
@@ -1,8 +1,19 @@
 #include "communication_ethernet.h"
 
 #include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_connection_pool.h>
+#include <communications/ethernet/ethernet_connector.h>
 #include <communications/ethernet/ethernet_context.h>
+#include <communications/ethernet/ethernet_discovery.h>
+#include <communications/ethernet/ethernet_discovery_protocol.h>
+#include <communications/ethernet/ethernet_hostname_resolver.h>
+#include <communications/ethernet/ethernet_neighbor_cache.h>
+#include <communications/ethernet/ethernet_neighbor_discovery.h>
+#include <communications/ethernet/ethernet_probe_pacer.h>
+#include <communications/ethernet/ethernet_response_matcher.h>
+#include <communications/ethernet/ethernet_rtt_estimator.h>
 #include <communications/ethernet/ethernet_tools.h>
+#include <communications/ethernet/ethernet_uring.h>
 #include <kommpot_core.h>
 #include <libkommpot.h>
 #include <third-party/spdlog/include/spdlog/spdlog.h>
@@ -10,10 +21,13 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <thread>
+#include <unordered_set>
 #include <vector>
 
 #ifdef _WIN32
@@ -37,10 +51,12 @@
 #else
 #    include <arpa/inet.h>
 #    include <ifaddrs.h>
+#    include <net/if.h>
 #    include <sys/socket.h>
 #    include <unistd.h>
 
 #    ifdef __linux__
+#        include <fstream>
 #        include <netpacket/packet.h>
 #    endif
 
@@ -92,45 +108,64 @@ auto communication_ethernet::devices(
             continue;
         }
 
+        /**
+         * @attention a multicast group or raw Ethernet has no host to search for, its device is
+         * always listed.
+         */
+        if (!identification->multicast_group.empty() ||
+            identification->protocol == kommpot::ethernet_protocol_type::RAW)
+        {
+            devices.push_back(std::make_shared<communication_ethernet>(*identification));
+            continue;
+        }
+
         for (const auto &interface : interfaces)
         {
             if (identification->ip == "*")
             {
-                auto hosts = scan_network_for_hosts(interface.ipv4, *identification);
+                std::vector<std::shared_ptr<kommpot::device_communication>> hosts;
+                switch (identification->discovery)
+                {
+                case kommpot::ethernet_discovery_type::UDP_BROADCAST: {
+                    hosts = discover_network_hosts(interface.ipv4, *identification);
+                    break;
+                }
+                case kommpot::ethernet_discovery_type::IPV6_NEIGHBOR_DISCOVERY: {
+                    hosts = discover_ipv6_neighbors(interface, *identification);
+                    break;
+                }
+                default:
+                    hosts = scan_network_for_hosts(interface.ipv4, *identification);
+                    break;
+                }
                 devices.insert(std::end(devices), std::make_move_iterator(std::begin(hosts)),
                     std::make_move_iterator(std::end(hosts)));
             }
             else
             {
-                auto ip_address_opt = ethernet_address_factory::from_string(identification->ip);
+                auto ip_address_opt = to_ip_address(*identification);
                 if (!ip_address_opt)
                 {
-                    SPDLOG_LOGGER_ERROR(
-                        KOMMPOT_LOGGER, "Invalid IP address format: {}", identification->ip);
                     continue;
                 }
                 auto ip_address = *ip_address_opt;
 
-                kommpot::ethernet_device_identification host_id;
-                if (!is_host_reachable(ip_address, identification->port, host_id))
-                {
-                    continue;
-                }
-
-                auto host = std::make_shared<communication_ethernet>(host_id);
-                if (host == nullptr)
+                const auto ports = search_ports(*identification);
+                if (ports.empty())
                 {
                     SPDLOG_LOGGER_ERROR(
-                        KOMMPOT_LOGGER, "std::make_shared() failed creating the device!");
+                        KOMMPOT_LOGGER, "No port to probe on host {}", identification->ip);
                     continue;
                 }
 
-                if (!is_host_suitable(*identification, host_id))
-                {
-                    continue;
-                }
+                ethernet_probe_pacer pacer(0);
+                auto probes = probe_ports(ip_address, ports, M_TRANSFER_TIMEOUT_MSEC, pacer,
+                    concurrent_probe_limit(*identification),
+                    identification->scan.is_io_uring_enabled);
 
-                devices.push_back(host);
+                auto hosts = create_devices(*identification, probes);
+                devices.insert(std::end(devices), std::make_move_iterator(std::begin(hosts)),
+                    std::make_move_iterator(std::end(hosts)));
             }
         }
     }
@@ -140,19 +175,75 @@ auto communication_ethernet::devices(
 
 auto communication_ethernet::open() -> bool
 {
-    auto ip_address_opt = ethernet_address_factory::from_string(m_identification.ip);
-    if (!ip_address_opt)
+    if (!m_identification.multicast_group.empty())
     {
-        return false;
+        return open_multicast();
     }
-    auto ip_address = *ip_address_opt;
 
-    if (ip_address == nullptr)
+    if (m_identification.protocol == kommpot::ethernet_protocol_type::RAW)
+    {
+        return open_raw();
+    }
+
+    /**
+     * @attention a connection left over from the search skips the handshake and address lookups.
+     */
+    auto connection = ethernet_connection_pool::instance().take(
+        m_identification.ip, m_identification.port, m_identification.protocol);
+    if (connection != nullptr)
+    {
+        m_socket = std::move(*connection);
+        apply_socket_profile();
+        apply_io_uring();
+        apply_zero_copy();
+        apply_zero_copy_receive();
+        apply_udp_offload();
+        apply_timestamping();
+        return true;
+    }
+
+    auto candidates = ethernet_connector::resolve(m_identification.ip);
+    if (candidates.empty())
     {
         return false;
     }
 
-    if (!m_socket.initialize(ip_address, m_identification.port, m_identification.protocol))
+    if (m_identification.scope_id != 0)
+    {
+        for (auto &candidate : candidates)
+        {
+            auto scoped_opt =
+                ethernet_address_factory::with_scope_id(candidate, m_identification.scope_id);
+            if (scoped_opt)
+            {
+                candidate = *scoped_opt;
+            }
+        }
+    }
+
+    /**
+     * @attention a dual-stack host is raced over both families, TCP Fast Open is skipped then as
+     * its SYN carries the first write, which must not reach the peer on a losing connection.
+     */
+    if (candidates.size() > 1 && m_identification.protocol == kommpot::ethernet_protocol_type::TCP)
+    {
+        if (!ethernet_connector::connect(candidates, m_identification.port,
+                M_TRANSFER_TIMEOUT_MSEC, m_configuration.connection_attempt_delay_msecs, m_socket,
+                m_configuration.socket_profile))
+        {
+            return false;
+        }
+
+        apply_io_uring();
+        apply_zero_copy();
+        apply_zero_copy_receive();
+        apply_udp_offload();
+        apply_timestamping();
+        return true;
+    }
+
+    if (!m_socket.initialize(
+            candidates.front(), m_identification.port, m_identification.protocol))
     {
         return false;
     }
@@ -162,16 +253,200 @@ auto communication_ethernet::open() -> bool
         return false;
     }
 
-    return m_socket.connect();
+    apply_socket_profile();
+    apply_io_uring();
+    apply_zero_copy();
+
+    if (m_configuration.is_tcp_fast_open_enabled &&
+        m_identification.protocol == kommpot::ethernet_protocol_type::TCP &&
+        !m_socket.set_fast_open(true))
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {}: continuing without TCP Fast Open.",
+            m_socket.to_string());
+    }
+
+    if (!m_socket.connect())
+    {
+        return false;
+    }
+
+    apply_zero_copy_receive();
+    apply_udp_offload();
+    apply_timestamping();
+
+    return true;
+}
+
+auto communication_ethernet::apply_socket_profile() -> void
+{
+    if (!m_socket.set_profile(m_configuration.socket_profile))
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {}: continuing with partial profile {}.",
+            m_socket.to_string(),
+            kommpot::ethernet_socket_profile_to_string(m_configuration.socket_profile));
+    }
+}
+
+auto communication_ethernet::apply_io_uring() -> void
+{
+    /**
+     * @attention an adopted probe connection of an io_uring sweep keeps the setting otherwise.
+     */
+    if (!m_socket.set_io_uring(m_configuration.is_io_uring_enabled))
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {}: continuing without io_uring.",
+            m_socket.to_string());
+    }
+}
+
+auto communication_ethernet::apply_zero_copy() -> void
+{
+    m_socket.set_zero_copy_threshold(m_configuration.zero_copy_threshold_bytes);
+
+    if (m_identification.protocol == kommpot::ethernet_protocol_type::TCP &&
+        !m_socket.set_zero_copy(true))
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {}: zero-copy writes fall back to copying.",
+            m_socket.to_string());
+    }
+}
+
+auto communication_ethernet::apply_zero_copy_receive() -> void
+{
+    /**
+     * @attention the receive region is mapped on the connected socket, so this runs after connect.
+     */
+    if (!m_configuration.is_zero_copy_receive_enabled ||
+        m_identification.protocol != kommpot::ethernet_protocol_type::TCP)
+    {
+        return;
+    }
+
+    if (!m_socket.set_zero_copy_receive(true))
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {}: zero-copy reads fall back to copying.",
+            m_socket.to_string());
+    }
+}
+
+auto communication_ethernet::apply_udp_offload() -> void
+{
+    if (!m_configuration.is_udp_offload_enabled ||
+        m_identification.protocol != kommpot::ethernet_protocol_type::UDP)
+    {
+        return;
+    }
+
+    if (!m_socket.set_udp_segmentation(true) || !m_socket.set_udp_gro(true))
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {}: continuing with partial UDP offload.",
+            m_socket.to_string());
+    }
+}
+
+auto communication_ethernet::apply_timestamping() -> void
+{
+    /**
+     * @attention the NIC of the connection is only known once connected, so this runs last.
+     */
+    if (!m_configuration.is_timestamping_enabled)
+    {
+        return;
+    }
+
+    if (!m_socket.set_timestamping(true, m_configuration.is_hardware_timestamping_enabled))
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {}: continuing without timestamps.",
+            m_socket.to_string());
+    }
+}
+
+auto communication_ethernet::open_multicast() -> bool
+{
+    if (m_subscription != nullptr)
+    {
+        return true;
+    }
+
+    if (m_identification.protocol != kommpot::ethernet_protocol_type::UDP &&
+        m_identification.protocol != kommpot::ethernet_protocol_type::UNKNOWN)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Multicast group {} can only be received over UDP.",
+            m_identification.multicast_group);
+        return false;
+    }
+
+    auto group_opt = ethernet_address_factory::from_string(m_identification.multicast_group);
+    if (!group_opt)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Multicast group {} is no IP address.",
+            m_identification.multicast_group);
+        return false;
+    }
+
+    std::shared_ptr<ethernet_ip_address> source = nullptr;
+    if (!m_identification.multicast_source.empty())
+    {
+        auto source_opt = ethernet_address_factory::from_string(m_identification.multicast_source);
+        if (!source_opt)
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Multicast source {} is no IP address.",
+                m_identification.multicast_source);
+            return false;
+        }
+        source = *source_opt;
+    }
+
+    m_subscription = ethernet_multicast_hub::instance().subscribe(*group_opt,
+        m_identification.port, source, m_identification.multicast_interface,
+        m_configuration.multicast_queue_datagrams);
+
+    return m_subscription != nullptr;
+}
+
+auto communication_ethernet::open_raw() -> bool
+{
+    if (m_packet_ring != nullptr)
+    {
+        return true;
+    }
+
+    /**
+     * @attention an empty mac or one with wildcards matches every sender, frames to it are
+     * broadcast.
+     */
+    std::optional<ethernet_mac_address> peer = std::nullopt;
+    if (!m_identification.mac.empty() &&
+        m_identification.mac.find_first_of("*?") == std::string::npos)
+    {
+        peer = ethernet_address_factory::mac_from_string(m_identification.mac);
+        if (!peer)
+        {
+            return false;
+        }
+    }
+
+    m_packet_ring = ethernet_packet_ring::create(
+        m_identification.raw_interface, m_identification.ether_type, peer);
+
+    return m_packet_ring != nullptr;
 }
 
 auto communication_ethernet::is_open() -> bool
 {
-    return m_socket.is_connected();
+    return m_subscription != nullptr || m_packet_ring != nullptr || m_socket.is_connected();
+}
+
+auto communication_ethernet::is_alive() -> bool
+{
+    return m_subscription != nullptr || m_packet_ring != nullptr || m_socket.is_alive();
 }
 
 auto communication_ethernet::close() -> void
 {
+    m_subscription = nullptr;
+    m_packet_ring = nullptr;
+
     if (m_socket.is_connected())
     {
         if (!m_socket.disconnect() && KOMMPOT_LOGGER != nullptr)
@@ -199,15 +474,206 @@ auto communication_ethernet::endpoints() -> std::vector<kommpot::endpoint_inform
 auto communication_ethernet::read(
     const kommpot::transfer_configuration &configuration, void *data, size_t size_bytes) -> bool
 {
+    if (m_subscription != nullptr)
+    {
+        kommpot::pooled_buffer datagram = nullptr;
+        if (!m_subscription->pop(datagram, M_TRANSFER_TIMEOUT_MSEC) ||
+            datagram->size() != size_bytes)
+        {
+            return false;
+        }
+
+        std::memcpy(data, datagram->data(), size_bytes);
+        return true;
+    }
+
+    if (m_packet_ring != nullptr)
+    {
+        /**
+         * @attention a frame padded to the minimum Ethernet size is accepted for shorter reads.
+         */
+        std::vector<kommpot::message_buffer> messages = {{data, size_bytes}};
+        size_t received_count = 0;
+        return m_packet_ring->read_messages(messages, received_count, M_TRANSFER_TIMEOUT_MSEC) &&
+               messages.front().received_size_bytes == size_bytes &&
+               (!messages.front().is_truncated ||
+                   size_bytes < ethernet_packet_ring::M_MIN_PAYLOAD_SIZE_BYTES);
+    }
+
     return m_socket.read(data, size_bytes);
 }
 
+auto communication_ethernet::read_some(const kommpot::transfer_configuration &configuration,
+    void *data, size_t size_bytes, size_t &received_size_bytes) -> bool
+{
+    received_size_bytes = 0;
+
+    if (m_subscription != nullptr)
+    {
+        kommpot::pooled_buffer datagram = nullptr;
+        if (!m_subscription->pop(datagram, M_TRANSFER_TIMEOUT_MSEC))
+        {
+            return false;
+        }
+
+        received_size_bytes = std::min(size_bytes, datagram->size());
+        std::memcpy(data, datagram->data(), received_size_bytes);
+        return true;
+    }
+
+    if (m_packet_ring != nullptr)
+    {
+        std::vector<kommpot::message_buffer> messages = {{data, size_bytes}};
+        size_t received_count = 0;
+        if (!m_packet_ring->read_messages(messages, received_count, M_TRANSFER_TIMEOUT_MSEC))
+        {
+            return false;
+        }
+
+        received_size_bytes = messages.front().received_size_bytes;
+        return true;
+    }
+
+    return m_socket.read_some(data, size_bytes, received_size_bytes, M_TRANSFER_TIMEOUT_MSEC);
+}
+
+auto communication_ethernet::read_view(const kommpot::transfer_configuration &configuration,
+    size_t max_size_bytes, kommpot::received_view &view) -> bool
+{
+    if (m_subscription != nullptr)
+    {
+        view.release();
+
+        /**
+         * @attention the view shares the datagram buffer with the other devices of the group.
+         */
+        kommpot::pooled_buffer datagram = nullptr;
+        if (!m_subscription->pop(datagram, M_TRANSFER_TIMEOUT_MSEC))
+        {
+            return false;
+        }
+
+        const auto *data = datagram->data();
+        view = kommpot::received_view(
+            data, std::min(max_size_bytes, datagram->size()), [datagram]() {});
+        return true;
+    }
+
+    if (m_packet_ring != nullptr)
+    {
+        return kommpot::device_communication::read_view(configuration, max_size_bytes, view);
+    }
+
+    return m_socket.read_view(max_size_bytes, view, M_TRANSFER_TIMEOUT_MSEC);
+}
+
+auto communication_ethernet::read_messages(const kommpot::transfer_configuration &configuration,
+    std::vector<kommpot::message_buffer> &messages, size_t &received_count) -> bool
+{
+    if (m_subscription != nullptr)
+    {
+        received_count = 0;
+
+        kommpot::pooled_buffer datagram = nullptr;
+        bool is_received = m_subscription->pop(datagram, M_TRANSFER_TIMEOUT_MSEC);
+        while (is_received && received_count < messages.size())
+        {
+            auto &message = messages[received_count++];
+            message.received_size_bytes = std::min(message.size_bytes, datagram->size());
+            message.is_truncated = datagram->size() > message.size_bytes;
+            std::memcpy(message.data, datagram->data(), message.received_size_bytes);
+
+            is_received = received_count < messages.size() && m_subscription->try_pop(datagram);
+        }
+
+        return received_count > 0;
+    }
+
+    if (m_packet_ring != nullptr)
+    {
+        return m_packet_ring->read_messages(messages, received_count, M_TRANSFER_TIMEOUT_MSEC);
+    }
+
+    return m_socket.read_messages(messages, received_count, M_TRANSFER_TIMEOUT_MSEC);
+}
+
+auto communication_ethernet::read_timestamped(const kommpot::transfer_configuration &configuration,
+    void *data, size_t size_bytes, kommpot::transfer_result &result) -> bool
+{
+    if (m_subscription != nullptr || m_packet_ring != nullptr)
+    {
+        return kommpot::device_communication::read_timestamped(
+            configuration, data, size_bytes, result);
+    }
+
+    result = kommpot::transfer_result();
+
+    return m_socket.read_timestamped(
+        data, size_bytes, result.size_bytes, result.timestamps, M_TRANSFER_TIMEOUT_MSEC);
+}
+
 auto communication_ethernet::write(
     const kommpot::transfer_configuration &configuration, void *data, size_t size_bytes) -> bool
 {
+    if (m_packet_ring != nullptr)
+    {
+        return m_packet_ring->write_messages({{data, size_bytes}}, M_TRANSFER_TIMEOUT_MSEC);
+    }
+
     return m_socket.write(data, size_bytes);
 }
 
+auto communication_ethernet::write_messages(const kommpot::transfer_configuration &configuration,
+    const std::vector<kommpot::message_buffer> &messages) -> bool
+{
+    if (m_packet_ring != nullptr)
+    {
+        return m_packet_ring->write_messages(messages, M_TRANSFER_TIMEOUT_MSEC);
+    }
+
+    return m_socket.write_messages(messages);
+}
+
+auto communication_ethernet::write_timestamped(
+    const kommpot::transfer_configuration &configuration, const void *data, size_t size_bytes,
+    kommpot::transfer_result &result) -> bool
+{
+    if (m_packet_ring != nullptr)
+    {
+        return kommpot::device_communication::write_timestamped(
+            configuration, data, size_bytes, result);
+    }
+
+    result = kommpot::transfer_result();
+
+    if (!m_socket.write_timestamped(data, size_bytes, result.timestamps, M_TRANSFER_TIMEOUT_MSEC))
+    {
+        return false;
+    }
+
+    result.size_bytes = size_bytes;
+
+    return true;
+}
+
+auto communication_ethernet::write_zero_copy(
+    const kommpot::transfer_configuration &configuration, const void *data, size_t size_bytes,
+    kommpot::write_completion_callback callback) -> bool
+{
+    if (m_packet_ring != nullptr)
+    {
+        return kommpot::device_communication::write_zero_copy(
+            configuration, data, size_bytes, std::move(callback));
+    }
+
+    return m_socket.write_zero_copy(data, size_bytes, std::move(callback));
+}
+
+auto communication_ethernet::flush_zero_copy(uint32_t timeout_msecs) -> bool
+{
+    return m_socket.flush_zero_copy(timeout_msecs);
+}
+
 auto communication_ethernet::get_error_string(const uint32_t &native_error_code) const
     -> std::string
 {
@@ -216,6 +682,11 @@ auto communication_ethernet::get_error_string(const uint32_t &native_error_code)
 
 auto communication_ethernet::native_handle() const -> void *
 {
+    if (m_packet_ring != nullptr)
+    {
+        return m_packet_ring->native_handle();
+    }
+
     if (!m_socket.is_connected())
     {
         return nullptr;
@@ -224,6 +695,38 @@ auto communication_ethernet::native_handle() const -> void *
     return m_socket.native_handle();
 }
 
+auto communication_ethernet::search_ports(
+    const kommpot::ethernet_device_identification &identification) -> std::vector<uint16_t>
+{
+    std::vector<uint16_t> ports;
+    std::unordered_set<uint16_t> known_ports;
+
+    auto add_port = [&ports, &known_ports](const uint16_t port) {
+        if (port != 0 && known_ports.insert(port).second)
+        {
+            ports.push_back(port);
+        }
+    };
+
+    add_port(identification.port);
+
+    for (const auto port : identification.ports)
+    {
+        add_port(port);
+    }
+
+    if (identification.port_range.first != 0)
+    {
+        for (uint32_t port = identification.port_range.first;
+            port <= identification.port_range.last; ++port)
+        {
+            add_port(static_cast<uint16_t>(port));
+        }
+    }
+
+    return ports;
+}
+
 auto communication_ethernet::get_all_interfaces()
     -> const std::vector<ethernet_interface_information>
 {
@@ -299,6 +802,7 @@ auto communication_ethernet::get_all_interfaces()
         auto interface = ethernet_interface_information();
 
         interface.adapter_name = adapter->AdapterName;
+        interface.interface_index = adapter->Ipv6IfIndex;
         interface.interface_name = adapter->FriendlyName;
         interface.description = adapter->Description;
         interface.dns_suffix = adapter->DnsSuffix;
@@ -735,84 +1239,463 @@ auto communication_ethernet::get_all_interfaces()
 
     for (auto it = interfaces.begin(); it != interfaces.end();)
     {
-        if (it->mac_address.empty() || (it->ipv4.address == nullptr && it->ipv6.address == nullptr))
+        if (it->mac_address.empty() || (it->ipv4.address == nullptr && it->ipv6.address == nullptr))
+        {
+            SPDLOG_LOGGER_TRACE(
+                KOMMPOT_LOGGER, "Removing incomplete interface: {}.", it->adapter_name);
+            it = interfaces.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+#    ifdef __linux__
+    /**
+     * @brief getifaddrs() does not report gateways, they are taken from the default routes.
+     */
+    for (const bool is_ipv6 : {false, true})
+    {
+        std::ifstream table(is_ipv6 ? "/proc/net/ipv6_route" : "/proc/net/route");
+        for (const auto &[name, gateway] : ethernet_tools::parse_default_gateways(table, is_ipv6))
+        {
+            auto gateway_opt = ethernet_address_factory::from_string(gateway);
+            auto it = std::find_if(interfaces.begin(), interfaces.end(),
+                [&name](const auto &interface) { return interface.adapter_name == name; });
+            if (!gateway_opt || it == interfaces.end())
+            {
+                continue;
+            }
+
+            (is_ipv6 ? it->ipv6 : it->ipv4).gateway = *gateway_opt;
+        }
+    }
+#    endif
+
+#endif
+
+    return interfaces;
+}
+
+auto communication_ethernet::find_or_create_interface(
+    std::vector<ethernet_interface_information> &interfaces, const std::string &interface_name)
+    -> ethernet_interface_information &
+{
+    for (auto &interface : interfaces)
+    {
+        if (interface.adapter_name == interface_name)
+        {
+            return interface;
+        }
+    }
+
+    auto &interface = interfaces.emplace_back();
+    interface.adapter_name = interface_name;
+#ifndef _WIN32
+    interface.interface_index = if_nametoindex(interface_name.c_str());
+#endif
+
+    return interfaces.back();
+}
+
+auto communication_ethernet::to_ip_address(
+    const kommpot::ethernet_device_identification &identification)
+    -> std::optional<std::shared_ptr<ethernet_ip_address>>
+{
+    auto ip_address_opt = ethernet_address_factory::from_string(identification.ip);
+    if (!ip_address_opt)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Invalid IP address format: {}", identification.ip);
+        return std::nullopt;
+    }
+
+    if (identification.scope_id == 0)
+    {
+        return ip_address_opt;
+    }
+
+    return ethernet_address_factory::with_scope_id(*ip_address_opt, identification.scope_id);
+}
+
+auto communication_ethernet::is_host_reachable(
+    const std::shared_ptr<ethernet_ip_address> ip_address, const uint16_t port,
+    const uint32_t connect_timeout_msecs, kommpot::ethernet_device_identification &information,
+    std::unique_ptr<ethernet_socket> &connection, std::optional<uint64_t> &rtt_usecs) -> bool
+{
+    auto socket = create_probe_socket(ip_address, port, connect_timeout_msecs);
+    if (socket == nullptr)
+    {
+        return false;
+    }
+
+    const bool is_connected = socket->connect();
+
+    return complete_probe(ip_address, port, std::move(socket), is_connected, information,
+        connection, rtt_usecs);
+}
+
+auto communication_ethernet::create_probe_socket(
+    const std::shared_ptr<ethernet_ip_address> ip_address, const uint16_t port,
+    const uint32_t connect_timeout_msecs) -> std::unique_ptr<ethernet_socket>
+{
+    /**
+     * @todo shall we also check the UDP here?
+     */
+    auto socket = std::make_unique<ethernet_socket>();
+
+    if (!socket->initialize(ip_address, port, kommpot::ethernet_protocol_type::TCP))
+    {
+        return nullptr;
+    }
+
+    if (!socket->set_timeout(M_TRANSFER_TIMEOUT_MSEC))
+    {
+        return nullptr;
+    }
+
+    socket->set_connect_timeout(connect_timeout_msecs);
+
+    return socket;
+}
+
+auto communication_ethernet::complete_probe(const std::shared_ptr<ethernet_ip_address> ip_address,
+    const uint16_t port, std::unique_ptr<ethernet_socket> socket, const bool is_connected,
+    kommpot::ethernet_device_identification &information,
+    std::unique_ptr<ethernet_socket> &connection, std::optional<uint64_t> &rtt_usecs) -> bool
+{
+    const auto protocol = kommpot::ethernet_protocol_type::TCP;
+
+    rtt_usecs = socket->connect_rtt_usecs();
+
+    if (!is_connected)
+    {
+        SPDLOG_LOGGER_TRACE(KOMMPOT_LOGGER, "Host '{}' is not reachable via '{}'.",
+            ip_address->to_string(), kommpot::ethernet_protocol_type_to_string(protocol));
+        return false;
+    }
+
+    SPDLOG_LOGGER_TRACE(KOMMPOT_LOGGER, "Host '{}' is reachable via '{}'.", socket->to_string(),
+        kommpot::ethernet_protocol_type_to_string(protocol));
+
+    information.ip = ip_address->to_string();
+    information.mac = socket->mac_address().to_string();
+
+    if (const auto *ipv6 = dynamic_cast<ethernet_ipv6_address *>(ip_address.get()))
+    {
+        information.scope_id = ipv6->scope_id();
+    }
+    information.port = port;
+    information.protocol = protocol;
+
+    /**
+     * @attention the caller decides whether the connection is parked or closed on destruction.
+     */
+    connection = std::move(socket);
+
+    return true;
+}
+
+auto communication_ethernet::concurrent_probe_limit(
+    const kommpot::ethernet_device_identification &identification) -> uint32_t
+{
+    /**
+     * @brief every probe in flight holds an ephemeral port, half of the range is left to the rest
+     * of the system.
+     */
+    return std::min<uint32_t>(
+        (identification.scan.max_concurrent_probes != 0) ? identification.scan.max_concurrent_probes
+                                                         : M_MAX_CONCURRENT_SEARCH_THREADS,
+        std::max<uint32_t>(1, ethernet_tools::get_ephemeral_port_count() / 2));
+}
+
+auto communication_ethernet::probe_ports(const std::shared_ptr<ethernet_ip_address> ip_address,
+    const std::vector<uint16_t> &ports, const uint32_t connect_timeout_msecs,
+    ethernet_probe_pacer &pacer, const uint32_t max_concurrent_ports,
+    const bool is_io_uring_enabled) -> std::vector<ethernet_port_probe>
+{
+    std::vector<ethernet_port_probe> probes(ports.size());
+    if (ports.empty())
+    {
+        return probes;
+    }
+
+    if (is_io_uring_enabled && ethernet_uring::is_supported())
+    {
+        return probe_ports_batched(
+            ip_address, ports, connect_timeout_msecs, pacer, max_concurrent_ports);
+    }
+
+    std::atomic<size_t> next_port_index = 0;
+
+    auto probe_next_ports = [&]() {
+        while (true)
+        {
+            const size_t port_index = next_port_index.fetch_add(1, std::memory_order_relaxed);
+            if (port_index >= ports.size())
+            {
+                break;
+            }
+
+            auto &probe = probes[port_index];
+
+            pacer.wait();
+            probe.is_reachable = is_host_reachable(ip_address, ports[port_index],
+                connect_timeout_msecs, probe.host_id, probe.connection, probe.rtt_usecs);
+        }
+    };
+
+    /**
+     * @brief up to max_concurrent_ports workers keep pulling the next port, the calling thread
+     * being one of them, so a host costs one connect timeout as long as its ports fit.
+     */
+    const size_t worker_count = std::clamp<size_t>(max_concurrent_ports, 1, ports.size());
+
+    std::vector<std::thread> port_threads;
+    port_threads.reserve(worker_count - 1);
+    for (size_t worker_index = 1; worker_index < worker_count; ++worker_index)
+    {
+        port_threads.emplace_back(probe_next_ports);
+    }
+
+    probe_next_ports();
+
+    for (auto &port_thread : port_threads)
+    {
+        port_thread.join();
+    }
+
+    return probes;
+}
+
+auto communication_ethernet::probe_ports_batched(
+    const std::shared_ptr<ethernet_ip_address> ip_address, const std::vector<uint16_t> &ports,
+    const uint32_t connect_timeout_msecs, ethernet_probe_pacer &pacer,
+    const uint32_t max_concurrent_ports) -> std::vector<ethernet_port_probe>
+{
+    std::vector<ethernet_port_probe> probes(ports.size());
+    std::vector<std::unique_ptr<ethernet_socket>> sockets(ports.size());
+    std::vector<ethernet_socket *> pending_sockets;
+    std::vector<size_t> pending_indices;
+
+    /**
+     * @brief the handshakes of up to max_concurrent_ports ports share one submission, so a host
+     * costs one connect timeout and a single system call as long as its ports fit.
+     */
+    const size_t batch_size = std::clamp<size_t>(max_concurrent_ports, 1, ports.size());
+
+    for (size_t batch_begin = 0; batch_begin < ports.size(); batch_begin += batch_size)
+    {
+        const size_t batch_end = std::min(ports.size(), batch_begin + batch_size);
+        pending_sockets.clear();
+        pending_indices.clear();
+
+        for (size_t port_index = batch_begin; port_index < batch_end; ++port_index)
+        {
+            pacer.wait();
+
+            auto socket =
+                create_probe_socket(ip_address, ports[port_index], connect_timeout_msecs);
+            if (socket == nullptr || !socket->set_io_uring(true))
+            {
+                continue;
+            }
+
+            pending_sockets.push_back(socket.get());
+            pending_indices.push_back(port_index);
+            sockets[port_index] = std::move(socket);
+        }
+
+        const auto results = ethernet_socket::connect_all(pending_sockets);
+
+        for (size_t pending_index = 0; pending_index < pending_indices.size(); ++pending_index)
+        {
+            const auto port_index = pending_indices[pending_index];
+            auto &probe = probes[port_index];
+
+            probe.is_reachable = complete_probe(ip_address, ports[port_index],
+                std::move(sockets[port_index]), results[pending_index], probe.host_id,
+                probe.connection, probe.rtt_usecs);
+        }
+    }
+
+    return probes;
+}
+
+auto communication_ethernet::create_devices(
+    const kommpot::ethernet_device_identification &search_id,
+    std::vector<ethernet_port_probe> &probes)
+    -> std::vector<std::shared_ptr<kommpot::device_communication>>
+{
+    std::vector<std::shared_ptr<kommpot::device_communication>> devices;
+    std::optional<std::string> hostname_opt = std::nullopt;
+
+    for (auto &probe : probes)
+    {
+        if (!probe.is_reachable)
+        {
+            continue;
+        }
+
+        /**
+         * @attention all probes belong to the same host, its name is looked up only once.
+         */
+        if (!hostname_opt)
+        {
+            read_out_hostname(search_id, probe.host_id);
+            hostname_opt = probe.host_id.name;
+        }
+        else
+        {
+            probe.host_id.name = *hostname_opt;
+        }
+
+        if (!is_host_suitable(search_id, probe.host_id))
+        {
+            continue;
+        }
+
+        if (!is_probe_answered(search_id, probe.host_id, *probe.connection))
+        {
+            continue;
+        }
+
+        auto device = std::make_shared<communication_ethernet>(probe.host_id);
+        if (!device)
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "std::make_shared() failed creating the device!");
+            continue;
+        }
+
+        park_connection(search_id, probe.host_id, std::move(probe.connection));
+
+        devices.push_back(device);
+    }
+
+    return devices;
+}
+
+auto communication_ethernet::is_probe_answered(
+    const kommpot::ethernet_device_identification &search_id,
+    const kommpot::ethernet_device_identification &host_id, const ethernet_socket &connection)
+    -> bool
+{
+    const auto &configuration = search_id.probe;
+    if (configuration.payload.empty())
+    {
+        return true;
+    }
+
+    ethernet_response_matcher matcher(configuration);
+    if (!matcher.is_valid())
+    {
+        return false;
+    }
+
+    std::string request = configuration.payload;
+    if (!connection.write(request.data(), request.size()))
+    {
+        return false;
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::milliseconds(configuration.response_timeout_msecs);
+
+    std::string response;
+    std::vector<char> buffer(std::max<uint32_t>(1, configuration.max_response_size_bytes));
+
+    /**
+     * @brief the response is checked after every chunk, so a matching host is accepted as soon
+     * as it answered and does not wait for the deadline.
+     */
+    while (response.size() < buffer.size())
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
         {
-            SPDLOG_LOGGER_TRACE(
-                KOMMPOT_LOGGER, "Removing incomplete interface: {}.", it->adapter_name);
-            it = interfaces.erase(it);
+            break;
         }
-        else
+
+        const auto remaining_msecs = static_cast<uint32_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count());
+
+        size_t received_size_bytes = 0;
+        if (!connection.read_some(buffer.data(), buffer.size() - response.size(),
+                received_size_bytes, remaining_msecs))
         {
-            ++it;
+            break;
         }
-    }
 
-#endif
+        response.append(buffer.data(), received_size_bytes);
 
-    return interfaces;
-}
+        if (matcher.is_match(response))
+        {
+            return true;
+        }
 
-auto communication_ethernet::find_or_create_interface(
-    std::vector<ethernet_interface_information> &interfaces, const std::string &interface_name)
-    -> ethernet_interface_information &
-{
-    for (auto &interface : interfaces)
-    {
-        if (interface.adapter_name == interface_name)
+        if (matcher.is_rejected(response))
         {
-            return interface;
+            break;
         }
     }
 
-    auto &interface = interfaces.emplace_back();
-    interface.adapter_name = interface_name;
+    SPDLOG_LOGGER_TRACE(KOMMPOT_LOGGER, "Host '{}:{}' did not answer probe as expected ({} bytes).",
+        host_id.ip, host_id.port, response.size());
 
-    return interfaces.back();
+    return false;
 }
 
-auto communication_ethernet::is_host_reachable(
-    const std::shared_ptr<ethernet_ip_address> ip_address, const uint16_t port,
-    kommpot::ethernet_device_identification &information) -> bool
+auto communication_ethernet::park_connection(
+    const kommpot::ethernet_device_identification &search_id,
+    const kommpot::ethernet_device_identification &host_id,
+    std::unique_ptr<ethernet_socket> connection) -> void
 {
     /**
-     * @todo shall we also check the UDP here?
+     * @attention the rest of a probe response may still be on its way after it matched, open()
+     * would hand it to the first read. A probed connection is closed instead.
      */
-    const auto protocol = kommpot::ethernet_protocol_type::TCP;
-
-    auto socket = ethernet_socket();
-
-    if (!socket.initialize(ip_address, port, protocol))
+    if (!search_id.scan.is_connection_reuse_enabled || !search_id.probe.payload.empty() ||
+        connection == nullptr)
     {
-        return false;
+        return;
     }
 
-    if (!socket.set_timeout(M_TRANSFER_TIMEOUT_MSEC))
+    /**
+     * @attention a parked connection is handed over to open(), it has to close gracefully again.
+     */
+    if (search_id.scan.is_abortive_close_enabled && !connection->set_abortive_close(false))
     {
-        return false;
+        return;
     }
 
-    if (!socket.connect())
-    {
-        SPDLOG_LOGGER_TRACE(KOMMPOT_LOGGER, "Host '{}' is not reachable via '{}'.",
-            ip_address->to_string(), kommpot::ethernet_protocol_type_to_string(protocol));
-        return false;
-    }
+    ethernet_connection_pool::instance().insert(
+        host_id.ip, host_id.port, host_id.protocol, std::move(connection));
+}
 
-    SPDLOG_LOGGER_TRACE(KOMMPOT_LOGGER, "Host '{}' is reachable via '{}'.", socket.to_string(),
-        kommpot::ethernet_protocol_type_to_string(protocol));
+auto communication_ethernet::read_out_hostname(
+    const kommpot::ethernet_device_identification &search_id,
+    kommpot::ethernet_device_identification &host_id) -> void
+{
+    auto &resolver = ethernet_hostname_resolver::instance();
 
-    information.name = socket.hostname();
-    information.ip = ip_address->to_string();
-    information.mac = socket.mac_address().to_string();
-    information.port = port;
-    information.protocol = protocol;
+    /**
+     * @attention reverse DNS is only awaited when the search filters by name, otherwise a name
+     * resolved by an earlier search is reused and the host is reported without waiting.
+     */
+    if (search_id.name == "*")
+    {
+        host_id.name = resolver.cached(host_id.ip).value_or("");
+        return;
+    }
 
-    if (!socket.disconnect())
+    auto hostname_opt = resolver.resolve(host_id.ip, M_HOSTNAME_TIMEOUT_MSEC);
+    if (!hostname_opt)
     {
-        return false;
+        SPDLOG_LOGGER_DEBUG(
+            KOMMPOT_LOGGER, "Host '{}': reverse DNS lookup failed or timed out.", host_id.ip);
     }
 
-    return true;
+    host_id.name = hostname_opt.value_or("");
 }
 
 auto communication_ethernet::is_host_suitable(
@@ -866,6 +1749,13 @@ auto communication_ethernet::scan_network_for_hosts(const ethernet_network_infor
     std::mutex mutex;
     std::vector<std::shared_ptr<kommpot::device_communication>> hosts;
 
+    const auto ports = search_ports(identification);
+    if (ports.empty())
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "scan_network_for_hosts(): no port to probe.");
+        return {};
+    }
+
     spdlog::stopwatch stopwatch;
     std::atomic<uint64_t> scanned_hosts = 0;
 
@@ -874,62 +1764,453 @@ auto communication_ethernet::scan_network_for_hosts(const ethernet_network_infor
      */
     const uint64_t first_index = 1;
     const uint64_t last_index = (network.max_hosts > 1) ? (network.max_hosts - 1) : first_index;
-    std::atomic<uint64_t> next_index = first_index;
 
     /**
-     * @brief a fixed pool of workers keeps pulling the next address to scan, so a fast host never
-     * waits for a slow one to time out before the next address is picked up.
+     * @brief neighbors already resolved by the OS are probed first, the ones with a MAC that does
+     * not match the search are dropped without connecting.
      */
-    const uint64_t total_hosts = last_index - first_index;
-    const uint32_t worker_count =
-        static_cast<uint32_t>(std::min<uint64_t>(M_MAX_CONCURRENT_SEARCH_THREADS, total_hosts));
-
-    auto worker = [&]() {
-        while (true)
+    std::vector<uint64_t> neighbor_indices;
+    std::unordered_set<uint64_t> known_indices;
+    if (identification.scan.is_neighbor_table_enabled)
+    {
+        const auto neighbors = ethernet_neighbor_cache::instance().snapshot();
+        for (const auto &neighbor : neighbors->entries())
         {
-            const uint64_t host_index = next_index.fetch_add(1, std::memory_order_relaxed);
-            if (host_index >= last_index)
+            auto host_index_opt = ethernet_address_factory::calculate_host_index(
+                network.base_address, neighbor.ip_address);
+            if (!host_index_opt || *host_index_opt < first_index || *host_index_opt >= last_index)
             {
-                break;
+                continue;
             }
 
-            auto new_address_opt =
-                ethernet_address_factory::calculate_new_address(network.base_address, host_index);
-            if (!new_address_opt)
+            if (!known_indices.insert(*host_index_opt).second)
             {
                 continue;
             }
 
-            auto new_address = *new_address_opt;
-            scanned_hosts.fetch_add(1, std::memory_order_relaxed);
-
-            kommpot::ethernet_device_identification host_id;
-            if (!is_host_reachable(new_address, identification.port, host_id))
+            if (!is_wildcard_match(identification.mac, neighbor.mac_address.to_string()))
             {
+                SPDLOG_LOGGER_TRACE(KOMMPOT_LOGGER,
+                    "Neighbor {}/'{}' does not match search MAC '{}'!",
+                    neighbor.ip_address->to_string(), neighbor.mac_address.to_string(),
+                    identification.mac);
                 continue;
             }
 
-            if (!is_host_suitable(identification, host_id))
+            neighbor_indices.push_back(*host_index_opt);
+        }
+
+        std::sort(std::begin(neighbor_indices), std::end(neighbor_indices));
+
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "scan_network_for_hosts(): {} neighbor(s) on network, {} left after MAC filter.",
+            known_indices.size(), neighbor_indices.size());
+    }
+
+    const bool is_neighbor_only = identification.scan.is_neighbor_table_enabled &&
+                                  identification.scan.is_neighbor_table_only;
+
+    /**
+     * @brief the gateway answers fast and seeds the RTT estimate, therefore it is probed first.
+     */
+    if (network.gateway != nullptr)
+    {
+        auto gateway_index_opt =
+            ethernet_address_factory::calculate_host_index(network.base_address, network.gateway);
+        if (gateway_index_opt && *gateway_index_opt >= first_index &&
+            *gateway_index_opt < last_index)
+        {
+            const auto gateway_index = *gateway_index_opt;
+
+            auto it = std::find(
+                std::begin(neighbor_indices), std::end(neighbor_indices), gateway_index);
+            if (it != std::end(neighbor_indices))
             {
-                continue;
+                std::rotate(std::begin(neighbor_indices), it, it + 1);
+            }
+            else if (!is_neighbor_only && known_indices.insert(gateway_index).second)
+            {
+                neighbor_indices.insert(std::begin(neighbor_indices), gateway_index);
+            }
+        }
+    }
+
+    const bool is_adaptive_timeout_enabled = identification.scan.is_adaptive_timeout_enabled;
+    ethernet_rtt_estimator rtt_estimator(M_TRANSFER_TIMEOUT_MSEC);
+    std::vector<uint64_t> unanswered_indices;
+
+    ethernet_probe_pacer pacer(identification.scan.max_probes_per_second);
+
+    /**
+     * @brief a worker probes the ports of its host in parallel, the probes of all workers
+     * together stay within the limit.
+     */
+    const uint32_t max_concurrent_probes = concurrent_probe_limit(identification);
+    const uint32_t max_concurrent_ports =
+        std::min<uint32_t>(max_concurrent_probes, static_cast<uint32_t>(ports.size()));
+    const uint32_t max_concurrent_hosts = max_concurrent_probes / max_concurrent_ports;
+
+    std::atomic<uint64_t> progress_total_hosts = 0;
+    std::atomic<uint64_t> found_devices = 0;
+    std::atomic<uint64_t> last_progress_msecs = 0;
+
+    auto report_progress = [&](const bool is_final) {
+        const auto &callback = identification.scan.progress_callback;
+        if (!callback)
+        {
+            return;
+        }
+
+        const auto elapsed_msecs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(stopwatch.elapsed()).count());
+
+        /**
+         * @attention only the worker that wins the exchange reports, the others carry on probing.
+         * Another worker may have stored a later time meanwhile, which must not be moved back.
+         */
+        uint64_t last_msecs = last_progress_msecs.load();
+        const bool is_due =
+            elapsed_msecs > last_msecs && elapsed_msecs - last_msecs >= M_PROGRESS_INTERVAL_MSEC;
+        if (!is_final &&
+            (!is_due || !last_progress_msecs.compare_exchange_strong(last_msecs, elapsed_msecs)))
+        {
+            return;
+        }
+
+        kommpot::ethernet_scan_progress progress;
+        progress.scanned_hosts = scanned_hosts.load();
+        progress.total_hosts = progress_total_hosts.load();
+        progress.found_devices = found_devices.load();
+        progress.elapsed_msecs = elapsed_msecs;
+
+        if (progress.scanned_hosts > 0 && progress.total_hosts > progress.scanned_hosts)
+        {
+            progress.remaining_msecs = elapsed_msecs *
+                                       (progress.total_hosts - progress.scanned_hosts) /
+                                       progress.scanned_hosts;
+        }
+
+        callback(progress);
+    };
+
+    auto probe_host = [&](const uint64_t host_index, const uint32_t connect_timeout_msecs) {
+        auto new_address_opt =
+            ethernet_address_factory::calculate_new_address(network.base_address, host_index);
+        if (!new_address_opt)
+        {
+            return;
+        }
+
+        auto new_address = *new_address_opt;
+        scanned_hosts.fetch_add(1, std::memory_order_relaxed);
+
+        auto probes = probe_ports(new_address, ports, connect_timeout_msecs, pacer,
+            max_concurrent_ports, identification.scan.is_io_uring_enabled);
+
+        bool is_answered = false;
+        for (auto &probe : probes)
+        {
+            /**
+             * @attention set before the probe may be dropped, closing it then resets the
+             * connection.
+             */
+            if (probe.is_reachable && identification.scan.is_abortive_close_enabled)
+            {
+                static_cast<void>(probe.connection->set_abortive_close(true));
             }
 
-            auto host = std::make_shared<communication_ethernet>(host_id);
-            if (!host)
+            if (probe.rtt_usecs)
             {
-                SPDLOG_LOGGER_ERROR(
-                    KOMMPOT_LOGGER, "std::make_shared() failed creating the device!");
-                continue;
+                rtt_estimator.add_sample(*probe.rtt_usecs);
+                is_answered = true;
+            }
+        }
+
+        if (!is_answered && connect_timeout_msecs < M_TRANSFER_TIMEOUT_MSEC)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            unanswered_indices.push_back(host_index);
+        }
+
+        auto host_devices = create_devices(identification, probes);
+        if (host_devices.empty())
+        {
+            return;
+        }
+
+        found_devices.fetch_add(host_devices.size(), std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        hosts.insert(std::end(hosts), std::make_move_iterator(std::begin(host_devices)),
+            std::make_move_iterator(std::end(host_devices)));
+    };
+
+    /**
+     * @brief a fixed pool of workers keeps pulling the next position to scan, so a fast host never
+     * waits for a slow one to time out before the next address is picked up.
+     */
+    auto run_workers = [&](const uint64_t position_count, const uint64_t host_count,
+                           const auto &host_index_at, const bool is_retry) {
+        std::atomic<uint64_t> next_position = 0;
+
+        auto worker = [&]() {
+            while (true)
+            {
+                const uint64_t position = next_position.fetch_add(1, std::memory_order_relaxed);
+                if (position >= position_count)
+                {
+                    break;
+                }
+
+                const std::optional<uint64_t> host_index_opt = host_index_at(position);
+                if (!host_index_opt)
+                {
+                    continue;
+                }
+
+                const uint32_t connect_timeout_msecs =
+                    (is_retry || !is_adaptive_timeout_enabled)
+                        ? M_TRANSFER_TIMEOUT_MSEC
+                        : rtt_estimator.timeout_msecs(
+                              identification.scan.adaptive_timeout_multiplier,
+                              identification.scan.min_connect_timeout_msecs);
+
+                probe_host(*host_index_opt, connect_timeout_msecs);
+                report_progress(false);
+            }
+        };
+
+        progress_total_hosts.fetch_add(host_count);
+
+        const uint32_t worker_count =
+            static_cast<uint32_t>(std::min<uint64_t>(max_concurrent_hosts, host_count));
+
+        std::vector<std::thread> workers;
+        workers.reserve(worker_count);
+        for (uint32_t worker_index = 0; worker_index < worker_count; ++worker_index)
+        {
+            workers.emplace_back(worker);
+        }
+
+        for (auto &worker_thread : workers)
+        {
+            worker_thread.join();
+        }
+    };
+
+    /**
+     * @brief positions [0, neighbor count) map to the neighbors, the following ones to the rest of
+     * the range in ascending order, so one counter drives both passes.
+     */
+    const uint64_t neighbor_count = neighbor_indices.size();
+    const uint64_t last_position =
+        is_neighbor_only ? neighbor_count : neighbor_count + (last_index - first_index);
+    const uint64_t total_hosts =
+        is_neighbor_only ? neighbor_count
+                         : (last_index - first_index) - known_indices.size() + neighbor_count;
+
+    run_workers(
+        last_position, total_hosts,
+        [&](const uint64_t position) -> std::optional<uint64_t> {
+            if (position < neighbor_count)
+            {
+                return neighbor_indices[position];
+            }
+
+            const uint64_t host_index = first_index + (position - neighbor_count);
+            if (known_indices.count(host_index) != 0)
+            {
+                return std::nullopt;
+            }
+
+            return host_index;
+        },
+        false);
+
+    /**
+     * @brief hosts that were given less than the full timeout get a second chance.
+     */
+    const uint64_t retried_hosts =
+        identification.scan.is_retry_pass_enabled ? unanswered_indices.size() : 0;
+    if (retried_hosts > 0)
+    {
+        const auto retry_indices = std::move(unanswered_indices);
+
+        run_workers(
+            retry_indices.size(), retry_indices.size(),
+            [&](const uint64_t position) -> std::optional<uint64_t> {
+                return retry_indices[position];
+            },
+            true);
+    }
+
+    report_progress(true);
+
+    SPDLOG_LOGGER_INFO(KOMMPOT_LOGGER,
+        "scan_network_for_hosts(): scanned {} host(s) on {} port(s), retried {}, found {} "
+        "device(s) in {:.3} seconds, {} RTT sample(s).",
+        scanned_hosts.load(), ports.size(), retried_hosts, hosts.size(), stopwatch,
+        rtt_estimator.sample_count());
+
+    return hosts;
+}
+
+auto communication_ethernet::discover_network_hosts(const ethernet_network_information &network,
+    const kommpot::ethernet_device_identification &identification)
+    -> const std::vector<std::shared_ptr<kommpot::device_communication>>
+{
+    std::vector<std::shared_ptr<kommpot::device_communication>> hosts;
+
+    /**
+     * @attention IPv6-only interfaces and tunnels have no IPv4 broadcast address, they are not
+     * searched by broadcast.
+     */
+    if (network.address == nullptr || network.mask == nullptr)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "discover_network_hosts(): interface has no IPv4 network, skipped.");
+        return {};
+    }
+
+    spdlog::stopwatch stopwatch;
+
+    auto broadcast_address_opt =
+        ethernet_address_factory::calculate_broadcast_address(network.address, network.mask);
+    if (!broadcast_address_opt)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "discover_network_hosts(): failed to calculate broadcast address.");
+        return {};
+    }
+
+    const uint16_t discovery_port = (identification.discovery_port != 0)
+                                        ? identification.discovery_port
+                                        : ethernet_discovery_protocol::DEFAULT_PORT;
+
+    const auto replies =
+        ethernet_discovery::query(*broadcast_address_opt, discovery_port, M_DISCOVERY_TIMEOUT_MSEC);
+
+    const auto ports = search_ports(identification);
+
+    for (const auto &host_id : replies)
+    {
+        /**
+         * @attention ports requested by the search narrow down the advertised services.
+         */
+        if (!ports.empty() &&
+            std::find(std::begin(ports), std::end(ports), host_id.port) == std::end(ports))
+        {
+            continue;
+        }
+
+        if (identification.protocol != kommpot::ethernet_protocol_type::UNKNOWN &&
+            identification.protocol != host_id.protocol)
+        {
+            continue;
+        }
+
+        if (!is_host_suitable(identification, host_id))
+        {
+            continue;
+        }
+
+        auto host = std::make_shared<communication_ethernet>(host_id);
+        if (!host)
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "std::make_shared() failed creating the device!");
+            continue;
+        }
+
+        hosts.push_back(host);
+    }
+
+    SPDLOG_LOGGER_INFO(KOMMPOT_LOGGER,
+        "discover_network_hosts(): {} responder(s) replied, found {} device(s) in {:.3} seconds.",
+        replies.size(), hosts.size(), stopwatch);
+
+    return hosts;
+}
+
+auto communication_ethernet::discover_ipv6_neighbors(
+    const ethernet_interface_information &interface,
+    const kommpot::ethernet_device_identification &identification)
+    -> const std::vector<std::shared_ptr<kommpot::device_communication>>
+{
+    std::mutex mutex;
+    std::vector<std::shared_ptr<kommpot::device_communication>> hosts;
+
+    if (interface.interface_index == 0)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "discover_ipv6_neighbors(): interface {} has no index, skipping.",
+            interface.adapter_name);
+        return {};
+    }
+
+    const auto ports = search_ports(identification);
+    if (ports.empty())
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "discover_ipv6_neighbors(): no port to probe.");
+        return {};
+    }
+
+    spdlog::stopwatch stopwatch;
+
+    const auto neighbors =
+        ethernet_neighbor_discovery::enumerate(interface.interface_index, M_DISCOVERY_TIMEOUT_MSEC);
+
+    /**
+     * @attention echo responders missing in the ND cache have no MAC yet, the connect resolves it.
+     */
+    std::vector<std::shared_ptr<ethernet_ip_address>> candidates;
+    for (const auto &neighbor : neighbors)
+    {
+        if (!neighbor.mac_address.empty() &&
+            !is_wildcard_match(identification.mac, neighbor.mac_address.to_string()))
+        {
+            continue;
+        }
+
+        candidates.push_back(neighbor.ip_address);
+    }
+
+    ethernet_probe_pacer pacer(identification.scan.max_probes_per_second);
+    std::atomic<size_t> next_candidate = 0;
+
+    const uint32_t max_concurrent_probes = concurrent_probe_limit(identification);
+    const uint32_t max_concurrent_ports =
+        std::min<uint32_t>(max_concurrent_probes, static_cast<uint32_t>(ports.size()));
+
+    auto worker = [&]() {
+        while (true)
+        {
+            const size_t candidate = next_candidate.fetch_add(1, std::memory_order_relaxed);
+            if (candidate >= candidates.size())
+            {
+                break;
+            }
+
+            auto probes = probe_ports(candidates[candidate], ports, M_TRANSFER_TIMEOUT_MSEC,
+                pacer, max_concurrent_ports, identification.scan.is_io_uring_enabled);
+            for (auto &probe : probes)
+            {
+                probe.host_id.discovery = kommpot::ethernet_discovery_type::IPV6_NEIGHBOR_DISCOVERY;
             }
 
+            auto host_devices = create_devices(identification, probes);
+
             std::lock_guard<std::mutex> lock(mutex);
-            hosts.push_back(host);
+            hosts.insert(std::end(hosts), std::make_move_iterator(std::begin(host_devices)),
+                std::make_move_iterator(std::end(host_devices)));
         }
     };
 
+    const size_t worker_count =
+        std::min<size_t>(max_concurrent_probes / max_concurrent_ports, candidates.size());
+
     std::vector<std::thread> workers;
     workers.reserve(worker_count);
-    for (uint32_t worker_index = 0; worker_index < worker_count; ++worker_index)
+    for (size_t worker_index = 0; worker_index < worker_count; ++worker_index)
     {
         workers.emplace_back(worker);
     }
@@ -940,8 +2221,9 @@ auto communication_ethernet::scan_network_for_hosts(const ethernet_network_infor
     }
 
     SPDLOG_LOGGER_INFO(KOMMPOT_LOGGER,
-        "scan_network_for_hosts(): scanned {} host(s), found {} device(s) in {:.3} seconds.",
-        scanned_hosts.load(), hosts.size(), stopwatch);
+        "discover_ipv6_neighbors(): {} neighbor(s) on interface {}, probed {}, found {} "
+        "device(s) in {:.3} seconds.",
+        neighbors.size(), interface.adapter_name, candidates.size(), hosts.size(), stopwatch);
 
     return hosts;
 }
@@ -3,12 +3,16 @@
 
 #pragma once
 
+#include <communications/ethernet/ethernet_multicast_hub.h>
+#include <communications/ethernet/ethernet_packet_ring.h>
+#include <communications/ethernet/ethernet_probe_pacer.h>
 #include <communications/ethernet/ethernet_socket.h>
 #include <libkommpot.h>
 
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -29,12 +33,28 @@ struct ethernet_interface_information
     std::wstring description = L"";
     std::wstring dns_suffix = L"";
 
+    /**
+     * @brief OS interface index, scope of the link-local IPv6 addresses on this interface.
+     */
+    uint32_t interface_index = 0;
+
     ethernet_mac_address mac_address;
 
     ethernet_network_information ipv4;
     ethernet_network_information ipv6;
 };
 
+/**
+ * @brief outcome of probing one port of a host.
+ */
+struct ethernet_port_probe
+{
+    kommpot::ethernet_device_identification host_id;
+    std::unique_ptr<ethernet_socket> connection = nullptr;
+    std::optional<uint64_t> rtt_usecs = std::nullopt;
+    bool is_reachable = false;
+};
+
 class communication_ethernet : public kommpot::device_communication
 {
 public:
@@ -46,25 +66,74 @@ public:
 
     auto open() -> bool override;
     auto is_open() -> bool override;
+    auto is_alive() -> bool override;
     auto close() -> void override;
 
     auto endpoints() -> std::vector<kommpot::endpoint_information> override;
 
     auto read(const kommpot::transfer_configuration &configuration, void *data, size_t size_bytes)
         -> bool override;
+    auto read_some(const kommpot::transfer_configuration &configuration, void *data,
+        size_t size_bytes, size_t &received_size_bytes) -> bool override;
+    auto read_view(const kommpot::transfer_configuration &configuration, size_t max_size_bytes,
+        kommpot::received_view &view) -> bool override;
+    auto read_messages(const kommpot::transfer_configuration &configuration,
+        std::vector<kommpot::message_buffer> &messages, size_t &received_count) -> bool override;
+    auto read_timestamped(const kommpot::transfer_configuration &configuration, void *data,
+        size_t size_bytes, kommpot::transfer_result &result) -> bool override;
     auto write(const kommpot::transfer_configuration &configuration, void *data, size_t size_bytes)
         -> bool override;
+    auto write_messages(const kommpot::transfer_configuration &configuration,
+        const std::vector<kommpot::message_buffer> &messages) -> bool override;
+    auto write_timestamped(const kommpot::transfer_configuration &configuration, const void *data,
+        size_t size_bytes, kommpot::transfer_result &result) -> bool override;
+    auto write_zero_copy(const kommpot::transfer_configuration &configuration, const void *data,
+        size_t size_bytes, kommpot::write_completion_callback callback) -> bool override;
+    auto flush_zero_copy(uint32_t timeout_msecs) -> bool override;
 
     [[nodiscard]] auto get_error_string(const uint32_t &native_error_code) const
         -> std::string override;
 
     [[nodiscard]] auto native_handle() const -> void * override;
 
+    /**
+     * @brief collects ports a search probes on every host: port, ports and port_range in this
+     * order, without duplicates and port 0.
+     */
+    [[nodiscard]] static auto search_ports(
+        const kommpot::ethernet_device_identification &identification) -> std::vector<uint16_t>;
+
 private:
     kommpot::ethernet_device_identification m_identification;
     ethernet_socket m_socket;
+
+    /**
+     * @brief queue of the shared group socket while the device is a multicast receiver.
+     */
+    std::shared_ptr<ethernet_multicast_subscription> m_subscription = nullptr;
+
+    /**
+     * @brief AF_PACKET rings while the device exchanges raw Ethernet frames.
+     */
+    std::shared_ptr<ethernet_packet_ring> m_packet_ring = nullptr;
+
     static constexpr uint32_t M_MAX_CONCURRENT_SEARCH_THREADS = 256;
     static constexpr uint32_t M_TRANSFER_TIMEOUT_MSEC = 2000;
+    static constexpr uint32_t M_DISCOVERY_TIMEOUT_MSEC = 1000;
+    static constexpr uint32_t M_HOSTNAME_TIMEOUT_MSEC = 2000;
+    static constexpr uint32_t M_PROGRESS_INTERVAL_MSEC = 500;
+
+    /**
+     * @brief tuning is best effort, a socket missing some options of the profile stays usable.
+     */
+    auto apply_socket_profile() -> void;
+    auto apply_io_uring() -> void;
+    auto apply_zero_copy() -> void;
+    auto apply_zero_copy_receive() -> void;
+    auto apply_udp_offload() -> void;
+    auto apply_timestamping() -> void;
+    auto open_multicast() -> bool;
+    auto open_raw() -> bool;
 
     [[nodiscard]] static auto get_all_interfaces()
         -> const std::vector<ethernet_interface_information>;
@@ -72,13 +141,53 @@ private:
     static auto find_or_create_interface(std::vector<ethernet_interface_information> &interfaces,
         const std::string &interface_name) -> ethernet_interface_information &;
 
+    [[nodiscard]] static auto to_ip_address(
+        const kommpot::ethernet_device_identification &identification)
+        -> std::optional<std::shared_ptr<ethernet_ip_address>>;
+
     static auto is_host_reachable(const std::shared_ptr<ethernet_ip_address> ip_address,
-        const uint16_t port, kommpot::ethernet_device_identification &information) -> bool;
+        const uint16_t port, const uint32_t connect_timeout_msecs,
+        kommpot::ethernet_device_identification &information,
+        std::unique_ptr<ethernet_socket> &connection, std::optional<uint64_t> &rtt_usecs) -> bool;
+    static auto create_probe_socket(const std::shared_ptr<ethernet_ip_address> ip_address,
+        const uint16_t port, const uint32_t connect_timeout_msecs)
+        -> std::unique_ptr<ethernet_socket>;
+    static auto complete_probe(const std::shared_ptr<ethernet_ip_address> ip_address,
+        const uint16_t port, std::unique_ptr<ethernet_socket> socket, const bool is_connected,
+        kommpot::ethernet_device_identification &information,
+        std::unique_ptr<ethernet_socket> &connection, std::optional<uint64_t> &rtt_usecs) -> bool;
+    [[nodiscard]] static auto concurrent_probe_limit(
+        const kommpot::ethernet_device_identification &identification) -> uint32_t;
+    static auto probe_ports(const std::shared_ptr<ethernet_ip_address> ip_address,
+        const std::vector<uint16_t> &ports, const uint32_t connect_timeout_msecs,
+        ethernet_probe_pacer &pacer, const uint32_t max_concurrent_ports,
+        const bool is_io_uring_enabled) -> std::vector<ethernet_port_probe>;
+    static auto probe_ports_batched(const std::shared_ptr<ethernet_ip_address> ip_address,
+        const std::vector<uint16_t> &ports, const uint32_t connect_timeout_msecs,
+        ethernet_probe_pacer &pacer, const uint32_t max_concurrent_ports)
+        -> std::vector<ethernet_port_probe>;
+    static auto create_devices(const kommpot::ethernet_device_identification &search_id,
+        std::vector<ethernet_port_probe> &probes)
+        -> std::vector<std::shared_ptr<kommpot::device_communication>>;
+    static auto is_probe_answered(const kommpot::ethernet_device_identification &search_id,
+        const kommpot::ethernet_device_identification &host_id, const ethernet_socket &connection)
+        -> bool;
+    static auto park_connection(const kommpot::ethernet_device_identification &search_id,
+        const kommpot::ethernet_device_identification &host_id,
+        std::unique_ptr<ethernet_socket> connection) -> void;
+    static auto read_out_hostname(const kommpot::ethernet_device_identification &search_id,
+        kommpot::ethernet_device_identification &host_id) -> void;
     static auto is_host_suitable(const kommpot::ethernet_device_identification &search_id,
         const kommpot::ethernet_device_identification &host_id) -> bool;
     static auto scan_network_for_hosts(const ethernet_network_information &network,
         const kommpot::ethernet_device_identification &identification)
         -> const std::vector<std::shared_ptr<kommpot::device_communication>>;
+    static auto discover_network_hosts(const ethernet_network_information &network,
+        const kommpot::ethernet_device_identification &identification)
+        -> const std::vector<std::shared_ptr<kommpot::device_communication>>;
+    static auto discover_ipv6_neighbors(const ethernet_interface_information &interface,
+        const kommpot::ethernet_device_identification &identification)
+        -> const std::vector<std::shared_ptr<kommpot::device_communication>>;
 
     static auto is_wildcard_match(const std::string &pattern, const std::string &value) -> bool;
 };
@@ -85,6 +85,16 @@ auto ethernet_ipv6_address::to_string() const -> std::string
     return std::string(buffer);
 }
 
+auto ethernet_ipv6_address::scope_id() const -> uint32_t
+{
+    return scope;
+}
+
+auto ethernet_ipv6_address::is_link_local() const -> bool
+{
+    return (value[0] & 0xFFC0) == 0xFE80;
+}
+
 auto ethernet_ipv6_address::operator==(const ethernet_ipv6_address &other) const noexcept -> bool
 {
     return value == other.value;
@@ -152,6 +162,11 @@ auto ethernet_mac_address::to_string() const -> std::string
     return std::string(buffer);
 }
 
+auto ethernet_mac_address::data() const -> const uint8_t *
+{
+    return value.data();
+}
+
 auto ethernet_mac_address::operator==(const ethernet_mac_address &other) const noexcept -> bool
 {
     return value == other.value;
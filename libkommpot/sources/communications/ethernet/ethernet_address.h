@@ -43,6 +43,13 @@ public:
 
     auto to_string() const -> std::string override;
 
+    /**
+     * @brief interface index a link-local address is reached through, 0 if not scoped.
+     * @attention scope is neither part of to_string() nor of comparisons.
+     */
+    auto scope_id() const -> uint32_t;
+    auto is_link_local() const -> bool;
+
     auto operator==(const ethernet_ipv6_address &other) const noexcept -> bool;
     auto operator!=(const ethernet_ipv6_address &other) const noexcept -> bool;
     auto operator<(const ethernet_ipv6_address &other) const noexcept -> bool;
@@ -53,6 +60,7 @@ public:
 private:
     friend class ethernet_address_factory;
     std::array<uint16_t, 8> value;
+    uint32_t scope = 0;
 };
 
 class ethernet_mac_address
@@ -63,6 +71,11 @@ public:
     auto empty() const -> bool;
     auto to_string() const -> std::string;
 
+    /**
+     * @brief states the 6 address bytes in wire order.
+     */
+    auto data() const -> const uint8_t *;
+
     auto operator==(const ethernet_mac_address &other) const noexcept -> bool;
     auto operator!=(const ethernet_mac_address &other) const noexcept -> bool;
     auto operator<(const ethernet_mac_address &other) const noexcept -> bool;
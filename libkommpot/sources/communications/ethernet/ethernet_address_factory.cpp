@@ -164,6 +164,7 @@ auto ethernet_address_factory::from_sockaddr_in(const sockaddr *structure)
             std::memcpy(&segment, &ipv6->sin6_addr.s6_addr[segment_index * 2], 2);
             ip->value.at(segment_index) = ntohs(segment);
         }
+        ip->scope = ipv6->sin6_scope_id;
 
         return ip;
     }
@@ -173,6 +174,23 @@ auto ethernet_address_factory::from_sockaddr_in(const sockaddr *structure)
     return std::nullopt;
 }
 
+auto ethernet_address_factory::with_scope_id(
+    const std::shared_ptr<ethernet_ip_address> &ip_address, const uint32_t scope_id)
+    -> std::optional<std::shared_ptr<ethernet_ip_address>>
+{
+    const auto *ipv6 = dynamic_cast<ethernet_ipv6_address *>(ip_address.get());
+    if (ipv6 == nullptr)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Scope ID can be set on IPv6 addresses only.");
+        return std::nullopt;
+    }
+
+    auto ip = std::make_shared<ethernet_ipv6_address>(*ipv6);
+    ip->scope = scope_id;
+
+    return ip;
+}
+
 auto ethernet_address_factory::from_array(const uint8_t *ptr, const size_t length)
     -> std::optional<ethernet_mac_address>
 {
@@ -197,6 +215,41 @@ auto ethernet_address_factory::from_array(const uint8_t *ptr, const size_t lengt
     return address;
 }
 
+auto ethernet_address_factory::mac_from_string(const std::string &value)
+    -> std::optional<ethernet_mac_address>
+{
+    ethernet_mac_address address;
+    const std::string_view text(value);
+
+    /**
+     * Exactly "XX:XX:XX:XX:XX:XX", each byte written with two hex digits.
+     */
+    if (text.size() != address.value.size() * 3 - 1)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Invalid MAC address: {}.", value);
+        return std::nullopt;
+    }
+
+    for (size_t index = 0; index < address.value.size(); ++index)
+    {
+        const auto *begin = text.data() + index * 3;
+        if (index > 0 && *(begin - 1) != ':' && *(begin - 1) != '-')
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Invalid MAC address: {}.", value);
+            return std::nullopt;
+        }
+
+        const auto result = std::from_chars(begin, begin + 2, address.value[index], 16);
+        if (result.ec != std::errc() || result.ptr != begin + 2)
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Invalid MAC address: {}.", value);
+            return std::nullopt;
+        }
+    }
+
+    return address;
+}
+
 auto ethernet_address_factory::calculate_base_address(
     const std::shared_ptr<ethernet_ip_address> &ip_address,
     const std::shared_ptr<ethernet_ip_address> &ip_mask)
@@ -249,6 +302,49 @@ auto ethernet_address_factory::calculate_base_address(
     return std::nullopt;
 }
 
+auto ethernet_address_factory::calculate_broadcast_address(
+    const std::shared_ptr<ethernet_ip_address> &ip_address,
+    const std::shared_ptr<ethernet_ip_address> &ip_mask)
+    -> std::optional<std::shared_ptr<ethernet_ip_address>>
+{
+    if (ip_address == nullptr)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Provided address pointer is nullptr.");
+        return std::nullopt;
+    }
+
+    if (ip_mask == nullptr)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Provided mask pointer is nullptr.");
+        return std::nullopt;
+    }
+
+    if (const auto *ipv4 = dynamic_cast<ethernet_ipv4_address *>(ip_address.get()))
+    {
+        const auto *ipv4_mask = dynamic_cast<ethernet_ipv4_address *>(ip_mask.get());
+        if (ipv4_mask == nullptr)
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Provided mask is not an IPv4 address.");
+            return std::nullopt;
+        }
+
+        return ethernet_address_factory::from_uint32_t(
+            (ipv4->to_uint32() & ipv4_mask->to_uint32()) | ~ipv4_mask->to_uint32());
+    }
+    else if (dynamic_cast<ethernet_ipv6_address *>(ip_address.get()))
+    {
+        /**
+         * @attention IPv6 has no broadcast, link-wide delivery is done through multicast groups.
+         */
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "IPv6 networks have no broadcast address.");
+        return std::nullopt;
+    }
+
+    SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Provided IP address is not IPv4 or IPv6.");
+
+    return std::nullopt;
+}
+
 auto ethernet_address_factory::calculate_new_address(
     const std::shared_ptr<ethernet_ip_address> &base_address, const uint64_t host_index)
     -> std::optional<std::shared_ptr<ethernet_ip_address>>
@@ -303,6 +399,70 @@ auto ethernet_address_factory::calculate_new_address(
     return std::nullopt;
 }
 
+auto ethernet_address_factory::calculate_host_index(
+    const std::shared_ptr<ethernet_ip_address> &base_address,
+    const std::shared_ptr<ethernet_ip_address> &ip_address) -> std::optional<uint64_t>
+{
+    if (base_address == nullptr || ip_address == nullptr)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Provided address pointer is nullptr.");
+        return std::nullopt;
+    }
+
+    /**
+     * @attention addresses below the base address or of another family are a regular outcome when
+     * filtering foreign addresses, therefore they are not reported as errors.
+     */
+    if (const auto *ipv4_base = dynamic_cast<ethernet_ipv4_address *>(base_address.get()))
+    {
+        const auto *ipv4 = dynamic_cast<ethernet_ipv4_address *>(ip_address.get());
+        if (ipv4 == nullptr || ipv4->to_uint32() < ipv4_base->to_uint32())
+        {
+            return std::nullopt;
+        }
+
+        return static_cast<uint64_t>(ipv4->to_uint32() - ipv4_base->to_uint32());
+    }
+    else if (const auto *ipv6_base = dynamic_cast<ethernet_ipv6_address *>(base_address.get()))
+    {
+        const auto *ipv6 = dynamic_cast<ethernet_ipv6_address *>(ip_address.get());
+        if (ipv6 == nullptr)
+        {
+            return std::nullopt;
+        }
+
+        /**
+         * @attention host index is limited to 64 bits, the upper half has to match the base.
+         */
+        for (size_t i = 0; i < 4; ++i)
+        {
+            if (ipv6->value[i] != ipv6_base->value[i])
+            {
+                return std::nullopt;
+            }
+        }
+
+        uint64_t base_low = 0;
+        uint64_t address_low = 0;
+        for (size_t i = 4; i < ipv6->value.size(); ++i)
+        {
+            base_low = (base_low << 16) | ipv6_base->value[i];
+            address_low = (address_low << 16) | ipv6->value[i];
+        }
+
+        if (address_low < base_low)
+        {
+            return std::nullopt;
+        }
+
+        return address_low - base_low;
+    }
+
+    SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Provided IP address is not IPv4 or IPv6.");
+
+    return std::nullopt;
+}
+
 auto ethernet_address_factory::calculate_mask(
     const std::shared_ptr<ethernet_ip_address> &ip_address, const uint32_t mask_prefix)
     -> std::optional<std::shared_ptr<ethernet_ip_address>>
@@ -26,18 +26,40 @@ public:
     [[nodiscard]] static auto from_sockaddr_in(const sockaddr *structure)
         -> std::optional<std::shared_ptr<ethernet_ip_address>>;
 
+    /**
+     * @brief copies an IPv6 address and binds the copy to the interface with the given index.
+     */
+    [[nodiscard]] static auto with_scope_id(
+        const std::shared_ptr<ethernet_ip_address> &ip_address, const uint32_t scope_id)
+        -> std::optional<std::shared_ptr<ethernet_ip_address>>;
+
     [[nodiscard]] static auto from_array(const uint8_t *ptr, const size_t length)
         -> std::optional<ethernet_mac_address>;
 
+    /**
+     * @brief parses a MAC address of 6 hex bytes separated by ':' or '-'.
+     */
+    [[nodiscard]] static auto mac_from_string(const std::string &value)
+        -> std::optional<ethernet_mac_address>;
+
     [[nodiscard]] static auto calculate_base_address(
         const std::shared_ptr<ethernet_ip_address> &ip_address,
         const std::shared_ptr<ethernet_ip_address> &mask)
         -> std::optional<std::shared_ptr<ethernet_ip_address>>;
 
+    [[nodiscard]] static auto calculate_broadcast_address(
+        const std::shared_ptr<ethernet_ip_address> &ip_address,
+        const std::shared_ptr<ethernet_ip_address> &mask)
+        -> std::optional<std::shared_ptr<ethernet_ip_address>>;
+
     [[nodiscard]] static auto calculate_new_address(
         const std::shared_ptr<ethernet_ip_address> &base_address, const uint64_t host_index)
         -> std::optional<std::shared_ptr<ethernet_ip_address>>;
 
+    [[nodiscard]] static auto calculate_host_index(
+        const std::shared_ptr<ethernet_ip_address> &base_address,
+        const std::shared_ptr<ethernet_ip_address> &ip_address) -> std::optional<uint64_t>;
+
     [[nodiscard]] static auto calculate_mask(const std::shared_ptr<ethernet_ip_address> &ip_address,
         const uint32_t mask_prefix) -> std::optional<std::shared_ptr<ethernet_ip_address>>;
 
@@ -0,0 +1,123 @@
+#include <communications/ethernet/ethernet_connection_pool.h>
+
+#include <kommpot_core.h>
+
+#include <algorithm>
+#include <iterator>
+
+auto ethernet_connection_pool::insert(const std::string &ip_address, const uint16_t &port,
+    const kommpot::ethernet_protocol_type &protocol, std::unique_ptr<ethernet_socket> socket)
+    -> void
+{
+    if (socket == nullptr || !socket->is_connected())
+    {
+        return;
+    }
+
+    const auto key = to_key(ip_address, port, protocol);
+    const auto now = clock::now();
+
+    /**
+     * @attention sockets are closed outside of the lock, closing may take a while.
+     */
+    std::vector<entry> removed;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        remove_expired(now, removed);
+
+        auto it = std::find_if(std::begin(m_entries), std::end(m_entries),
+            [&key](const entry &item) { return item.key == key; });
+        if (it != std::end(m_entries))
+        {
+            removed.push_back(std::move(*it));
+            m_entries.erase(it);
+        }
+
+        if (m_entries.size() >= M_MAX_IDLE_CONNECTIONS)
+        {
+            removed.push_back(std::move(m_entries.front()));
+            m_entries.erase(std::begin(m_entries));
+        }
+
+        m_entries.push_back({key, std::move(socket), now});
+    }
+
+    SPDLOG_LOGGER_TRACE(KOMMPOT_LOGGER, "Connection pool: parked connection to {}.", key);
+}
+
+auto ethernet_connection_pool::take(const std::string &ip_address, const uint16_t &port,
+    const kommpot::ethernet_protocol_type &protocol) -> std::unique_ptr<ethernet_socket>
+{
+    const auto key = to_key(ip_address, port, protocol);
+
+    std::vector<entry> removed;
+    std::unique_ptr<ethernet_socket> socket = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        remove_expired(clock::now(), removed);
+
+        auto it = std::find_if(std::begin(m_entries), std::end(m_entries),
+            [&key](const entry &item) { return item.key == key; });
+        if (it == std::end(m_entries))
+        {
+            return nullptr;
+        }
+
+        socket = std::move(it->socket);
+        m_entries.erase(it);
+    }
+
+    if (!socket->is_alive())
+    {
+        SPDLOG_LOGGER_DEBUG(
+            KOMMPOT_LOGGER, "Connection pool: parked connection to {} was closed by peer.", key);
+        return nullptr;
+    }
+
+    SPDLOG_LOGGER_TRACE(KOMMPOT_LOGGER, "Connection pool: adopted connection to {}.", key);
+
+    return socket;
+}
+
+auto ethernet_connection_pool::size() -> size_t
+{
+    /**
+     * @attention removed is declared first, so it is destroyed after the lock was released.
+     */
+    std::vector<entry> removed;
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    remove_expired(clock::now(), removed);
+
+    return m_entries.size();
+}
+
+auto ethernet_connection_pool::clear() -> void
+{
+    std::vector<entry> removed;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        removed.swap(m_entries);
+    }
+}
+
+auto ethernet_connection_pool::remove_expired(
+    const clock::time_point &now, std::vector<entry> &removed) -> void
+{
+    auto expired = std::stable_partition(std::begin(m_entries), std::end(m_entries),
+        [&now](const entry &item) {
+            return now - item.time < std::chrono::milliseconds(M_TTL_MSEC);
+        });
+
+    std::move(expired, std::end(m_entries), std::back_inserter(removed));
+    m_entries.erase(expired, std::end(m_entries));
+}
+
+auto ethernet_connection_pool::to_key(const std::string &ip_address, const uint16_t &port,
+    const kommpot::ethernet_protocol_type &protocol) -> std::string
+{
+    return ip_address + ":" + std::to_string(port) + "/" +
+           kommpot::ethernet_protocol_type_to_string(protocol);
+}
@@ -0,0 +1,78 @@
+#ifndef ETHERNET_CONNECTION_POOL_H
+#define ETHERNET_CONNECTION_POOL_H
+
+#pragma once
+
+#include <communications/ethernet/ethernet_socket.h>
+#include <libkommpot.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief keeps connections established while searching for devices, so that opening a just found
+ * device adopts the connection instead of doing another handshake.
+ */
+class ethernet_connection_pool
+{
+public:
+    static auto instance() -> ethernet_connection_pool &
+    {
+        static ethernet_connection_pool instance;
+        return instance;
+    }
+
+    ethernet_connection_pool(const ethernet_connection_pool &) = delete;
+    auto operator=(const ethernet_connection_pool &) -> void = delete;
+
+    /**
+     * @brief parks connected socket, the oldest one is closed if the pool is full.
+     */
+    auto insert(const std::string &ip_address, const uint16_t &port,
+        const kommpot::ethernet_protocol_type &protocol, std::unique_ptr<ethernet_socket> socket)
+        -> void;
+
+    /**
+     * @brief removes parked socket of the endpoint from the pool.
+     * @return socket or nullptr if there is none that is younger than the TTL and still alive.
+     */
+    [[nodiscard]] auto take(const std::string &ip_address, const uint16_t &port,
+        const kommpot::ethernet_protocol_type &protocol) -> std::unique_ptr<ethernet_socket>;
+
+    [[nodiscard]] auto size() -> size_t;
+
+    auto clear() -> void;
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    struct entry
+    {
+        std::string key = "";
+        std::unique_ptr<ethernet_socket> socket = nullptr;
+        clock::time_point time = {};
+    };
+
+    static constexpr uint32_t M_TTL_MSEC = 5000;
+    static constexpr size_t M_MAX_IDLE_CONNECTIONS = 64;
+
+    std::mutex m_mutex;
+    std::vector<entry> m_entries;
+
+    ethernet_connection_pool() = default;
+    ~ethernet_connection_pool() = default;
+
+    /**
+     * @brief moves expired entries to removed, so the caller closes them after unlocking.
+     */
+    auto remove_expired(const clock::time_point &now, std::vector<entry> &removed) -> void;
+
+    static auto to_key(const std::string &ip_address, const uint16_t &port,
+        const kommpot::ethernet_protocol_type &protocol) -> std::string;
+};
+
+#endif // ETHERNET_CONNECTION_POOL_H
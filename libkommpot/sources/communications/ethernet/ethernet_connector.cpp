@@ -0,0 +1,209 @@
+#include <communications/ethernet/ethernet_connector.h>
+
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <kommpot_core.h>
+
+#include <algorithm>
+#include <chrono>
+
+#ifdef _WIN32
+// clang-format off
+#    include <winsock2.h>
+#    include <ws2tcpip.h>
+// clang-format on
+#else
+#    include <netdb.h>
+#    include <sys/socket.h>
+#endif
+
+auto ethernet_connector::resolve(const std::string &host)
+    -> std::vector<std::shared_ptr<ethernet_ip_address>>
+{
+    addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    addrinfo *results = nullptr;
+    const auto result = getaddrinfo(host.c_str(), nullptr, &hints, &results);
+    if (result != 0 || results == nullptr)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Failed to resolve host {}: {}", host,
+            std::string(gai_strerror(result)));
+        return {};
+    }
+
+    std::vector<std::shared_ptr<ethernet_ip_address>> addresses;
+    for (const auto *entry = results; entry != nullptr; entry = entry->ai_next)
+    {
+        auto ip_address_opt = ethernet_address_factory::from_sockaddr_in(entry->ai_addr);
+        if (!ip_address_opt)
+        {
+            continue;
+        }
+
+        const auto &ip_address = *ip_address_opt;
+        const auto is_duplicate = std::any_of(std::begin(addresses), std::end(addresses),
+            [&ip_address](const auto &known) {
+                return known->to_string() == ip_address->to_string();
+            });
+        if (!is_duplicate)
+        {
+            addresses.push_back(ip_address);
+        }
+    }
+
+    freeaddrinfo(results);
+
+    return interleave(addresses);
+}
+
+auto ethernet_connector::interleave(
+    const std::vector<std::shared_ptr<ethernet_ip_address>> &addresses)
+    -> std::vector<std::shared_ptr<ethernet_ip_address>>
+{
+    if (addresses.empty())
+    {
+        return {};
+    }
+
+    std::vector<std::shared_ptr<ethernet_ip_address>> first_family;
+    std::vector<std::shared_ptr<ethernet_ip_address>> other_family;
+
+    const auto is_first_ipv6 = is_ipv6(addresses.front());
+    for (const auto &ip_address : addresses)
+    {
+        (is_ipv6(ip_address) == is_first_ipv6 ? first_family : other_family).push_back(ip_address);
+    }
+
+    std::vector<std::shared_ptr<ethernet_ip_address>> interleaved;
+    interleaved.reserve(addresses.size());
+
+    for (size_t i = 0; i < std::max(first_family.size(), other_family.size()); i++)
+    {
+        if (i < first_family.size())
+        {
+            interleaved.push_back(first_family[i]);
+        }
+        if (i < other_family.size())
+        {
+            interleaved.push_back(other_family[i]);
+        }
+    }
+
+    return interleaved;
+}
+
+auto ethernet_connector::connect(
+    const std::vector<std::shared_ptr<ethernet_ip_address>> &candidates, const uint16_t port,
+    const uint32_t timeout_msecs, const uint32_t attempt_delay_msecs, ethernet_socket &socket,
+    const kommpot::ethernet_socket_profile &profile) -> bool
+{
+    using clock = std::chrono::steady_clock;
+
+    if (timeout_msecs == 0)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Racing connects requires a connect timeout.");
+        return false;
+    }
+
+    const auto attempt_delay =
+        std::chrono::milliseconds(std::max(attempt_delay_msecs, M_MIN_ATTEMPT_DELAY_MSEC));
+    const auto deadline = clock::now() + std::chrono::milliseconds(timeout_msecs);
+
+    std::vector<std::unique_ptr<ethernet_socket>> attempts;
+    auto next_attempt_time = clock::now();
+    size_t next_candidate = 0;
+
+    while (clock::now() < deadline)
+    {
+        const auto now = clock::now();
+
+        if (next_candidate < candidates.size() && (attempts.empty() || now >= next_attempt_time))
+        {
+            const auto &candidate = candidates[next_candidate++];
+
+            auto attempt = std::make_unique<ethernet_socket>();
+            if (!attempt->initialize(candidate, port, kommpot::ethernet_protocol_type::TCP) ||
+                !attempt->set_timeout(timeout_msecs))
+            {
+                continue;
+            }
+
+            /**
+             * @attention tuning is best effort, a missing option does not disqualify a candidate.
+             */
+            (void)attempt->set_profile(profile);
+
+            if (!attempt->begin_connect())
+            {
+                /**
+                 * @attention a candidate failing right away, e.g. unreachable network, hands over
+                 * to the next one without waiting for the attempt delay.
+                 */
+                continue;
+            }
+
+            if (!attempt->is_connect_pending())
+            {
+                if (attempt->end_connect())
+                {
+                    socket = std::move(*attempt);
+                    return true;
+                }
+                continue;
+            }
+
+            attempts.push_back(std::move(attempt));
+            next_attempt_time = now + attempt_delay;
+            continue;
+        }
+
+        if (attempts.empty())
+        {
+            break;
+        }
+
+        const auto wait_until = next_candidate < candidates.size()
+                                    ? std::min(next_attempt_time, deadline)
+                                    : deadline;
+        const auto wait_msecs = std::chrono::ceil<std::chrono::milliseconds>(wait_until - now);
+
+        std::vector<ethernet_socket *> pending;
+        pending.reserve(attempts.size());
+        for (const auto &attempt : attempts)
+        {
+            pending.push_back(attempt.get());
+        }
+
+        const auto ready = ethernet_socket::wait_for_connect(
+            pending, static_cast<uint32_t>(std::max<int64_t>(wait_msecs.count(), 0)));
+
+        for (auto *attempt : ready)
+        {
+            if (attempt->end_connect())
+            {
+                /**
+                 * @attention the losing attempts are closed when they go out of scope.
+                 */
+                socket = std::move(*attempt);
+                return true;
+            }
+
+            next_attempt_time = clock::now();
+        }
+
+        attempts.erase(std::remove_if(std::begin(attempts), std::end(attempts),
+                           [](const auto &attempt) { return !attempt->is_connect_pending(); }),
+            std::end(attempts));
+    }
+
+    SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Failed to connect to any of {} candidates on port {}.",
+        candidates.size(), port);
+
+    return false;
+}
+
+auto ethernet_connector::is_ipv6(const std::shared_ptr<ethernet_ip_address> &ip_address) -> bool
+{
+    return dynamic_cast<ethernet_ipv6_address *>(ip_address.get()) != nullptr;
+}
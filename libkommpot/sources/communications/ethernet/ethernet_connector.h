@@ -0,0 +1,59 @@
+#ifndef ETHERNET_CONNECTOR_H
+#define ETHERNET_CONNECTOR_H
+
+#pragma once
+
+#include <communications/ethernet/ethernet_address.h>
+#include <communications/ethernet/ethernet_socket.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief dual-stack TCP connect after RFC 8305 (happy eyeballs): candidates of both families are
+ * tried staggered and in parallel, the first completed handshake wins, so connection setup takes
+ * the RTT of the fastest path instead of the timeout of a broken one.
+ */
+class ethernet_connector
+{
+public:
+    /**
+     * @brief resolves a hostname or numeric address to all of its IPv4 and IPv6 addresses.
+     * @return addresses in interleaved order, empty if the host could not be resolved.
+     */
+    [[nodiscard]] static auto resolve(const std::string &host)
+        -> std::vector<std::shared_ptr<ethernet_ip_address>>;
+
+    /**
+     * @brief alternates address families, starting with the family of the first address.
+     */
+    [[nodiscard]] static auto interleave(
+        const std::vector<std::shared_ptr<ethernet_ip_address>> &addresses)
+        -> std::vector<std::shared_ptr<ethernet_ip_address>>;
+
+    /**
+     * @brief races TCP connects to the candidates, the next candidate starts once the attempt
+     * delay elapsed or the previous attempt failed.
+     * @param timeout_msecs states connect budget over all candidates, it is also the read/write
+     * timeout of the resulting socket and has to be non-zero.
+     * @param socket receives the winning connection.
+     * @param profile states socket options applied to every attempt before it connects.
+     */
+    [[nodiscard]] static auto connect(
+        const std::vector<std::shared_ptr<ethernet_ip_address>> &candidates, const uint16_t port,
+        const uint32_t timeout_msecs, const uint32_t attempt_delay_msecs, ethernet_socket &socket,
+        const kommpot::ethernet_socket_profile &profile = kommpot::ethernet_socket_profile::DEFAULT)
+        -> bool;
+
+private:
+    /**
+     * @brief lower bound of the attempt delay recommended by RFC 8305.
+     */
+    static constexpr uint32_t M_MIN_ATTEMPT_DELAY_MSEC = 10;
+
+    static auto is_ipv6(const std::shared_ptr<ethernet_ip_address> &ip_address) -> bool;
+};
+
+#endif // ETHERNET_CONNECTOR_H
@@ -1,5 +1,7 @@
 #include <communications/ethernet/ethernet_context.h>
 
+#include <communications/ethernet/ethernet_connection_pool.h>
+
 #include <kommpot_core.h>
 
 #ifdef _WIN32
@@ -33,6 +35,11 @@ auto ethernet_context::initialize() -> bool
 
 auto ethernet_context::deinitialize() -> bool
 {
+    /**
+     * @attention parked connections have to be closed while sockets and logger are still usable.
+     */
+    ethernet_connection_pool::instance().clear();
+
 #ifdef _WIN32
     const int result = WSACleanup();
     if (result != NO_ERROR)
@@ -0,0 +1,128 @@
+#include <communications/ethernet/ethernet_discovery.h>
+
+#include <communications/ethernet/ethernet_discovery_protocol.h>
+#include <communications/ethernet/ethernet_socket.h>
+#include <kommpot_core.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <random>
+
+namespace {
+#ifdef _WIN32
+    constexpr int32_t INTERRUPTED_ERROR_CODE = WSAEINTR;
+#else
+    constexpr int32_t INTERRUPTED_ERROR_CODE = EINTR;
+#endif
+} // namespace
+
+auto ethernet_discovery::query(const std::shared_ptr<ethernet_ip_address> &destination,
+    const uint16_t discovery_port, const uint32_t timeout_msecs)
+    -> std::vector<kommpot::ethernet_device_identification>
+{
+    std::vector<kommpot::ethernet_device_identification> identifications;
+
+    if (destination == nullptr)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Provided discovery destination is nullptr.");
+        return {};
+    }
+
+    auto socket = ethernet_socket();
+
+    if (!socket.initialize(destination, discovery_port, kommpot::ethernet_protocol_type::UDP))
+    {
+        return {};
+    }
+
+    if (dynamic_cast<ethernet_ipv4_address *>(destination.get()) && !socket.set_broadcast(true))
+    {
+        return {};
+    }
+
+    std::random_device random_device;
+    std::uniform_int_distribution<uint32_t> distribution(0, 0xFFFF);
+
+    ethernet_discovery_message probe;
+    probe.type = ethernet_discovery_message_type::PROBE;
+    probe.transaction_id = static_cast<uint16_t>(distribution(random_device));
+
+    const auto probe_bytes = ethernet_discovery_protocol::encode(probe);
+    if (!socket.send_to(probe_bytes.data(), probe_bytes.size()))
+    {
+        return {};
+    }
+
+    SPDLOG_LOGGER_TRACE(KOMMPOT_LOGGER, "Sent discovery probe {:#06x} to {}.",
+        probe.transaction_id, socket.to_string());
+
+    std::array<uint8_t, ethernet_discovery_protocol::MAX_MESSAGE_SIZE_BYTES> buffer = {};
+
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_msecs);
+    while (true)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+        {
+            break;
+        }
+
+        const auto remaining_msecs = static_cast<uint32_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count());
+
+        size_t received_size_bytes = 0;
+        std::shared_ptr<ethernet_ip_address> source_address = nullptr;
+        int32_t error_code = 0;
+        if (!socket.receive_from(buffer.data(), buffer.size(), received_size_bytes,
+                source_address, remaining_msecs, error_code))
+        {
+            /**
+             * @attention an error such as ECONNREFUSED of an ICMP message fails every read right
+             * away, waiting again would spin until the deadline.
+             */
+            if (error_code == 0 || error_code == INTERRUPTED_ERROR_CODE)
+            {
+                continue;
+            }
+            break;
+        }
+
+        const auto reply = ethernet_discovery_protocol::decode(buffer.data(), received_size_bytes);
+        if (!reply || reply->type != ethernet_discovery_message_type::REPLY ||
+            reply->transaction_id != probe.transaction_id)
+        {
+            SPDLOG_LOGGER_TRACE(KOMMPOT_LOGGER, "Ignoring unrelated datagram from {}.",
+                source_address->to_string());
+            continue;
+        }
+
+        kommpot::ethernet_device_identification identification;
+        identification.name = reply->name;
+        identification.ip = source_address->to_string();
+        identification.mac = reply->mac;
+        identification.port = reply->port;
+        identification.protocol = static_cast<kommpot::ethernet_protocol_type>(reply->protocol);
+        identification.discovery = kommpot::ethernet_discovery_type::UDP_BROADCAST;
+        identification.discovery_port = discovery_port;
+
+        const bool is_duplicate = std::any_of(identifications.begin(), identifications.end(),
+            [&](const kommpot::ethernet_device_identification &known) {
+                return known.ip == identification.ip && known.port == identification.port &&
+                       known.protocol == identification.protocol;
+            });
+        if (is_duplicate)
+        {
+            continue;
+        }
+
+        SPDLOG_LOGGER_TRACE(KOMMPOT_LOGGER, "Discovery reply from {} ('{}', port {}).",
+            identification.ip, identification.name, identification.port);
+
+        identifications.push_back(identification);
+    }
+
+    return identifications;
+}
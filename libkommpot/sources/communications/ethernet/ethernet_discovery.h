@@ -0,0 +1,28 @@
+#ifndef ETHERNET_DISCOVERY_H
+#define ETHERNET_DISCOVERY_H
+
+#pragma once
+
+#include <communications/ethernet/ethernet_address.h>
+#include <libkommpot.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class ethernet_discovery
+{
+public:
+    /**
+     * @brief sends a single discovery probe and collects responder replies until timeout.
+     * @param destination states broadcast or unicast address the probe is sent to.
+     * @param discovery_port states UDP port the responders listen on.
+     * @param timeout_msecs states how long replies are collected.
+     * @return identifications of all responders, IP address is taken from the reply source.
+     */
+    [[nodiscard]] static auto query(const std::shared_ptr<ethernet_ip_address> &destination,
+        const uint16_t discovery_port, const uint32_t timeout_msecs)
+        -> std::vector<kommpot::ethernet_device_identification>;
+};
+
+#endif // ETHERNET_DISCOVERY_H
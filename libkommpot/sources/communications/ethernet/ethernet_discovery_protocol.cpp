@@ -0,0 +1,127 @@
+#include <communications/ethernet/ethernet_discovery_protocol.h>
+
+#include <algorithm>
+#include <limits>
+
+auto ethernet_discovery_protocol::encode(const ethernet_discovery_message &message)
+    -> std::vector<uint8_t>
+{
+    std::vector<uint8_t> buffer(std::begin(MAGIC), std::end(MAGIC));
+    buffer.reserve(HEADER_SIZE_BYTES + message.name.size() + message.mac.size() + 16);
+
+    buffer.push_back(VERSION);
+    buffer.push_back(static_cast<uint8_t>(message.type));
+    buffer.push_back(static_cast<uint8_t>((message.transaction_id >> 8) & 0xFF));
+    buffer.push_back(static_cast<uint8_t>(message.transaction_id & 0xFF));
+
+    if (message.type != ethernet_discovery_message_type::REPLY)
+    {
+        return buffer;
+    }
+
+    append_field(buffer, field_tag::NAME, reinterpret_cast<const uint8_t *>(message.name.data()),
+        message.name.size());
+    append_field(buffer, field_tag::MAC, reinterpret_cast<const uint8_t *>(message.mac.data()),
+        message.mac.size());
+
+    const uint8_t port[2] = {static_cast<uint8_t>((message.port >> 8) & 0xFF),
+        static_cast<uint8_t>(message.port & 0xFF)};
+    append_field(buffer, field_tag::PORT, port, sizeof(port));
+
+    append_field(buffer, field_tag::PROTOCOL, &message.protocol, sizeof(message.protocol));
+
+    return buffer;
+}
+
+auto ethernet_discovery_protocol::decode(const uint8_t *data, const size_t size_bytes)
+    -> std::optional<ethernet_discovery_message>
+{
+    if (data == nullptr || size_bytes < HEADER_SIZE_BYTES || size_bytes > MAX_MESSAGE_SIZE_BYTES)
+    {
+        return std::nullopt;
+    }
+
+    if (!std::equal(std::begin(MAGIC), std::end(MAGIC), data) || data[4] != VERSION)
+    {
+        return std::nullopt;
+    }
+
+    ethernet_discovery_message message;
+
+    const auto type = static_cast<ethernet_discovery_message_type>(data[5]);
+    if (type != ethernet_discovery_message_type::PROBE &&
+        type != ethernet_discovery_message_type::REPLY)
+    {
+        return std::nullopt;
+    }
+
+    message.type = type;
+    message.transaction_id = static_cast<uint16_t>((data[6] << 8) | data[7]);
+
+    size_t offset = HEADER_SIZE_BYTES;
+    while (offset < size_bytes)
+    {
+        if (size_bytes - offset < 2)
+        {
+            return std::nullopt;
+        }
+
+        const auto tag = static_cast<field_tag>(data[offset]);
+        const size_t length = data[offset + 1];
+        offset += 2;
+
+        if (size_bytes - offset < length)
+        {
+            return std::nullopt;
+        }
+
+        const uint8_t *value = data + offset;
+        offset += length;
+
+        switch (tag)
+        {
+        case field_tag::NAME: {
+            message.name.assign(reinterpret_cast<const char *>(value), length);
+            break;
+        }
+        case field_tag::MAC: {
+            message.mac.assign(reinterpret_cast<const char *>(value), length);
+            break;
+        }
+        case field_tag::PORT: {
+            if (length != 2)
+            {
+                return std::nullopt;
+            }
+            message.port = static_cast<uint16_t>((value[0] << 8) | value[1]);
+            break;
+        }
+        case field_tag::PROTOCOL: {
+            if (length != 1)
+            {
+                return std::nullopt;
+            }
+            message.protocol = value[0];
+            break;
+        }
+        default: {
+            break;
+        }
+        }
+    }
+
+    return message;
+}
+
+auto ethernet_discovery_protocol::append_field(std::vector<uint8_t> &buffer, const field_tag tag,
+    const uint8_t *value, const size_t size_bytes) -> void
+{
+    /**
+     * @attention the length field is a single byte, longer values are truncated.
+     */
+    const auto length = std::min<size_t>(size_bytes, std::numeric_limits<uint8_t>::max());
+
+    buffer.push_back(static_cast<uint8_t>(tag));
+    buffer.push_back(static_cast<uint8_t>(length));
+    buffer.insert(buffer.end(), value, value + length);
+}
@@ -0,0 +1,75 @@
+#ifndef ETHERNET_DISCOVERY_PROTOCOL_H
+#define ETHERNET_DISCOVERY_PROTOCOL_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief kommpot-native discovery datagram layout (all multi-byte values are big-endian):
+ *
+ *   offset 0  magic "KMPD" (4 bytes)
+ *   offset 4  protocol version (1 byte)
+ *   offset 5  message type (1 byte)
+ *   offset 6  transaction ID (2 bytes)
+ *   offset 8  sequence of TLV fields: tag (1 byte), length (1 byte), value (length bytes)
+ *
+ * Unknown tags are skipped, so newer responders stay readable by older clients.
+ *
+ * @attention this file is shared with the kommpot-responder library and therefore must not depend
+ * on the kommpot logger or any other library internals.
+ */
+enum class ethernet_discovery_message_type : uint8_t
+{
+    UNKNOWN = 0,
+    PROBE = 1,
+    REPLY = 2
+};
+
+struct ethernet_discovery_message
+{
+    ethernet_discovery_message_type type = ethernet_discovery_message_type::UNKNOWN;
+    uint16_t transaction_id = 0;
+
+    /**
+     * @category identity fields, only carried by REPLY messages.
+     */
+    std::string name = "";
+    std::string mac = "";
+    uint16_t port = 0;
+    uint8_t protocol = 0;
+};
+
+class ethernet_discovery_protocol
+{
+public:
+    static constexpr uint16_t DEFAULT_PORT = 47808;
+    static constexpr uint8_t VERSION = 1;
+    static constexpr size_t HEADER_SIZE_BYTES = 8;
+    static constexpr size_t MAX_MESSAGE_SIZE_BYTES = 1024;
+
+    [[nodiscard]] static auto encode(const ethernet_discovery_message &message)
+        -> std::vector<uint8_t>;
+    [[nodiscard]] static auto decode(const uint8_t *data, const size_t size_bytes)
+        -> std::optional<ethernet_discovery_message>;
+
+private:
+    enum class field_tag : uint8_t
+    {
+        NAME = 1,
+        MAC = 2,
+        PORT = 3,
+        PROTOCOL = 4
+    };
+
+    static constexpr uint8_t MAGIC[4] = {'K', 'M', 'P', 'D'};
+
+    static auto append_field(std::vector<uint8_t> &buffer, const field_tag tag,
+        const uint8_t *value, const size_t size_bytes) -> void;
+};
+
+#endif // ETHERNET_DISCOVERY_PROTOCOL_H
@@ -0,0 +1,207 @@
+#include <communications/ethernet/ethernet_hostname_resolver.h>
+
+#include <algorithm>
+
+#ifdef _WIN32
+// clang-format off
+#    include <winsock2.h>
+#    include <ws2tcpip.h>
+// clang-format on
+#else
+#    include <arpa/inet.h>
+#    include <netdb.h>
+#    include <netinet/in.h>
+#    include <sys/socket.h>
+#endif
+
+/**
+ * @attention a worker stuck in getnameinfo() delays the destruction by the resolver timeout,
+ * the workers never outlive the library.
+ */
+ethernet_hostname_resolver::~ethernet_hostname_resolver()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_is_stopping = true;
+
+        for (auto &pending : m_requests)
+        {
+            pending.hostname.set_value(std::nullopt);
+        }
+        m_requests.clear();
+    }
+    m_condition.notify_all();
+
+    for (auto &worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+auto ethernet_hostname_resolver::resolve(const std::string &ip_address,
+    const uint32_t &timeout_msecs) -> std::optional<std::string>
+{
+    auto hostname = find_or_start(ip_address);
+
+    if (hostname.wait_for(std::chrono::milliseconds(timeout_msecs)) != std::future_status::ready)
+    {
+        return std::nullopt;
+    }
+
+    return hostname.get();
+}
+
+auto ethernet_hostname_resolver::cached(const std::string &ip_address)
+    -> std::optional<std::string>
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto it = m_entries.find(ip_address);
+    if (it == m_entries.end() ||
+        it->second.hostname.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+        return std::nullopt;
+    }
+
+    return it->second.hostname.get();
+}
+
+auto ethernet_hostname_resolver::clear() -> void
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+}
+
+auto ethernet_hostname_resolver::size() -> size_t
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+auto ethernet_hostname_resolver::find_or_start(const std::string &ip_address)
+    -> std::shared_future<std::optional<std::string>>
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto now = clock::now();
+
+    const auto it = m_entries.find(ip_address);
+    if (it != m_entries.end() && now - it->second.time < std::chrono::milliseconds(M_TTL_MSEC))
+    {
+        return it->second.hostname;
+    }
+
+    std::promise<std::optional<std::string>> promise;
+    auto hostname = promise.get_future().share();
+
+    /**
+     * @attention on a network without reverse DNS every lookup waits for the resolver timeout,
+     * addresses beyond the backlog are reported unresolved instead of queued.
+     */
+    if (m_requests.size() >= M_MAX_ENTRIES)
+    {
+        promise.set_value(std::nullopt);
+        return hostname;
+    }
+
+    if (it == m_entries.end() && m_entries.size() >= M_MAX_ENTRIES)
+    {
+        evict(now);
+    }
+
+    m_requests.push_back({ip_address, std::move(promise)});
+    if (m_requests.size() > m_idle_worker_count && m_workers.size() < M_MAX_LOOKUP_THREADS)
+    {
+        m_workers.emplace_back(&ethernet_hostname_resolver::work, this);
+    }
+    m_condition.notify_one();
+
+    m_entries[ip_address] = {hostname, now};
+
+    return hostname;
+}
+
+auto ethernet_hostname_resolver::evict(const clock::time_point &now) -> void
+{
+    /**
+     * @brief expired entries go first, the oldest one otherwise.
+     */
+    for (auto it = m_entries.begin(); it != m_entries.end();)
+    {
+        if (now - it->second.time >= std::chrono::milliseconds(M_TTL_MSEC))
+        {
+            it = m_entries.erase(it);
+            continue;
+        }
+        ++it;
+    }
+
+    if (m_entries.size() < M_MAX_ENTRIES)
+    {
+        return;
+    }
+
+    const auto oldest = std::min_element(m_entries.begin(), m_entries.end(),
+        [](const auto &left, const auto &right) { return left.second.time < right.second.time; });
+    m_entries.erase(oldest);
+}
+
+auto ethernet_hostname_resolver::work() -> void
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true)
+    {
+        m_idle_worker_count++;
+        m_condition.wait(lock, [this]() { return m_is_stopping || !m_requests.empty(); });
+        m_idle_worker_count--;
+
+        if (m_is_stopping)
+        {
+            return;
+        }
+
+        auto pending = std::move(m_requests.front());
+        m_requests.pop_front();
+
+        lock.unlock();
+        pending.hostname.set_value(lookup(pending.ip_address));
+        lock.lock();
+    }
+}
+
+auto ethernet_hostname_resolver::lookup(const std::string &ip_address)
+    -> std::optional<std::string>
+{
+    sockaddr_storage address = {};
+    socklen_t address_length_bytes = 0;
+
+    auto *ipv4 = reinterpret_cast<sockaddr_in *>(&address);
+    auto *ipv6 = reinterpret_cast<sockaddr_in6 *>(&address);
+    if (inet_pton(AF_INET, ip_address.c_str(), &ipv4->sin_addr) == 1)
+    {
+        ipv4->sin_family = AF_INET;
+        address_length_bytes = sizeof(sockaddr_in);
+    }
+    else if (inet_pton(AF_INET6, ip_address.c_str(), &ipv6->sin6_addr) == 1)
+    {
+        ipv6->sin6_family = AF_INET6;
+        address_length_bytes = sizeof(sockaddr_in6);
+    }
+    else
+    {
+        return std::nullopt;
+    }
+
+    /**
+     * @attention getnameinfo() falls back to the numeric address when there is no PTR record.
+     */
+    char host_buffer[NI_MAXHOST] = {0};
+    if (getnameinfo((const sockaddr *)&address, address_length_bytes, host_buffer,
+            sizeof(host_buffer), nullptr, 0, 0) != 0)
+    {
+        return std::nullopt;
+    }
+
+    return std::string(host_buffer);
+}
@@ -0,0 +1,94 @@
+#ifndef ETHERNET_HOSTNAME_RESOLVER_H
+#define ETHERNET_HOSTNAME_RESOLVER_H
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief process-wide reverse DNS cache, lookups run on a small pool of background threads so
+ * neither connect() nor open() ever wait for a resolver timeout.
+ */
+class ethernet_hostname_resolver
+{
+public:
+    static constexpr size_t M_MAX_ENTRIES = 1024;
+    static constexpr size_t M_MAX_LOOKUP_THREADS = 4;
+
+    static auto instance() -> ethernet_hostname_resolver &
+    {
+        static ethernet_hostname_resolver instance;
+        return instance;
+    }
+
+    ethernet_hostname_resolver(const ethernet_hostname_resolver &) = delete;
+    auto operator=(const ethernet_hostname_resolver &) -> void = delete;
+
+    /**
+     * @brief starts lookup of the IP address unless it is cached and waits for the result.
+     * @param timeout_msecs states maximal time to wait, the lookup keeps running afterwards and
+     * its result is cached for later calls.
+     * @return hostname, numeric address if it has no name, std::nullopt on timeout or failure.
+     */
+    [[nodiscard]] auto resolve(const std::string &ip_address, const uint32_t &timeout_msecs)
+        -> std::optional<std::string>;
+
+    /**
+     * @brief returns already resolved hostname without starting a lookup.
+     */
+    [[nodiscard]] auto cached(const std::string &ip_address) -> std::optional<std::string>;
+
+    auto clear() -> void;
+
+    /**
+     * @brief gets number of cached and pending lookups, at most M_MAX_ENTRIES.
+     */
+    [[nodiscard]] auto size() -> size_t;
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    struct entry
+    {
+        std::shared_future<std::optional<std::string>> hostname;
+        clock::time_point time = {};
+    };
+
+    struct request
+    {
+        std::string ip_address;
+        std::promise<std::optional<std::string>> hostname;
+    };
+
+    static constexpr uint32_t M_TTL_MSEC = 5 * 60 * 1000;
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::unordered_map<std::string, entry> m_entries;
+    std::deque<request> m_requests;
+    std::vector<std::thread> m_workers;
+    size_t m_idle_worker_count = 0;
+    bool m_is_stopping = false;
+
+    ethernet_hostname_resolver() = default;
+    ~ethernet_hostname_resolver();
+
+    auto find_or_start(const std::string &ip_address)
+        -> std::shared_future<std::optional<std::string>>;
+    auto evict(const clock::time_point &now) -> void;
+    auto work() -> void;
+
+    static auto lookup(const std::string &ip_address) -> std::optional<std::string>;
+};
+
+#endif // ETHERNET_HOSTNAME_RESOLVER_H
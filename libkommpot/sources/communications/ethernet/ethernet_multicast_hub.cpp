@@ -0,0 +1,242 @@
+#include <communications/ethernet/ethernet_multicast_hub.h>
+
+#include <kommpot_core.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+ethernet_multicast_subscription::ethernet_multicast_subscription(
+    std::shared_ptr<ethernet_multicast_channel> channel, const size_t &max_queued_datagrams)
+    : m_channel(std::move(channel)),
+      m_max_queued_datagrams(std::max<size_t>(max_queued_datagrams, 1))
+{}
+
+ethernet_multicast_subscription::~ethernet_multicast_subscription()
+{
+    if (m_channel != nullptr)
+    {
+        m_channel->remove(this);
+    }
+}
+
+auto ethernet_multicast_subscription::pop(
+    kommpot::pooled_buffer &datagram, const uint32_t &timeout_msecs) -> bool
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    if (!m_condition.wait_for(lock, std::chrono::milliseconds(timeout_msecs),
+            [this]() { return !m_datagrams.empty() || m_is_failed; }) ||
+        m_datagrams.empty())
+    {
+        return false;
+    }
+
+    datagram = std::move(m_datagrams.front());
+    m_datagrams.pop_front();
+
+    return true;
+}
+
+auto ethernet_multicast_subscription::try_pop(kommpot::pooled_buffer &datagram) -> bool
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_datagrams.empty())
+    {
+        return false;
+    }
+
+    datagram = std::move(m_datagrams.front());
+    m_datagrams.pop_front();
+
+    return true;
+}
+
+auto ethernet_multicast_subscription::dropped_count() const -> uint64_t
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_dropped_count;
+}
+
+auto ethernet_multicast_subscription::push(const kommpot::pooled_buffer &datagram) -> void
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_datagrams.size() >= m_max_queued_datagrams)
+        {
+            m_datagrams.pop_front();
+            ++m_dropped_count;
+        }
+
+        m_datagrams.push_back(datagram);
+    }
+
+    m_condition.notify_one();
+}
+
+auto ethernet_multicast_subscription::fail() -> void
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_is_failed = true;
+    }
+
+    m_condition.notify_all();
+}
+
+ethernet_multicast_channel::~ethernet_multicast_channel()
+{
+    m_is_running = false;
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+auto ethernet_multicast_channel::create(const std::shared_ptr<ethernet_ip_address> &group,
+    const uint16_t &port, const std::shared_ptr<ethernet_ip_address> &source,
+    const uint32_t &interface_index) -> std::shared_ptr<ethernet_multicast_channel>
+{
+    std::shared_ptr<ethernet_multicast_channel> channel(new ethernet_multicast_channel());
+
+    if (!channel->m_socket.initialize(group, port, kommpot::ethernet_protocol_type::UDP) ||
+        !channel->m_socket.join_multicast(source, interface_index))
+    {
+        return nullptr;
+    }
+
+    /**
+     * @attention UDP offload is best effort, a burst of a sender then costs a single receive.
+     */
+    static_cast<void>(channel->m_socket.set_udp_gro(true));
+
+    channel->m_pool = kommpot::buffer_pool::create();
+    channel->m_is_running = true;
+    channel->m_thread = std::thread(&ethernet_multicast_channel::run, channel.get());
+
+    return channel;
+}
+
+auto ethernet_multicast_channel::add(ethernet_multicast_subscription *subscription) -> void
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_subscriptions.push_back(subscription);
+}
+
+auto ethernet_multicast_channel::remove(ethernet_multicast_subscription *subscription) -> void
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_subscriptions.erase(std::remove(std::begin(m_subscriptions), std::end(m_subscriptions),
+                              subscription),
+        std::end(m_subscriptions));
+}
+
+auto ethernet_multicast_channel::run() -> void
+{
+    std::vector<std::vector<uint8_t>> buffers(
+        M_BATCH_MESSAGES, std::vector<uint8_t>(M_MAX_DATAGRAM_SIZE_BYTES));
+    std::vector<kommpot::message_buffer> messages(M_BATCH_MESSAGES);
+    for (size_t index = 0; index < M_BATCH_MESSAGES; ++index)
+    {
+        messages[index].data = buffers[index].data();
+        messages[index].size_bytes = buffers[index].size();
+    }
+
+    while (m_is_running)
+    {
+        size_t received_count = 0;
+        if (!m_socket.read_messages(messages, received_count, M_POLL_INTERVAL_MSEC))
+        {
+            if (!m_socket.is_connected())
+            {
+                break;
+            }
+            continue;
+        }
+
+        /**
+         * @attention every datagram is copied once into a right-sized buffer, the consumers
+         * share it.
+         */
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (size_t index = 0; index < received_count; ++index)
+        {
+            const auto &message = messages[index];
+            auto datagram = m_pool->acquire(message.received_size_bytes);
+            if (message.received_size_bytes > 0)
+            {
+                std::memcpy(datagram->data(), message.data, message.received_size_bytes);
+            }
+
+            for (auto *subscription : m_subscriptions)
+            {
+                subscription->push(datagram);
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto *subscription : m_subscriptions)
+    {
+        subscription->fail();
+    }
+}
+
+auto ethernet_multicast_hub::subscribe(const std::shared_ptr<ethernet_ip_address> &group,
+    const uint16_t &port, const std::shared_ptr<ethernet_ip_address> &source,
+    const uint32_t &interface_index, const size_t &max_queued_datagrams)
+    -> std::shared_ptr<ethernet_multicast_subscription>
+{
+    if (group == nullptr)
+    {
+        return nullptr;
+    }
+
+    const auto key = fmt::format("{}|{}|{}|{}", group->to_string(), port,
+        source != nullptr ? source->to_string() : "*", interface_index);
+
+    std::shared_ptr<ethernet_multicast_channel> channel = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_channels.find(key);
+        if (it != std::end(m_channels))
+        {
+            channel = it->second.lock();
+        }
+
+        if (channel == nullptr)
+        {
+            channel = ethernet_multicast_channel::create(group, port, source, interface_index);
+            if (channel == nullptr)
+            {
+                return nullptr;
+            }
+
+            m_channels[key] = channel;
+
+            SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Multicast hub: joined group {}.", key);
+        }
+    }
+
+    auto subscription =
+        std::make_shared<ethernet_multicast_subscription>(channel, max_queued_datagrams);
+    channel->add(subscription.get());
+
+    return subscription;
+}
+
+auto ethernet_multicast_hub::channel_count() -> size_t
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto it = std::begin(m_channels); it != std::end(m_channels);)
+    {
+        it = it->second.expired() ? m_channels.erase(it) : std::next(it);
+    }
+
+    return m_channels.size();
+}
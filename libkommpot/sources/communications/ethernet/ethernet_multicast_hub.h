@@ -0,0 +1,154 @@
+#ifndef ETHERNET_MULTICAST_HUB_H
+#define ETHERNET_MULTICAST_HUB_H
+
+#pragma once
+
+#include <communications/ethernet/ethernet_socket.h>
+#include <libkommpot.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class ethernet_multicast_channel;
+
+/**
+ * @brief datagrams of a multicast group queued for one consumer. Every datagram is received once
+ * into a pooled buffer shared by the queues of all consumers of the group.
+ * @attention a consumer falling behind by more than the queue size loses the oldest datagrams.
+ */
+class ethernet_multicast_subscription
+{
+public:
+    ethernet_multicast_subscription(
+        std::shared_ptr<ethernet_multicast_channel> channel, const size_t &max_queued_datagrams);
+    ~ethernet_multicast_subscription();
+
+    ethernet_multicast_subscription(const ethernet_multicast_subscription &obj) = delete;
+    auto operator=(const ethernet_multicast_subscription &obj)
+        -> ethernet_multicast_subscription & = delete;
+
+    /**
+     * @brief waits for the next datagram.
+     * @return false on timeout or once the group's socket failed.
+     */
+    [[nodiscard]] auto pop(kommpot::pooled_buffer &datagram, const uint32_t &timeout_msecs) -> bool;
+
+    /**
+     * @brief takes the next datagram without waiting.
+     */
+    [[nodiscard]] auto try_pop(kommpot::pooled_buffer &datagram) -> bool;
+
+    /**
+     * @brief states how many datagrams were dropped as the queue was full.
+     */
+    [[nodiscard]] auto dropped_count() const -> uint64_t;
+
+    /**
+     * @category called by the channel's receive thread.
+     */
+    auto push(const kommpot::pooled_buffer &datagram) -> void;
+    auto fail() -> void;
+
+private:
+    std::shared_ptr<ethernet_multicast_channel> m_channel = nullptr;
+    size_t m_max_queued_datagrams = 0;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<kommpot::pooled_buffer> m_datagrams;
+    uint64_t m_dropped_count = 0;
+    bool m_is_failed = false;
+};
+
+/**
+ * @brief socket joined to a multicast group and the thread receiving its datagrams in batches,
+ * it lives as long as any subscription holds it.
+ */
+class ethernet_multicast_channel
+{
+public:
+    ~ethernet_multicast_channel();
+
+    ethernet_multicast_channel(const ethernet_multicast_channel &obj) = delete;
+    auto operator=(const ethernet_multicast_channel &obj) -> ethernet_multicast_channel & = delete;
+
+    /**
+     * @return nullptr if the socket could not join the group.
+     */
+    [[nodiscard]] static auto create(const std::shared_ptr<ethernet_ip_address> &group,
+        const uint16_t &port, const std::shared_ptr<ethernet_ip_address> &source,
+        const uint32_t &interface_index) -> std::shared_ptr<ethernet_multicast_channel>;
+
+    /**
+     * @brief subscriptions register after construction and leave in their destructor, so the
+     * receive thread never holds the last reference to a subscription and thus to the channel.
+     */
+    auto add(ethernet_multicast_subscription *subscription) -> void;
+    auto remove(ethernet_multicast_subscription *subscription) -> void;
+
+private:
+    static constexpr size_t M_BATCH_MESSAGES = 64;
+    static constexpr size_t M_MAX_DATAGRAM_SIZE_BYTES = 65507;
+    static constexpr uint32_t M_POLL_INTERVAL_MSEC = 100;
+
+    ethernet_socket m_socket;
+    std::shared_ptr<kommpot::buffer_pool> m_pool = nullptr;
+
+    std::mutex m_mutex;
+    std::vector<ethernet_multicast_subscription *> m_subscriptions;
+
+    std::atomic_bool m_is_running = false;
+    std::thread m_thread;
+
+    ethernet_multicast_channel() = default;
+
+    auto run() -> void;
+};
+
+/**
+ * @brief joins every multicast group once per process, consumers of the same group, port, source
+ * and interface share the socket of the first one.
+ */
+class ethernet_multicast_hub
+{
+public:
+    static auto instance() -> ethernet_multicast_hub &
+    {
+        static ethernet_multicast_hub instance;
+        return instance;
+    }
+
+    ethernet_multicast_hub(const ethernet_multicast_hub &) = delete;
+    auto operator=(const ethernet_multicast_hub &) -> void = delete;
+
+    /**
+     * @param source states sender of a source-specific subscription, nullptr any sender.
+     * @return nullptr if the group could not be joined.
+     */
+    [[nodiscard]] auto subscribe(const std::shared_ptr<ethernet_ip_address> &group,
+        const uint16_t &port, const std::shared_ptr<ethernet_ip_address> &source,
+        const uint32_t &interface_index, const size_t &max_queued_datagrams)
+        -> std::shared_ptr<ethernet_multicast_subscription>;
+
+    /**
+     * @brief states number of groups joined with subscriptions still alive.
+     */
+    [[nodiscard]] auto channel_count() -> size_t;
+
+private:
+    std::mutex m_mutex;
+    std::unordered_map<std::string, std::weak_ptr<ethernet_multicast_channel>> m_channels;
+
+    ethernet_multicast_hub() = default;
+    ~ethernet_multicast_hub() = default;
+};
+
+#endif // ETHERNET_MULTICAST_HUB_H
@@ -0,0 +1,68 @@
+#include <communications/ethernet/ethernet_neighbor_cache.h>
+
+#include <kommpot_core.h>
+
+auto ethernet_neighbor_cache::snapshot() -> std::shared_ptr<const ethernet_neighbor_table>
+{
+    clock::time_point snapshot_time;
+    auto table = current(snapshot_time);
+    if (table != nullptr && clock::now() - snapshot_time < std::chrono::milliseconds(M_TTL_MSEC))
+    {
+        return table;
+    }
+
+    return refresh(M_TTL_MSEC);
+}
+
+auto ethernet_neighbor_cache::find(const std::string &ip_address)
+    -> std::optional<ethernet_mac_address>
+{
+    auto mac_address_opt = snapshot()->find(ip_address);
+    if (mac_address_opt)
+    {
+        return mac_address_opt;
+    }
+
+    return refresh(M_MISS_REFRESH_INTERVAL_MSEC)->find(ip_address);
+}
+
+auto ethernet_neighbor_cache::invalidate() -> void
+{
+    std::lock_guard<std::mutex> lock(m_snapshot_mutex);
+    m_snapshot = nullptr;
+}
+
+auto ethernet_neighbor_cache::current(clock::time_point &snapshot_time)
+    -> std::shared_ptr<const ethernet_neighbor_table>
+{
+    std::lock_guard<std::mutex> lock(m_snapshot_mutex);
+    snapshot_time = m_snapshot_time;
+    return m_snapshot;
+}
+
+auto ethernet_neighbor_cache::refresh(const uint32_t &max_age_msecs)
+    -> std::shared_ptr<const ethernet_neighbor_table>
+{
+    /**
+     * @attention only one thread reads the OS table, the others wait and reuse its result.
+     */
+    std::lock_guard<std::mutex> refresh_lock(m_refresh_mutex);
+
+    clock::time_point snapshot_time;
+    auto table = current(snapshot_time);
+    if (table != nullptr &&
+        clock::now() - snapshot_time < std::chrono::milliseconds(max_age_msecs))
+    {
+        return table;
+    }
+
+    table = std::make_shared<const ethernet_neighbor_table>(ethernet_neighbor_table::snapshot());
+
+    std::lock_guard<std::mutex> snapshot_lock(m_snapshot_mutex);
+    m_snapshot = table;
+    m_snapshot_time = clock::now();
+
+    SPDLOG_LOGGER_TRACE(KOMMPOT_LOGGER, "Neighbor cache refreshed with {} entries.", table->size());
+
+    return table;
+}
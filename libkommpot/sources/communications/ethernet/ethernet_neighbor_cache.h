@@ -0,0 +1,66 @@
+#ifndef ETHERNET_NEIGHBOR_CACHE_H
+#define ETHERNET_NEIGHBOR_CACHE_H
+
+#pragma once
+
+#include <communications/ethernet/ethernet_neighbor_table.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+/**
+ * @brief process-wide neighbor table shared by all sockets, re-read at most once per TTL so a
+ * concurrent sweep does not query the OS for every connected host.
+ */
+class ethernet_neighbor_cache
+{
+public:
+    static auto instance() -> ethernet_neighbor_cache &
+    {
+        static ethernet_neighbor_cache instance;
+        return instance;
+    }
+
+    ethernet_neighbor_cache(const ethernet_neighbor_cache &) = delete;
+    auto operator=(const ethernet_neighbor_cache &) -> void = delete;
+
+    /**
+     * @brief returns current snapshot, re-reads the OS table if snapshot is older than the TTL.
+     */
+    [[nodiscard]] auto snapshot() -> std::shared_ptr<const ethernet_neighbor_table>;
+
+    /**
+     * @brief looks up MAC address of a neighbor, a miss re-reads the OS table once the snapshot is
+     * older than the miss refresh interval, as the entry may have been resolved in the meantime.
+     */
+    [[nodiscard]] auto find(const std::string &ip_address) -> std::optional<ethernet_mac_address>;
+
+    /**
+     * @brief forces next lookup to re-read the OS table.
+     */
+    auto invalidate() -> void;
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    static constexpr uint32_t M_TTL_MSEC = 2000;
+    static constexpr uint32_t M_MISS_REFRESH_INTERVAL_MSEC = 100;
+
+    std::mutex m_snapshot_mutex;
+    std::mutex m_refresh_mutex;
+    std::shared_ptr<const ethernet_neighbor_table> m_snapshot = nullptr;
+    clock::time_point m_snapshot_time = {};
+
+    ethernet_neighbor_cache() = default;
+    ~ethernet_neighbor_cache() = default;
+
+    auto current(clock::time_point &snapshot_time)
+        -> std::shared_ptr<const ethernet_neighbor_table>;
+    auto refresh(const uint32_t &max_age_msecs) -> std::shared_ptr<const ethernet_neighbor_table>;
+};
+
+#endif // ETHERNET_NEIGHBOR_CACHE_H
@@ -0,0 +1,199 @@
+#include <communications/ethernet/ethernet_neighbor_discovery.h>
+
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_neighbor_cache.h>
+#include <communications/ethernet/ethernet_tools.h>
+#include <kommpot_core.h>
+
+#include <array>
+#include <chrono>
+#include <random>
+#include <string>
+#include <unordered_set>
+
+#ifndef _WIN32
+#    include <arpa/inet.h>
+#    include <netinet/in.h>
+#    include <poll.h>
+#    include <sys/socket.h>
+#    include <unistd.h>
+#endif
+
+auto ethernet_neighbor_discovery::enumerate(const uint32_t interface_index,
+    const uint32_t timeout_msecs) -> std::vector<ethernet_neighbor_entry>
+{
+    const auto responders = solicit_all_nodes(interface_index, timeout_msecs);
+
+    /**
+     * @attention the responders resolved us while answering, the ND cache has to be re-read.
+     */
+    auto &cache = ethernet_neighbor_cache::instance();
+    cache.invalidate();
+    const auto neighbors = cache.snapshot();
+
+    std::vector<ethernet_neighbor_entry> entries;
+    std::unordered_set<std::string> known_addresses;
+
+    for (const auto &neighbor : neighbors->entries())
+    {
+        if (neighbor.interface_index != interface_index ||
+            dynamic_cast<ethernet_ipv6_address *>(neighbor.ip_address.get()) == nullptr)
+        {
+            continue;
+        }
+
+        if (known_addresses.insert(neighbor.ip_address->to_string()).second)
+        {
+            entries.push_back(neighbor);
+        }
+    }
+
+    const auto cached_count = entries.size();
+
+    for (const auto &responder : responders)
+    {
+        if (known_addresses.insert(responder->to_string()).second)
+        {
+            entries.push_back({responder, ethernet_mac_address(), interface_index});
+        }
+    }
+
+    SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+        "Interface {}: {} echo responder(s), {} IPv6 neighbor(s) cached, {} in total.",
+        interface_index, responders.size(), cached_count, entries.size());
+
+    return entries;
+}
+
+auto ethernet_neighbor_discovery::solicit_all_nodes(const uint32_t interface_index,
+    const uint32_t timeout_msecs) -> std::vector<std::shared_ptr<ethernet_ip_address>>
+{
+#ifdef _WIN32
+
+    /**
+     * @todo ICMPv6 sockets need administrator rights on Windows, only the ND cache is used.
+     */
+    SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+        "Interface {}: ICMPv6 echo is not supported, using ND cache only.", interface_index);
+    return {};
+
+#else
+
+    /**
+     * @brief unprivileged ping sockets are preferred, raw sockets need CAP_NET_RAW.
+     */
+    int handle = socket(AF_INET6, SOCK_DGRAM, IPPROTO_ICMPV6);
+    if (handle < 0)
+    {
+        handle = socket(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6);
+    }
+
+    if (handle < 0)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "Interface {}: ICMPv6 socket() failed with error: {}, using ND cache only.",
+            interface_index, ethernet_tools::get_last_error_code_as_string());
+        return {};
+    }
+
+    const unsigned int multicast_interface = interface_index;
+    const int multicast_hops = 1;
+    const unsigned int multicast_loop = 0;
+
+    if (setsockopt(handle, IPPROTO_IPV6, IPV6_MULTICAST_IF, &multicast_interface,
+            sizeof(multicast_interface)) < 0 ||
+        setsockopt(handle, IPPROTO_IPV6, IPV6_MULTICAST_HOPS, &multicast_hops,
+            sizeof(multicast_hops)) < 0 ||
+        setsockopt(handle, IPPROTO_IPV6, IPV6_MULTICAST_LOOP, &multicast_loop,
+            sizeof(multicast_loop)) < 0)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Interface {}: ICMPv6 setsockopt() failed with error: {}.", interface_index,
+            ethernet_tools::get_last_error_code_as_string());
+        close(handle);
+        return {};
+    }
+
+    sockaddr_in6 destination = {};
+    destination.sin6_family = AF_INET6;
+    destination.sin6_scope_id = interface_index;
+    inet_pton(AF_INET6, "ff02::1", &destination.sin6_addr);
+
+    std::random_device random_device;
+    std::uniform_int_distribution<uint32_t> distribution(0, 0xFFFF);
+    const auto sequence = static_cast<uint16_t>(distribution(random_device));
+
+    /**
+     * @attention checksum is filled in by the kernel, ping sockets also replace the identifier.
+     */
+    const std::array<uint8_t, 8> request = {M_ICMPV6_ECHO_REQUEST, 0, 0, 0, 0, 0,
+        static_cast<uint8_t>(sequence >> 8), static_cast<uint8_t>(sequence & 0xFF)};
+
+    if (sendto(handle, request.data(), request.size(), 0, (const sockaddr *)&destination,
+            sizeof(destination)) < 0)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "Interface {}: ICMPv6 echo request failed with error: {}.", interface_index,
+            ethernet_tools::get_last_error_code_as_string());
+        close(handle);
+        return {};
+    }
+
+    std::vector<std::shared_ptr<ethernet_ip_address>> responders;
+    std::array<uint8_t, M_ECHO_BUFFER_SIZE_BYTES> buffer = {};
+
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_msecs);
+    while (true)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+        {
+            break;
+        }
+
+        const auto remaining_msecs =
+            std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count();
+
+        pollfd descriptor = {};
+        descriptor.fd = handle;
+        descriptor.events = POLLIN;
+
+        if (poll(&descriptor, 1, static_cast<int>(remaining_msecs)) <= 0 ||
+            (descriptor.revents & POLLIN) == 0)
+        {
+            continue;
+        }
+
+        sockaddr_in6 source = {};
+        socklen_t source_size_bytes = sizeof(source);
+        const auto received_size_bytes = recvfrom(
+            handle, buffer.data(), buffer.size(), 0, (sockaddr *)&source, &source_size_bytes);
+
+        /**
+         * @attention raw sockets see every ICMPv6 message of the host, not only the replies.
+         */
+        if (received_size_bytes < static_cast<ssize_t>(request.size()) ||
+            buffer[0] != M_ICMPV6_ECHO_REPLY || buffer[6] != request[6] || buffer[7] != request[7])
+        {
+            continue;
+        }
+
+        auto responder_opt = ethernet_address_factory::from_sockaddr_in((const sockaddr *)&source);
+        if (!responder_opt)
+        {
+            continue;
+        }
+
+        SPDLOG_LOGGER_TRACE(KOMMPOT_LOGGER, "Interface {}: echo reply from {}.", interface_index,
+            (*responder_opt)->to_string());
+
+        responders.push_back(*responder_opt);
+    }
+
+    close(handle);
+
+    return responders;
+
+#endif
+}
@@ -0,0 +1,43 @@
+#ifndef ETHERNET_NEIGHBOR_DISCOVERY_H
+#define ETHERNET_NEIGHBOR_DISCOVERY_H
+
+#pragma once
+
+#include <communications/ethernet/ethernet_address.h>
+#include <communications/ethernet/ethernet_neighbor_table.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief enumerates IPv6 hosts of a link without touching its address space: an echo request to
+ * the all-nodes address ff02::1 makes every live host answer and, by doing so, resolve us via
+ * neighbor discovery, which leaves it in the OS ND cache.
+ */
+class ethernet_neighbor_discovery
+{
+public:
+    /**
+     * @brief solicits all nodes on the interface and collects the IPv6 neighbors seen on it.
+     * @param interface_index states OS index of the interface.
+     * @param timeout_msecs states how long echo replies are collected.
+     * @return neighbors from the ND cache, completed by echo responders the cache does not know
+     * (those have no MAC address).
+     */
+    [[nodiscard]] static auto enumerate(const uint32_t interface_index,
+        const uint32_t timeout_msecs) -> std::vector<ethernet_neighbor_entry>;
+
+private:
+    static constexpr uint8_t M_ICMPV6_ECHO_REQUEST = 128;
+    static constexpr uint8_t M_ICMPV6_ECHO_REPLY = 129;
+    static constexpr size_t M_ECHO_BUFFER_SIZE_BYTES = 1500;
+
+    /**
+     * @return addresses of all hosts that answered, empty if the echo request could not be sent.
+     */
+    static auto solicit_all_nodes(const uint32_t interface_index, const uint32_t timeout_msecs)
+        -> std::vector<std::shared_ptr<ethernet_ip_address>>;
+};
+
+#endif // ETHERNET_NEIGHBOR_DISCOVERY_H
@@ -0,0 +1,434 @@
+#include <communications/ethernet/ethernet_neighbor_table.h>
+
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_tools.h>
+#include <kommpot_core.h>
+
+#ifdef _WIN32
+// clang-format off
+#    include <winsock2.h>
+#    include <ws2tcpip.h>
+#    include <iphlpapi.h>
+#    pragma comment(lib, "iphlpapi.lib")
+// clang-format on
+#else
+#    include <arpa/inet.h>
+#    include <net/route.h>
+#    include <netinet/if_ether.h>
+#    include <netinet/in.h>
+#    include <sys/socket.h>
+
+#    include <unistd.h>
+
+#    ifdef __linux__
+#        include <linux/neighbour.h>
+#        include <linux/netlink.h>
+#        include <linux/rtnetlink.h>
+
+#        include <cstdio>
+#        include <cstring>
+#        include <fstream>
+#        include <sstream>
+#    endif
+
+#    ifdef __APPLE__
+#        include <net/if_dl.h>
+#        include <sys/sysctl.h>
+#    endif
+
+#    ifndef SA_SIZE
+#        define SA_SIZE(sa)                                                                        \
+            (((sa) == NULL)                                                                        \
+                    ? sizeof(long)                                                                 \
+                    : ((sa)->sin_len == 0 ? sizeof(long)                                           \
+                                          : (1 + (((sa)->sin_len - 1) | (sizeof(long) - 1)))))
+#    endif
+
+#endif
+
+auto ethernet_neighbor_table::snapshot() -> ethernet_neighbor_table
+{
+    ethernet_neighbor_table table;
+
+    if (!read_out_entries(table))
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Neighbor table could not be read, using empty one.");
+        return {};
+    }
+
+    SPDLOG_LOGGER_TRACE(
+        KOMMPOT_LOGGER, "Neighbor table contains {} resolved entries.", table.size());
+
+    return table;
+}
+
+auto ethernet_neighbor_table::add(const std::shared_ptr<ethernet_ip_address> &ip_address,
+    const ethernet_mac_address &mac_address, const uint32_t interface_index) -> void
+{
+    if (ip_address == nullptr || mac_address.empty())
+    {
+        return;
+    }
+
+    const auto key = ip_address->to_string();
+
+    const auto it = m_index_by_ip.find(key);
+    if (it != m_index_by_ip.end())
+    {
+        m_entries[it->second].mac_address = mac_address;
+        m_entries[it->second].interface_index = interface_index;
+        return;
+    }
+
+    m_index_by_ip.emplace(key, m_entries.size());
+    m_entries.push_back({ip_address, mac_address, interface_index});
+}
+
+auto ethernet_neighbor_table::find(const std::string &ip_address) const
+    -> std::optional<ethernet_mac_address>
+{
+    const auto it = m_index_by_ip.find(ip_address);
+    if (it == m_index_by_ip.end())
+    {
+        return std::nullopt;
+    }
+
+    return m_entries[it->second].mac_address;
+}
+
+auto ethernet_neighbor_table::entries() const -> const std::vector<ethernet_neighbor_entry> &
+{
+    return m_entries;
+}
+
+auto ethernet_neighbor_table::size() const -> size_t
+{
+    return m_entries.size();
+}
+
+auto ethernet_neighbor_table::empty() const -> bool
+{
+    return m_entries.empty();
+}
+
+auto ethernet_neighbor_table::read_out_entries(ethernet_neighbor_table &table) -> bool
+{
+#ifdef _WIN32
+
+    MIB_IPNET_TABLE2 *rows = nullptr;
+
+    const auto result = GetIpNetTable2(AF_UNSPEC, &rows);
+    if (result != NO_ERROR)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "GetIpNetTable2() failed with error: {} (code {}).",
+            ethernet_tools::get_error_code_as_string(result), result);
+        return false;
+    }
+
+    for (ULONG row_index = 0; row_index < rows->NumEntries; ++row_index)
+    {
+        const auto &row = rows->Table[row_index];
+
+        if (row.State == NlnsUnreachable || row.State == NlnsIncomplete ||
+            row.PhysicalAddressLength != 6)
+        {
+            continue;
+        }
+
+        auto ip_address_opt =
+            ethernet_address_factory::from_sockaddr_in((const sockaddr *)&row.Address);
+        auto mac_address_opt =
+            ethernet_address_factory::from_array(row.PhysicalAddress, row.PhysicalAddressLength);
+        if (!ip_address_opt || !mac_address_opt)
+        {
+            continue;
+        }
+
+        table.add(*ip_address_opt, *mac_address_opt, row.InterfaceIndex);
+    }
+
+    FreeMibTable(rows);
+
+    return true;
+
+#elif defined __linux__
+
+    /**
+     * @attention /proc/net/arp is kept as fallback for environments where rtnetlink is filtered.
+     */
+    if (read_out_netlink_entries(table))
+    {
+        return true;
+    }
+
+    return read_out_arp_entries(table);
+
+#elif defined __APPLE__
+
+    constexpr const uint8_t name_size_bytes = 6;
+
+    int name[name_size_bytes] = {};
+    name[0] = CTL_NET;
+    name[1] = PF_ROUTE;
+    name[2] = 0;
+    name[3] = AF_INET;
+    name[4] = NET_RT_FLAGS;
+    name[5] = RTF_LLINFO;
+
+    size_t buffer_size_bytes = 0;
+    if (sysctl(name, name_size_bytes, NULL, &buffer_size_bytes, NULL, 0) == -1)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "sysctl() failed to get size with error: {}.",
+            ethernet_tools::get_last_error_code_as_string());
+        return false;
+    }
+
+    std::vector<char> buffer(buffer_size_bytes);
+    if (sysctl(name, name_size_bytes, buffer.data(), &buffer_size_bytes, NULL, 0) == -1)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "sysctl() failed to get data with error: {}.",
+            ethernet_tools::get_last_error_code_as_string());
+        return false;
+    }
+
+    char *next = buffer.data();
+    char *end = buffer.data() + buffer_size_bytes;
+
+    while (next < end)
+    {
+        struct rt_msghdr *rtm = (struct rt_msghdr *)next;
+        struct sockaddr_inarp *sin = (struct sockaddr_inarp *)(rtm + 1);
+        struct sockaddr_dl *sdl = (struct sockaddr_dl *)((char *)sin + SA_SIZE(sin));
+
+        next += rtm->rtm_msglen;
+
+        if (sdl->sdl_alen != 6)
+        {
+            continue;
+        }
+
+        auto ip_address_opt = ethernet_address_factory::from_sockaddr_in((const sockaddr *)sin);
+        auto mac_address_opt =
+            ethernet_address_factory::from_array((const uint8_t *)LLADDR(sdl), sdl->sdl_alen);
+        if (!ip_address_opt || !mac_address_opt)
+        {
+            continue;
+        }
+
+        table.add(*ip_address_opt, *mac_address_opt, sdl->sdl_index);
+    }
+
+    return true;
+
+#else
+    return false;
+#endif
+}
+
+#ifdef __linux__
+auto ethernet_neighbor_table::read_out_netlink_entries(ethernet_neighbor_table &table) -> bool
+{
+    const int handle = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (handle < 0)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Netlink socket() failed with error: {}.",
+            ethernet_tools::get_last_error_code_as_string());
+        return false;
+    }
+
+    /**
+     * @brief dumps IPv4 and IPv6 neighbors of all interfaces with a single RTM_GETNEIGH request.
+     */
+    struct
+    {
+        nlmsghdr header;
+        ndmsg message;
+    } request = {};
+
+    request.header.nlmsg_len = NLMSG_LENGTH(sizeof(ndmsg));
+    request.header.nlmsg_type = RTM_GETNEIGH;
+    request.header.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    request.header.nlmsg_seq = 1;
+    request.message.ndm_family = AF_UNSPEC;
+
+    sockaddr_nl kernel_address = {};
+    kernel_address.nl_family = AF_NETLINK;
+
+    if (sendto(handle, &request, request.header.nlmsg_len, 0, (const sockaddr *)&kernel_address,
+            sizeof(kernel_address)) < 0)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Netlink sendto() failed with error: {}.",
+            ethernet_tools::get_last_error_code_as_string());
+        close(handle);
+        return false;
+    }
+
+    std::vector<uint8_t> buffer(M_NETLINK_BUFFER_SIZE_BYTES);
+
+    bool is_done = false;
+    bool is_failed = false;
+    while (!is_done && !is_failed)
+    {
+        const auto received_size_bytes = recv(handle, buffer.data(), buffer.size(), 0);
+        if (received_size_bytes <= 0)
+        {
+            SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Netlink recv() failed with error: {}.",
+                ethernet_tools::get_last_error_code_as_string());
+            is_failed = true;
+            break;
+        }
+
+        int remaining_size_bytes = static_cast<int>(received_size_bytes);
+        for (auto *header = reinterpret_cast<nlmsghdr *>(buffer.data());
+            NLMSG_OK(header, remaining_size_bytes);
+            header = NLMSG_NEXT(header, remaining_size_bytes))
+        {
+            if (header->nlmsg_type == NLMSG_DONE)
+            {
+                is_done = true;
+                break;
+            }
+
+            if (header->nlmsg_type == NLMSG_ERROR)
+            {
+                is_failed = true;
+                break;
+            }
+
+            if (header->nlmsg_type != RTM_NEWNEIGH)
+            {
+                continue;
+            }
+
+            const auto *message = reinterpret_cast<const ndmsg *>(NLMSG_DATA(header));
+
+            /**
+             * @attention incomplete and failed entries carry no usable link-layer address.
+             */
+            if ((message->ndm_state & (NUD_INCOMPLETE | NUD_FAILED)) != 0 ||
+                message->ndm_state == NUD_NONE)
+            {
+                continue;
+            }
+
+            sockaddr_storage ip_address = {};
+            const uint8_t *mac_address_bytes = nullptr;
+            size_t mac_address_size_bytes = 0;
+
+            /**
+             * @attention NDA_RTA()/NDA_PAYLOAD() are not part of the userspace headers.
+             */
+            int attribute_size_bytes = static_cast<int>(NLMSG_PAYLOAD(header, sizeof(ndmsg)));
+            for (auto *attribute = reinterpret_cast<const rtattr *>(
+                     reinterpret_cast<const char *>(message) + NLMSG_ALIGN(sizeof(ndmsg)));
+                RTA_OK(attribute, attribute_size_bytes);
+                attribute = RTA_NEXT(attribute, attribute_size_bytes))
+            {
+                if (attribute->rta_type == NDA_DST && message->ndm_family == AF_INET &&
+                    RTA_PAYLOAD(attribute) == sizeof(in_addr))
+                {
+                    auto *ipv4 = reinterpret_cast<sockaddr_in *>(&ip_address);
+                    ipv4->sin_family = AF_INET;
+                    std::memcpy(&ipv4->sin_addr, RTA_DATA(attribute), sizeof(in_addr));
+                }
+                else if (attribute->rta_type == NDA_DST && message->ndm_family == AF_INET6 &&
+                         RTA_PAYLOAD(attribute) == sizeof(in6_addr))
+                {
+                    auto *ipv6 = reinterpret_cast<sockaddr_in6 *>(&ip_address);
+                    ipv6->sin6_family = AF_INET6;
+                    std::memcpy(&ipv6->sin6_addr, RTA_DATA(attribute), sizeof(in6_addr));
+
+                    if (IN6_IS_ADDR_LINKLOCAL(&ipv6->sin6_addr))
+                    {
+                        ipv6->sin6_scope_id = static_cast<uint32_t>(message->ndm_ifindex);
+                    }
+                }
+                else if (attribute->rta_type == NDA_LLADDR)
+                {
+                    mac_address_bytes = reinterpret_cast<const uint8_t *>(RTA_DATA(attribute));
+                    mac_address_size_bytes = RTA_PAYLOAD(attribute);
+                }
+            }
+
+            if (ip_address.ss_family == AF_UNSPEC || mac_address_bytes == nullptr ||
+                mac_address_size_bytes != 6)
+            {
+                continue;
+            }
+
+            auto ip_address_opt =
+                ethernet_address_factory::from_sockaddr_in((const sockaddr *)&ip_address);
+            auto mac_address_opt =
+                ethernet_address_factory::from_array(mac_address_bytes, mac_address_size_bytes);
+            if (!ip_address_opt || !mac_address_opt)
+            {
+                continue;
+            }
+
+            table.add(*ip_address_opt, *mac_address_opt,
+                static_cast<uint32_t>(message->ndm_ifindex));
+        }
+    }
+
+    close(handle);
+
+    return is_done;
+}
+
+auto ethernet_neighbor_table::read_out_arp_entries(ethernet_neighbor_table &table) -> bool
+{
+    /**
+     * @attention /proc/net/arp lists IPv4 neighbors only, flag ATF_COM (0x2) marks entries with a
+     * resolved MAC address.
+     */
+    std::ifstream arp_table("/proc/net/arp");
+    if (!arp_table.is_open())
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Failed to open /proc/net/arp.");
+        return false;
+    }
+
+    std::string line;
+    // Skip the header line.
+    std::getline(arp_table, line);
+
+    while (std::getline(arp_table, line))
+    {
+        std::istringstream stream(line);
+        std::string ip_string;
+        std::string hardware_type;
+        std::string flags_string;
+        std::string mac_string;
+        if (!(stream >> ip_string >> hardware_type >> flags_string >> mac_string))
+        {
+            continue;
+        }
+
+        const auto flags = std::strtoul(flags_string.c_str(), nullptr, 16);
+        if ((flags & ATF_COM) == 0)
+        {
+            continue;
+        }
+
+        uint8_t mac_address_bytes[6] = {0};
+        if (std::sscanf(mac_string.c_str(), "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx", &mac_address_bytes[0],
+                &mac_address_bytes[1], &mac_address_bytes[2], &mac_address_bytes[3],
+                &mac_address_bytes[4], &mac_address_bytes[5]) != 6)
+        {
+            continue;
+        }
+
+        auto ip_address_opt = ethernet_address_factory::from_string(ip_string);
+        auto mac_address_opt =
+            ethernet_address_factory::from_array(mac_address_bytes, sizeof(mac_address_bytes));
+        if (!ip_address_opt || !mac_address_opt)
+        {
+            continue;
+        }
+
+        table.add(*ip_address_opt, *mac_address_opt);
+    }
+
+    return true;
+}
+#endif
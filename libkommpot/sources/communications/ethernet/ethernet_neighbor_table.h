@@ -0,0 +1,63 @@
+#ifndef ETHERNET_NEIGHBOR_TABLE_H
+#define ETHERNET_NEIGHBOR_TABLE_H
+
+#pragma once
+
+#include <communications/ethernet/ethernet_address.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct ethernet_neighbor_entry
+{
+    std::shared_ptr<ethernet_ip_address> ip_address = nullptr;
+    ethernet_mac_address mac_address;
+
+    /**
+     * @brief OS index of the interface the neighbor was seen on, 0 if unknown.
+     */
+    uint32_t interface_index = 0;
+};
+
+/**
+ * @brief snapshot of the OS neighbor table (ARP for IPv4, ND for IPv6), containing only entries
+ * with a resolved link-layer address.
+ */
+class ethernet_neighbor_table
+{
+public:
+    /**
+     * @brief reads the OS neighbor table once.
+     * @return snapshot, empty if the table could not be read.
+     */
+    [[nodiscard]] static auto snapshot() -> ethernet_neighbor_table;
+
+    auto add(const std::shared_ptr<ethernet_ip_address> &ip_address,
+        const ethernet_mac_address &mac_address, const uint32_t interface_index = 0) -> void;
+
+    [[nodiscard]] auto find(const std::string &ip_address) const
+        -> std::optional<ethernet_mac_address>;
+
+    [[nodiscard]] auto entries() const -> const std::vector<ethernet_neighbor_entry> &;
+    [[nodiscard]] auto size() const -> size_t;
+    [[nodiscard]] auto empty() const -> bool;
+
+private:
+    static constexpr size_t M_NETLINK_BUFFER_SIZE_BYTES = 32 * 1024;
+
+    std::vector<ethernet_neighbor_entry> m_entries;
+    std::unordered_map<std::string, size_t> m_index_by_ip;
+
+    static auto read_out_entries(ethernet_neighbor_table &table) -> bool;
+
+#ifdef __linux__
+    static auto read_out_netlink_entries(ethernet_neighbor_table &table) -> bool;
+    static auto read_out_arp_entries(ethernet_neighbor_table &table) -> bool;
+#endif
+};
+
+#endif // ETHERNET_NEIGHBOR_TABLE_H
@@ -0,0 +1,495 @@
+#include <communications/ethernet/ethernet_packet_ring.h>
+
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_tools.h>
+#include <kommpot_core.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+#ifdef __linux__
+#    include <linux/filter.h>
+#    include <linux/if_ether.h>
+#    include <linux/if_packet.h>
+#    include <net/if.h>
+#    include <poll.h>
+#    include <sys/ioctl.h>
+#    include <sys/mman.h>
+#    include <sys/socket.h>
+#    include <unistd.h>
+#endif
+
+#ifdef __linux__
+
+namespace
+{
+    /**
+     * @brief offset of the frame data in a transmit ring slot, the kernel expects it right behind
+     * the aligned slot header when PACKET_TX_HAS_OFF is not set.
+     */
+    constexpr size_t M_TX_DATA_OFFSET = TPACKET_ALIGN(sizeof(tpacket3_hdr));
+
+    auto load_acquire(const uint32_t *value) -> uint32_t
+    {
+        return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+    }
+
+    auto store_release(uint32_t *value, const uint32_t new_value) -> void
+    {
+        __atomic_store_n(value, new_value, __ATOMIC_RELEASE);
+    }
+
+    /**
+     * @brief classic BPF program accepting frames of ether_type and, with a peer, only those whose
+     * source address is the peer's.
+     */
+    auto create_filter(const uint16_t ether_type, const std::optional<ethernet_mac_address> &peer)
+        -> std::vector<sock_filter>
+    {
+        std::vector<sock_filter> program;
+        std::vector<size_t> drop_jumps;
+
+        auto add_compare = [&program, &drop_jumps](
+                               const uint16_t size, const uint32_t offset, const uint32_t value) {
+            program.push_back(BPF_STMT(BPF_LD | size | BPF_ABS, offset));
+            drop_jumps.push_back(program.size());
+            program.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, value, 0, 0));
+        };
+
+        add_compare(BPF_H, 12, ether_type);
+
+        if (peer)
+        {
+            const auto *mac = peer->data();
+            add_compare(BPF_W, 6,
+                (static_cast<uint32_t>(mac[0]) << 24) | (static_cast<uint32_t>(mac[1]) << 16) |
+                    (static_cast<uint32_t>(mac[2]) << 8) | mac[3]);
+            add_compare(BPF_H, 10, (static_cast<uint32_t>(mac[4]) << 8) | mac[5]);
+        }
+
+        program.push_back(BPF_STMT(BPF_RET | BPF_K, 0x40000));
+        program.push_back(BPF_STMT(BPF_RET | BPF_K, 0));
+
+        const auto drop_index = program.size() - 1;
+        for (const auto jump : drop_jumps)
+        {
+            program[jump].jf = static_cast<uint8_t>(drop_index - jump - 1);
+        }
+
+        return program;
+    }
+} // namespace
+
+#endif
+
+ethernet_packet_ring::~ethernet_packet_ring()
+{
+#ifdef __linux__
+    if (m_address != nullptr)
+    {
+        munmap(m_address, m_size_bytes);
+    }
+
+    if (m_handle >= 0)
+    {
+        ::close(m_handle);
+    }
+#endif
+}
+
+auto ethernet_packet_ring::create(const std::string &interface_name, const uint16_t &ether_type,
+    const std::optional<ethernet_mac_address> &peer) -> std::shared_ptr<ethernet_packet_ring>
+{
+#ifdef __linux__
+    if (ether_type < ETH_P_802_3_MIN)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Packet ring: EtherType 0x{:04X} is a length, at least 0x{:04X} is required.",
+            ether_type, ETH_P_802_3_MIN);
+        return nullptr;
+    }
+
+    const auto interface_index = if_nametoindex(interface_name.c_str());
+    if (interface_index == 0)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Packet ring: interface {} not found.", interface_name);
+        return nullptr;
+    }
+
+    std::shared_ptr<ethernet_packet_ring> ring(new ethernet_packet_ring());
+    ring->m_ether_type = ether_type;
+    ring->m_interface_index = interface_index;
+
+    /**
+     * @attention the socket is created for no protocol, so it receives nothing until it is bound
+     * with the filter attached.
+     */
+    ring->m_handle = socket(AF_PACKET, SOCK_RAW, 0);
+    if (ring->m_handle < 0)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Packet ring: socket not created due to error: {}.",
+            ethernet_tools::get_last_error_code_as_string());
+        return nullptr;
+    }
+    ring->m_native_handle = static_cast<uint64_t>(ring->m_handle);
+
+    ifreq request = {};
+    std::strncpy(request.ifr_name, interface_name.c_str(), IFNAMSIZ - 1);
+    if (ioctl(ring->m_handle, SIOCGIFHWADDR, &request) != 0)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Packet ring: failed to read MAC address of {} due to error: {}.", interface_name,
+            ethernet_tools::get_last_error_code_as_string());
+        return nullptr;
+    }
+
+    auto mac_address_opt = ethernet_address_factory::from_array(
+        reinterpret_cast<const uint8_t *>(request.ifr_hwaddr.sa_data), ETH_ALEN);
+    if (!mac_address_opt)
+    {
+        return nullptr;
+    }
+    ring->m_mac_address = *mac_address_opt;
+
+    if (ioctl(ring->m_handle, SIOCGIFMTU, &request) != 0)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Packet ring: failed to read MTU of {} due to error: {}.", interface_name,
+            ethernet_tools::get_last_error_code_as_string());
+        return nullptr;
+    }
+    ring->m_max_payload_size_bytes = std::min<size_t>(static_cast<size_t>(request.ifr_mtu),
+        M_FRAME_SIZE_BYTES - M_TX_DATA_OFFSET - M_HEADER_SIZE_BYTES);
+
+    const int version = TPACKET_V3;
+    if (setsockopt(ring->m_handle, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) != 0)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Packet ring: TPACKET_V3 not supported due to error: {}.",
+            ethernet_tools::get_last_error_code_as_string());
+        return nullptr;
+    }
+
+    tpacket_req3 rx_request = {};
+    rx_request.tp_block_size = M_BLOCK_SIZE_BYTES;
+    rx_request.tp_block_nr = M_RX_BLOCK_COUNT;
+    rx_request.tp_frame_size = M_FRAME_SIZE_BYTES;
+    rx_request.tp_frame_nr = M_BLOCK_SIZE_BYTES / M_FRAME_SIZE_BYTES * M_RX_BLOCK_COUNT;
+    rx_request.tp_retire_blk_tov = M_BLOCK_TIMEOUT_MSEC;
+
+    /**
+     * @attention the transmit ring takes fixed size frames, block timeout and private area have
+     * to stay zero.
+     */
+    tpacket_req3 tx_request = {};
+    tx_request.tp_block_size = M_BLOCK_SIZE_BYTES;
+    tx_request.tp_block_nr = M_TX_BLOCK_COUNT;
+    tx_request.tp_frame_size = M_FRAME_SIZE_BYTES;
+    tx_request.tp_frame_nr = M_BLOCK_SIZE_BYTES / M_FRAME_SIZE_BYTES * M_TX_BLOCK_COUNT;
+
+    if (setsockopt(ring->m_handle, SOL_PACKET, PACKET_RX_RING, &rx_request,
+            sizeof(rx_request)) != 0 ||
+        setsockopt(ring->m_handle, SOL_PACKET, PACKET_TX_RING, &tx_request,
+            sizeof(tx_request)) != 0)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Packet ring: rings not set up due to error: {}.",
+            ethernet_tools::get_last_error_code_as_string());
+        return nullptr;
+    }
+
+    /**
+     * @attention one mapping covers both rings, the receive ring comes first.
+     */
+    ring->m_size_bytes = M_BLOCK_SIZE_BYTES * (M_RX_BLOCK_COUNT + M_TX_BLOCK_COUNT);
+    auto *address = mmap(
+        nullptr, ring->m_size_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, ring->m_handle, 0);
+    if (address == MAP_FAILED)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Packet ring: rings not mapped due to error: {}.",
+            ethernet_tools::get_last_error_code_as_string());
+        return nullptr;
+    }
+    ring->m_address = static_cast<uint8_t *>(address);
+    ring->m_tx_address = ring->m_address + M_BLOCK_SIZE_BYTES * M_RX_BLOCK_COUNT;
+    ring->m_tx_frame_count = tx_request.tp_frame_nr;
+
+    auto filter = create_filter(ether_type, peer);
+    sock_fprog program = {};
+    program.len = static_cast<unsigned short>(filter.size());
+    program.filter = filter.data();
+    if (setsockopt(ring->m_handle, SOL_SOCKET, SO_ATTACH_FILTER, &program, sizeof(program)) != 0)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Packet ring: filter not attached due to error: {}.",
+            ethernet_tools::get_last_error_code_as_string());
+        return nullptr;
+    }
+
+    sockaddr_ll address_ll = {};
+    address_ll.sll_family = AF_PACKET;
+    address_ll.sll_protocol = htons(ether_type);
+    address_ll.sll_ifindex = static_cast<int>(interface_index);
+    if (bind(ring->m_handle, reinterpret_cast<const sockaddr *>(&address_ll),
+            sizeof(address_ll)) != 0)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Packet ring: not bound to interface {} due to error: {}.", interface_name,
+            ethernet_tools::get_last_error_code_as_string());
+        return nullptr;
+    }
+
+    if (peer)
+    {
+        std::memcpy(ring->m_destination.data(), peer->data(), ring->m_destination.size());
+    }
+    else
+    {
+        ring->m_destination.fill(0xFF);
+    }
+
+    SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+        "Packet ring: EtherType 0x{:04X} on {} ({}), peer {}.", ether_type, interface_name,
+        ring->m_mac_address.to_string(), peer ? peer->to_string() : "any");
+
+    return ring;
+#else
+    return nullptr;
+#endif
+}
+
+auto ethernet_packet_ring::read_messages(std::vector<kommpot::message_buffer> &messages,
+    size_t &received_count, const uint32_t &timeout_msecs) -> bool
+{
+    received_count = 0;
+
+#ifdef __linux__
+    if (messages.empty())
+    {
+        return false;
+    }
+
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_msecs);
+    while (next_frame() == nullptr)
+    {
+        const auto remaining_msecs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now())
+                                         .count();
+        if (remaining_msecs <= 0 || !wait(POLLIN, static_cast<uint32_t>(remaining_msecs)))
+        {
+            return false;
+        }
+    }
+
+    uint8_t *frame = nullptr;
+    while (received_count < messages.size() && (frame = next_frame()) != nullptr)
+    {
+        const auto *header = reinterpret_cast<const tpacket3_hdr *>(frame);
+        if (header->tp_snaplen < M_HEADER_SIZE_BYTES)
+        {
+            consume_frame();
+            continue;
+        }
+
+        const auto *payload = frame + header->tp_mac + M_HEADER_SIZE_BYTES;
+        const auto payload_size_bytes = header->tp_snaplen - M_HEADER_SIZE_BYTES;
+
+        auto &message = messages[received_count++];
+        message.received_size_bytes = std::min(message.size_bytes, payload_size_bytes);
+        message.is_truncated =
+            payload_size_bytes > message.size_bytes || header->tp_len > header->tp_snaplen;
+        std::memcpy(message.data, payload, message.received_size_bytes);
+
+        consume_frame();
+    }
+
+    return received_count > 0;
+#else
+    return false;
+#endif
+}
+
+auto ethernet_packet_ring::write_messages(
+    const std::vector<kommpot::message_buffer> &messages, const uint32_t &timeout_msecs) -> bool
+{
+#ifdef __linux__
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_msecs);
+
+    for (const auto &message : messages)
+    {
+        if (message.size_bytes > m_max_payload_size_bytes)
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+                "Packet ring: payload of {} bytes exceeds the maximum of {} bytes.",
+                message.size_bytes, m_max_payload_size_bytes);
+            return false;
+        }
+
+        auto *frame = m_tx_address + m_tx_frame * M_FRAME_SIZE_BYTES;
+        auto *header = reinterpret_cast<tpacket3_hdr *>(frame);
+
+        /**
+         * @attention a slot is busy while the kernel still sends it, a full ring is sent first.
+         */
+        auto status = load_acquire(&header->tp_status);
+        while (status != TP_STATUS_AVAILABLE)
+        {
+            if ((status & TP_STATUS_WRONG_FORMAT) != 0)
+            {
+                SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Packet ring: kernel rejected a frame.");
+                store_release(&header->tp_status, TP_STATUS_AVAILABLE);
+                return false;
+            }
+
+            const auto remaining_msecs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now())
+                                             .count();
+            if (remaining_msecs <= 0 || !flush(true))
+            {
+                return false;
+            }
+
+            status = load_acquire(&header->tp_status);
+            if (status != TP_STATUS_AVAILABLE &&
+                !wait(POLLOUT, static_cast<uint32_t>(remaining_msecs)))
+            {
+                return false;
+            }
+            status = load_acquire(&header->tp_status);
+        }
+
+        auto *data = frame + M_TX_DATA_OFFSET;
+        std::memcpy(data, m_destination.data(), m_destination.size());
+        std::memcpy(data + ETH_ALEN, m_mac_address.data(), ETH_ALEN);
+        data[2 * ETH_ALEN] = static_cast<uint8_t>(m_ether_type >> 8);
+        data[2 * ETH_ALEN + 1] = static_cast<uint8_t>(m_ether_type & 0xFF);
+        if (message.size_bytes > 0)
+        {
+            std::memcpy(data + M_HEADER_SIZE_BYTES, message.data, message.size_bytes);
+        }
+
+        header->tp_len = static_cast<uint32_t>(M_HEADER_SIZE_BYTES + message.size_bytes);
+        header->tp_snaplen = header->tp_len;
+        header->tp_next_offset = 0;
+        store_release(&header->tp_status, TP_STATUS_SEND_REQUEST);
+
+        m_tx_frame = (m_tx_frame + 1) % m_tx_frame_count;
+    }
+
+    return flush(false);
+#else
+    return false;
+#endif
+}
+
+auto ethernet_packet_ring::mac_address() const -> const ethernet_mac_address &
+{
+    return m_mac_address;
+}
+
+auto ethernet_packet_ring::interface_index() const -> uint32_t
+{
+    return m_interface_index;
+}
+
+auto ethernet_packet_ring::max_payload_size() const -> size_t
+{
+    return m_max_payload_size_bytes;
+}
+
+auto ethernet_packet_ring::native_handle() const -> void *
+{
+    return (void *)(&m_native_handle);
+}
+
+auto ethernet_packet_ring::next_frame() -> uint8_t *
+{
+#ifdef __linux__
+    while (m_rx_remaining_frames == 0)
+    {
+        auto *block =
+            reinterpret_cast<tpacket_block_desc *>(m_address + m_rx_block * M_BLOCK_SIZE_BYTES);
+        if ((load_acquire(&block->hdr.bh1.block_status) & TP_STATUS_USER) == 0)
+        {
+            return nullptr;
+        }
+
+        if (block->hdr.bh1.num_pkts == 0)
+        {
+            store_release(&block->hdr.bh1.block_status, TP_STATUS_KERNEL);
+            m_rx_block = (m_rx_block + 1) % M_RX_BLOCK_COUNT;
+            continue;
+        }
+
+        m_rx_remaining_frames = block->hdr.bh1.num_pkts;
+        m_rx_frame = reinterpret_cast<uint8_t *>(block) + block->hdr.bh1.offset_to_first_pkt;
+    }
+
+    return m_rx_frame;
+#else
+    return nullptr;
+#endif
+}
+
+auto ethernet_packet_ring::consume_frame() -> void
+{
+#ifdef __linux__
+    if (--m_rx_remaining_frames > 0)
+    {
+        m_rx_frame += reinterpret_cast<const tpacket3_hdr *>(m_rx_frame)->tp_next_offset;
+        return;
+    }
+
+    /**
+     * @attention the whole block goes back to the kernel once its last frame was read.
+     */
+    auto *block =
+        reinterpret_cast<tpacket_block_desc *>(m_address + m_rx_block * M_BLOCK_SIZE_BYTES);
+    store_release(&block->hdr.bh1.block_status, TP_STATUS_KERNEL);
+    m_rx_block = (m_rx_block + 1) % M_RX_BLOCK_COUNT;
+    m_rx_frame = nullptr;
+#endif
+}
+
+auto ethernet_packet_ring::wait(const short events, const uint32_t &timeout_msecs) -> bool
+{
+#ifdef __linux__
+    pollfd descriptor = {};
+    descriptor.fd = m_handle;
+    descriptor.events = events;
+
+    const auto result = poll(&descriptor, 1, static_cast<int>(timeout_msecs));
+    if (result < 0 && errno != EINTR)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Packet ring: poll failed due to error: {}.",
+            ethernet_tools::get_last_error_code_as_string());
+        return false;
+    }
+
+    return result > 0 || (result < 0 && errno == EINTR);
+#else
+    return false;
+#endif
+}
+
+auto ethernet_packet_ring::flush(const bool is_waiting) -> bool
+{
+#ifdef __linux__
+    /**
+     * @attention the kernel hands every queued frame to the driver within the call either way,
+     * waiting only covers frames the driver has not released yet.
+     */
+    if (send(m_handle, nullptr, 0, is_waiting ? 0 : MSG_DONTWAIT) < 0 && errno != EAGAIN)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Packet ring: frames not sent due to error: {}.",
+            ethernet_tools::get_last_error_code_as_string());
+        return false;
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
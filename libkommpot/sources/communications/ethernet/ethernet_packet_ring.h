@@ -0,0 +1,111 @@
+#ifndef ETHERNET_PACKET_RING_H
+#define ETHERNET_PACKET_RING_H
+
+#pragma once
+
+#include <communications/ethernet/ethernet_address.h>
+#include <libkommpot.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief AF_PACKET socket exchanging Ethernet frames of one EtherType on one interface through
+ * memory-mapped TPACKET_V3 rings. The kernel fills whole blocks of received frames and sends
+ * every frame queued in the transmit ring with a single send().
+ * @attention a BPF filter attached before binding drops frames of other EtherTypes and, with a
+ * peer, of other senders in the kernel. Linux only, create() returns nullptr on other OSes.
+ */
+class ethernet_packet_ring
+{
+public:
+    static constexpr size_t M_HEADER_SIZE_BYTES = 14;
+
+    /**
+     * @brief shorter frames are padded by the sender, their payload ends with zeros.
+     */
+    static constexpr size_t M_MIN_PAYLOAD_SIZE_BYTES = 46;
+
+    static constexpr size_t M_BLOCK_SIZE_BYTES = 128 * 1024;
+    static constexpr size_t M_RX_BLOCK_COUNT = 16;
+    static constexpr size_t M_TX_BLOCK_COUNT = 4;
+    static constexpr size_t M_FRAME_SIZE_BYTES = 2048;
+
+    /**
+     * @brief time after which the kernel hands out a block that is not full yet.
+     */
+    static constexpr uint32_t M_BLOCK_TIMEOUT_MSEC = 1;
+
+    ~ethernet_packet_ring();
+
+    ethernet_packet_ring(const ethernet_packet_ring &obj) = delete;
+    auto operator=(const ethernet_packet_ring &obj) -> ethernet_packet_ring & = delete;
+
+    /**
+     * @param peer states the only sender frames are received from and the destination of writes,
+     * std::nullopt receives from every sender and broadcasts writes.
+     */
+    [[nodiscard]] static auto create(const std::string &interface_name, const uint16_t &ether_type,
+        const std::optional<ethernet_mac_address> &peer) -> std::shared_ptr<ethernet_packet_ring>;
+
+    /**
+     * @brief waits for the first frame, then takes further frames already received without
+     * waiting. Messages get the frame payloads without the Ethernet header.
+     * @return false on timeout or error.
+     */
+    [[nodiscard]] auto read_messages(std::vector<kommpot::message_buffer> &messages,
+        size_t &received_count, const uint32_t &timeout_msecs) -> bool;
+
+    /**
+     * @brief queues every payload behind an Ethernet header in the transmit ring and sends the
+     * frames with one send() per ring-full, waiting only while the ring is full.
+     */
+    [[nodiscard]] auto write_messages(const std::vector<kommpot::message_buffer> &messages,
+        const uint32_t &timeout_msecs) -> bool;
+
+    [[nodiscard]] auto mac_address() const -> const ethernet_mac_address &;
+    [[nodiscard]] auto interface_index() const -> uint32_t;
+    [[nodiscard]] auto max_payload_size() const -> size_t;
+    [[nodiscard]] auto native_handle() const -> void *;
+
+private:
+    int m_handle = -1;
+
+    /**
+     * @brief handle widened like the one of ethernet_socket, so native_handle() reads the same.
+     */
+    uint64_t m_native_handle = 0;
+    uint16_t m_ether_type = 0;
+    uint32_t m_interface_index = 0;
+    size_t m_max_payload_size_bytes = 0;
+    ethernet_mac_address m_mac_address;
+    std::array<uint8_t, 6> m_destination = {};
+
+    uint8_t *m_address = nullptr;
+    size_t m_size_bytes = 0;
+    uint8_t *m_tx_address = nullptr;
+    size_t m_tx_frame_count = 0;
+
+    /**
+     * @brief receive position: block owned by user space and the next unread frame in it.
+     */
+    size_t m_rx_block = 0;
+    uint8_t *m_rx_frame = nullptr;
+    uint32_t m_rx_remaining_frames = 0;
+
+    size_t m_tx_frame = 0;
+
+    ethernet_packet_ring() = default;
+
+    [[nodiscard]] auto next_frame() -> uint8_t *;
+    auto consume_frame() -> void;
+    [[nodiscard]] auto wait(const short events, const uint32_t &timeout_msecs) -> bool;
+    [[nodiscard]] auto flush(const bool is_waiting) -> bool;
+};
+
+#endif // ETHERNET_PACKET_RING_H
@@ -0,0 +1,37 @@
+#include <communications/ethernet/ethernet_probe_pacer.h>
+
+#include <algorithm>
+#include <thread>
+
+ethernet_probe_pacer::ethernet_probe_pacer(const uint32_t &probes_per_second)
+{
+    if (probes_per_second == 0)
+    {
+        return;
+    }
+
+    m_interval = std::chrono::duration_cast<clock::duration>(std::chrono::seconds(1)) /
+                 probes_per_second;
+}
+
+auto ethernet_probe_pacer::wait() -> void
+{
+    if (m_interval == clock::duration::zero())
+    {
+        return;
+    }
+
+    /**
+     * @attention every caller reserves its own slot under the lock and sleeps outside of it, so
+     * workers do not serialize on the sleep.
+     */
+    clock::time_point slot;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        slot = std::max(clock::now(), m_next_slot);
+        m_next_slot = slot + m_interval;
+    }
+
+    std::this_thread::sleep_until(slot);
+}
@@ -0,0 +1,35 @@
+#ifndef ETHERNET_PROBE_PACER_H
+#define ETHERNET_PROBE_PACER_H
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+/**
+ * @brief spreads probes of all scan workers evenly over time, so a sweep never bursts more than
+ * the configured number of connection attempts per second.
+ */
+class ethernet_probe_pacer
+{
+public:
+    /**
+     * @param probes_per_second states probe rate, 0 disables pacing.
+     */
+    explicit ethernet_probe_pacer(const uint32_t &probes_per_second);
+
+    /**
+     * @brief blocks until the calling worker is allowed to send its next probe.
+     */
+    auto wait() -> void;
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    std::mutex m_mutex;
+    clock::duration m_interval = clock::duration::zero();
+    clock::time_point m_next_slot = {};
+};
+
+#endif // ETHERNET_PROBE_PACER_H
@@ -0,0 +1,116 @@
+#include <communications/ethernet/ethernet_receive_region.h>
+
+#include <communications/ethernet/ethernet_tools.h>
+#include <kommpot_core.h>
+
+#ifdef __linux__
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+ethernet_receive_region::~ethernet_receive_region()
+{
+#ifdef __linux__
+    if (m_address != nullptr)
+    {
+        munmap(m_address, m_size_bytes);
+    }
+#endif
+}
+
+auto ethernet_receive_region::create(const int handle, const size_t &slot_count,
+    const size_t &slot_size_bytes) -> std::shared_ptr<ethernet_receive_region>
+{
+#ifdef __linux__
+    const auto page_size_bytes = page_size();
+    if (slot_count == 0 || slot_size_bytes == 0)
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<ethernet_receive_region> region(new ethernet_receive_region());
+    region->m_slot_size_bytes =
+        (slot_size_bytes + page_size_bytes - 1) / page_size_bytes * page_size_bytes;
+    region->m_size_bytes = region->m_slot_size_bytes * slot_count;
+
+    /**
+     * @attention TCP sockets only accept read-only shared mappings, nothing is mapped until
+     * TCP_ZEROCOPY_RECEIVE inserts received pages.
+     */
+    auto *address = mmap(nullptr, region->m_size_bytes, PROT_READ, MAP_SHARED, handle, 0);
+    if (address == MAP_FAILED)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "Receive region: failed to map socket {} due to error: {}.", handle,
+            ethernet_tools::get_last_error_code_as_string());
+        return nullptr;
+    }
+
+    region->m_address = static_cast<uint8_t *>(address);
+    region->m_is_slot_busy.assign(slot_count, false);
+
+    return region;
+#else
+    return nullptr;
+#endif
+}
+
+auto ethernet_receive_region::page_size() -> size_t
+{
+#ifdef __linux__
+    static const auto value = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return value;
+#else
+    return 4096;
+#endif
+}
+
+auto ethernet_receive_region::acquire() -> std::optional<size_t>
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (size_t slot = 0; slot < m_is_slot_busy.size(); ++slot)
+    {
+        if (!m_is_slot_busy[slot])
+        {
+            m_is_slot_busy[slot] = true;
+            return slot;
+        }
+    }
+
+    return std::nullopt;
+}
+
+auto ethernet_receive_region::release(const size_t &slot, const size_t &mapped_size_bytes) -> void
+{
+#ifdef __linux__
+    if (mapped_size_bytes > 0)
+    {
+        /**
+         * @attention dropping the mapping hands the pages back to the socket, the slot has to be
+         * empty before the next TCP_ZEROCOPY_RECEIVE maps into it.
+         */
+        const auto page_size_bytes = page_size();
+        const auto size_bytes =
+            (mapped_size_bytes + page_size_bytes - 1) / page_size_bytes * page_size_bytes;
+        madvise(slot_address(slot), size_bytes, MADV_DONTNEED);
+    }
+#endif
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (slot < m_is_slot_busy.size())
+    {
+        m_is_slot_busy[slot] = false;
+    }
+}
+
+auto ethernet_receive_region::slot_address(const size_t &slot) const -> uint8_t *
+{
+    return m_address + slot * m_slot_size_bytes;
+}
+
+auto ethernet_receive_region::slot_size() const -> size_t
+{
+    return m_slot_size_bytes;
+}
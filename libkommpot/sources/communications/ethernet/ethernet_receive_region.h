@@ -0,0 +1,64 @@
+#ifndef ETHERNET_RECEIVE_REGION_H
+#define ETHERNET_RECEIVE_REGION_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+/**
+ * @brief address space mmap()ed on a TCP socket, TCP_ZEROCOPY_RECEIVE maps received pages into
+ * its slots. A slot stays acquired until the view of its pages is released.
+ * @attention the mapping holds a reference to the socket file, the connection is only closed
+ * once the region is destroyed. Linux only, create() returns nullptr on other OSes.
+ */
+class ethernet_receive_region
+{
+public:
+    static constexpr size_t M_DEFAULT_SLOT_COUNT = 8;
+    static constexpr size_t M_DEFAULT_SLOT_SIZE_BYTES = 2 * 1024 * 1024;
+
+    ~ethernet_receive_region();
+
+    ethernet_receive_region(const ethernet_receive_region &obj) = delete;
+    auto operator=(const ethernet_receive_region &obj) -> ethernet_receive_region & = delete;
+
+    /**
+     * @param slot_size_bytes is rounded up to whole pages.
+     */
+    [[nodiscard]] static auto create(const int handle,
+        const size_t &slot_count = M_DEFAULT_SLOT_COUNT,
+        const size_t &slot_size_bytes = M_DEFAULT_SLOT_SIZE_BYTES)
+        -> std::shared_ptr<ethernet_receive_region>;
+
+    [[nodiscard]] static auto page_size() -> size_t;
+
+    /**
+     * @return index of a free slot or std::nullopt if views hold all of them.
+     */
+    [[nodiscard]] auto acquire() -> std::optional<size_t>;
+
+    /**
+     * @brief unmaps the pages mapped into the slot and frees it.
+     */
+    auto release(const size_t &slot, const size_t &mapped_size_bytes) -> void;
+
+    [[nodiscard]] auto slot_address(const size_t &slot) const -> uint8_t *;
+    [[nodiscard]] auto slot_size() const -> size_t;
+
+private:
+    uint8_t *m_address = nullptr;
+    size_t m_size_bytes = 0;
+    size_t m_slot_size_bytes = 0;
+
+    std::mutex m_mutex;
+    std::vector<bool> m_is_slot_busy;
+
+    ethernet_receive_region() = default;
+};
+
+#endif // ETHERNET_RECEIVE_REGION_H
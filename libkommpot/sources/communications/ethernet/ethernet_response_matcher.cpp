@@ -0,0 +1,71 @@
+#include <communications/ethernet/ethernet_response_matcher.h>
+
+#include <kommpot_core.h>
+
+#include <algorithm>
+
+ethernet_response_matcher::ethernet_response_matcher(
+    const kommpot::ethernet_probe_configuration &configuration)
+    : m_prefix(configuration.response_prefix), m_callback(configuration.response_callback)
+{
+    if (configuration.response_regex.empty())
+    {
+        return;
+    }
+
+    /**
+     * @attention std::regex reports a malformed expression only by throwing.
+     */
+    try
+    {
+        m_regex = std::regex(configuration.response_regex, std::regex::ECMAScript);
+    }
+    catch (const std::regex_error &error)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Invalid probe response regex '{}': {}",
+            configuration.response_regex, error.what());
+        m_is_valid = false;
+    }
+}
+
+auto ethernet_response_matcher::is_valid() const -> bool
+{
+    return m_is_valid;
+}
+
+auto ethernet_response_matcher::is_match(const std::string &response) const -> bool
+{
+    if (!m_is_valid)
+    {
+        return false;
+    }
+
+    if (response.compare(0, m_prefix.size(), m_prefix) != 0)
+    {
+        return false;
+    }
+
+    if (m_regex && !std::regex_search(response, *m_regex))
+    {
+        return false;
+    }
+
+    if (m_callback && !m_callback(response))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+auto ethernet_response_matcher::is_rejected(const std::string &response) const -> bool
+{
+    if (!m_is_valid)
+    {
+        return true;
+    }
+
+    const auto compared_size_bytes = std::min(response.size(), m_prefix.size());
+
+    return response.compare(0, compared_size_bytes, m_prefix, 0, compared_size_bytes) != 0;
+}
@@ -0,0 +1,41 @@
+#ifndef ETHERNET_RESPONSE_MATCHER_H
+#define ETHERNET_RESPONSE_MATCHER_H
+
+#pragma once
+
+#include <libkommpot.h>
+
+#include <optional>
+#include <regex>
+#include <string>
+
+/**
+ * @brief checks a probe response against the prefix, regular expression and callback of an
+ * ethernet_probe_configuration, the response passes only if all configured matchers accept it.
+ */
+class ethernet_response_matcher
+{
+public:
+    explicit ethernet_response_matcher(const kommpot::ethernet_probe_configuration &configuration);
+
+    /**
+     * @brief states if the regular expression compiled, an invalid matcher accepts nothing.
+     */
+    [[nodiscard]] auto is_valid() const -> bool;
+
+    [[nodiscard]] auto is_match(const std::string &response) const -> bool;
+
+    /**
+     * @brief states that no further data can make the response match, because its beginning
+     * already differs from the prefix.
+     */
+    [[nodiscard]] auto is_rejected(const std::string &response) const -> bool;
+
+private:
+    std::string m_prefix;
+    std::optional<std::regex> m_regex = std::nullopt;
+    kommpot::ethernet_probe_response_callback m_callback = nullptr;
+    bool m_is_valid = true;
+};
+
+#endif // ETHERNET_RESPONSE_MATCHER_H
@@ -0,0 +1,61 @@
+#include <communications/ethernet/ethernet_rtt_estimator.h>
+
+#include <algorithm>
+
+ethernet_rtt_estimator::ethernet_rtt_estimator(const uint32_t &max_timeout_msecs)
+    : m_max_timeout_msecs(max_timeout_msecs)
+{
+    m_samples.reserve(M_MAX_SAMPLES);
+}
+
+auto ethernet_rtt_estimator::add_sample(const uint64_t &rtt_usecs) -> void
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    /**
+     * @attention only the latest samples are kept, so the estimate follows a changing network.
+     */
+    if (m_samples.size() < M_MAX_SAMPLES)
+    {
+        m_samples.push_back(rtt_usecs);
+    }
+    else
+    {
+        m_samples[m_next_sample_index] = rtt_usecs;
+    }
+
+    m_next_sample_index = (m_next_sample_index + 1) % M_MAX_SAMPLES;
+    m_sample_count++;
+}
+
+auto ethernet_rtt_estimator::timeout_msecs(
+    const uint32_t &multiplier, const uint32_t &min_timeout_msecs) const -> uint32_t
+{
+    std::vector<uint64_t> samples;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_samples.size() < M_MIN_SAMPLES)
+        {
+            return m_max_timeout_msecs;
+        }
+
+        samples = m_samples;
+    }
+
+    const size_t percentile_index = (samples.size() - 1) * M_PERCENTILE / 100;
+    std::nth_element(
+        std::begin(samples), std::begin(samples) + percentile_index, std::end(samples));
+
+    const uint64_t timeout_usecs = samples[percentile_index] * multiplier;
+    const uint64_t timeout_msecs = (timeout_usecs + 999) / 1000;
+
+    return static_cast<uint32_t>(std::clamp<uint64_t>(timeout_msecs,
+        std::min(min_timeout_msecs, m_max_timeout_msecs), m_max_timeout_msecs));
+}
+
+auto ethernet_rtt_estimator::sample_count() const -> size_t
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_sample_count;
+}
@@ -0,0 +1,47 @@
+#ifndef ETHERNET_RTT_ESTIMATOR_H
+#define ETHERNET_RTT_ESTIMATOR_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief collects connect round trip times of a network scan and derives the connect timeout for
+ * the remaining probes from them.
+ */
+class ethernet_rtt_estimator
+{
+public:
+    /**
+     * @param max_timeout_msecs states timeout used until enough samples are collected, it also
+     * caps the derived timeout.
+     */
+    explicit ethernet_rtt_estimator(const uint32_t &max_timeout_msecs);
+
+    auto add_sample(const uint64_t &rtt_usecs) -> void;
+
+    /**
+     * @brief calculates multiplier times the 95th percentile of collected RTTs.
+     * @return timeout clamped to [min_timeout_msecs, max_timeout_msecs].
+     */
+    [[nodiscard]] auto timeout_msecs(const uint32_t &multiplier,
+        const uint32_t &min_timeout_msecs) const -> uint32_t;
+
+    [[nodiscard]] auto sample_count() const -> size_t;
+
+private:
+    static constexpr size_t M_MAX_SAMPLES = 256;
+    static constexpr size_t M_MIN_SAMPLES = 3;
+    static constexpr uint32_t M_PERCENTILE = 95;
+
+    mutable std::mutex m_mutex;
+    std::vector<uint64_t> m_samples;
+    size_t m_next_sample_index = 0;
+    size_t m_sample_count = 0;
+    uint32_t m_max_timeout_msecs = 0;
+};
+
+#endif // ETHERNET_RTT_ESTIMATOR_H
@@ -2,9 +2,16 @@
 
 #include <communications/ethernet/ethernet_address_factory.h>
 #include <communications/ethernet/ethernet_context.h>
+#include <communications/ethernet/ethernet_neighbor_cache.h>
+#include <communications/ethernet/ethernet_socket_tuning.h>
 #include <communications/ethernet/ethernet_tools.h>
 #include <kommpot_core.h>
 
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
 #ifdef _WIN32
 // clang-format off
 #    include <winsock2.h>
@@ -15,34 +22,85 @@
 // clang-format on
 #else
 #    include <arpa/inet.h>
-#    include <cerrno>
 #    include <fcntl.h>
-#    include <net/route.h>
-#    include <netdb.h>
-#    include <netinet/if_ether.h>
 #    include <netinet/in.h>
+#    include <netinet/tcp.h>
+#    include <netinet/udp.h>
+#    include <poll.h>
 #    include <sys/socket.h>
 #    include <unistd.h>
+#endif
 
-#    ifdef __linux__
-#        include <cstdio>
-#        include <fstream>
-#        include <sstream>
-#    endif
+#ifdef __linux__
+#    include <ifaddrs.h>
+#    include <linux/errqueue.h>
+#    include <linux/net_tstamp.h>
+#    include <linux/sockios.h>
+#    include <net/if.h>
+#    include <sys/ioctl.h>
+#endif
 
-#    ifdef __APPLE__
-#        include <net/if_dl.h>
-#        include <sys/sysctl.h>
-#    endif
+namespace
+{
+    /**
+     * @brief poll() takes handles of any value, select() only those below FD_SETSIZE.
+     */
+#ifdef _WIN32
+    using poll_descriptor = WSAPOLLFD;
+    using poll_handle = SOCKET;
+#else
+    using poll_descriptor = pollfd;
+    using poll_handle = int;
+#endif
 
-#    ifndef SA_SIZE
-#        define SA_SIZE(sa)                                                                        \
-            (((sa) == NULL)                                                                        \
-                    ? sizeof(long)                                                                 \
-                    : ((sa)->sin_len == 0 ? sizeof(long)                                           \
-                                          : (1 + (((sa)->sin_len - 1) | (sizeof(long) - 1)))))
-#    endif
+    auto poll_handles(std::vector<poll_descriptor> &descriptors, const uint32_t &timeout_msecs)
+        -> int
+    {
+#ifdef _WIN32
+        return WSAPoll(descriptors.data(), static_cast<ULONG>(descriptors.size()),
+            static_cast<INT>(timeout_msecs));
+#else
+        return poll(descriptors.data(), static_cast<nfds_t>(descriptors.size()),
+            static_cast<int>(timeout_msecs));
+#endif
+    }
+} // namespace
+
+#ifdef __linux__
+
+namespace
+{
+    auto to_nsecs(const timespec &value) -> uint64_t
+    {
+        return static_cast<uint64_t>(value.tv_sec) * 1000000000ULL +
+               static_cast<uint64_t>(value.tv_nsec);
+    }
+
+    /**
+     * @brief ts[0] holds the software timestamp and ts[2] the hardware one, unset ones are zero.
+     */
+    auto to_transfer_timestamps(const scm_timestamping &value) -> kommpot::transfer_timestamps
+    {
+        kommpot::transfer_timestamps timestamps;
+
+        if (const auto nsecs = to_nsecs(value.ts[0]); nsecs != 0)
+        {
+            timestamps.software_nsecs = nsecs;
+        }
+
+        if (const auto nsecs = to_nsecs(value.ts[2]); nsecs != 0)
+        {
+            timestamps.hardware_nsecs = nsecs;
+        }
 
+        return timestamps;
+    }
+
+    /**
+     * @brief SOF_TIMESTAMPING_OPT_ID_TCP (Linux 6.2+), older headers do not know it yet.
+     */
+    constexpr uint32_t TIMESTAMPING_OPT_ID_TCP = 1U << 16;
+} // namespace
 #endif
 
 ethernet_socket::ethernet_socket()
@@ -61,6 +119,13 @@ ethernet_socket::~ethernet_socket()
                 static_cast<void *>(this), to_string());
         }
     }
+    else if (m_handle != ETH_INVALID_SOCKET)
+    {
+        /**
+         * @attention connectionless or never connected sockets still own a handle.
+         */
+        close_socket();
+    }
 
     if (KOMMPOT_LOGGER == nullptr)
     {
@@ -71,6 +136,93 @@ ethernet_socket::~ethernet_socket()
         static_cast<void *>(this), to_string());
 }
 
+ethernet_socket::ethernet_socket(ethernet_socket &&obj) noexcept
+    : m_protocol(obj.m_protocol),
+      m_ip_address(std::move(obj.m_ip_address)),
+      m_ip_family(obj.m_ip_family),
+      m_port(obj.m_port),
+      m_handle(std::exchange(obj.m_handle, ETH_INVALID_SOCKET)),
+      m_mac_address(obj.m_mac_address),
+      m_is_connected(std::exchange(obj.m_is_connected, false)),
+      m_connect_timeout_msecs(obj.m_connect_timeout_msecs),
+      m_connect_rtt_usecs(obj.m_connect_rtt_usecs),
+      m_connect_start(obj.m_connect_start),
+      m_is_connect_pending(std::exchange(obj.m_is_connect_pending, false)),
+      m_profile(obj.m_profile),
+      m_is_quick_ack_enabled(obj.m_is_quick_ack_enabled),
+      m_timeout_msecs(obj.m_timeout_msecs),
+      m_is_io_uring_enabled(obj.m_is_io_uring_enabled),
+      m_is_zero_copy_enabled(obj.m_is_zero_copy_enabled),
+      m_zero_copy_threshold_bytes(obj.m_zero_copy_threshold_bytes),
+      m_zero_copy_next_id(obj.m_zero_copy_next_id),
+      m_zero_copy_copied_count(obj.m_zero_copy_copied_count),
+      m_zero_copy_writes(std::exchange(obj.m_zero_copy_writes, {})),
+      m_receive_region(std::move(obj.m_receive_region)),
+      m_receive_pool(std::move(obj.m_receive_pool)),
+      m_zero_copy_mapped_bytes(obj.m_zero_copy_mapped_bytes),
+      m_zero_copy_received_copied_bytes(obj.m_zero_copy_received_copied_bytes),
+      m_is_udp_segmentation_enabled(obj.m_is_udp_segmentation_enabled),
+      m_udp_max_segment_size_bytes(obj.m_udp_max_segment_size_bytes),
+      m_is_udp_gro_enabled(obj.m_is_udp_gro_enabled),
+      m_gro_buffers(std::move(obj.m_gro_buffers)),
+      m_gro_segments(std::exchange(obj.m_gro_segments, {})),
+      m_is_timestamping_enabled(obj.m_is_timestamping_enabled),
+      m_is_hardware_timestamping_enabled(obj.m_is_hardware_timestamping_enabled),
+      m_timestamping_flags(obj.m_timestamping_flags),
+      m_transmit_timestamp_key(obj.m_transmit_timestamp_key),
+      m_transmit_timestamps(obj.m_transmit_timestamps)
+{}
+
+auto ethernet_socket::operator=(ethernet_socket &&obj) noexcept -> ethernet_socket &
+{
+    if (this == &obj)
+    {
+        return *this;
+    }
+
+    if (m_handle != ETH_INVALID_SOCKET)
+    {
+        close_socket();
+    }
+
+    m_protocol = obj.m_protocol;
+    m_ip_address = std::move(obj.m_ip_address);
+    m_ip_family = obj.m_ip_family;
+    m_port = obj.m_port;
+    m_handle = std::exchange(obj.m_handle, ETH_INVALID_SOCKET);
+    m_mac_address = obj.m_mac_address;
+    m_is_connected = std::exchange(obj.m_is_connected, false);
+    m_connect_timeout_msecs = obj.m_connect_timeout_msecs;
+    m_connect_rtt_usecs = obj.m_connect_rtt_usecs;
+    m_connect_start = obj.m_connect_start;
+    m_is_connect_pending = std::exchange(obj.m_is_connect_pending, false);
+    m_profile = obj.m_profile;
+    m_is_quick_ack_enabled = obj.m_is_quick_ack_enabled;
+    m_timeout_msecs = obj.m_timeout_msecs;
+    m_is_io_uring_enabled = obj.m_is_io_uring_enabled;
+    m_is_zero_copy_enabled = obj.m_is_zero_copy_enabled;
+    m_zero_copy_threshold_bytes = obj.m_zero_copy_threshold_bytes;
+    m_zero_copy_next_id = obj.m_zero_copy_next_id;
+    m_zero_copy_copied_count = obj.m_zero_copy_copied_count;
+    m_zero_copy_writes = std::exchange(obj.m_zero_copy_writes, {});
+    m_receive_region = std::move(obj.m_receive_region);
+    m_receive_pool = std::move(obj.m_receive_pool);
+    m_zero_copy_mapped_bytes = obj.m_zero_copy_mapped_bytes;
+    m_zero_copy_received_copied_bytes = obj.m_zero_copy_received_copied_bytes;
+    m_is_udp_segmentation_enabled = obj.m_is_udp_segmentation_enabled;
+    m_udp_max_segment_size_bytes = obj.m_udp_max_segment_size_bytes;
+    m_is_udp_gro_enabled = obj.m_is_udp_gro_enabled;
+    m_gro_buffers = std::move(obj.m_gro_buffers);
+    m_gro_segments = std::exchange(obj.m_gro_segments, {});
+    m_is_timestamping_enabled = obj.m_is_timestamping_enabled;
+    m_is_hardware_timestamping_enabled = obj.m_is_hardware_timestamping_enabled;
+    m_timestamping_flags = obj.m_timestamping_flags;
+    m_transmit_timestamp_key = obj.m_transmit_timestamp_key;
+    m_transmit_timestamps = obj.m_transmit_timestamps;
+
+    return *this;
+}
+
 auto ethernet_socket::initialize(const std::shared_ptr<ethernet_ip_address> ip_address,
     const uint16_t &port, const kommpot::ethernet_protocol_type &protocol) -> const bool
 {
@@ -125,56 +277,90 @@ auto ethernet_socket::connect() -> const bool
         return true;
     }
 
-    sockaddr_in address = {};
-    address.sin_family = m_ip_family;
-    address.sin_port = htons(m_port);
-    inet_pton(m_ip_family, m_ip_address->to_string().c_str(), &address.sin_addr);
+    if (io_uring() != nullptr)
+    {
+        return connect_all({this}).front();
+    }
+
+    if (!begin_connect())
+    {
+        return false;
+    }
+
+    if (m_is_connect_pending && wait_for_connect({this}, m_connect_timeout_msecs).empty())
+    {
+        SPDLOG_LOGGER_TRACE(KOMMPOT_LOGGER, "Socket {} / {}: connect timed out.",
+            static_cast<void *>(this), to_string());
+        m_is_connect_pending = false;
+        close_socket();
+        return false;
+    }
+
+    return end_connect();
+}
+
+auto ethernet_socket::begin_connect() -> const bool
+{
+    sockaddr_storage address = {};
+    socklen_t address_length_bytes = 0;
+    if (!to_sockaddr(address, address_length_bytes))
+    {
+        close_socket();
+        return false;
+    }
 
     /**
      * @attention a blocking connect() ignores SO_SNDTIMEO and stalls for the OS-default timeout
      * (~21s on Windows) on unreachable hosts, which makes network scans hang. When a timeout is
-     * configured we perform a non-blocking connect bounded by select().
+     * configured we perform a non-blocking connect bounded by poll().
      */
-    if (m_timeout_msecs > 0 && !set_blocking(false))
+    if (m_connect_timeout_msecs > 0 && !set_blocking(false))
     {
         close_socket();
         return false;
     }
 
-    const auto result = ::connect(m_handle, (sockaddr *)&address, sizeof(address));
+    m_connect_rtt_usecs = std::nullopt;
+    m_connect_start = std::chrono::steady_clock::now();
+    m_is_connect_pending = false;
+
+    const auto result = ::connect(m_handle, (sockaddr *)&address, address_length_bytes);
     if (result == ETH_SOCKET_ERROR)
     {
 #ifdef _WIN32
-        const bool is_in_progress = (WSAGetLastError() == WSAEWOULDBLOCK);
+        const auto error_code = WSAGetLastError();
+        const bool is_in_progress = (error_code == WSAEWOULDBLOCK);
+        const bool is_refused = (error_code == WSAECONNREFUSED);
 #else
-        const bool is_in_progress = (errno == EINPROGRESS);
+        const auto error_code = errno;
+        const bool is_in_progress = (error_code == EINPROGRESS);
+        const bool is_refused = (error_code == ECONNREFUSED);
 #endif
-        if (m_timeout_msecs == 0 || !is_in_progress)
+        if (m_connect_timeout_msecs == 0 || !is_in_progress)
         {
+            if (is_refused)
+            {
+                store_connect_rtt();
+            }
+
             SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
                 "Socket {} / {}: failed to connect due to error: {}.", static_cast<void *>(this),
-                to_string(), ethernet_tools::get_last_error_code_as_string());
+                to_string(), ethernet_tools::get_error_code_as_string(error_code));
             close_socket();
             return false;
         }
 
-        fd_set write_set;
-        FD_ZERO(&write_set);
-        FD_SET(m_handle, &write_set);
+        m_is_connect_pending = true;
+    }
 
-        timeval timeout = {};
-        timeout.tv_sec = m_timeout_msecs / 1000;
-        timeout.tv_usec = (m_timeout_msecs % 1000) * 1000;
+    return true;
+}
 
-        const auto select_result =
-            select(static_cast<int>(m_handle) + 1, nullptr, &write_set, nullptr, &timeout);
-        if (select_result <= 0)
-        {
-            SPDLOG_LOGGER_TRACE(KOMMPOT_LOGGER, "Socket {} / {}: connect timed out.",
-                static_cast<void *>(this), to_string());
-            close_socket();
-            return false;
-        }
+auto ethernet_socket::end_connect() -> const bool
+{
+    if (m_is_connect_pending)
+    {
+        m_is_connect_pending = false;
 
         int socket_error = 0;
 #ifdef _WIN32
@@ -186,6 +372,15 @@ auto ethernet_socket::connect() -> const bool
                 ETH_SOCKET_ERROR ||
             socket_error != 0)
         {
+#ifdef _WIN32
+            if (socket_error == WSAECONNREFUSED)
+#else
+            if (socket_error == ECONNREFUSED)
+#endif
+            {
+                store_connect_rtt();
+            }
+
             SPDLOG_LOGGER_TRACE(KOMMPOT_LOGGER, "Socket {} / {}: failed to connect.",
                 static_cast<void *>(this), to_string());
             close_socket();
@@ -193,29 +388,29 @@ auto ethernet_socket::connect() -> const bool
         }
     }
 
+    store_connect_rtt();
+
     /**
      * @attention restore blocking mode so read()/write() honour SO_RCVTIMEO/SO_SNDTIMEO.
      */
-    if (m_timeout_msecs > 0 && !set_blocking(true))
+    if (m_connect_timeout_msecs > 0 && !set_blocking(true))
     {
         close_socket();
         return false;
     }
 
-    if (!read_out_hostname(m_hostname))
-    {
-        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Socket {} / {}: failed to read out hostname.",
-            static_cast<void *>(this), to_string());
-        close_socket();
-        return false;
-    }
+    return complete_connect();
+}
 
+auto ethernet_socket::complete_connect() -> const bool
+{
+    /**
+     * @attention peers behind a router or on loopback have no neighbor entry, the connection is
+     * usable regardless, only the MAC address stays empty.
+     */
     if (!read_out_mac_address(m_mac_address))
     {
-        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Socket {} / {}: failed to read out MAC address.",
-            static_cast<void *>(this), to_string());
-        close_socket();
-        return false;
+        m_mac_address = ethernet_mac_address();
     }
 
     SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {} / {}: connected successfully.",
@@ -226,6 +421,161 @@ auto ethernet_socket::connect() -> const bool
     return true;
 }
 
+auto ethernet_socket::is_connect_pending() const -> const bool
+{
+    return m_is_connect_pending;
+}
+
+auto ethernet_socket::wait_for_connect(
+    const std::vector<ethernet_socket *> &sockets, const uint32_t &timeout_msecs)
+    -> std::vector<ethernet_socket *>
+{
+    std::vector<poll_descriptor> descriptors(sockets.size());
+    for (size_t index = 0; index < sockets.size(); ++index)
+    {
+        descriptors[index].fd = static_cast<poll_handle>(sockets[index]->m_handle);
+        descriptors[index].events = POLLOUT;
+    }
+
+    /**
+     * @attention a failed connect is reported as POLLERR / POLLHUP, which are set without asking.
+     */
+    if (poll_handles(descriptors, timeout_msecs) <= 0)
+    {
+        return {};
+    }
+
+    std::vector<ethernet_socket *> ready_sockets;
+    for (size_t index = 0; index < sockets.size(); ++index)
+    {
+        if ((descriptors[index].revents & (POLLOUT | POLLERR | POLLHUP)) != 0)
+        {
+            ready_sockets.push_back(sockets[index]);
+        }
+    }
+
+    return ready_sockets;
+}
+
+auto ethernet_socket::connect_all(const std::vector<ethernet_socket *> &sockets)
+    -> std::vector<bool>
+{
+    std::vector<bool> results(sockets.size(), false);
+
+    auto *ring = ethernet_uring::thread_instance();
+    const bool is_batched = (ring != nullptr) &&
+                            std::all_of(std::begin(sockets), std::end(sockets),
+                                [](const auto *socket) { return socket->m_is_io_uring_enabled; });
+    if (!is_batched)
+    {
+        for (size_t index = 0; index < sockets.size(); ++index)
+        {
+            results[index] = sockets[index]->connect();
+        }
+        return results;
+    }
+
+    std::vector<sockaddr_storage> addresses(sockets.size());
+    std::vector<ethernet_uring::operation> operations;
+    std::vector<size_t> indices;
+    operations.reserve(sockets.size());
+    indices.reserve(sockets.size());
+
+    for (size_t index = 0; index < sockets.size(); ++index)
+    {
+        auto *socket = sockets[index];
+        if (socket->is_connected())
+        {
+            results[index] = true;
+            continue;
+        }
+
+        socklen_t address_length_bytes = 0;
+        if (!socket->to_sockaddr(addresses[index], address_length_bytes))
+        {
+            socket->close_socket();
+            continue;
+        }
+
+        socket->m_connect_rtt_usecs = std::nullopt;
+        socket->m_is_connect_pending = false;
+        socket->m_connect_start = std::chrono::steady_clock::now();
+
+        ethernet_uring::operation operation;
+        operation.type = ethernet_uring::operation_type::CONNECT;
+        operation.handle = static_cast<int>(socket->m_handle);
+        operation.data = &addresses[index];
+        operation.size_bytes = address_length_bytes;
+        operation.timeout_msecs = socket->m_connect_timeout_msecs;
+        operations.push_back(operation);
+        indices.push_back(index);
+    }
+
+    if (!ring->execute(operations))
+    {
+        for (const auto index : indices)
+        {
+            sockets[index]->close_socket();
+        }
+        return results;
+    }
+
+    for (size_t operation_index = 0; operation_index < operations.size(); ++operation_index)
+    {
+        const auto &operation = operations[operation_index];
+        const auto index = indices[operation_index];
+        auto *socket = sockets[index];
+
+        if (operation.result == 0 || operation.result == -ECONNREFUSED)
+        {
+            socket->m_connect_rtt_usecs = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    operation.completion_time - socket->m_connect_start)
+                    .count());
+        }
+
+        if (operation.result != 0)
+        {
+            SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+                "Socket {} / {}: failed to connect due to error: {}.",
+                static_cast<void *>(socket), socket->to_string(),
+                operation.is_timed_out ? std::string("timed out")
+                                       : ethernet_tools::get_error_code_as_string(
+                                             static_cast<int32_t>(-operation.result)));
+            socket->close_socket();
+            continue;
+        }
+
+        results[index] = socket->complete_connect();
+    }
+
+    return results;
+}
+
+auto ethernet_socket::set_fast_open(const bool is_enabled) -> const bool
+{
+#ifdef TCP_FASTOPEN_CONNECT
+    const int value = is_enabled ? 1 : 0;
+
+    const auto result = setsockopt(
+        m_handle, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, (const char *)&value, sizeof(value));
+    if (result == ETH_SOCKET_ERROR)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "Socket {} / {}: setsockopt(TCP_FASTOPEN_CONNECT) failed with error: {}.",
+            static_cast<void *>(this), to_string(),
+            ethernet_tools::get_last_error_code_as_string());
+        return false;
+    }
+
+    return true;
+#else
+    SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {} / {}: TCP Fast Open is not supported.",
+        static_cast<void *>(this), to_string());
+    return !is_enabled;
+#endif
+}
+
 auto ethernet_socket::disconnect() -> const bool
 {
     if (!is_connected())
@@ -243,6 +593,32 @@ auto ethernet_socket::is_connected() const -> const bool
     return m_handle != ETH_INVALID_SOCKET && m_is_connected;
 }
 
+auto ethernet_socket::is_alive() const -> const bool
+{
+    if (!is_connected())
+    {
+        return false;
+    }
+
+    if (!wait_for_readable(0))
+    {
+        return true;
+    }
+
+    /**
+     * @attention a readable socket either has data or has reached EOF/error, peeking tells them
+     * apart without consuming anything.
+     */
+    char byte = 0;
+#ifdef _WIN32
+    const auto result = recv(m_handle, &byte, sizeof(byte), MSG_PEEK);
+#else
+    const auto result = recv(m_handle, &byte, sizeof(byte), MSG_PEEK | MSG_DONTWAIT);
+#endif
+
+    return result > 0;
+}
+
 auto ethernet_socket::read(void *data, size_t size_bytes) const -> const bool
 {
     if (!is_connected())
@@ -267,7 +643,80 @@ auto ethernet_socket::read(void *data, size_t size_bytes) const -> const bool
         return false;
     }
 
+    auto *ring = io_uring();
+
+    /**
+     * @attention a datagram is received as a whole, looping would glue the next one to it.
+     */
+    if (m_protocol == kommpot::ethernet_protocol_type::UDP)
+    {
+#ifdef _WIN32
+        const int flags = 0;
+#else
+        const int flags = MSG_TRUNC;
+#endif
+        int64_t result = 0;
+        if (ring != nullptr)
+        {
+            result = transfer(*ring, ethernet_uring::operation_type::RECEIVE, data, size_bytes,
+                flags, m_timeout_msecs);
+        }
+        else
+        {
+            result = recv(m_handle, static_cast<char *>(data), static_cast<int>(size_bytes), flags);
+            if (result == ETH_SOCKET_ERROR)
+            {
+                SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+                    "Socket {} / {}: failed to read datagram due to error: {}.",
+                    static_cast<const void *>(this), to_string(),
+                    ethernet_tools::get_last_error_code_as_string());
+                return false;
+            }
+        }
+
+        if (result < 0)
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+                "Socket {} / {}: failed to read datagram due to error: {}.",
+                static_cast<const void *>(this), to_string(),
+                ethernet_tools::get_error_code_as_string(static_cast<int32_t>(-result)));
+            return false;
+        }
+        else if (static_cast<size_t>(result) != size_bytes)
+        {
+            SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+                "Socket {} / {}: received datagram of {} bytes instead of {}.",
+                static_cast<const void *>(this), to_string(), result, size_bytes);
+            return false;
+        }
+
+        return true;
+    }
+
     size_t bytes_received = 0;
+    while (bytes_received < size_bytes && ring != nullptr)
+    {
+        const auto result = transfer(*ring, ethernet_uring::operation_type::RECEIVE,
+            static_cast<char *>(data) + bytes_received, size_bytes - bytes_received, MSG_WAITALL,
+            m_timeout_msecs);
+        if (result < 0)
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+                "Socket {} / {}: failed to read data due to error: {}.",
+                static_cast<const void *>(this), to_string(),
+                ethernet_tools::get_error_code_as_string(static_cast<int32_t>(-result)));
+            return false;
+        }
+        else if (result == 0)
+        {
+            SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {} / {}: connection closed by peer.",
+                static_cast<const void *>(this), to_string());
+            return false;
+        }
+
+        bytes_received += static_cast<size_t>(result);
+    }
+
     while (bytes_received < size_bytes)
     {
         const auto result = recv(
@@ -290,6 +739,11 @@ auto ethernet_socket::read(void *data, size_t size_bytes) const -> const bool
         bytes_received += result;
     }
 
+    if (m_is_quick_ack_enabled)
+    {
+        rearm_quick_ack();
+    }
+
     return true;
 }
 
@@ -317,7 +771,26 @@ auto ethernet_socket::write(void *data, size_t size_bytes) const -> const bool
         return false;
     }
 
+    auto *ring = io_uring();
+
     size_t bytes_sent = 0;
+    while (bytes_sent < size_bytes && ring != nullptr)
+    {
+        const auto result = transfer(*ring, ethernet_uring::operation_type::SEND,
+            static_cast<char *>(data) + bytes_sent, size_bytes - bytes_sent, MSG_WAITALL,
+            m_timeout_msecs);
+        if (result < 0)
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+                "Socket {} / {}: failed to write data due to error: {}.",
+                static_cast<const void *>(this), to_string(),
+                ethernet_tools::get_error_code_as_string(static_cast<int32_t>(-result)));
+            return false;
+        }
+
+        bytes_sent += static_cast<size_t>(result);
+    }
+
     while (bytes_sent < size_bytes)
     {
         const auto result = send(
@@ -337,13 +810,106 @@ auto ethernet_socket::write(void *data, size_t size_bytes) const -> const bool
     return true;
 }
 
-auto ethernet_socket::set_timeout(const uint32_t &timeout_msecs) -> const bool
+auto ethernet_socket::read_some(void *data, size_t size_bytes, size_t &received_size_bytes,
+    const uint32_t &timeout_msecs) const -> const bool
 {
-    m_timeout_msecs = timeout_msecs;
+    received_size_bytes = 0;
 
-    /**
-     * @attention please note the difference between Windows and *nix OSes here.
-     */
+    if (!is_connected())
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Socket {} / {}: not connected.",
+            static_cast<const void *>(this), to_string());
+        return false;
+    }
+
+    if (data == nullptr || size_bytes == 0)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Socket {} / {}: read_some() called with empty buffer.",
+            static_cast<const void *>(this), to_string());
+        return false;
+    }
+
+    if (auto *ring = io_uring(); ring != nullptr)
+    {
+        /**
+         * @attention a zero timeout only polls, a linked timeout of 0 would wait without limit.
+         */
+#ifdef _WIN32
+        const int flags = 0;
+#else
+        const int flags = (timeout_msecs == 0) ? MSG_DONTWAIT : 0;
+#endif
+        const auto result = transfer(*ring, ethernet_uring::operation_type::RECEIVE, data,
+            size_bytes, flags, timeout_msecs);
+        if (result == -ETIMEDOUT || result == -EAGAIN)
+        {
+            return false;
+        }
+        else if (result < 0)
+        {
+            SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+                "Socket {} / {}: failed to read data due to error: {}.",
+                static_cast<const void *>(this), to_string(),
+                ethernet_tools::get_error_code_as_string(static_cast<int32_t>(-result)));
+            return false;
+        }
+        else if (result == 0)
+        {
+            SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {} / {}: connection closed by peer.",
+                static_cast<const void *>(this), to_string());
+            return false;
+        }
+
+        received_size_bytes = static_cast<size_t>(result);
+
+        if (m_is_quick_ack_enabled)
+        {
+            rearm_quick_ack();
+        }
+
+        return true;
+    }
+
+    if (!wait_for_readable(timeout_msecs))
+    {
+        return false;
+    }
+
+    const auto result = recv(m_handle, static_cast<char *>(data), static_cast<int>(size_bytes), 0);
+    if (result == ETH_SOCKET_ERROR)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "Socket {} / {}: failed to read data due to error: {}.",
+            static_cast<const void *>(this), to_string(),
+            ethernet_tools::get_last_error_code_as_string());
+        return false;
+    }
+    else if (result == 0)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {} / {}: connection closed by peer.",
+            static_cast<const void *>(this), to_string());
+        return false;
+    }
+
+    received_size_bytes = static_cast<size_t>(result);
+
+    if (m_is_quick_ack_enabled)
+    {
+        rearm_quick_ack();
+    }
+
+    return true;
+}
+
+auto ethernet_socket::set_timeout(const uint32_t &timeout_msecs) -> const bool
+{
+    m_connect_timeout_msecs = timeout_msecs;
+    m_timeout_msecs = timeout_msecs;
+
+    /**
+     * @attention please note the difference between Windows and *nix OSes here.
+     */
 #ifdef _WIN32
     const DWORD timeout = timeout_msecs;
 #else
@@ -375,9 +941,1343 @@ auto ethernet_socket::set_timeout(const uint32_t &timeout_msecs) -> const bool
     return true;
 }
 
-auto ethernet_socket::hostname() const -> const std::string
-{
-    return m_hostname;
+auto ethernet_socket::read_messages(std::vector<kommpot::message_buffer> &messages,
+    size_t &received_count, const uint32_t &timeout_msecs) -> const bool
+{
+    received_count = 0;
+
+    if (!is_connected())
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Socket {} / {}: not connected.",
+            static_cast<void *>(this), to_string());
+        return false;
+    }
+
+    if (messages.empty())
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Socket {} / {}: read_messages() called without messages.", static_cast<void *>(this),
+            to_string());
+        return false;
+    }
+
+    if (m_is_udp_gro_enabled)
+    {
+        return read_coalesced_messages(messages, received_count, timeout_msecs);
+    }
+
+    if (!wait_for_readable(timeout_msecs))
+    {
+        return false;
+    }
+
+#ifdef __linux__
+    std::array<mmsghdr, M_MAX_BATCH_MESSAGES> headers;
+    std::array<iovec, M_MAX_BATCH_MESSAGES> vectors;
+
+    /**
+     * @attention only the first batch is waited for, later ones take what is already queued.
+     */
+    while (received_count < messages.size())
+    {
+        const auto count = std::min(M_MAX_BATCH_MESSAGES, messages.size() - received_count);
+        for (size_t index = 0; index < count; ++index)
+        {
+            auto &message = messages[received_count + index];
+            vectors[index] = {message.data, message.size_bytes};
+            headers[index] = {};
+            headers[index].msg_hdr.msg_iov = &vectors[index];
+            headers[index].msg_hdr.msg_iovlen = 1;
+        }
+
+        const auto result = recvmmsg(static_cast<int>(m_handle), headers.data(),
+            static_cast<unsigned int>(count), MSG_DONTWAIT, nullptr);
+        if (result == ETH_SOCKET_ERROR)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+                    "Socket {} / {}: failed to read datagrams due to error: {}.",
+                    static_cast<void *>(this), to_string(),
+                    ethernet_tools::get_last_error_code_as_string());
+            }
+            break;
+        }
+
+        for (size_t index = 0; index < static_cast<size_t>(result); ++index)
+        {
+            auto &message = messages[received_count + index];
+            message.received_size_bytes = headers[index].msg_len;
+            message.is_truncated = (headers[index].msg_hdr.msg_flags & MSG_TRUNC) != 0;
+        }
+
+        received_count += static_cast<size_t>(result);
+        if (static_cast<size_t>(result) < count)
+        {
+            break;
+        }
+    }
+#else
+    auto &message = messages.front();
+    const auto result = recv(
+        m_handle, static_cast<char *>(message.data), static_cast<int>(message.size_bytes), 0);
+    if (result != ETH_SOCKET_ERROR)
+    {
+        message.received_size_bytes = static_cast<size_t>(result);
+        message.is_truncated = false;
+        received_count = 1;
+    }
+    else if (WSAGetLastError() == WSAEMSGSIZE)
+    {
+        message.received_size_bytes = message.size_bytes;
+        message.is_truncated = true;
+        received_count = 1;
+    }
+#endif
+
+    return received_count > 0;
+}
+
+auto ethernet_socket::read_coalesced_messages(std::vector<kommpot::message_buffer> &messages,
+    size_t &received_count, const uint32_t &timeout_msecs) -> const bool
+{
+#if defined(__linux__) && defined(UDP_GRO)
+    if (m_gro_segments.empty())
+    {
+        if (!wait_for_readable(timeout_msecs))
+        {
+            return false;
+        }
+
+        if (m_gro_buffers.empty())
+        {
+            m_gro_buffers.assign(
+                M_GRO_BUFFER_COUNT, std::vector<uint8_t>(M_MAX_DATAGRAM_SIZE_BYTES));
+        }
+
+        union segment_control
+        {
+            cmsghdr header;
+            char buffer[CMSG_SPACE(sizeof(int))];
+        };
+
+        std::array<mmsghdr, M_GRO_BUFFER_COUNT> headers;
+        std::array<iovec, M_GRO_BUFFER_COUNT> vectors;
+        std::array<segment_control, M_GRO_BUFFER_COUNT> controls;
+        for (size_t index = 0; index < M_GRO_BUFFER_COUNT; ++index)
+        {
+            vectors[index] = {m_gro_buffers[index].data(), m_gro_buffers[index].size()};
+            headers[index] = {};
+            headers[index].msg_hdr.msg_iov = &vectors[index];
+            headers[index].msg_hdr.msg_iovlen = 1;
+            headers[index].msg_hdr.msg_control = controls[index].buffer;
+            headers[index].msg_hdr.msg_controllen = sizeof(controls[index].buffer);
+        }
+
+        const auto result = recvmmsg(static_cast<int>(m_handle), headers.data(),
+            static_cast<unsigned int>(M_GRO_BUFFER_COUNT), MSG_DONTWAIT, nullptr);
+        if (result == ETH_SOCKET_ERROR)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+                    "Socket {} / {}: failed to read datagrams due to error: {}.",
+                    static_cast<void *>(this), to_string(),
+                    ethernet_tools::get_last_error_code_as_string());
+            }
+            return false;
+        }
+
+        /**
+         * @attention a coalesced receive reports its segment size, all segments but the last
+         * have that size. Receives without it hold a single datagram.
+         */
+        for (size_t index = 0; index < static_cast<size_t>(result); ++index)
+        {
+            const auto &header = headers[index].msg_hdr;
+            const auto size_bytes = static_cast<size_t>(headers[index].msg_len);
+            const bool is_truncated = (header.msg_flags & MSG_TRUNC) != 0;
+
+            size_t segment_size_bytes = size_bytes;
+            for (auto *control = CMSG_FIRSTHDR(&header); control != nullptr;
+                 control = CMSG_NXTHDR(const_cast<msghdr *>(&header), control))
+            {
+                if (control->cmsg_level == IPPROTO_UDP && control->cmsg_type == UDP_GRO)
+                {
+                    int value = 0;
+                    std::memcpy(&value, CMSG_DATA(control), sizeof(value));
+                    segment_size_bytes = static_cast<size_t>(value);
+                }
+            }
+
+            const auto *data = m_gro_buffers[index].data();
+            if (size_bytes == 0 || segment_size_bytes == 0)
+            {
+                m_gro_segments.push_back({data, 0, is_truncated});
+                continue;
+            }
+
+            for (size_t offset = 0; offset < size_bytes; offset += segment_size_bytes)
+            {
+                m_gro_segments.push_back({data + offset,
+                    std::min(segment_size_bytes, size_bytes - offset), is_truncated});
+            }
+        }
+    }
+
+    while (received_count < messages.size() && !m_gro_segments.empty())
+    {
+        const auto &segment = m_gro_segments.front();
+        auto &message = messages[received_count];
+
+        message.received_size_bytes = std::min(segment.size_bytes, message.size_bytes);
+        message.is_truncated = segment.is_truncated || segment.size_bytes > message.size_bytes;
+        if (message.received_size_bytes > 0)
+        {
+            std::memcpy(message.data, segment.data, message.received_size_bytes);
+        }
+
+        m_gro_segments.pop_front();
+        ++received_count;
+    }
+
+    return received_count > 0;
+#else
+    return false;
+#endif
+}
+
+auto ethernet_socket::write_messages(const std::vector<kommpot::message_buffer> &messages) const
+    -> const bool
+{
+    if (!is_connected())
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Socket {} / {}: not connected.",
+            static_cast<const void *>(this), to_string());
+        return false;
+    }
+
+#ifdef __linux__
+    union segment_control
+    {
+        cmsghdr header;
+        char buffer[CMSG_SPACE(sizeof(uint16_t))];
+    };
+
+    std::array<mmsghdr, M_MAX_BATCH_MESSAGES> headers;
+    std::array<iovec, M_MAX_BATCH_MESSAGES * M_MAX_SEGMENTS / 4> vectors;
+    std::array<segment_control, M_MAX_BATCH_MESSAGES> controls;
+    std::array<size_t, M_MAX_BATCH_MESSAGES> end_indexes;
+
+    size_t index = 0;
+    while (index < messages.size())
+    {
+        size_t header_count = 0;
+        size_t vector_count = 0;
+        size_t next_index = index;
+
+        while (next_index < messages.size() && header_count < headers.size())
+        {
+            const auto run_length =
+                segment_run_length(messages, next_index, vectors.size() - vector_count);
+            if (run_length == 0)
+            {
+                break;
+            }
+
+            auto &header = headers[header_count];
+            header = {};
+            header.msg_hdr.msg_iov = &vectors[vector_count];
+            header.msg_hdr.msg_iovlen = run_length;
+
+            for (size_t offset = 0; offset < run_length; ++offset)
+            {
+                const auto &message = messages[next_index + offset];
+                vectors[vector_count++] = {message.data, message.size_bytes};
+            }
+
+#    ifdef UDP_SEGMENT
+            if (run_length > 1)
+            {
+                auto &control = controls[header_count];
+                header.msg_hdr.msg_control = control.buffer;
+                header.msg_hdr.msg_controllen = sizeof(control.buffer);
+
+                auto *segment = CMSG_FIRSTHDR(&header.msg_hdr);
+                segment->cmsg_level = IPPROTO_UDP;
+                segment->cmsg_type = UDP_SEGMENT;
+                segment->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+
+                const auto segment_size_bytes =
+                    static_cast<uint16_t>(messages[next_index].size_bytes);
+                std::memcpy(CMSG_DATA(segment), &segment_size_bytes, sizeof(segment_size_bytes));
+            }
+#    endif
+
+            next_index += run_length;
+            end_indexes[header_count++] = next_index;
+        }
+
+        const auto result = sendmmsg(
+            static_cast<int>(m_handle), headers.data(), static_cast<unsigned int>(header_count), 0);
+        if (result == ETH_SOCKET_ERROR)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+                "Socket {} / {}: failed to write datagrams due to error: {}.",
+                static_cast<const void *>(this), to_string(),
+                ethernet_tools::get_last_error_code_as_string());
+            return false;
+        }
+
+        /**
+         * @attention a short count means a later header failed, it is sent again next round.
+         */
+        index = end_indexes[static_cast<size_t>(result) - 1];
+    }
+#else
+    for (const auto &message : messages)
+    {
+        const auto result = send(m_handle, static_cast<const char *>(message.data),
+            static_cast<int>(message.size_bytes), 0);
+        if (result == ETH_SOCKET_ERROR)
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+                "Socket {} / {}: failed to write datagram due to error: {}.",
+                static_cast<const void *>(this), to_string(),
+                ethernet_tools::get_last_error_code_as_string());
+            return false;
+        }
+    }
+#endif
+
+    return true;
+}
+
+auto ethernet_socket::segment_run_length(const std::vector<kommpot::message_buffer> &messages,
+    const size_t &index, const size_t &max_count) const -> size_t
+{
+    if (max_count == 0 || index >= messages.size())
+    {
+        return 0;
+    }
+
+    const auto segment_size_bytes = messages[index].size_bytes;
+    if (!m_is_udp_segmentation_enabled || segment_size_bytes == 0 ||
+        segment_size_bytes > m_udp_max_segment_size_bytes)
+    {
+        return 1;
+    }
+
+    const auto limit = std::min({max_count, M_MAX_SEGMENTS, messages.size() - index});
+
+    size_t count = 1;
+    size_t total_size_bytes = segment_size_bytes;
+    while (count < limit)
+    {
+        const auto size_bytes = messages[index + count].size_bytes;
+        if (size_bytes == 0 || size_bytes > segment_size_bytes ||
+            total_size_bytes + size_bytes > M_MAX_DATAGRAM_SIZE_BYTES)
+        {
+            break;
+        }
+
+        total_size_bytes += size_bytes;
+        ++count;
+
+        /**
+         * @attention only the last segment may be shorter.
+         */
+        if (size_bytes < segment_size_bytes)
+        {
+            break;
+        }
+    }
+
+    return count;
+}
+
+auto ethernet_socket::set_udp_segmentation(const bool is_enabled) -> const bool
+{
+    if (!is_enabled)
+    {
+        m_is_udp_segmentation_enabled = false;
+        return true;
+    }
+
+#if defined(__linux__) && defined(UDP_SEGMENT)
+    if (!is_connected() || m_protocol != kommpot::ethernet_protocol_type::UDP ||
+        !get_option(IPPROTO_UDP, UDP_SEGMENT).has_value())
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "Socket {} / {}: UDP segmentation needs a connected UDP socket and Linux 4.18+.",
+            static_cast<void *>(this), to_string());
+        m_is_udp_segmentation_enabled = false;
+        return false;
+    }
+
+    /**
+     * @attention the OS refuses segments not fitting into the path MTU, longer datagrams are
+     * sent on their own.
+     */
+    const bool is_ipv4 = (m_ip_family == AF_INET);
+    const auto mtu = is_ipv4 ? get_option(IPPROTO_IP, IP_MTU) : get_option(IPPROTO_IPV6, IPV6_MTU);
+    const size_t header_size_bytes = (is_ipv4 ? 20 : 40) + 8;
+    const size_t mtu_bytes = (mtu.has_value() && *mtu > 0) ? static_cast<size_t>(*mtu) : 1500;
+
+    m_udp_max_segment_size_bytes = mtu_bytes > header_size_bytes ? mtu_bytes - header_size_bytes
+                                                                  : 0;
+    m_is_udp_segmentation_enabled = true;
+
+    return true;
+#else
+    SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {} / {}: UDP segmentation is not supported.",
+        static_cast<void *>(this), to_string());
+    m_is_udp_segmentation_enabled = false;
+    return false;
+#endif
+}
+
+auto ethernet_socket::set_udp_gro(const bool is_enabled) -> const bool
+{
+#if defined(__linux__) && defined(UDP_GRO)
+    if (m_protocol != kommpot::ethernet_protocol_type::UDP ||
+        !set_option(IPPROTO_UDP, UDP_GRO, is_enabled ? 1 : 0, "UDP_GRO"))
+    {
+        m_is_udp_gro_enabled = false;
+        return !is_enabled;
+    }
+
+    m_is_udp_gro_enabled = is_enabled;
+
+    return true;
+#else
+    SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {} / {}: UDP receive offload is not supported.",
+        static_cast<void *>(this), to_string());
+    m_is_udp_gro_enabled = false;
+    return !is_enabled;
+#endif
+}
+
+auto ethernet_socket::set_zero_copy(const bool is_enabled) -> const bool
+{
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+    if (!set_option(SOL_SOCKET, SO_ZEROCOPY, is_enabled ? 1 : 0, "SO_ZEROCOPY"))
+    {
+        m_is_zero_copy_enabled = false;
+        return false;
+    }
+
+    m_is_zero_copy_enabled = is_enabled;
+
+    return true;
+#else
+    SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {} / {}: zero-copy send is not supported.",
+        static_cast<void *>(this), to_string());
+    m_is_zero_copy_enabled = false;
+    return !is_enabled;
+#endif
+}
+
+auto ethernet_socket::set_zero_copy_threshold(const size_t &threshold_bytes) -> void
+{
+    m_zero_copy_threshold_bytes = threshold_bytes;
+}
+
+auto ethernet_socket::write_zero_copy(
+    const void *data, size_t size_bytes, std::function<void()> callback) -> const bool
+{
+    if (!m_is_zero_copy_enabled || size_bytes == 0 || size_bytes < m_zero_copy_threshold_bytes)
+    {
+        if (!write(const_cast<void *>(data), size_bytes))
+        {
+            return false;
+        }
+
+        if (!m_zero_copy_writes.empty())
+        {
+            static_cast<void>(reap_zero_copy(0));
+        }
+
+        /**
+         * @attention a copied write behind pending zero-copy writes completes with the last of
+         * them, so its callback is not called ahead of theirs.
+         */
+        if (!m_zero_copy_writes.empty())
+        {
+            m_zero_copy_writes.push_back(
+                {m_zero_copy_writes.back().last_id, std::move(callback)});
+        }
+        else if (callback)
+        {
+            callback();
+        }
+
+        return true;
+    }
+
+#if defined(MSG_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+    if (!is_connected() || data == nullptr)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Socket {} / {}: write_zero_copy() called without connection or data.",
+            static_cast<void *>(this), to_string());
+        return false;
+    }
+
+    static_cast<void>(reap_zero_copy(0));
+
+    size_t bytes_sent = 0;
+    while (bytes_sent < size_bytes)
+    {
+        const auto result = send(m_handle, static_cast<const char *>(data) + bytes_sent,
+            size_bytes - bytes_sent, MSG_ZEROCOPY);
+        if (result == ETH_SOCKET_ERROR)
+        {
+            /**
+             * @attention pinned pages are charged to the socket option memory, ENOBUFS asks to
+             * wait for completions of earlier sends first.
+             */
+            if (errno == ENOBUFS && reap_zero_copy(m_timeout_msecs))
+            {
+                continue;
+            }
+
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+                "Socket {} / {}: failed to write data without copy due to error: {}.",
+                static_cast<void *>(this), to_string(),
+                ethernet_tools::get_last_error_code_as_string());
+            return false;
+        }
+
+        ++m_zero_copy_next_id;
+        bytes_sent += static_cast<size_t>(result);
+    }
+
+    m_zero_copy_writes.push_back({m_zero_copy_next_id - 1, std::move(callback)});
+
+    static_cast<void>(reap_zero_copy(0));
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+auto ethernet_socket::flush_zero_copy(const uint32_t &timeout_msecs) -> const bool
+{
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_msecs);
+
+    while (!m_zero_copy_writes.empty())
+    {
+        const auto remaining_msecs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now())
+                                         .count();
+        if (remaining_msecs <= 0 || !reap_zero_copy(static_cast<uint32_t>(remaining_msecs)))
+        {
+            break;
+        }
+    }
+
+    return m_zero_copy_writes.empty();
+}
+
+auto ethernet_socket::zero_copy_pending_count() const -> size_t
+{
+    return m_zero_copy_writes.size();
+}
+
+auto ethernet_socket::zero_copy_copied_count() const -> uint64_t
+{
+    return m_zero_copy_copied_count;
+}
+
+auto ethernet_socket::set_zero_copy_receive(const bool is_enabled) -> const bool
+{
+    if (!is_enabled)
+    {
+        m_receive_region = nullptr;
+        return true;
+    }
+
+#if defined(__linux__) && defined(TCP_ZEROCOPY_RECEIVE)
+    if (!is_connected() || m_protocol != kommpot::ethernet_protocol_type::TCP)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Socket {} / {}: zero-copy receive needs a connected TCP socket.",
+            static_cast<void *>(this), to_string());
+        return false;
+    }
+
+    if (m_receive_region == nullptr)
+    {
+        m_receive_region = ethernet_receive_region::create(static_cast<int>(m_handle));
+    }
+
+    return m_receive_region != nullptr;
+#else
+    SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {} / {}: zero-copy receive is not supported.",
+        static_cast<void *>(this), to_string());
+    return false;
+#endif
+}
+
+auto ethernet_socket::read_view(size_t max_size_bytes, kommpot::received_view &view,
+    const uint32_t &timeout_msecs) -> const bool
+{
+    view.release();
+
+    if (!is_connected())
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Socket {} / {}: not connected.",
+            static_cast<void *>(this), to_string());
+        return false;
+    }
+
+    if (max_size_bytes == 0)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Socket {} / {}: read_view() called with empty size.", static_cast<void *>(this),
+            to_string());
+        return false;
+    }
+
+    if (!wait_for_readable(timeout_msecs))
+    {
+        return false;
+    }
+
+    size_t copy_size_bytes = max_size_bytes;
+
+#if defined(__linux__) && defined(TCP_ZEROCOPY_RECEIVE)
+    const auto page_size_bytes = ethernet_receive_region::page_size();
+    auto region = m_receive_region;
+    auto slot = (region != nullptr && max_size_bytes >= page_size_bytes) ? region->acquire()
+                                                                          : std::nullopt;
+    if (slot.has_value())
+    {
+        /**
+         * @brief layout of struct tcp_zerocopy_receive up to err (Linux 5.11+), older kernels
+         * accept the shorter prefix and leave the rest zeroed.
+         */
+        struct zero_copy_receive
+        {
+            uint64_t address;
+            uint32_t length;
+            uint32_t recv_skip_hint;
+            uint32_t inq;
+            int32_t err;
+        };
+
+        zero_copy_receive receive = {};
+        receive.address = reinterpret_cast<uint64_t>(region->slot_address(*slot));
+        receive.length = static_cast<uint32_t>(std::min(
+            region->slot_size(), max_size_bytes / page_size_bytes * page_size_bytes));
+        socklen_t receive_size_bytes = sizeof(receive);
+
+        const auto result = getsockopt(static_cast<int>(m_handle), IPPROTO_TCP,
+            TCP_ZEROCOPY_RECEIVE, &receive, &receive_size_bytes);
+        if (result == 0 && receive.err == 0 && receive.length > 0)
+        {
+            const auto mapped_size_bytes = static_cast<size_t>(receive.length);
+            m_zero_copy_mapped_bytes += mapped_size_bytes;
+
+            view = kommpot::received_view(region->slot_address(*slot), mapped_size_bytes,
+                [region, slot = *slot, mapped_size_bytes]() {
+                    region->release(slot, mapped_size_bytes);
+                });
+
+            if (m_is_quick_ack_enabled)
+            {
+                rearm_quick_ack();
+            }
+
+            return true;
+        }
+
+        region->release(*slot, 0);
+
+        /**
+         * @attention bytes before the next page-aligned payload have to be copied, reading no
+         * more than them lets the following call map again.
+         */
+        if (result == 0 && receive.recv_skip_hint > 0)
+        {
+            copy_size_bytes = std::min<size_t>(max_size_bytes, receive.recv_skip_hint);
+        }
+    }
+#endif
+
+    if (m_receive_pool == nullptr)
+    {
+        m_receive_pool = kommpot::buffer_pool::create();
+    }
+
+    auto buffer = m_receive_pool->acquire(copy_size_bytes);
+    const auto result = recv(m_handle, reinterpret_cast<char *>(buffer->data()),
+        static_cast<int>(copy_size_bytes), 0);
+    if (result == ETH_SOCKET_ERROR)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "Socket {} / {}: failed to read data due to error: {}.", static_cast<void *>(this),
+            to_string(), ethernet_tools::get_last_error_code_as_string());
+        return false;
+    }
+    else if (result == 0)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {} / {}: connection closed by peer.",
+            static_cast<void *>(this), to_string());
+        return false;
+    }
+
+    m_zero_copy_received_copied_bytes += static_cast<uint64_t>(result);
+
+    const auto *data = buffer->data();
+    view = kommpot::received_view(data, static_cast<size_t>(result), [buffer]() {});
+
+    if (m_is_quick_ack_enabled)
+    {
+        rearm_quick_ack();
+    }
+
+    return true;
+}
+
+auto ethernet_socket::zero_copy_mapped_bytes() const -> uint64_t
+{
+    return m_zero_copy_mapped_bytes;
+}
+
+auto ethernet_socket::zero_copy_received_copied_bytes() const -> uint64_t
+{
+    return m_zero_copy_received_copied_bytes;
+}
+
+auto ethernet_socket::set_io_uring(const bool is_enabled) -> const bool
+{
+    if (is_enabled && !ethernet_uring::is_supported())
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "Socket {} / {}: io_uring is not available, using plain system calls.",
+            static_cast<void *>(this), to_string());
+        m_is_io_uring_enabled = false;
+        return false;
+    }
+
+    m_is_io_uring_enabled = is_enabled;
+
+    return true;
+}
+
+auto ethernet_socket::is_io_uring_enabled() const -> const bool
+{
+    return m_is_io_uring_enabled;
+}
+
+auto ethernet_socket::set_timestamping(const bool is_enabled, const bool is_hardware_enabled)
+    -> const bool
+{
+    m_is_timestamping_enabled = false;
+    m_is_hardware_timestamping_enabled = false;
+
+#if defined(__linux__) && defined(SO_TIMESTAMPING)
+    /**
+     * @attention transmit timestamps are requested per write by write_timestamped(), so other
+     * writes do not fill the error queue. OPT_TSONLY keeps the OS from looping the sent data back.
+     */
+    uint32_t flags = 0;
+    if (is_enabled)
+    {
+        flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE |
+                SOF_TIMESTAMPING_OPT_TSONLY;
+        if (is_hardware_enabled)
+        {
+            flags |= SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE;
+        }
+    }
+
+    if (!set_option(SOL_SOCKET, SO_TIMESTAMPING, static_cast<int>(flags), "SO_TIMESTAMPING"))
+    {
+        return false;
+    }
+
+    m_is_timestamping_enabled = is_enabled;
+    m_timestamping_flags = flags;
+    m_is_hardware_timestamping_enabled =
+        is_enabled && is_hardware_enabled && is_hardware_timestamping_configured();
+
+    if (is_enabled && is_hardware_enabled && !m_is_hardware_timestamping_enabled)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "Socket {} / {}: NIC does not take hardware timestamps, using software ones.",
+            static_cast<void *>(this), to_string());
+    }
+
+    return true;
+#else
+    SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {} / {}: timestamping is not supported.",
+        static_cast<void *>(this), to_string());
+    return !is_enabled;
+#endif
+}
+
+auto ethernet_socket::is_hardware_timestamping_enabled() const -> const bool
+{
+    return m_is_hardware_timestamping_enabled;
+}
+
+auto ethernet_socket::read_timestamped(void *data, size_t size_bytes,
+    size_t &received_size_bytes, kommpot::transfer_timestamps &timestamps,
+    const uint32_t &timeout_msecs) -> const bool
+{
+    timestamps = {};
+
+#if defined(__linux__) && defined(SO_TIMESTAMPING)
+    if (!m_is_timestamping_enabled)
+    {
+        return read_some(data, size_bytes, received_size_bytes, timeout_msecs);
+    }
+
+    received_size_bytes = 0;
+
+    if (!is_connected())
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Socket {} / {}: not connected.",
+            static_cast<void *>(this), to_string());
+        return false;
+    }
+
+    if (data == nullptr || size_bytes == 0)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Socket {} / {}: read_timestamped() called with empty buffer.",
+            static_cast<void *>(this), to_string());
+        return false;
+    }
+
+    if (!wait_for_readable(timeout_msecs))
+    {
+        return false;
+    }
+
+    iovec buffer = {data, size_bytes};
+    char control[256] = {};
+    msghdr message = {};
+    message.msg_iov = &buffer;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    const auto result = recvmsg(static_cast<int>(m_handle), &message, 0);
+    if (result == ETH_SOCKET_ERROR)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "Socket {} / {}: failed to read data due to error: {}.", static_cast<void *>(this),
+            to_string(), ethernet_tools::get_last_error_code_as_string());
+        return false;
+    }
+    else if (result == 0)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {} / {}: connection closed by peer.",
+            static_cast<void *>(this), to_string());
+        return false;
+    }
+
+    for (auto *header = CMSG_FIRSTHDR(&message); header != nullptr;
+         header = CMSG_NXTHDR(&message, header))
+    {
+        if (header->cmsg_level == SOL_SOCKET && header->cmsg_type == SO_TIMESTAMPING)
+        {
+            scm_timestamping value = {};
+            std::memcpy(&value, CMSG_DATA(header), sizeof(value));
+            timestamps = to_transfer_timestamps(value);
+        }
+    }
+
+    received_size_bytes = static_cast<size_t>(result);
+
+    if (m_is_quick_ack_enabled)
+    {
+        rearm_quick_ack();
+    }
+
+    return true;
+#else
+    return read_some(data, size_bytes, received_size_bytes, timeout_msecs);
+#endif
+}
+
+auto ethernet_socket::write_timestamped(const void *data, size_t size_bytes,
+    kommpot::transfer_timestamps &timestamps, const uint32_t &timeout_msecs) -> const bool
+{
+    timestamps = {};
+
+#if defined(__linux__) && defined(SO_TIMESTAMPING)
+    if (!m_is_timestamping_enabled)
+    {
+        return write(const_cast<void *>(data), size_bytes);
+    }
+
+    if (!is_connected() || data == nullptr || size_bytes == 0)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Socket {} / {}: write_timestamped() called without connection or data.",
+            static_cast<void *>(this), to_string());
+        return false;
+    }
+
+    /**
+     * @attention timestamps of earlier writes reported after their timeout must not be taken for
+     * the ones of this write.
+     */
+    static_cast<void>(read_error_queue());
+    m_transmit_timestamps = {};
+
+    /**
+     * @attention a send appending to a TCP segment not sent yet replaces its timestamp request,
+     * so fewer timestamps than sends may arrive. The key of the last byte is awaited instead.
+     */
+    uint32_t key_offset = 0;
+    if (!restart_timestamp_key(key_offset))
+    {
+        return write(const_cast<void *>(data), size_bytes);
+    }
+
+    uint32_t flags = SOF_TIMESTAMPING_TX_SOFTWARE;
+    if (m_is_hardware_timestamping_enabled)
+    {
+        flags |= SOF_TIMESTAMPING_TX_HARDWARE;
+    }
+
+    /**
+     * @brief every send call asks for a timestamp of its last byte, TCP keys count bytes and UDP
+     * keys count datagrams.
+     */
+    uint32_t send_count = 0;
+    size_t bytes_sent = 0;
+    while (bytes_sent < size_bytes)
+    {
+        iovec buffer = {const_cast<char *>(static_cast<const char *>(data)) + bytes_sent,
+            size_bytes - bytes_sent};
+        char control[CMSG_SPACE(sizeof(flags))] = {};
+        msghdr message = {};
+        message.msg_iov = &buffer;
+        message.msg_iovlen = 1;
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+
+        auto *header = CMSG_FIRSTHDR(&message);
+        header->cmsg_level = SOL_SOCKET;
+        header->cmsg_type = SO_TIMESTAMPING;
+        header->cmsg_len = CMSG_LEN(sizeof(flags));
+        std::memcpy(CMSG_DATA(header), &flags, sizeof(flags));
+
+        const auto result = sendmsg(static_cast<int>(m_handle), &message, 0);
+        if (result == ETH_SOCKET_ERROR)
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+                "Socket {} / {}: failed to write data due to error: {}.",
+                static_cast<void *>(this), to_string(),
+                ethernet_tools::get_last_error_code_as_string());
+            return false;
+        }
+
+        ++send_count;
+        bytes_sent += static_cast<size_t>(result);
+    }
+
+    const auto sent_count = (m_protocol == kommpot::ethernet_protocol_type::TCP)
+                                ? static_cast<uint32_t>(bytes_sent)
+                                : send_count;
+    m_transmit_timestamp_key = key_offset + sent_count - 1;
+
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_msecs);
+    while (!m_transmit_timestamps.software_nsecs ||
+           (m_is_hardware_timestamping_enabled && !m_transmit_timestamps.hardware_nsecs))
+    {
+        const auto remaining_msecs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now())
+                                         .count();
+        if (remaining_msecs <= 0 || !wait_for_error_queue(static_cast<uint32_t>(remaining_msecs)))
+        {
+            SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+                "Socket {} / {}: transmit timestamps not reported within {} ms.",
+                static_cast<void *>(this), to_string(), timeout_msecs);
+            break;
+        }
+
+        static_cast<void>(read_error_queue());
+    }
+
+    timestamps = m_transmit_timestamps;
+
+    return true;
+#else
+    return write(const_cast<void *>(data), size_bytes);
+#endif
+}
+
+auto ethernet_socket::set_abortive_close(const bool is_enabled) -> const bool
+{
+    linger value = {};
+    value.l_onoff = is_enabled ? 1 : 0;
+    value.l_linger = 0;
+
+    const auto result =
+        setsockopt(m_handle, SOL_SOCKET, SO_LINGER, (const char *)&value, sizeof(value));
+    if (result == ETH_SOCKET_ERROR)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Socket {} / {}: setsockopt(SO_LINGER) failed with error: {}.",
+            static_cast<void *>(this), to_string(),
+            ethernet_tools::get_last_error_code_as_string());
+        return false;
+    }
+
+    return true;
+}
+
+auto ethernet_socket::set_connect_timeout(const uint32_t &timeout_msecs) -> void
+{
+    m_connect_timeout_msecs = timeout_msecs;
+}
+
+auto ethernet_socket::connect_rtt_usecs() const -> const std::optional<uint64_t>
+{
+    return m_connect_rtt_usecs;
+}
+
+auto ethernet_socket::set_broadcast(const bool is_enabled) -> const bool
+{
+    const int value = is_enabled ? 1 : 0;
+
+    const auto result =
+        setsockopt(m_handle, SOL_SOCKET, SO_BROADCAST, (const char *)&value, sizeof(value));
+    if (result == ETH_SOCKET_ERROR)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Socket {} / {}: setsockopt(SO_BROADCAST) failed with error: {}.",
+            static_cast<void *>(this), to_string(),
+            ethernet_tools::get_last_error_code_as_string());
+        return false;
+    }
+
+    return true;
+}
+
+auto ethernet_socket::set_profile(const kommpot::ethernet_socket_profile &profile) -> const bool
+{
+    const auto tuning = ethernet_socket_tuning::from_profile(profile);
+    const auto is_tcp = (m_protocol == kommpot::ethernet_protocol_type::TCP);
+
+    bool is_applied = true;
+
+    if (tuning.buffer_size_bytes > 0)
+    {
+        const auto size = static_cast<int>(tuning.buffer_size_bytes);
+        is_applied &= set_option(SOL_SOCKET, SO_RCVBUF, size, "SO_RCVBUF");
+        is_applied &= set_option(SOL_SOCKET, SO_SNDBUF, size, "SO_SNDBUF");
+    }
+
+    if (tuning.dscp > 0)
+    {
+        const auto traffic_class = static_cast<int>(tuning.dscp) << 2;
+        if (m_ip_family == AF_INET6)
+        {
+#ifdef IPV6_TCLASS
+            is_applied &= set_option(IPPROTO_IPV6, IPV6_TCLASS, traffic_class, "IPV6_TCLASS");
+#endif
+        }
+        else
+        {
+            is_applied &= set_option(IPPROTO_IP, IP_TOS, traffic_class, "IP_TOS");
+        }
+    }
+
+#ifdef SO_BUSY_POLL
+    if (tuning.busy_poll_usecs > 0)
+    {
+        is_applied &= set_option(
+            SOL_SOCKET, SO_BUSY_POLL, static_cast<int>(tuning.busy_poll_usecs), "SO_BUSY_POLL");
+    }
+#endif
+
+    if (is_tcp && tuning.is_no_delay_enabled)
+    {
+        is_applied &= set_option(IPPROTO_TCP, TCP_NODELAY, 1, "TCP_NODELAY");
+    }
+
+    if (is_tcp && tuning.keepalive_idle_secs > 0)
+    {
+        is_applied &= set_option(SOL_SOCKET, SO_KEEPALIVE, 1, "SO_KEEPALIVE");
+#if defined(TCP_KEEPIDLE)
+        is_applied &= set_option(IPPROTO_TCP, TCP_KEEPIDLE,
+            static_cast<int>(tuning.keepalive_idle_secs), "TCP_KEEPIDLE");
+#elif defined(TCP_KEEPALIVE)
+        is_applied &= set_option(IPPROTO_TCP, TCP_KEEPALIVE,
+            static_cast<int>(tuning.keepalive_idle_secs), "TCP_KEEPALIVE");
+#endif
+#ifdef TCP_KEEPINTVL
+        is_applied &= set_option(IPPROTO_TCP, TCP_KEEPINTVL,
+            static_cast<int>(tuning.keepalive_interval_secs), "TCP_KEEPINTVL");
+#endif
+#ifdef TCP_KEEPCNT
+        is_applied &= set_option(IPPROTO_TCP, TCP_KEEPCNT,
+            static_cast<int>(tuning.keepalive_probe_count), "TCP_KEEPCNT");
+#endif
+    }
+
+#ifdef TCP_QUICKACK
+    m_is_quick_ack_enabled = is_tcp && tuning.is_quick_ack_enabled;
+    if (m_is_quick_ack_enabled)
+    {
+        is_applied &= set_option(IPPROTO_TCP, TCP_QUICKACK, 1, "TCP_QUICKACK");
+    }
+#endif
+
+    m_profile = profile;
+
+    SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+        "Socket {} / {}: applied profile {}{}, SO_RCVBUF {} bytes, SO_SNDBUF {} bytes.",
+        static_cast<void *>(this), to_string(), kommpot::ethernet_socket_profile_to_string(profile),
+        is_applied ? "" : " partially", get_option(SOL_SOCKET, SO_RCVBUF).value_or(0),
+        get_option(SOL_SOCKET, SO_SNDBUF).value_or(0));
+
+    return is_applied;
+}
+
+auto ethernet_socket::profile() const -> const kommpot::ethernet_socket_profile
+{
+    return m_profile;
+}
+
+auto ethernet_socket::send_to(const void *data, size_t size_bytes) const -> const bool
+{
+    if (m_handle == ETH_INVALID_SOCKET)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Socket {} / {}: not initialized.",
+            static_cast<const void *>(this), to_string());
+        return false;
+    }
+
+    if (data == nullptr || size_bytes == 0)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Socket {} / {}: send_to() called with empty data.", static_cast<const void *>(this),
+            to_string());
+        return false;
+    }
+
+    sockaddr_storage address = {};
+    socklen_t address_length_bytes = 0;
+    if (!to_sockaddr(address, address_length_bytes))
+    {
+        return false;
+    }
+
+    const auto result = sendto(m_handle, static_cast<const char *>(data),
+        static_cast<int>(size_bytes), 0, (const sockaddr *)&address, address_length_bytes);
+    if (result == ETH_SOCKET_ERROR)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Socket {} / {}: failed to send datagram due to error: {}.",
+            static_cast<const void *>(this), to_string(),
+            ethernet_tools::get_last_error_code_as_string());
+        return false;
+    }
+
+    return true;
+}
+
+auto ethernet_socket::receive_from(void *data, size_t size_bytes, size_t &received_size_bytes,
+    std::shared_ptr<ethernet_ip_address> &source_address, const uint32_t &timeout_msecs,
+    int32_t &error_code) const -> const bool
+{
+    received_size_bytes = 0;
+    error_code = 0;
+
+    if (m_handle == ETH_INVALID_SOCKET)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Socket {} / {}: not initialized.",
+            static_cast<const void *>(this), to_string());
+        return false;
+    }
+
+    if (data == nullptr || size_bytes == 0)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Socket {} / {}: receive_from() called with empty buffer.",
+            static_cast<const void *>(this), to_string());
+        return false;
+    }
+
+    if (!wait_for_readable(timeout_msecs))
+    {
+        return false;
+    }
+
+    sockaddr_storage address = {};
+    socklen_t address_length_bytes = sizeof(address);
+
+    const auto result = recvfrom(m_handle, static_cast<char *>(data), static_cast<int>(size_bytes),
+        0, (sockaddr *)&address, &address_length_bytes);
+    if (result == ETH_SOCKET_ERROR)
+    {
+        error_code = ethernet_tools::get_error_code();
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "Socket {} / {}: failed to receive datagram due to error: {}.",
+            static_cast<const void *>(this), to_string(),
+            ethernet_tools::get_error_code_as_string(error_code));
+        return false;
+    }
+
+    auto source_address_opt = ethernet_address_factory::from_sockaddr_in((sockaddr *)&address);
+    if (!source_address_opt)
+    {
+        return false;
+    }
+
+    source_address = *source_address_opt;
+    received_size_bytes = static_cast<size_t>(result);
+
+    return true;
+}
+
+auto ethernet_socket::join_multicast(const std::shared_ptr<ethernet_ip_address> &source,
+    const uint32_t &interface_index) -> const bool
+{
+    if (m_handle == ETH_INVALID_SOCKET || m_protocol != kommpot::ethernet_protocol_type::UDP)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Socket {} / {}: joining a multicast group needs an initialized UDP socket.",
+            static_cast<void *>(this), to_string());
+        return false;
+    }
+
+    sockaddr_storage group = {};
+    socklen_t group_length_bytes = 0;
+    if (!to_sockaddr(group, group_length_bytes))
+    {
+        return false;
+    }
+
+    if (!set_option(SOL_SOCKET, SO_REUSEADDR, 1, "SO_REUSEADDR"))
+    {
+        return false;
+    }
+
+    /**
+     * @attention Linux delivers the datagrams of every group joined on the machine to sockets
+     * bound to the wildcard address by default, only those of the joined group are wanted.
+     */
+#ifdef IP_MULTICAST_ALL
+    if (m_ip_family == AF_INET)
+    {
+        static_cast<void>(set_option(IPPROTO_IP, IP_MULTICAST_ALL, 0, "IP_MULTICAST_ALL"));
+    }
+#endif
+#ifdef IPV6_MULTICAST_ALL
+    if (m_ip_family == AF_INET6)
+    {
+        static_cast<void>(set_option(IPPROTO_IPV6, IPV6_MULTICAST_ALL, 0, "IPV6_MULTICAST_ALL"));
+    }
+#endif
+
+    sockaddr_storage local = {};
+    local.ss_family = group.ss_family;
+    if (m_ip_family == AF_INET)
+    {
+        reinterpret_cast<sockaddr_in *>(&local)->sin_port = htons(m_port);
+    }
+    else
+    {
+        reinterpret_cast<sockaddr_in6 *>(&local)->sin6_port = htons(m_port);
+    }
+
+    if (::bind(m_handle, (const sockaddr *)&local, group_length_bytes) == ETH_SOCKET_ERROR)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Socket {} / {}: failed to bind multicast port due to error: {}.",
+            static_cast<void *>(this), to_string(),
+            ethernet_tools::get_last_error_code_as_string());
+        return false;
+    }
+
+    /**
+     * @attention the protocol independent requests (RFC 3678) take an interface index for both
+     * families, unlike ip_mreq which takes an interface address.
+     */
+    const int level = (m_ip_family == AF_INET) ? IPPROTO_IP : IPPROTO_IPV6;
+    int result = ETH_SOCKET_ERROR;
+    if (source == nullptr)
+    {
+        group_req request = {};
+        request.gr_interface = interface_index;
+        std::memcpy(&request.gr_group, &group, group_length_bytes);
+
+        result = setsockopt(
+            m_handle, level, MCAST_JOIN_GROUP, (const char *)&request, sizeof(request));
+    }
+    else
+    {
+        group_source_req request = {};
+        request.gsr_interface = interface_index;
+        std::memcpy(&request.gsr_group, &group, group_length_bytes);
+
+        auto *source_address = &request.gsr_source;
+        source_address->ss_family = group.ss_family;
+        const auto source_string = source->to_string();
+        void *source_bytes = &reinterpret_cast<sockaddr_in *>(source_address)->sin_addr;
+        if (m_ip_family == AF_INET6)
+        {
+            source_bytes = &reinterpret_cast<sockaddr_in6 *>(source_address)->sin6_addr;
+        }
+
+        if (inet_pton(m_ip_family, source_string.c_str(), source_bytes) != 1)
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+                "Socket {} / {}: multicast source {} is not of the group's address family.",
+                static_cast<void *>(this), to_string(), source_string);
+            return false;
+        }
+
+        result = setsockopt(
+            m_handle, level, MCAST_JOIN_SOURCE_GROUP, (const char *)&request, sizeof(request));
+    }
+
+    if (result == ETH_SOCKET_ERROR)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Socket {} / {}: failed to join multicast group due to error: {}.",
+            static_cast<void *>(this), to_string(),
+            ethernet_tools::get_last_error_code_as_string());
+        return false;
+    }
+
+    m_is_connected = true;
+
+    SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "Socket {} / {}: joined multicast group{}{}.",
+        static_cast<void *>(this), to_string(), source != nullptr ? " from " : "",
+        source != nullptr ? source->to_string() : "");
+
+    return true;
+}
+
+auto ethernet_socket::set_multicast_loop(const bool is_enabled) -> const bool
+{
+    if (m_ip_family == AF_INET6)
+    {
+        return set_option(
+            IPPROTO_IPV6, IPV6_MULTICAST_LOOP, is_enabled ? 1 : 0, "IPV6_MULTICAST_LOOP");
+    }
+
+    return set_option(IPPROTO_IP, IP_MULTICAST_LOOP, is_enabled ? 1 : 0, "IP_MULTICAST_LOOP");
 }
 
 auto ethernet_socket::mac_address() const -> const ethernet_mac_address
@@ -396,8 +2296,91 @@ auto ethernet_socket::to_string() const -> const std::string
         kommpot::ethernet_protocol_type_to_string(m_protocol));
 }
 
+auto ethernet_socket::store_connect_rtt() -> void
+{
+    m_connect_rtt_usecs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - m_connect_start)
+            .count());
+}
+
+auto ethernet_socket::set_option(
+    const int level, const int name, const int value, const char *name_string) -> const bool
+{
+    const auto result = setsockopt(m_handle, level, name, (const char *)&value, sizeof(value));
+    if (result == ETH_SOCKET_ERROR)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "Socket {} / {}: setsockopt({}) failed with error: {}.", static_cast<void *>(this),
+            to_string(), name_string, ethernet_tools::get_last_error_code_as_string());
+        return false;
+    }
+
+    return true;
+}
+
+auto ethernet_socket::get_option(const int level, const int name) const -> std::optional<int>
+{
+    int value = 0;
+#ifdef _WIN32
+    int value_size = sizeof(value);
+#else
+    socklen_t value_size = sizeof(value);
+#endif
+    if (getsockopt(m_handle, level, name, (char *)&value, &value_size) == ETH_SOCKET_ERROR)
+    {
+        return std::nullopt;
+    }
+
+    return value;
+}
+
+auto ethernet_socket::rearm_quick_ack() const -> void
+{
+#ifdef TCP_QUICKACK
+    const int value = 1;
+    setsockopt(m_handle, IPPROTO_TCP, TCP_QUICKACK, (const char *)&value, sizeof(value));
+#endif
+}
+
 auto ethernet_socket::close_socket() -> const bool
 {
+    /**
+     * @attention the OS keeps its own references of pages still in flight, so callbacks of writes
+     * not completed in time are called anyway before the completions are lost with the socket.
+     */
+    if (!m_zero_copy_writes.empty() && !flush_zero_copy(m_timeout_msecs))
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "Socket {} / {}: {} zero-copy writes not completed before close.",
+            static_cast<void *>(this), to_string(), m_zero_copy_writes.size());
+
+        while (!m_zero_copy_writes.empty())
+        {
+            auto callback = std::move(m_zero_copy_writes.front().callback);
+            m_zero_copy_writes.pop_front();
+            if (callback)
+            {
+                callback();
+            }
+        }
+    }
+
+    /**
+     * @attention views still holding mapped pages keep the region and thus the connection alive,
+     * the OS closes it once the last of them was released.
+     */
+    m_receive_region = nullptr;
+    m_gro_segments.clear();
+
+    /**
+     * @attention timestamping is a socket option, it is gone together with the handle.
+     */
+    m_is_timestamping_enabled = false;
+    m_is_hardware_timestamping_enabled = false;
+    m_timestamping_flags = 0;
+    m_transmit_timestamps = {};
+
     /**
      * @attention please note the difference between Windows and *nix OSes here.
      */
@@ -453,220 +2436,423 @@ auto ethernet_socket::set_blocking(const bool blocking) -> const bool
     return true;
 }
 
-auto ethernet_socket::read_out_hostname(std::string &hostname) -> const bool
+auto ethernet_socket::reap_zero_copy(const uint32_t &timeout_msecs) -> const bool
 {
-    char host_buffer[NI_MAXHOST] = {0};
-    char service_buffer[NI_MAXSERV] = {0};
+#if defined(MSG_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+    return wait_for_error_queue(timeout_msecs) && read_error_queue();
+#else
+    return false;
+#endif
+}
 
-    sockaddr_storage peer_address = {};
-    socklen_t address_length_bytes = sizeof(peer_address);
+auto ethernet_socket::wait_for_error_queue(const uint32_t &timeout_msecs) const -> const bool
+{
+#ifdef __linux__
+    /**
+     * @attention the error queue is signalled by POLLERR, which is reported without asking.
+     */
+    pollfd descriptor = {};
+    descriptor.fd = static_cast<int>(m_handle);
+    return poll(&descriptor, 1, static_cast<int>(timeout_msecs)) > 0 &&
+           (descriptor.revents & POLLERR) != 0;
+#else
+    return false;
+#endif
+}
 
-    int32_t result = getpeername(m_handle, (sockaddr *)&peer_address, &address_length_bytes);
-    if (result == ETH_SOCKET_ERROR)
+auto ethernet_socket::read_error_queue() -> const bool
+{
+#ifdef __linux__
+    bool is_reaped = false;
+    while (true)
+    {
+        char control[256] = {};
+        msghdr message = {};
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+
+        if (recvmsg(static_cast<int>(m_handle), &message, MSG_ERRQUEUE | MSG_DONTWAIT) ==
+            ETH_SOCKET_ERROR)
+        {
+            break;
+        }
+
+        /**
+         * @attention a transmit timestamp comes as SO_TIMESTAMPING message together with the error
+         * stating its origin.
+         */
+        std::optional<kommpot::transfer_timestamps> timestamps = std::nullopt;
+        bool is_transmit_timestamp = false;
+        uint32_t timestamp_key = 0;
+
+        for (auto *header = CMSG_FIRSTHDR(&message); header != nullptr;
+             header = CMSG_NXTHDR(&message, header))
+        {
+#    ifdef SO_TIMESTAMPING
+            if (header->cmsg_level == SOL_SOCKET && header->cmsg_type == SO_TIMESTAMPING)
+            {
+                scm_timestamping value = {};
+                std::memcpy(&value, CMSG_DATA(header), sizeof(value));
+                timestamps = to_transfer_timestamps(value);
+                continue;
+            }
+#    endif
+
+            const bool is_ipv4_error =
+                (header->cmsg_level == SOL_IP && header->cmsg_type == IP_RECVERR);
+            const bool is_ipv6_error =
+                (header->cmsg_level == SOL_IPV6 && header->cmsg_type == IPV6_RECVERR);
+            if (!is_ipv4_error && !is_ipv6_error)
+            {
+                continue;
+            }
+
+            sock_extended_err error = {};
+            std::memcpy(&error, CMSG_DATA(header), sizeof(error));
+            if (error.ee_errno != 0 && error.ee_errno != ENOMSG)
+            {
+                continue;
+            }
+
+#    ifdef SO_EE_ORIGIN_TIMESTAMPING
+            if (error.ee_origin == SO_EE_ORIGIN_TIMESTAMPING)
+            {
+                is_transmit_timestamp = (error.ee_info == SCM_TSTAMP_SND);
+                timestamp_key = error.ee_data;
+                continue;
+            }
+#    endif
+
+#    if defined(MSG_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+            if (error.ee_errno != 0 || error.ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+            {
+                continue;
+            }
+
+            if ((error.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0)
+            {
+                ++m_zero_copy_copied_count;
+            }
+
+            /**
+             * @attention TCP reports the IDs in order, so the upper end of the range completes
+             * every write up to it.
+             */
+            while (!m_zero_copy_writes.empty() &&
+                   static_cast<int32_t>(m_zero_copy_writes.front().last_id - error.ee_data) <= 0)
+            {
+                auto callback = std::move(m_zero_copy_writes.front().callback);
+                m_zero_copy_writes.pop_front();
+                if (callback)
+                {
+                    callback();
+                }
+            }
+
+            is_reaped = true;
+#    endif
+        }
+
+        if (is_transmit_timestamp && timestamps && timestamp_key == m_transmit_timestamp_key)
+        {
+            if (timestamps->software_nsecs)
+            {
+                m_transmit_timestamps.software_nsecs = timestamps->software_nsecs;
+            }
+
+            if (timestamps->hardware_nsecs)
+            {
+                m_transmit_timestamps.hardware_nsecs = timestamps->hardware_nsecs;
+            }
+        }
+    }
+
+    return is_reaped;
+#else
+    return false;
+#endif
+}
+
+auto ethernet_socket::restart_timestamp_key(uint32_t &offset) -> const bool
+{
+    offset = 0;
+
+#if defined(__linux__) && defined(SO_TIMESTAMPING)
+    /**
+     * @attention the OS only restarts the key when OPT_ID gets set, so it is cleared first.
+     */
+    if (!set_option(SOL_SOCKET, SO_TIMESTAMPING, static_cast<int>(m_timestamping_flags),
+            "SO_TIMESTAMPING"))
     {
-        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Socket {} / {}: getpeername() failed with error: {}.",
-            static_cast<void *>(this), to_string(),
-            ethernet_tools::get_last_error_code_as_string());
         return false;
     }
 
+    const auto flags = m_timestamping_flags | SOF_TIMESTAMPING_OPT_ID;
+    if (m_protocol != kommpot::ethernet_protocol_type::TCP)
+    {
+        return set_option(SOL_SOCKET, SO_TIMESTAMPING, static_cast<int>(flags), "SO_TIMESTAMPING");
+    }
+
+    if (set_option(SOL_SOCKET, SO_TIMESTAMPING, static_cast<int>(flags | TIMESTAMPING_OPT_ID_TCP),
+            "SO_TIMESTAMPING"))
+    {
+        return true;
+    }
+
     /**
-     * @attention getnameinfo() has its own error codes that are different to standard socket ones.
+     * @attention without OPT_ID_TCP the key starts at the first unacknowledged byte, so the bytes
+     * still queued are skipped. Acknowledgements arriving in between may shift it nevertheless.
      */
-    result = getnameinfo((sockaddr *)&peer_address, address_length_bytes, host_buffer,
-        sizeof(host_buffer), service_buffer, sizeof(service_buffer), 0);
-    if (result != 0)
+    int queued_bytes = 0;
+    if (ioctl(static_cast<int>(m_handle), SIOCOUTQ, &queued_bytes) != 0)
     {
-        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
-            "Socket {} / {}: getnameinfo() failed with error {} (code {}).",
-            static_cast<void *>(this), to_string(), gai_strerror(result), result);
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "Socket {} / {}: failed to get queued bytes due to error: {}.",
+            static_cast<void *>(this), to_string(),
+            ethernet_tools::get_last_error_code_as_string());
+        return false;
     }
 
-    hostname = host_buffer;
+    offset = static_cast<uint32_t>(queued_bytes);
 
-    return true;
+    return set_option(SOL_SOCKET, SO_TIMESTAMPING, static_cast<int>(flags), "SO_TIMESTAMPING");
+#else
+    return false;
+#endif
 }
 
-auto ethernet_socket::read_out_mac_address(ethernet_mac_address &mac_address) -> const bool
+auto ethernet_socket::is_hardware_timestamping_configured() const -> const bool
 {
-#ifdef _WIN32
-
-    IPAddr connected_ip_address = {};
+#if defined(__linux__) && defined(SIOCGHWTSTAMP)
+    sockaddr_storage local_address = {};
+    socklen_t local_address_length_bytes = sizeof(local_address);
+    if (getsockname(static_cast<int>(m_handle), reinterpret_cast<sockaddr *>(&local_address),
+            &local_address_length_bytes) == ETH_SOCKET_ERROR)
+    {
+        return false;
+    }
 
-    int result = InetPton(m_ip_family, m_ip_address->to_string().c_str(), &connected_ip_address);
-    if (result != 1)
+    ifaddrs *adapters_raw = nullptr;
+    if (getifaddrs(&adapters_raw) == -1)
     {
-        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Socket {} / {}: InetPton() failed with error: {}.",
-            static_cast<void *>(this), to_string(),
-            ethernet_tools::get_last_error_code_as_string());
         return false;
     }
 
-    BYTE mac_address_bytes[6] = {0};
-    ULONG mac_address_length = 6;
+    auto adapters = std::shared_ptr<ifaddrs>(adapters_raw, [](ifaddrs *ptr) {
+        if (ptr != nullptr)
+        {
+            freeifaddrs(ptr);
+        }
+    });
 
-    result = SendARP(connected_ip_address, 0, mac_address_bytes, &mac_address_length);
-    if (result != NO_ERROR)
+    const char *interface_name = nullptr;
+    for (auto *adapter = adapters.get(); adapter != nullptr; adapter = adapter->ifa_next)
+    {
+        if (adapter->ifa_addr == nullptr || adapter->ifa_addr->sa_family != local_address.ss_family)
+        {
+            continue;
+        }
+
+        bool is_match = false;
+        if (local_address.ss_family == AF_INET)
+        {
+            const auto *local = reinterpret_cast<const sockaddr_in *>(&local_address);
+            const auto *candidate = reinterpret_cast<const sockaddr_in *>(adapter->ifa_addr);
+            is_match = (local->sin_addr.s_addr == candidate->sin_addr.s_addr);
+        }
+        else if (local_address.ss_family == AF_INET6)
+        {
+            const auto *local = reinterpret_cast<const sockaddr_in6 *>(&local_address);
+            const auto *candidate = reinterpret_cast<const sockaddr_in6 *>(adapter->ifa_addr);
+            is_match = (std::memcmp(&local->sin6_addr, &candidate->sin6_addr,
+                            sizeof(local->sin6_addr)) == 0);
+        }
+
+        if (is_match)
+        {
+            interface_name = adapter->ifa_name;
+            break;
+        }
+    }
+
+    if (interface_name == nullptr)
     {
-        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
-            "Socket {} / {}: SendARP() failed with error: {} (code {}).", static_cast<void *>(this),
-            to_string(), ethernet_tools::get_error_code_as_string(result), result);
         return false;
     }
 
-    auto mac_address_opt =
-        ethernet_address_factory::from_array(mac_address_bytes, sizeof(mac_address_bytes));
-    if (!mac_address_opt.has_value())
+    hwtstamp_config config = {};
+    ifreq request = {};
+    std::strncpy(request.ifr_name, interface_name, IFNAMSIZ - 1);
+    request.ifr_data = reinterpret_cast<char *>(&config);
+    if (ioctl(static_cast<int>(m_handle), SIOCGHWTSTAMP, &request) != 0)
     {
-        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
-            "Socket {} / {}: failed to convert MAC address from byte array.",
-            static_cast<void *>(this), to_string());
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "Socket {} / {}: hardware timestamping of {} not readable due to error: {}.",
+            static_cast<const void *>(this), to_string(), interface_name,
+            ethernet_tools::get_last_error_code_as_string());
         return false;
     }
 
-    mac_address = *mac_address_opt;
+    return config.tx_type == HWTSTAMP_TX_ON;
+#else
+    return false;
+#endif
+}
 
-    return true;
+auto ethernet_socket::io_uring() const -> ethernet_uring *
+{
+    return m_is_io_uring_enabled ? ethernet_uring::thread_instance() : nullptr;
+}
+
+auto ethernet_socket::transfer(ethernet_uring &ring, const ethernet_uring::operation_type &type,
+    void *data, size_t size_bytes, const int flags, const uint32_t &timeout_msecs) const -> int64_t
+{
+    std::vector<ethernet_uring::operation> operations(1);
+    auto &operation = operations.front();
+    operation.type = type;
+    operation.handle = static_cast<int>(m_handle);
+    operation.data = data;
+    operation.size_bytes = size_bytes;
+    operation.flags = flags;
+    operation.timeout_msecs = timeout_msecs;
+
+    if (!ring.execute(operations))
+    {
+        return -EIO;
+    }
 
-#elif defined __linux__
+    return operation.is_timed_out ? -ETIMEDOUT : operation.result;
+}
 
-    const std::string target_ip = m_ip_address->to_string();
+auto ethernet_socket::wait_for_readable(const uint32_t &timeout_msecs) const -> const bool
+{
+    std::vector<poll_descriptor> descriptors(1);
+    descriptors.front().fd = static_cast<poll_handle>(m_handle);
+    descriptors.front().events = POLLIN;
 
     /**
-     * @attention Linux exposes the resolved ARP cache via /proc/net/arp, which maps peer IP
-     * addresses to their MAC addresses. The entry only exists after the kernel has resolved the
-     * peer, which is the case once the socket is connected.
+     * @attention a closed or failed connection counts as readable, the read reports it then.
      */
-    std::ifstream arp_table("/proc/net/arp");
-    if (!arp_table.is_open())
+    const auto result = poll_handles(descriptors, timeout_msecs);
+    if (result == ETH_SOCKET_ERROR)
     {
-        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Socket {} / {}: failed to open /proc/net/arp.",
-            static_cast<void *>(this), to_string());
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Socket {} / {}: poll() failed with error: {}.",
+            static_cast<const void *>(this), to_string(),
+            ethernet_tools::get_last_error_code_as_string());
         return false;
     }
 
-    std::string line;
-    // Skip the header line.
-    std::getline(arp_table, line);
+    return result > 0;
+}
+
+auto ethernet_socket::to_sockaddr(sockaddr_storage &address, socklen_t &address_length_bytes) const
+    -> const bool
+{
+    address = {};
 
-    while (std::getline(arp_table, line))
+    if (m_ip_family == AF_INET)
     {
-        std::istringstream stream(line);
-        std::string ip_address;
-        std::string hardware_type;
-        std::string flags;
-        std::string mac_string;
-        if (!(stream >> ip_address >> hardware_type >> flags >> mac_string))
-        {
-            continue;
-        }
-
-        if (ip_address != target_ip)
+        auto *ipv4 = reinterpret_cast<sockaddr_in *>(&address);
+        ipv4->sin_family = AF_INET;
+        ipv4->sin_port = htons(m_port);
+        if (inet_pton(AF_INET, m_ip_address->to_string().c_str(), &ipv4->sin_addr) != 1)
         {
-            continue;
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Socket {} / {}: inet_pton() failed.",
+                static_cast<const void *>(this), to_string());
+            return false;
         }
 
-        uint8_t mac_address_bytes[6] = {0};
-        if (std::sscanf(mac_string.c_str(), "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx", &mac_address_bytes[0],
-                &mac_address_bytes[1], &mac_address_bytes[2], &mac_address_bytes[3],
-                &mac_address_bytes[4], &mac_address_bytes[5]) != 6)
+        address_length_bytes = sizeof(sockaddr_in);
+        return true;
+    }
+    else if (m_ip_family == AF_INET6)
+    {
+        auto *ipv6 = reinterpret_cast<sockaddr_in6 *>(&address);
+        ipv6->sin6_family = AF_INET6;
+        ipv6->sin6_port = htons(m_port);
+        if (inet_pton(AF_INET6, m_ip_address->to_string().c_str(), &ipv6->sin6_addr) != 1)
         {
-            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
-                "Socket {} / {}: failed to parse MAC address '{}' from /proc/net/arp.",
-                static_cast<void *>(this), to_string(), mac_string);
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Socket {} / {}: inet_pton() failed.",
+                static_cast<const void *>(this), to_string());
             return false;
         }
 
-        auto mac_address_opt =
-            ethernet_address_factory::from_array(mac_address_bytes, sizeof(mac_address_bytes));
-        if (!mac_address_opt.has_value())
+        /**
+         * @attention link-local addresses are only reachable through the interface of their scope.
+         */
+        if (const auto *ip_address = dynamic_cast<ethernet_ipv6_address *>(m_ip_address.get()))
         {
-            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
-                "Socket {} / {}: failed to convert MAC address from byte array.",
-                static_cast<void *>(this), to_string());
-            return false;
+            ipv6->sin6_scope_id = ip_address->scope_id();
         }
 
-        mac_address = *mac_address_opt;
-
+        address_length_bytes = sizeof(sockaddr_in6);
         return true;
     }
 
-    SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
-        "Socket {} / {}: no matching MAC address found in /proc/net/arp.",
-        static_cast<void *>(this), to_string());
+    SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Socket {} / {}: unsupported address family {}.",
+        static_cast<const void *>(this), to_string(), m_ip_family);
+
     return false;
+}
+
+auto ethernet_socket::read_out_mac_address(ethernet_mac_address &mac_address) -> const bool
+{
+#ifdef _WIN32
 
-#elif defined __APPLE__
+    IPAddr connected_ip_address = {};
 
-    struct in_addr ip_address = {};
-    if (inet_pton(AF_INET, m_ip_address->to_string().c_str(), &ip_address) != 1)
+    int result = InetPton(m_ip_family, m_ip_address->to_string().c_str(), &connected_ip_address);
+    if (result != 1)
     {
-        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
-            "Socket {} / {}: inet_pton() failed to convert IP address.", static_cast<void *>(this),
-            to_string());
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Socket {} / {}: InetPton() failed with error: {}.",
+            static_cast<void *>(this), to_string(),
+            ethernet_tools::get_last_error_code_as_string());
         return false;
     }
 
-    constexpr const uint8_t name_size_bytes = 6;
-
-    int name[name_size_bytes] = {};
-    name[0] = CTL_NET;
-    name[1] = PF_ROUTE;
-    name[2] = 0;
-    name[3] = AF_INET;
-    name[4] = NET_RT_FLAGS;
-    name[5] = RTF_LLINFO;
+    BYTE mac_address_bytes[6] = {0};
+    ULONG mac_address_length = 6;
 
-    size_t buffer_size_bytes = 0;
-    if (sysctl(name, name_size_bytes, NULL, &buffer_size_bytes, NULL, 0) == -1)
+    result = SendARP(connected_ip_address, 0, mac_address_bytes, &mac_address_length);
+    if (result != NO_ERROR)
     {
-        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
-            "Socket {} / {}: sysctl() failed to get size with error: {}.",
-            static_cast<void *>(this), to_string(),
-            ethernet_tools::get_last_error_code_as_string());
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "Socket {} / {}: SendARP() failed with error: {} (code {}).", static_cast<void *>(this),
+            to_string(), ethernet_tools::get_error_code_as_string(result), result);
         return false;
     }
 
-    std::vector<char> buffer(buffer_size_bytes);
-    if (sysctl(name, name_size_bytes, buffer.data(), &buffer_size_bytes, NULL, 0) == -1)
+    auto mac_address_opt =
+        ethernet_address_factory::from_array(mac_address_bytes, sizeof(mac_address_bytes));
+    if (!mac_address_opt.has_value())
     {
         SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
-            "Socket {} / {}: sysctl() failed to get data with error: {}.",
-            static_cast<void *>(this), to_string(),
-            ethernet_tools::get_last_error_code_as_string());
+            "Socket {} / {}: failed to convert MAC address from byte array.",
+            static_cast<void *>(this), to_string());
         return false;
     }
 
-    char *next = buffer.data();
-    char *end = buffer.data() + buffer_size_bytes;
-
-    while (next < end)
-    {
-        struct rt_msghdr *rtm = (struct rt_msghdr *)next;
-        struct sockaddr_inarp *sin = (struct sockaddr_inarp *)(rtm + 1);
-        struct sockaddr_dl *sdl = (struct sockaddr_dl *)((char *)sin + SA_SIZE(sin));
-
-        if (sin->sin_addr.s_addr == ip_address.s_addr && sdl->sdl_alen)
-        {
-            unsigned char *mac = (unsigned char *)LLADDR(sdl);
-            auto mac_address_opt = ethernet_address_factory::from_array(mac, 6);
-            if (!mac_address_opt.has_value())
-            {
-                SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
-                    "Socket {} / {}: failed to convert MAC address from byte array.",
-                    static_cast<void *>(this), to_string());
-                return false;
-            }
+    mac_address = *mac_address_opt;
 
-            mac_address = *mac_address_opt;
+    return true;
 
-            return true;
-        }
+#else
 
-        next += rtm->rtm_msglen;
+    /**
+     * @attention the entry only exists after the kernel has resolved the peer, which is the case
+     * once the socket is connected to a host on the local link.
+     */
+    auto mac_address_opt = ethernet_neighbor_cache::instance().find(m_ip_address->to_string());
+    if (!mac_address_opt)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "Socket {} / {}: no matching MAC address found in neighbor table.",
+            static_cast<void *>(this), to_string());
+        return false;
     }
 
-    return false;
+    mac_address = *mac_address_opt;
+
+    return true;
 #endif
 }
@@ -4,9 +4,27 @@
 #pragma once
 
 #include <communications/ethernet/ethernet_address.h>
+#include <communications/ethernet/ethernet_receive_region.h>
+#include <communications/ethernet/ethernet_uring.h>
 #include <libkommpot.h>
 
+#include <array>
+#include <chrono>
 #include <cstring>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+// clang-format off
+#    include <winsock2.h>
+#    include <ws2tcpip.h>
+// clang-format on
+#else
+#    include <sys/socket.h>
+#endif
 
 class ethernet_socket
 {
@@ -14,20 +32,249 @@ public:
     ethernet_socket();
     ~ethernet_socket();
 
+    /**
+     * @warning states class is non-copyable.
+     */
+    ethernet_socket(const ethernet_socket &obj) = delete;
+    auto operator=(const ethernet_socket &obj) -> ethernet_socket & = delete;
+
+    /**
+     * @brief moving transfers ownership of the OS handle, the source is left unconnected.
+     */
+    ethernet_socket(ethernet_socket &&obj) noexcept;
+    auto operator=(ethernet_socket &&obj) noexcept -> ethernet_socket &;
+
     [[nodiscard]] auto initialize(const std::shared_ptr<ethernet_ip_address> ip_address,
         const uint16_t &port, const kommpot::ethernet_protocol_type &protocol) -> const bool;
 
     [[nodiscard]] auto connect() -> const bool;
     [[nodiscard]] auto disconnect() -> const bool;
 
+    /**
+     * @brief split connect() for racing several sockets: begin_connect() starts the handshake
+     * without waiting, end_connect() completes it once wait_for_connect() reported the socket.
+     * @attention a connect timeout has to be set, otherwise begin_connect() blocks.
+     */
+    [[nodiscard]] auto begin_connect() -> const bool;
+    [[nodiscard]] auto end_connect() -> const bool;
+    [[nodiscard]] auto is_connect_pending() const -> const bool;
+
+    /**
+     * @brief waits until at least one of the pending connects succeeded or failed.
+     * @return sockets whose connect finished, empty on timeout.
+     */
+    [[nodiscard]] static auto wait_for_connect(const std::vector<ethernet_socket *> &sockets,
+        const uint32_t &timeout_msecs) -> std::vector<ethernet_socket *>;
+
+    /**
+     * @brief connects all sockets at once, with io_uring enabled on every socket the handshakes
+     * are submitted together with their timeouts in a single system call.
+     * @return per socket whether it is connected.
+     */
+    [[nodiscard]] static auto connect_all(const std::vector<ethernet_socket *> &sockets)
+        -> std::vector<bool>;
+
     [[nodiscard]] auto is_connected() const -> const bool;
 
+    /**
+     * @brief checks without blocking that an idle connection has not been closed or reset by the
+     * peer, pending unread data counts as alive.
+     */
+    [[nodiscard]] auto is_alive() const -> const bool;
+
     [[nodiscard]] auto read(void *data, size_t size_bytes) const -> const bool;
     [[nodiscard]] auto write(void *data, size_t size_bytes) const -> const bool;
 
+    /**
+     * @brief reads whatever arrives first, at most size_bytes.
+     * @return false if nothing arrived within the timeout, the peer closed or an error happened.
+     */
+    [[nodiscard]] auto read_some(void *data, size_t size_bytes, size_t &received_size_bytes,
+        const uint32_t &timeout_msecs) const -> const bool;
+
     [[nodiscard]] auto set_timeout(const uint32_t &timeout_msecs) -> const bool;
 
-    [[nodiscard]] auto hostname() const -> const std::string;
+    /**
+     * @brief datagram batches of connected UDP sockets, a single recvmmsg() / sendmmsg() moves up
+     * to M_MAX_BATCH_MESSAGES datagrams. read_messages() waits for the first datagram only.
+     * @return false if nothing arrived within the timeout or if any error happened.
+     */
+    [[nodiscard]] auto read_messages(std::vector<kommpot::message_buffer> &messages,
+        size_t &received_count, const uint32_t &timeout_msecs) -> const bool;
+    [[nodiscard]] auto write_messages(const std::vector<kommpot::message_buffer> &messages) const
+        -> const bool;
+
+    /**
+     * @brief lets write_messages() send a run of equally sized datagrams, the last one may be
+     * shorter, as one UDP_SEGMENT buffer the OS splits, has to be called on a connected socket.
+     * @return false if the OS does not support UDP segmentation offload (Linux 4.18+ only).
+     */
+    [[nodiscard]] auto set_udp_segmentation(const bool is_enabled) -> const bool;
+
+    /**
+     * @brief lets the OS coalesce received datagrams of the flow with UDP_GRO, read_messages()
+     * receives them into internal buffers and splits them again.
+     * @return false if the OS does not support UDP receive offload (Linux 5.0+ only).
+     */
+    [[nodiscard]] auto set_udp_gro(const bool is_enabled) -> const bool;
+
+    /**
+     * @brief lets write_zero_copy() send large buffers with MSG_ZEROCOPY, the OS then transmits
+     * from the pinned user pages and reports on the error queue once it released them.
+     * @return false if the OS does not support zero-copy sends (Linux 4.14+ only).
+     */
+    [[nodiscard]] auto set_zero_copy(const bool is_enabled) -> const bool;
+
+    /**
+     * @brief writes smaller than the threshold are copied and completed right away, or together
+     * with the zero-copy write before them while it is pending.
+     */
+    auto set_zero_copy_threshold(const size_t &threshold_bytes) -> void;
+
+    /**
+     * @brief sends without copying if zero copy is enabled and the write reaches the threshold,
+     * the callback is called once the OS released the buffer, possibly before returning.
+     * @attention callbacks are called in write order, also for writes that were copied.
+     * @return false if any error happened, the callback is not called then.
+     */
+    [[nodiscard]] auto write_zero_copy(
+        const void *data, size_t size_bytes, std::function<void()> callback) -> const bool;
+
+    /**
+     * @brief waits for the completion of all zero-copy writes and calls their callbacks.
+     * @return false if writes are still pending after the timeout.
+     */
+    [[nodiscard]] auto flush_zero_copy(const uint32_t &timeout_msecs) -> const bool;
+    [[nodiscard]] auto zero_copy_pending_count() const -> size_t;
+
+    /**
+     * @brief states how many completions reported that the OS copied the data nevertheless, e.g.
+     * on loopback or if the NIC lacks scatter-gather and checksum offload.
+     */
+    [[nodiscard]] auto zero_copy_copied_count() const -> uint64_t;
+
+    /**
+     * @brief lets read_view() map received pages with TCP_ZEROCOPY_RECEIVE instead of copying
+     * them, has to be called on a connected socket.
+     * @return false if the OS does not support zero-copy receive (Linux 4.18+ only).
+     */
+    [[nodiscard]] auto set_zero_copy_receive(const bool is_enabled) -> const bool;
+
+    /**
+     * @brief reads whatever arrives first like read_some(), at most max_size_bytes. Whole pages
+     * are mapped while zero-copy receive is enabled and a slot is free, the rest is copied into
+     * a pooled buffer.
+     * @return false if nothing arrived within the timeout, the peer closed or an error happened.
+     */
+    [[nodiscard]] auto read_view(size_t max_size_bytes, kommpot::received_view &view,
+        const uint32_t &timeout_msecs) -> const bool;
+
+    /**
+     * @brief states how many bytes read_view() mapped and how many it copied.
+     */
+    [[nodiscard]] auto zero_copy_mapped_bytes() const -> uint64_t;
+    [[nodiscard]] auto zero_copy_received_copied_bytes() const -> uint64_t;
+
+    /**
+     * @brief routes connect(), read(), write() and read_some() through the io_uring of the calling
+     * thread, every call then costs a single system call including its timeout.
+     * @return false if io_uring is not available, the socket keeps using plain system calls then.
+     */
+    [[nodiscard]] auto set_io_uring(const bool is_enabled) -> const bool;
+    [[nodiscard]] auto is_io_uring_enabled() const -> const bool;
+
+    /**
+     * @brief lets the OS timestamp received and sent data with SO_TIMESTAMPING, read by
+     * read_timestamped() and write_timestamped(). Hardware timestamps are only taken if the NIC
+     * was configured for them, has to be called on a connected socket to detect that.
+     * @return false if the OS does not support timestamping (Linux only).
+     */
+    [[nodiscard]] auto set_timestamping(const bool is_enabled, const bool is_hardware_enabled)
+        -> const bool;
+
+    /**
+     * @brief states if the NIC of the connection reports hardware transmit timestamps.
+     */
+    [[nodiscard]] auto is_hardware_timestamping_enabled() const -> const bool;
+
+    /**
+     * @brief reads whatever arrives first like read_some() and reports when the OS received the
+     * last packet of it. Timestamps stay empty while timestamping is disabled.
+     * @return false if nothing arrived within the timeout, the peer closed or an error happened.
+     */
+    [[nodiscard]] auto read_timestamped(void *data, size_t size_bytes,
+        size_t &received_size_bytes, kommpot::transfer_timestamps &timestamps,
+        const uint32_t &timeout_msecs) -> const bool;
+
+    /**
+     * @brief writes like write() and waits until the OS reports when it handed the last byte to
+     * the driver, and with hardware timestamping when it left the NIC.
+     * @return false if any error happened, timestamps not reported within the timeout stay empty.
+     */
+    [[nodiscard]] auto write_timestamped(const void *data, size_t size_bytes,
+        kommpot::transfer_timestamps &timestamps, const uint32_t &timeout_msecs) -> const bool;
+
+    /**
+     * @brief overrides connect timeout set by set_timeout() without touching read/write timeouts.
+     */
+    auto set_connect_timeout(const uint32_t &timeout_msecs) -> void;
+
+    /**
+     * @brief states how long the last connect() took until the peer answered, either by accepting
+     * or by refusing the connection.
+     * @return round trip time or std::nullopt if the peer did not answer.
+     */
+    [[nodiscard]] auto connect_rtt_usecs() const -> const std::optional<uint64_t>;
+    [[nodiscard]] auto set_broadcast(const bool is_enabled) -> const bool;
+
+    /**
+     * @brief makes disconnect() reset the connection (SO_LINGER 0) instead of a graceful close, so
+     * the local port does not linger in TIME_WAIT.
+     */
+    [[nodiscard]] auto set_abortive_close(const bool is_enabled) -> const bool;
+
+    /**
+     * @brief sends the first write() together with the SYN if the peer handed out a TFO cookie
+     * before, has to be called before connect(). Connect RTT is not measured then, as connect()
+     * returns before the handshake.
+     * @return false if the OS does not support client side TCP Fast Open.
+     */
+    [[nodiscard]] auto set_fast_open(const bool is_enabled) -> const bool;
+
+    /**
+     * @brief applies the socket options of the profile, has to be called before connect() for the
+     * buffer sizes to take effect on the TCP window.
+     * @return false if any option could not be applied, the others stay applied.
+     */
+    [[nodiscard]] auto set_profile(const kommpot::ethernet_socket_profile &profile) -> const bool;
+    [[nodiscard]] auto profile() const -> const kommpot::ethernet_socket_profile;
+
+    /**
+     * @brief datagram helpers for connectionless UDP sockets, the peer is the address and port
+     * passed to initialize(). A failed receive_from() states the socket error in error_code, 0
+     * if no datagram arrived within the timeout.
+     */
+    [[nodiscard]] auto send_to(const void *data, size_t size_bytes) const -> const bool;
+    [[nodiscard]] auto receive_from(void *data, size_t size_bytes, size_t &received_size_bytes,
+        std::shared_ptr<ethernet_ip_address> &source_address, const uint32_t &timeout_msecs,
+        int32_t &error_code) const -> const bool;
+
+    /**
+     * @brief binds to the port passed to initialize() and joins the multicast group passed as
+     * address, reads deliver the datagrams of the group afterwards. A source restricts them to
+     * datagrams of that sender (source-specific multicast, RFC 4607).
+     * @param interface_index states the interface to join on, 0 lets the OS choose by route.
+     * @attention SO_REUSEADDR lets several sockets of the machine join the same group and port.
+     * The socket counts as connected for reads, writes fail as it has no peer.
+     */
+    [[nodiscard]] auto join_multicast(const std::shared_ptr<ethernet_ip_address> &source,
+        const uint32_t &interface_index) -> const bool;
+
+    /**
+     * @brief lets datagrams sent to a multicast group reach members on the same machine.
+     */
+    [[nodiscard]] auto set_multicast_loop(const bool is_enabled) -> const bool;
+
     [[nodiscard]] auto mac_address() const -> const ethernet_mac_address;
 
     [[nodiscard]] auto native_handle() const -> void *;
@@ -55,20 +302,159 @@ private:
     static constexpr int32_t ETH_SOCKET_ERROR = -1;
 
     uint64_t m_handle = ETH_INVALID_SOCKET;
-    std::string m_hostname = "";
     ethernet_mac_address m_mac_address;
     bool m_is_connected = false;
 
     /**
      * @brief bounds connect(); 0 keeps the OS-default blocking connect behaviour.
      */
+    uint32_t m_connect_timeout_msecs = 0;
+    std::optional<uint64_t> m_connect_rtt_usecs = std::nullopt;
+    std::chrono::steady_clock::time_point m_connect_start = {};
+    bool m_is_connect_pending = false;
+    kommpot::ethernet_socket_profile m_profile = kommpot::ethernet_socket_profile::DEFAULT;
+    bool m_is_quick_ack_enabled = false;
+
+    /**
+     * @brief read / write timeout, SO_RCVTIMEO and SO_SNDTIMEO do not apply to io_uring.
+     */
     uint32_t m_timeout_msecs = 0;
+    bool m_is_io_uring_enabled = false;
+
+    /**
+     * @brief every successful MSG_ZEROCOPY send() gets the next ID, a completion reports a range
+     * of IDs, a write completes once the ID of its last send() was reported.
+     */
+    struct zero_copy_write
+    {
+        uint32_t last_id = 0;
+        std::function<void()> callback = nullptr;
+    };
+
+    static constexpr size_t M_DEFAULT_ZERO_COPY_THRESHOLD_BYTES = 16 * 1024;
+
+    bool m_is_zero_copy_enabled = false;
+    size_t m_zero_copy_threshold_bytes = M_DEFAULT_ZERO_COPY_THRESHOLD_BYTES;
+    uint32_t m_zero_copy_next_id = 0;
+    uint64_t m_zero_copy_copied_count = 0;
+    std::deque<zero_copy_write> m_zero_copy_writes;
+
+    /**
+     * @brief shared with the views of mapped pages, so they stay valid after the socket closed.
+     */
+    std::shared_ptr<ethernet_receive_region> m_receive_region = nullptr;
+    std::shared_ptr<kommpot::buffer_pool> m_receive_pool = nullptr;
+    uint64_t m_zero_copy_mapped_bytes = 0;
+    uint64_t m_zero_copy_received_copied_bytes = 0;
+
+    /**
+     * @brief datagrams per recvmmsg() / sendmmsg(), segments per UDP_SEGMENT send (UDP_MAX_SEGMENTS
+     * of older kernels) and the largest UDP payload of an IPv4 packet.
+     */
+    static constexpr size_t M_MAX_BATCH_MESSAGES = 64;
+    static constexpr size_t M_MAX_SEGMENTS = 64;
+    static constexpr size_t M_MAX_DATAGRAM_SIZE_BYTES = 65507;
+    static constexpr size_t M_GRO_BUFFER_COUNT = 8;
+
+    /**
+     * @brief datagram of a coalesced receive not handed out yet.
+     */
+    struct datagram_segment
+    {
+        const uint8_t *data = nullptr;
+        size_t size_bytes = 0;
+        bool is_truncated = false;
+    };
+
+    bool m_is_udp_segmentation_enabled = false;
+    size_t m_udp_max_segment_size_bytes = 0;
+    bool m_is_udp_gro_enabled = false;
+    std::vector<std::vector<uint8_t>> m_gro_buffers;
+    std::deque<datagram_segment> m_gro_segments;
+
+    /**
+     * @brief transmit timestamps read from the error queue since the last write_timestamped()
+     * started, only those reported for its key are kept.
+     */
+    bool m_is_timestamping_enabled = false;
+    bool m_is_hardware_timestamping_enabled = false;
+    uint32_t m_timestamping_flags = 0;
+    uint32_t m_transmit_timestamp_key = 0;
+    kommpot::transfer_timestamps m_transmit_timestamps;
 
+    /**
+     * @brief a refused connection is an answer of the peer as well, so its duration is an RTT.
+     */
+    auto store_connect_rtt() -> void;
     auto close_socket() -> const bool;
 
+    auto set_option(const int level, const int name, const int value, const char *name_string)
+        -> const bool;
+    [[nodiscard]] auto get_option(const int level, const int name) const -> std::optional<int>;
+    auto rearm_quick_ack() const -> void;
+
     [[nodiscard]] auto set_blocking(const bool blocking) -> const bool;
+    [[nodiscard]] auto complete_connect() -> const bool;
+
+    /**
+     * @brief refills the coalesced segments if none are left, then copies them into messages.
+     */
+    [[nodiscard]] auto read_coalesced_messages(std::vector<kommpot::message_buffer> &messages,
+        size_t &received_count, const uint32_t &timeout_msecs) -> const bool;
+
+    /**
+     * @brief states how many messages from index on can be sent as one UDP_SEGMENT buffer.
+     */
+    [[nodiscard]] auto segment_run_length(const std::vector<kommpot::message_buffer> &messages,
+        const size_t &index, const size_t &max_count) const -> size_t;
+
+    /**
+     * @brief reads zero-copy completions from the error queue and calls finished callbacks.
+     * @return false if none arrived within the timeout.
+     */
+    auto reap_zero_copy(const uint32_t &timeout_msecs) -> const bool;
+
+    /**
+     * @brief waits until the error queue holds a message, it is signalled by POLLERR.
+     */
+    [[nodiscard]] auto wait_for_error_queue(const uint32_t &timeout_msecs) const -> const bool;
+
+    /**
+     * @brief drains the error queue, zero-copy completions call finished callbacks and transmit
+     * timestamps are stored, so neither consumer discards messages of the other one.
+     * @return true if any zero-copy completion was read.
+     */
+    auto read_error_queue() -> const bool;
+
+    /**
+     * @brief sets SOF_TIMESTAMPING_OPT_ID anew, so the OS numbers the bytes (TCP) or datagrams
+     * (UDP) sent from now on from offset on.
+     * @return false if the OS does not support it.
+     */
+    [[nodiscard]] auto restart_timestamp_key(uint32_t &offset) -> const bool;
+
+    /**
+     * @brief looks up the interface of the local address and asks its driver whether transmit
+     * timestamps are taken in hardware (SIOCGHWTSTAMP).
+     */
+    [[nodiscard]] auto is_hardware_timestamping_configured() const -> const bool;
+
+    /**
+     * @return ring of the calling thread if io_uring is enabled, nullptr otherwise.
+     */
+    [[nodiscard]] auto io_uring() const -> ethernet_uring *;
+
+    /**
+     * @return transferred bytes or negative errno, -ETIMEDOUT once the timeout elapsed.
+     */
+    [[nodiscard]] auto transfer(ethernet_uring &ring, const ethernet_uring::operation_type &type,
+        void *data, size_t size_bytes, const int flags, const uint32_t &timeout_msecs) const
+        -> int64_t;
+    [[nodiscard]] auto wait_for_readable(const uint32_t &timeout_msecs) const -> const bool;
+
+    [[nodiscard]] auto to_sockaddr(sockaddr_storage &address, socklen_t &address_length_bytes) const
+        -> const bool;
 
-    [[nodiscard]] auto read_out_hostname(std::string &hostname) -> const bool;
     [[nodiscard]] auto read_out_mac_address(ethernet_mac_address &mac_address) -> const bool;
 };
 
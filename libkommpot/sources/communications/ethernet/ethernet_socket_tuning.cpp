@@ -0,0 +1,33 @@
+#include <communications/ethernet/ethernet_socket_tuning.h>
+
+auto ethernet_socket_tuning::from_profile(const kommpot::ethernet_socket_profile &profile)
+    -> ethernet_socket_tuning
+{
+    ethernet_socket_tuning tuning;
+
+    switch (profile)
+    {
+    case kommpot::ethernet_socket_profile::LOW_LATENCY: {
+        tuning.is_no_delay_enabled = true;
+        tuning.is_quick_ack_enabled = true;
+        tuning.busy_poll_usecs = M_BUSY_POLL_USEC;
+        tuning.dscp = M_DSCP_EXPEDITED_FORWARDING;
+        tuning.keepalive_idle_secs = 10;
+        tuning.keepalive_interval_secs = 2;
+        tuning.keepalive_probe_count = 3;
+        break;
+    }
+    case kommpot::ethernet_socket_profile::BULK_THROUGHPUT: {
+        tuning.buffer_size_bytes = M_BULK_BUFFER_SIZE_BYTES;
+        tuning.dscp = M_DSCP_ASSURED_FORWARDING_11;
+        tuning.keepalive_idle_secs = 60;
+        tuning.keepalive_interval_secs = 10;
+        tuning.keepalive_probe_count = 5;
+        break;
+    }
+    default:
+        break;
+    }
+
+    return tuning;
+}
@@ -0,0 +1,52 @@
+#ifndef ETHERNET_SOCKET_TUNING_H
+#define ETHERNET_SOCKET_TUNING_H
+
+#pragma once
+
+#include <libkommpot.h>
+
+#include <cstdint>
+
+/**
+ * @brief socket options behind an ethernet_socket_profile, a zero value keeps the OS default.
+ */
+struct ethernet_socket_tuning
+{
+    bool is_no_delay_enabled = false;
+
+    /**
+     * @attention Linux only, the kernel falls back to delayed ACKs after a while, so the option is
+     * re-armed after every read.
+     */
+    bool is_quick_ack_enabled = false;
+
+    /**
+     * @attention the OS caps the value at its maximum (net.core.rmem_max / wmem_max on Linux).
+     */
+    uint32_t buffer_size_bytes = 0;
+
+    /**
+     * @attention Linux only, raising it above net.core.busy_read requires CAP_NET_ADMIN.
+     */
+    uint32_t busy_poll_usecs = 0;
+
+    /**
+     * @brief differentiated services code point, written to IP_TOS / IPV6_TCLASS.
+     */
+    uint8_t dscp = 0;
+
+    uint32_t keepalive_idle_secs = 0;
+    uint32_t keepalive_interval_secs = 0;
+    uint32_t keepalive_probe_count = 0;
+
+    [[nodiscard]] static auto from_profile(const kommpot::ethernet_socket_profile &profile)
+        -> ethernet_socket_tuning;
+
+private:
+    static constexpr uint8_t M_DSCP_EXPEDITED_FORWARDING = 46;
+    static constexpr uint8_t M_DSCP_ASSURED_FORWARDING_11 = 10;
+    static constexpr uint32_t M_BULK_BUFFER_SIZE_BYTES = 4 * 1024 * 1024;
+    static constexpr uint32_t M_BUSY_POLL_USEC = 50;
+};
+
+#endif // ETHERNET_SOCKET_TUNING_H
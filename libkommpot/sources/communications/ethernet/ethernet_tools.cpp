@@ -1,6 +1,9 @@
 #include <communications/ethernet/ethernet_tools.h>
 
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <sstream>
 
 #ifdef _WIN32
 // clang-format off
@@ -8,6 +11,14 @@
 // clang-format on
 #endif
 
+#ifdef __linux__
+#    include <fstream>
+#endif
+
+#ifdef __APPLE__
+#    include <sys/sysctl.h>
+#endif
+
 auto ethernet_tools::get_last_error_code_as_string() -> const std::string
 {
     const auto error_code = get_error_code();
@@ -60,3 +71,144 @@ auto ethernet_tools::get_error_code_as_string(const int32_t &error_code) -> cons
     return std::strerror(error_code);
 #endif
 }
+
+auto ethernet_tools::get_ephemeral_port_count() -> const uint32_t
+{
+    /**
+     * @attention IANA dynamic range 49152-65535, used by Windows and as fallback elsewhere.
+     */
+    constexpr uint32_t default_port_count = 16384;
+
+#ifdef __linux__
+    std::ifstream port_range("/proc/sys/net/ipv4/ip_local_port_range");
+
+    uint32_t first_port = 0;
+    uint32_t last_port = 0;
+    if (!(port_range >> first_port >> last_port) || last_port < first_port)
+    {
+        return default_port_count;
+    }
+
+    return last_port - first_port + 1;
+#elif defined __APPLE__
+    int first_port = 0;
+    int last_port = 0;
+    size_t value_size_bytes = sizeof(int);
+
+    if (sysctlbyname("net.inet.ip.portrange.first", &first_port, &value_size_bytes, NULL, 0) != 0 ||
+        sysctlbyname("net.inet.ip.portrange.last", &last_port, &value_size_bytes, NULL, 0) != 0 ||
+        last_port < first_port)
+    {
+        return default_port_count;
+    }
+
+    return static_cast<uint32_t>(last_port - first_port + 1);
+#else
+    return default_port_count;
+#endif
+}
+
+auto ethernet_tools::parse_default_gateways(std::istream &table, const bool is_ipv6)
+    -> const std::unordered_map<std::string, std::string>
+{
+    /**
+     * @attention RTF_GATEWAY (0x2) marks routes via a gateway, /proc/net/route starts with a
+     * header line, /proc/net/ipv6_route has none.
+     */
+    constexpr uint32_t gateway_flag = 0x2;
+
+    std::unordered_map<std::string, std::string> gateways;
+    std::unordered_map<std::string, uint32_t> metrics;
+
+    std::string line;
+    if (!is_ipv6)
+    {
+        std::getline(table, line);
+    }
+
+    while (std::getline(table, line))
+    {
+        std::istringstream stream(line);
+        std::string interface_name;
+        std::string destination;
+        std::string destination_prefix = "00";
+        std::string gateway;
+        std::string flags_string;
+        std::string metric_string;
+
+        if (is_ipv6)
+        {
+            std::string source;
+            std::string source_prefix;
+            std::string reference_count;
+            std::string use_count;
+            if (!(stream >> destination >> destination_prefix >> source >> source_prefix >>
+                    gateway >> metric_string >> reference_count >> use_count >> flags_string >>
+                    interface_name))
+            {
+                continue;
+            }
+        }
+        else
+        {
+            std::string reference_count;
+            std::string use_count;
+            if (!(stream >> interface_name >> destination >> gateway >> flags_string >>
+                    reference_count >> use_count >> metric_string))
+            {
+                continue;
+            }
+        }
+
+        const auto flags = std::strtoul(flags_string.c_str(), nullptr, 16);
+        const bool is_default = destination.find_first_not_of('0') == std::string::npos &&
+                                destination_prefix == "00";
+        if (!is_default || (flags & gateway_flag) == 0 ||
+            gateway.find_first_not_of('0') == std::string::npos)
+        {
+            continue;
+        }
+
+        std::string address;
+        if (is_ipv6)
+        {
+            if (gateway.size() != 32)
+            {
+                continue;
+            }
+
+            for (size_t offset = 0; offset < gateway.size(); offset += 4)
+            {
+                address += (offset == 0 ? "" : ":") + gateway.substr(offset, 4);
+            }
+        }
+        else
+        {
+            /**
+             * @attention the kernel prints the address in network byte order as a host integer,
+             * so its bytes in memory are the address bytes.
+             */
+            const auto value = static_cast<uint32_t>(std::strtoul(gateway.c_str(), nullptr, 16));
+            uint8_t bytes[4] = {0};
+            std::memcpy(bytes, &value, sizeof(bytes));
+
+            char buffer[16] = {0};
+            std::snprintf(
+                buffer, sizeof(buffer), "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]);
+            address = buffer;
+        }
+
+        const auto metric = static_cast<uint32_t>(
+            std::strtoul(metric_string.c_str(), nullptr, is_ipv6 ? 16 : 10));
+        auto it = metrics.find(interface_name);
+        if (it != metrics.end() && it->second <= metric)
+        {
+            continue;
+        }
+
+        metrics[interface_name] = metric;
+        gateways[interface_name] = address;
+    }
+
+    return gateways;
+}
@@ -4,7 +4,9 @@
 #pragma once
 
 #include <stdint.h>
+#include <istream>
 #include <string>
+#include <unordered_map>
 
 namespace ethernet_tools {
 /**
@@ -13,6 +15,20 @@ namespace ethernet_tools {
 [[nodiscard]] auto get_last_error_code_as_string() -> const std::string;
 [[nodiscard]] auto get_error_code() -> const int32_t;
 [[nodiscard]] auto get_error_code_as_string(const int32_t &error_code) -> const std::string;
+
+/**
+ * @brief states how many local ports the OS hands out to outgoing connections.
+ * @return size of the ephemeral port range, the OS default if it cannot be read.
+ */
+[[nodiscard]] auto get_ephemeral_port_count() -> const uint32_t;
+
+/**
+ * @brief reads the default routes of a /proc/net/route (IPv4) or /proc/net/ipv6_route (IPv6)
+ * formatted table, the route of lowest metric wins per interface.
+ * @return gateway address as string by interface name.
+ */
+[[nodiscard]] auto parse_default_gateways(std::istream &table, const bool is_ipv6)
+    -> const std::unordered_map<std::string, std::string>;
 }; // namespace ethernet_tools
 
 #endif // ETHERNET_TOOLS_H
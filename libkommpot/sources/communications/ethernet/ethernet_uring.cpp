@@ -0,0 +1,497 @@
+#include <communications/ethernet/ethernet_uring.h>
+
+#include <kommpot_core.h>
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef __linux__
+#    include <sys/syscall.h>
+#    if __has_include(<linux/io_uring.h>) && defined(__NR_io_uring_setup)
+#        define ETH_IO_URING_AVAILABLE
+#        include <cerrno>
+#        include <linux/io_uring.h>
+#        include <linux/time_types.h>
+#        include <sys/mman.h>
+#        include <unistd.h>
+#    endif
+#endif
+
+#ifdef ETH_IO_URING_AVAILABLE
+
+namespace
+{
+    /**
+     * @brief user data of a completion, the lowest bit tells the linked timeout from the operation.
+     */
+    constexpr uint64_t M_TIMEOUT_TAG = 1;
+
+    /**
+     * @brief user data of the cancellations of a failed batch, beyond any operation index.
+     */
+    constexpr uint64_t M_CANCEL_USER_DATA = UINT64_MAX;
+
+    auto load_acquire(const uint32_t *value) -> uint32_t
+    {
+        return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+    }
+
+    auto store_release(uint32_t *value, const uint32_t new_value) -> void
+    {
+        __atomic_store_n(value, new_value, __ATOMIC_RELEASE);
+    }
+
+    auto to_opcode(const ethernet_uring::operation_type &type) -> uint8_t
+    {
+        switch (type)
+        {
+        case ethernet_uring::operation_type::CONNECT:
+            return IORING_OP_CONNECT;
+        case ethernet_uring::operation_type::SEND:
+            return IORING_OP_SEND;
+        default:
+            return IORING_OP_RECV;
+        }
+    }
+
+    /**
+     * @brief checks that the kernel knows every opcode used here, connect / send / recv arrived
+     * later than io_uring itself.
+     */
+    auto is_probe_succeeded(const int handle) -> bool
+    {
+        constexpr size_t M_PROBE_OPS = 256;
+        std::vector<uint8_t> buffer(
+            sizeof(io_uring_probe) + M_PROBE_OPS * sizeof(io_uring_probe_op), 0);
+        auto *probe = reinterpret_cast<io_uring_probe *>(buffer.data());
+
+        if (syscall(__NR_io_uring_register, handle, IORING_REGISTER_PROBE, probe, M_PROBE_OPS) < 0)
+        {
+            return false;
+        }
+
+        for (const auto opcode :
+            {IORING_OP_CONNECT, IORING_OP_SEND, IORING_OP_RECV, IORING_OP_LINK_TIMEOUT,
+                IORING_OP_ASYNC_CANCEL})
+        {
+            if (opcode > probe->last_op || (probe->ops[opcode].flags & IO_URING_OP_SUPPORTED) == 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+} // namespace
+
+#endif
+
+ethernet_uring::~ethernet_uring()
+{
+#ifdef ETH_IO_URING_AVAILABLE
+    if (m_sqes != nullptr)
+    {
+        munmap(m_sqes, m_sqes_size_bytes);
+    }
+
+    if (m_cq_ring != nullptr && m_cq_ring != m_sq_ring)
+    {
+        munmap(m_cq_ring, m_cq_ring_size_bytes);
+    }
+
+    if (m_sq_ring != nullptr)
+    {
+        munmap(m_sq_ring, m_sq_ring_size_bytes);
+    }
+
+    if (m_handle >= 0)
+    {
+        close(m_handle);
+    }
+#endif
+}
+
+auto ethernet_uring::create(const uint32_t &entries) -> std::unique_ptr<ethernet_uring>
+{
+#ifdef ETH_IO_URING_AVAILABLE
+    io_uring_params parameters = {};
+
+    /**
+     * @attention a ring is only used by the thread that created it, so completions can be run
+     * when that thread waits instead of interrupting it, older kernels reject the flags.
+     */
+#    if defined(IORING_SETUP_SINGLE_ISSUER) && defined(IORING_SETUP_DEFER_TASKRUN)
+    parameters.flags =
+        IORING_SETUP_SUBMIT_ALL | IORING_SETUP_SINGLE_ISSUER | IORING_SETUP_DEFER_TASKRUN;
+#    endif
+
+    auto handle = static_cast<int>(syscall(__NR_io_uring_setup, entries, &parameters));
+    if (handle < 0 && errno == EINVAL && parameters.flags != 0)
+    {
+        parameters = {};
+        handle = static_cast<int>(syscall(__NR_io_uring_setup, entries, &parameters));
+    }
+
+    if (handle < 0)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "io_uring_setup() failed with error: {}.",
+            std::strerror(errno));
+        return nullptr;
+    }
+
+    std::unique_ptr<ethernet_uring> ring(new ethernet_uring());
+    ring->m_handle = handle;
+
+    if (!is_probe_succeeded(handle))
+    {
+        SPDLOG_LOGGER_DEBUG(
+            KOMMPOT_LOGGER, "io_uring does not support socket operations on this kernel.");
+        return nullptr;
+    }
+
+    if (!ring->map_rings(&parameters))
+    {
+        return nullptr;
+    }
+
+    return ring;
+#else
+    (void)entries;
+    return nullptr;
+#endif
+}
+
+auto ethernet_uring::is_supported() -> const bool
+{
+    static const bool is_supported = (create(4) != nullptr);
+    return is_supported;
+}
+
+auto ethernet_uring::thread_instance() -> ethernet_uring *
+{
+    if (!is_supported())
+    {
+        return nullptr;
+    }
+
+    thread_local std::unique_ptr<ethernet_uring> ring = create();
+
+    /**
+     * @attention closing a ring cancels whatever it still runs, the thread uses plain sockets
+     * afterwards.
+     */
+    if (ring != nullptr && ring->m_is_broken)
+    {
+        ring.reset();
+    }
+
+    return ring.get();
+}
+
+auto ethernet_uring::enter_count() const -> uint64_t
+{
+    return m_enter_count.load(std::memory_order_relaxed);
+}
+
+auto ethernet_uring::execute(std::vector<operation> &operations) -> const bool
+{
+    /**
+     * @attention every operation takes two entries, itself and its linked timeout.
+     */
+    const size_t max_chunk = std::max<size_t>(1, m_sq_entries / 2);
+
+    for (size_t offset = 0; offset < operations.size(); offset += max_chunk)
+    {
+        const auto count = std::min(max_chunk, operations.size() - offset);
+        if (!execute_chunk(operations.data() + offset, count))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+auto ethernet_uring::map_rings(const void *parameters) -> const bool
+{
+#ifdef ETH_IO_URING_AVAILABLE
+    const auto &params = *static_cast<const io_uring_params *>(parameters);
+
+    m_sq_ring_size_bytes = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    m_cq_ring_size_bytes = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+    /**
+     * @attention kernels since 5.4 map both rings with a single mmap().
+     */
+    const bool is_single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (is_single_mmap)
+    {
+        m_sq_ring_size_bytes = std::max(m_sq_ring_size_bytes, m_cq_ring_size_bytes);
+        m_cq_ring_size_bytes = m_sq_ring_size_bytes;
+    }
+
+    m_sq_ring = mmap(nullptr, m_sq_ring_size_bytes, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, m_handle, IORING_OFF_SQ_RING);
+    if (m_sq_ring == MAP_FAILED)
+    {
+        m_sq_ring = nullptr;
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "io_uring: failed to map submission ring.");
+        return false;
+    }
+
+    if (is_single_mmap)
+    {
+        m_cq_ring = m_sq_ring;
+    }
+    else
+    {
+        m_cq_ring = mmap(nullptr, m_cq_ring_size_bytes, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, m_handle, IORING_OFF_CQ_RING);
+        if (m_cq_ring == MAP_FAILED)
+        {
+            m_cq_ring = nullptr;
+            SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "io_uring: failed to map completion ring.");
+            return false;
+        }
+    }
+
+    m_sqes_size_bytes = params.sq_entries * sizeof(io_uring_sqe);
+    m_sqes = mmap(nullptr, m_sqes_size_bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+        m_handle, IORING_OFF_SQES);
+    if (m_sqes == MAP_FAILED)
+    {
+        m_sqes = nullptr;
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "io_uring: failed to map submission entries.");
+        return false;
+    }
+
+    auto *sq_ring = static_cast<uint8_t *>(m_sq_ring);
+    m_sq_head = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.head);
+    m_sq_tail = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.tail);
+    m_sq_mask = *reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.ring_mask);
+    m_sq_entries = *reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.ring_entries);
+    m_sq_array = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.array);
+
+    auto *cq_ring = static_cast<uint8_t *>(m_cq_ring);
+    m_cq_head = reinterpret_cast<uint32_t *>(cq_ring + params.cq_off.head);
+    m_cq_tail = reinterpret_cast<uint32_t *>(cq_ring + params.cq_off.tail);
+    m_cq_mask = *reinterpret_cast<uint32_t *>(cq_ring + params.cq_off.ring_mask);
+    m_cqes = cq_ring + params.cq_off.cqes;
+
+    return true;
+#else
+    (void)parameters;
+    return false;
+#endif
+}
+
+auto ethernet_uring::execute_chunk(operation *operations, const size_t &count) -> const bool
+{
+#ifdef ETH_IO_URING_AVAILABLE
+    std::vector<__kernel_timespec> timeouts(count);
+
+    auto *sqes = static_cast<io_uring_sqe *>(m_sqes);
+    auto tail = *m_sq_tail;
+    uint32_t to_submit = 0;
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        auto &op = operations[index];
+        op.result = 0;
+        op.is_timed_out = false;
+
+        const auto op_index = tail & m_sq_mask;
+        auto &sqe = sqes[op_index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = to_opcode(op.type);
+        sqe.fd = op.handle;
+        sqe.addr = reinterpret_cast<uint64_t>(op.data);
+        sqe.user_data = index << 1;
+        if (op.type == operation_type::CONNECT)
+        {
+            sqe.off = op.size_bytes;
+        }
+        else
+        {
+            sqe.len = static_cast<uint32_t>(op.size_bytes);
+            sqe.msg_flags = static_cast<uint32_t>(op.flags);
+        }
+        m_sq_array[op_index] = op_index;
+        ++tail;
+        ++to_submit;
+
+        if (op.timeout_msecs == 0)
+        {
+            continue;
+        }
+
+        sqe.flags |= IOSQE_IO_LINK;
+
+        timeouts[index].tv_sec = op.timeout_msecs / 1000;
+        timeouts[index].tv_nsec = static_cast<long long>(op.timeout_msecs % 1000) * 1000000;
+
+        const auto timeout_index = tail & m_sq_mask;
+        auto &timeout_sqe = sqes[timeout_index];
+        std::memset(&timeout_sqe, 0, sizeof(timeout_sqe));
+        timeout_sqe.opcode = IORING_OP_LINK_TIMEOUT;
+        timeout_sqe.fd = -1;
+        timeout_sqe.addr = reinterpret_cast<uint64_t>(&timeouts[index]);
+        timeout_sqe.len = 1;
+        timeout_sqe.user_data = (index << 1) | M_TIMEOUT_TAG;
+        m_sq_array[timeout_index] = timeout_index;
+        ++tail;
+        ++to_submit;
+    }
+
+    store_release(m_sq_tail, tail);
+
+    /**
+     * @attention every submitted entry completes exactly once, the linked timeout of a finished
+     * operation with -ECANCELED, so all entries are awaited before the buffers are handed back.
+     */
+    uint32_t remaining = to_submit;
+    size_t pending_operations = count;
+    auto *cqes = static_cast<io_uring_cqe *>(m_cqes);
+
+    while (remaining > 0)
+    {
+        /**
+         * @attention while operations are pending, every completion is reaped as soon as it
+         * arrives for its timestamp, the leftover timeout completions are awaited at once.
+         */
+        const auto result = enter(to_submit, (pending_operations > 0) ? 1 : remaining);
+        if (result < 0 && result != -EINTR && result != -EAGAIN && result != -EBUSY)
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "io_uring_enter() failed with error: {}.",
+                std::strerror(-result));
+
+            /**
+             * @attention operations already submitted would still write into the buffers and
+             * leave their completions to the next batch, they are cancelled and reaped first.
+             */
+            m_is_broken = !cancel_and_reap(count, remaining);
+            return false;
+        }
+
+        if (result > 0)
+        {
+            to_submit -= std::min(to_submit, static_cast<uint32_t>(result));
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        auto head = *m_cq_head;
+        const auto cq_tail = load_acquire(m_cq_tail);
+        while (head != cq_tail)
+        {
+            const auto &cqe = cqes[head & m_cq_mask];
+            const auto index = static_cast<size_t>(cqe.user_data >> 1);
+            if (index < count)
+            {
+                if ((cqe.user_data & M_TIMEOUT_TAG) != 0)
+                {
+                    operations[index].is_timed_out = (cqe.res == -ETIME);
+                }
+                else
+                {
+                    operations[index].result = cqe.res;
+                    operations[index].completion_time = now;
+                    --pending_operations;
+                }
+            }
+            ++head;
+            --remaining;
+        }
+        store_release(m_cq_head, head);
+    }
+
+    return true;
+#else
+    (void)operations;
+    (void)count;
+    return false;
+#endif
+}
+
+auto ethernet_uring::cancel_and_reap(const size_t &count, uint32_t remaining) -> const bool
+{
+#ifdef ETH_IO_URING_AVAILABLE
+    /**
+     * @attention entries the kernel has not consumed yet are taken back, they never complete.
+     */
+    const auto sq_head = load_acquire(m_sq_head);
+    remaining -= std::min(remaining, *m_sq_tail - sq_head);
+    store_release(m_sq_tail, sq_head);
+
+    auto *sqes = static_cast<io_uring_sqe *>(m_sqes);
+    auto tail = sq_head;
+    uint32_t to_submit = 0;
+
+    if (remaining > 0)
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            const auto cancel_index = tail & m_sq_mask;
+            auto &sqe = sqes[cancel_index];
+            std::memset(&sqe, 0, sizeof(sqe));
+            sqe.opcode = IORING_OP_ASYNC_CANCEL;
+            sqe.fd = -1;
+            sqe.addr = index << 1;
+            sqe.user_data = M_CANCEL_USER_DATA;
+            m_sq_array[cancel_index] = cancel_index;
+            ++tail;
+            ++to_submit;
+        }
+
+        store_release(m_sq_tail, tail);
+        remaining += to_submit;
+    }
+
+    while (remaining > 0)
+    {
+        const auto result = enter(to_submit, remaining);
+        if (result < 0 && result != -EINTR && result != -EAGAIN && result != -EBUSY)
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+                "io_uring: failed to cancel a failed batch with error: {}.",
+                std::strerror(-result));
+            return false;
+        }
+
+        if (result > 0)
+        {
+            to_submit -= std::min(to_submit, static_cast<uint32_t>(result));
+        }
+
+        auto head = *m_cq_head;
+        const auto cq_tail = load_acquire(m_cq_tail);
+        while (head != cq_tail && remaining > 0)
+        {
+            ++head;
+            --remaining;
+        }
+        store_release(m_cq_head, head);
+    }
+
+    return true;
+#else
+    (void)count;
+    (void)remaining;
+    return false;
+#endif
+}
+
+auto ethernet_uring::enter(const uint32_t &to_submit, const uint32_t &min_complete) -> int
+{
+#ifdef ETH_IO_URING_AVAILABLE
+    m_enter_count.fetch_add(1, std::memory_order_relaxed);
+
+    const auto result = syscall(__NR_io_uring_enter, m_handle, to_submit, min_complete,
+        IORING_ENTER_GETEVENTS, nullptr, 0);
+
+    return (result < 0) ? -errno : static_cast<int>(result);
+#else
+    (void)to_submit;
+    (void)min_complete;
+    return -1;
+#endif
+}
@@ -0,0 +1,128 @@
+#ifndef ETHERNET_URING_H
+#define ETHERNET_URING_H
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief io_uring submission and completion rings used by ethernet_socket, every operation is
+ * linked to its own timeout so a whole batch of connects, sends and receives costs one system call.
+ * @attention Linux only, create() returns nullptr on other OSes, on kernels without io_uring or if
+ * it is disabled by the administrator (kernel.io_uring_disabled).
+ */
+class ethernet_uring
+{
+public:
+    enum class operation_type
+    {
+        CONNECT = 0,
+        SEND = 1,
+        RECEIVE = 2
+    };
+
+    struct operation
+    {
+        operation_type type = operation_type::RECEIVE;
+        int handle = -1;
+
+        /**
+         * @brief buffer of SEND / RECEIVE, address of CONNECT.
+         */
+        void *data = nullptr;
+        size_t size_bytes = 0;
+        int flags = 0;
+
+        /**
+         * @brief cancels the operation once elapsed, 0 waits without limit.
+         */
+        uint32_t timeout_msecs = 0;
+
+        /**
+         * @brief transferred bytes or negative errno, as returned by the system call.
+         */
+        int64_t result = 0;
+        bool is_timed_out = false;
+
+        /**
+         * @brief when the completion was reaped, used to measure connect round trip times.
+         */
+        std::chrono::steady_clock::time_point completion_time = {};
+    };
+
+    ~ethernet_uring();
+
+    ethernet_uring(const ethernet_uring &obj) = delete;
+    auto operator=(const ethernet_uring &obj) -> ethernet_uring & = delete;
+
+    [[nodiscard]] static auto create(const uint32_t &entries = M_DEFAULT_ENTRIES)
+        -> std::unique_ptr<ethernet_uring>;
+
+    /**
+     * @brief probes once per process whether rings can be created and support all operations.
+     */
+    [[nodiscard]] static auto is_supported() -> const bool;
+
+    /**
+     * @brief ring of the calling thread, created on first use and released on thread exit.
+     * @return nullptr if io_uring is not supported or the ring of the thread was released after
+     * it failed.
+     */
+    [[nodiscard]] static auto thread_instance() -> ethernet_uring *;
+
+    /**
+     * @brief submits all operations and waits until every one of them completed, failed or timed
+     * out, batches larger than the ring are split.
+     * @return false if the ring itself failed, the results of the operations are undefined then.
+     */
+    [[nodiscard]] auto execute(std::vector<operation> &operations) -> const bool;
+
+    /**
+     * @brief states how many times io_uring_enter() was called on this ring.
+     */
+    [[nodiscard]] auto enter_count() const -> uint64_t;
+
+private:
+    static constexpr uint32_t M_DEFAULT_ENTRIES = 64;
+
+    int m_handle = -1;
+    void *m_sq_ring = nullptr;
+    size_t m_sq_ring_size_bytes = 0;
+    void *m_cq_ring = nullptr;
+    size_t m_cq_ring_size_bytes = 0;
+    void *m_sqes = nullptr;
+    size_t m_sqes_size_bytes = 0;
+
+    uint32_t *m_sq_head = nullptr;
+    uint32_t *m_sq_tail = nullptr;
+    uint32_t m_sq_mask = 0;
+    uint32_t m_sq_entries = 0;
+    uint32_t *m_sq_array = nullptr;
+
+    uint32_t *m_cq_head = nullptr;
+    uint32_t *m_cq_tail = nullptr;
+    uint32_t m_cq_mask = 0;
+    void *m_cqes = nullptr;
+
+    std::atomic<uint64_t> m_enter_count = 0;
+
+    /**
+     * @brief states that operations of a failed batch could not be cancelled, the kernel may
+     * still complete them into released buffers.
+     */
+    bool m_is_broken = false;
+
+    ethernet_uring() = default;
+
+    [[nodiscard]] auto map_rings(const void *parameters) -> const bool;
+    [[nodiscard]] auto execute_chunk(operation *operations, const size_t &count) -> const bool;
+    [[nodiscard]] auto cancel_and_reap(const size_t &count, uint32_t remaining) -> const bool;
+    [[nodiscard]] auto enter(const uint32_t &to_submit, const uint32_t &min_complete) -> int;
+};
+
+#endif // ETHERNET_URING_H
@@ -289,6 +289,7 @@ auto communication_libusb::close() -> void
 
     libusb_close(m_device_handle);
     m_device_handle = nullptr;
+    m_max_packet_sizes.clear();
 }
 
 auto communication_libusb::endpoints() -> std::vector<kommpot::endpoint_information>
@@ -336,13 +337,41 @@ auto communication_libusb::endpoints() -> std::vector<kommpot::endpoint_informat
 auto communication_libusb::read(
     const kommpot::transfer_configuration &configuration, void *data, size_t size_bytes) -> bool
 {
-    return transfer(configuration, data, size_bytes);
+    size_t transferred_size_bytes = 0;
+    return transfer(configuration, data, size_bytes, transferred_size_bytes);
+}
+
+auto communication_libusb::read_some(const kommpot::transfer_configuration &configuration,
+    void *data, size_t size_bytes, size_t &received_size_bytes) -> bool
+{
+    /**
+     * @attention a bulk transfer completes with the first short packet, so a large buffer collects
+     * everything the device has queued without waiting for the full size. Its size is kept a
+     * multiple of the packet size, a full last packet would overflow the buffer otherwise.
+     */
+    if (const auto *bulk = std::get_if<kommpot::bulk_transfer_configuration>(&configuration))
+    {
+        const auto packet_size_bytes = max_packet_size(bulk->endpoint);
+        if (packet_size_bytes != 0 && size_bytes >= packet_size_bytes)
+        {
+            size_bytes -= size_bytes % packet_size_bytes;
+        }
+    }
+
+    /**
+     * @attention bytes of a transfer which timed out partway were taken from the device already,
+     * they are returned instead of being dropped with the failure.
+     */
+    static_cast<void>(transfer(configuration, data, size_bytes, received_size_bytes));
+
+    return received_size_bytes > 0;
 }
 
 auto communication_libusb::write(
     const kommpot::transfer_configuration &configuration, void *data, size_t size_bytes) -> bool
 {
-    return transfer(configuration, data, size_bytes);
+    size_t transferred_size_bytes = 0;
+    return transfer(configuration, data, size_bytes, transferred_size_bytes);
 }
 
 auto communication_libusb::get_error_string(const uint32_t &native_error_code) const -> std::string
@@ -407,10 +436,11 @@ auto communication_libusb::get_port_path(libusb_device_handle *device_handle) ->
     return stream.str();
 }
 
-bool communication_libusb::transfer(
-    const kommpot::transfer_configuration &configuration, void *data, size_t size_bytes)
+bool communication_libusb::transfer(const kommpot::transfer_configuration &configuration,
+    void *data, size_t size_bytes, size_t &transferred_size_bytes)
 {
     auto *data_ptr = reinterpret_cast<unsigned char *>(data);
+    transferred_size_bytes = 0;
 
     auto result = std::visit(
         [&](const auto &s) {
@@ -420,6 +450,7 @@ bool communication_libusb::transfer(
                 int size_bytes_written = 0;
                 int result_code = libusb_bulk_transfer(m_device_handle, s.endpoint, data_ptr,
                     size_bytes, &size_bytes_written, M_TRANSFER_TIMEOUT_MSEC);
+                transferred_size_bytes = static_cast<size_t>(size_bytes_written);
                 if (result_code < 0)
                 {
                     SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
@@ -443,6 +474,7 @@ bool communication_libusb::transfer(
                     return false;
                 }
 
+                transferred_size_bytes = static_cast<size_t>(result_code);
                 return true;
             }
             else if constexpr (std::is_same_v<std::decay_t<decltype(s)>,
@@ -451,6 +483,7 @@ bool communication_libusb::transfer(
                 int size_bytes_written = 0;
                 int result_code = libusb_interrupt_transfer(m_device_handle, s.endpoint, data_ptr,
                     size_bytes, &size_bytes_written, M_TRANSFER_TIMEOUT_MSEC);
+                transferred_size_bytes = static_cast<size_t>(size_bytes_written);
                 if (result_code < 0)
                 {
                     SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
@@ -472,6 +505,28 @@ bool communication_libusb::transfer(
     return result;
 }
 
+auto communication_libusb::max_packet_size(const uint8_t &endpoint) -> size_t
+{
+    const auto it = m_max_packet_sizes.find(endpoint);
+    if (it != m_max_packet_sizes.end())
+    {
+        return it->second;
+    }
+
+    int result_code = libusb_get_max_packet_size(libusb_get_device(m_device_handle), endpoint);
+    if (result_code < 0)
+    {
+        SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+            "libusb_get_max_packet_size() failed with error {} [{}]",
+            libusb_error_name(result_code), result_code);
+        return 0;
+    }
+
+    m_max_packet_sizes[endpoint] = static_cast<size_t>(result_code);
+
+    return static_cast<size_t>(result_code);
+}
+
 auto communication_libusb::strip_trailing_lf(std::string string) -> std::string
 {
     if (!string.empty() && string.back() == '\n')
@@ -11,6 +11,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class communication_libusb : public kommpot::device_communication
@@ -30,6 +31,8 @@ public:
 
     auto read(const kommpot::transfer_configuration &configuration, void *data, size_t size_bytes)
         -> bool override;
+    auto read_some(const kommpot::transfer_configuration &configuration, void *data,
+        size_t size_bytes, size_t &received_size_bytes) -> bool override;
     auto write(const kommpot::transfer_configuration &configuration, void *data, size_t size_bytes)
         -> bool override;
 
@@ -42,6 +45,7 @@ private:
     kommpot::usb_device_identification m_identification;
     static libusb_context *m_libusb_context;
     libusb_device_handle *m_device_handle = nullptr;
+    std::unordered_map<uint8_t, size_t> m_max_packet_sizes;
     static constexpr uint32_t M_TRANSFER_TIMEOUT_MSEC = 2000;
     static constexpr uint32_t M_MAX_USB_DESCRIPTOR_LENGTH_BYTES = 255;
 
@@ -49,8 +53,12 @@ private:
         -> std::string;
     static auto get_port_path(libusb_device_handle *device_handle) -> std::string;
 
+    /**
+     * @brief reports the bytes transferred before a failure as well, e.g. before a timeout.
+     */
     auto transfer(const kommpot::transfer_configuration &configuration, void *data,
-        size_t size_bytes) -> bool;
+        size_t size_bytes, size_t &transferred_size_bytes) -> bool;
+    auto max_packet_size(const uint8_t &endpoint) -> size_t;
 
     static auto strip_trailing_lf(std::string string) -> std::string;
     static auto log(libusb_context *context, libusb_log_level level, const char *message) -> void;
@@ -11,8 +11,12 @@
 #endif
 
 #include <kommpot_core.h>
+#include <protocols/byte_scanner.h>
+#include <protocols/crc.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <spdlog/sinks/stdout_color_sinks.h>
@@ -123,20 +127,619 @@ auto kommpot::ethernet_protocol_type_to_string(const ethernet_protocol_type &typ
     case ethernet_protocol_type::UDP: {
         return "UDP";
     }
+    case ethernet_protocol_type::RAW: {
+        return "RAW";
+    }
+    default:
+        return "";
+    }
+}
+
+auto kommpot::ethernet_socket_profile_to_string(const ethernet_socket_profile &profile) noexcept
+    -> std::string
+{
+    switch (profile)
+    {
+    case ethernet_socket_profile::DEFAULT: {
+        return "DEFAULT";
+    }
+    case ethernet_socket_profile::LOW_LATENCY: {
+        return "LOW_LATENCY";
+    }
+    case ethernet_socket_profile::BULK_THROUGHPUT: {
+        return "BULK_THROUGHPUT";
+    }
+    default:
+        return "";
+    }
+}
+
+auto kommpot::modbus_function_to_string(const modbus_function &function) noexcept -> std::string
+{
+    switch (function)
+    {
+    case modbus_function::READ_HOLDING_REGISTERS: {
+        return "READ_HOLDING_REGISTERS";
+    }
+    case modbus_function::READ_INPUT_REGISTERS: {
+        return "READ_INPUT_REGISTERS";
+    }
+    case modbus_function::WRITE_SINGLE_REGISTER: {
+        return "WRITE_SINGLE_REGISTER";
+    }
+    case modbus_function::WRITE_MULTIPLE_REGISTERS: {
+        return "WRITE_MULTIPLE_REGISTERS";
+    }
+    default:
+        return "";
+    }
+}
+
+auto kommpot::rpc_status_to_string(const rpc_status &status) noexcept -> std::string
+{
+    switch (status)
+    {
+    case rpc_status::UNKNOWN: {
+        return "UNKNOWN";
+    }
+    case rpc_status::SUCCEEDED: {
+        return "SUCCEEDED";
+    }
+    case rpc_status::TIMED_OUT: {
+        return "TIMED_OUT";
+    }
+    case rpc_status::FAILED: {
+        return "FAILED";
+    }
+    case rpc_status::CANCELLED: {
+        return "CANCELLED";
+    }
+    default:
+        return "";
+    }
+}
+
+auto kommpot::framing_type_to_string(const framing_type &type) noexcept -> std::string
+{
+    switch (type)
+    {
+    case framing_type::UNKNOWN: {
+        return "UNKNOWN";
+    }
+    case framing_type::LENGTH_PREFIXED: {
+        return "LENGTH_PREFIXED";
+    }
+    case framing_type::COBS: {
+        return "COBS";
+    }
+    case framing_type::SLIP: {
+        return "SLIP";
+    }
+    default:
+        return "";
+    }
+}
+
+auto kommpot::frame_check_type_to_string(const frame_check_type &type) noexcept -> std::string
+{
+    switch (type)
+    {
+    case frame_check_type::NONE: {
+        return "NONE";
+    }
+    case frame_check_type::CRC16: {
+        return "CRC16";
+    }
+    case frame_check_type::CRC32C: {
+        return "CRC32C";
+    }
+    default:
+        return "";
+    }
+}
+
+auto kommpot::ethernet_discovery_type_to_string(const ethernet_discovery_type &type) noexcept
+    -> std::string
+{
+    switch (type)
+    {
+    case ethernet_discovery_type::UNKNOWN: {
+        return "UNKNOWN";
+    }
+    case ethernet_discovery_type::TCP_SWEEP: {
+        return "TCP_SWEEP";
+    }
+    case ethernet_discovery_type::UDP_BROADCAST: {
+        return "UDP_BROADCAST";
+    }
+    case ethernet_discovery_type::IPV6_NEIGHBOR_DISCOVERY: {
+        return "IPV6_NEIGHBOR_DISCOVERY";
+    }
     default:
         return "";
     }
 }
 
+kommpot::received_view::received_view(
+    const uint8_t *data, size_t size_bytes, std::function<void()> release)
+    : m_data(data),
+      m_size_bytes(size_bytes),
+      m_release(std::move(release))
+{}
+
+kommpot::received_view::~received_view()
+{
+    release();
+}
+
+kommpot::received_view::received_view(received_view &&obj) noexcept
+    : m_data(std::exchange(obj.m_data, nullptr)),
+      m_size_bytes(std::exchange(obj.m_size_bytes, 0)),
+      m_release(std::exchange(obj.m_release, nullptr))
+{}
+
+auto kommpot::received_view::operator=(received_view &&obj) noexcept -> received_view &
+{
+    if (this == &obj)
+    {
+        return *this;
+    }
+
+    release();
+
+    m_data = std::exchange(obj.m_data, nullptr);
+    m_size_bytes = std::exchange(obj.m_size_bytes, 0);
+    m_release = std::exchange(obj.m_release, nullptr);
+
+    return *this;
+}
+
+auto kommpot::received_view::data() const -> const uint8_t *
+{
+    return m_data;
+}
+
+auto kommpot::received_view::size() const -> size_t
+{
+    return m_size_bytes;
+}
+
+auto kommpot::received_view::empty() const -> bool
+{
+    return m_size_bytes == 0;
+}
+
+auto kommpot::received_view::release() -> void
+{
+    auto release = std::exchange(m_release, nullptr);
+
+    m_data = nullptr;
+    m_size_bytes = 0;
+
+    if (release)
+    {
+        release();
+    }
+}
+
 kommpot::device_communication::device_communication(kommpot::device_identification identification)
     : m_identification_variant(std::move(identification))
 {}
 
+auto kommpot::device_communication::is_alive() -> bool
+{
+    return is_open();
+}
+
+auto kommpot::device_communication::read_some(const transfer_configuration &configuration,
+    void *data, size_t size_bytes, size_t &received_size_bytes) -> bool
+{
+    received_size_bytes = 0;
+
+    if (!read(configuration, data, size_bytes))
+    {
+        return false;
+    }
+
+    received_size_bytes = size_bytes;
+
+    return true;
+}
+
+auto kommpot::device_communication::read_view(const transfer_configuration &configuration,
+    size_t max_size_bytes, received_view &view) -> bool
+{
+    view.release();
+
+    auto buffer = std::make_shared<std::vector<uint8_t>>(max_size_bytes);
+    size_t received_size_bytes = 0;
+    if (!read_some(configuration, buffer->data(), buffer->size(), received_size_bytes))
+    {
+        return false;
+    }
+
+    view = received_view(buffer->data(), received_size_bytes, [buffer]() {});
+
+    return true;
+}
+
+auto kommpot::device_communication::read_messages(const transfer_configuration &configuration,
+    std::vector<message_buffer> &messages, size_t &received_count) -> bool
+{
+    received_count = 0;
+
+    if (messages.empty())
+    {
+        return false;
+    }
+
+    auto &message = messages.front();
+    size_t received_size_bytes = 0;
+    if (!read_some(configuration, message.data, message.size_bytes, received_size_bytes))
+    {
+        return false;
+    }
+
+    message.received_size_bytes = received_size_bytes;
+    message.is_truncated = false;
+    received_count = 1;
+
+    return true;
+}
+
+auto kommpot::device_communication::read_timestamped(const transfer_configuration &configuration,
+    void *data, size_t size_bytes, transfer_result &result) -> bool
+{
+    result = transfer_result();
+
+    return read_some(configuration, data, size_bytes, result.size_bytes);
+}
+
+auto kommpot::device_communication::write_messages(
+    const transfer_configuration &configuration, const std::vector<message_buffer> &messages)
+    -> bool
+{
+    for (const auto &message : messages)
+    {
+        if (!write(configuration, message.data, message.size_bytes))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+auto kommpot::device_communication::write_timestamped(const transfer_configuration &configuration,
+    const void *data, size_t size_bytes, transfer_result &result) -> bool
+{
+    result = transfer_result();
+
+    if (!write(configuration, const_cast<void *>(data), size_bytes))
+    {
+        return false;
+    }
+
+    result.size_bytes = size_bytes;
+
+    return true;
+}
+
+auto kommpot::device_communication::write_zero_copy(const transfer_configuration &configuration,
+    const void *data, size_t size_bytes, write_completion_callback callback) -> bool
+{
+    if (!write(configuration, const_cast<void *>(data), size_bytes))
+    {
+        return false;
+    }
+
+    if (callback)
+    {
+        callback();
+    }
+
+    return true;
+}
+
+auto kommpot::device_communication::flush_zero_copy([[maybe_unused]] uint32_t timeout_msecs) -> bool
+{
+    return true;
+}
+
 auto kommpot::device_communication::type() const -> kommpot::communication_type
 {
     return m_type;
 }
 
+kommpot::buffered_reader::buffered_reader(device_communication &communication,
+    transfer_configuration configuration, size_t read_ahead_size_bytes)
+    : m_communication(communication)
+    , m_configuration(std::move(configuration))
+    , m_read_ahead_size_bytes(std::max<size_t>(read_ahead_size_bytes, 1))
+    , m_buffer(m_read_ahead_size_bytes)
+{}
+
+auto kommpot::buffered_reader::peek(void *data, size_t size_bytes) -> bool
+{
+    if (!fill(size_bytes))
+    {
+        return false;
+    }
+
+    std::memcpy(data, m_buffer.data() + m_begin, size_bytes);
+
+    return true;
+}
+
+auto kommpot::buffered_reader::read_exact(void *data, size_t size_bytes) -> bool
+{
+    auto *bytes = static_cast<uint8_t *>(data);
+
+    /**
+     * @attention large reads are copied once: buffered bytes first, the rest straight from the
+     * device into the caller's memory.
+     */
+    if (size_bytes - std::min(size_bytes, buffered_size()) >= m_read_ahead_size_bytes)
+    {
+        const auto buffered_size_bytes = buffered_size();
+        std::memcpy(bytes, m_buffer.data() + m_begin, buffered_size_bytes);
+        discard();
+
+        m_device_read_count++;
+        return m_communication.read(
+            m_configuration, bytes + buffered_size_bytes, size_bytes - buffered_size_bytes);
+    }
+
+    if (!fill(size_bytes))
+    {
+        return false;
+    }
+
+    std::memcpy(bytes, m_buffer.data() + m_begin, size_bytes);
+    m_begin += size_bytes;
+
+    return true;
+}
+
+auto kommpot::buffered_reader::read_until(
+    const std::string &delimiter, std::string &data, size_t max_size_bytes) -> bool
+{
+    if (delimiter.empty())
+    {
+        return false;
+    }
+
+    size_t searched_size_bytes = 0;
+    while (true)
+    {
+        const auto *found = byte_scanner::search(m_buffer.data() + m_begin + searched_size_bytes,
+            buffered_size() - searched_size_bytes,
+            reinterpret_cast<const uint8_t *>(delimiter.data()), delimiter.size());
+        if (found != nullptr)
+        {
+            const auto line_size_bytes =
+                static_cast<size_t>(found - (m_buffer.data() + m_begin)) + delimiter.size();
+            if (max_size_bytes > 0 && line_size_bytes > max_size_bytes)
+            {
+                return false;
+            }
+
+            data.assign(reinterpret_cast<const char *>(m_buffer.data() + m_begin),
+                line_size_bytes);
+            m_begin += line_size_bytes;
+            return true;
+        }
+
+        if (max_size_bytes > 0 && buffered_size() >= max_size_bytes)
+        {
+            return false;
+        }
+
+        /**
+         * @attention the tail may hold the first bytes of the delimiter, it is searched again.
+         */
+        searched_size_bytes = buffered_size() - std::min(buffered_size(), delimiter.size() - 1);
+
+        if (!fill(buffered_size() + 1))
+        {
+            return false;
+        }
+    }
+}
+
+auto kommpot::buffered_reader::buffered_size() const -> size_t
+{
+    return m_end - m_begin;
+}
+
+auto kommpot::buffered_reader::discard() -> void
+{
+    m_begin = 0;
+    m_end = 0;
+}
+
+auto kommpot::buffered_reader::device_read_count() const -> uint64_t
+{
+    return m_device_read_count;
+}
+
+auto kommpot::buffered_reader::fill(size_t size_bytes) -> bool
+{
+    if (buffered_size() >= size_bytes)
+    {
+        return true;
+    }
+
+    if (m_begin > 0)
+    {
+        std::memmove(m_buffer.data(), m_buffer.data() + m_begin, buffered_size());
+        m_end -= m_begin;
+        m_begin = 0;
+    }
+
+    if (m_buffer.size() < std::max(size_bytes, m_read_ahead_size_bytes))
+    {
+        m_buffer.resize(std::max(size_bytes, m_read_ahead_size_bytes));
+    }
+
+    while (m_end < size_bytes)
+    {
+        size_t received_size_bytes = 0;
+        m_device_read_count++;
+        if (!m_communication.read_some(m_configuration, m_buffer.data() + m_end,
+                m_buffer.size() - m_end, received_size_bytes) ||
+            received_size_bytes == 0)
+        {
+            return false;
+        }
+
+        m_end += received_size_bytes;
+    }
+
+    return true;
+}
+
+kommpot::buffered_writer::buffered_writer(device_communication &communication,
+    transfer_configuration configuration, size_t flush_size_bytes, uint32_t flush_deadline_usecs)
+    : m_communication(communication)
+    , m_configuration(std::move(configuration))
+    , m_flush_size_bytes(std::max<size_t>(flush_size_bytes, 1))
+    , m_flush_deadline(flush_deadline_usecs)
+{
+    m_buffer.reserve(m_flush_size_bytes);
+
+    if (flush_deadline_usecs > 0)
+    {
+        m_is_running = true;
+        m_flush_thread = std::thread(&buffered_writer::run, this);
+    }
+}
+
+kommpot::buffered_writer::~buffered_writer()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_is_running = false;
+    }
+    m_condition.notify_all();
+
+    if (m_flush_thread.joinable())
+    {
+        m_flush_thread.join();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    flush_locked();
+}
+
+auto kommpot::buffered_writer::write(const void *data, size_t size_bytes) -> bool
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto *bytes = static_cast<const uint8_t *>(data);
+
+    if (size_bytes >= m_flush_size_bytes)
+    {
+        flush_locked();
+
+        /**
+         * @attention device_communication::write() takes a mutable pointer but does not modify
+         * the data.
+         */
+        m_device_write_count++;
+        if (!m_communication.write(m_configuration, const_cast<uint8_t *>(bytes), size_bytes))
+        {
+            m_is_failed = true;
+        }
+
+        return !std::exchange(m_is_failed, false);
+    }
+
+    const auto was_empty = m_buffer.empty();
+    m_buffer.insert(std::end(m_buffer), bytes, bytes + size_bytes);
+
+    if (m_buffer.size() >= m_flush_size_bytes)
+    {
+        flush_locked();
+    }
+    else if (was_empty && m_is_running)
+    {
+        m_deadline = clock::now() + m_flush_deadline;
+        m_condition.notify_one();
+    }
+
+    return !std::exchange(m_is_failed, false);
+}
+
+auto kommpot::buffered_writer::flush() -> bool
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    flush_locked();
+
+    return !std::exchange(m_is_failed, false);
+}
+
+auto kommpot::buffered_writer::buffered_size() const -> size_t
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_buffer.size();
+}
+
+auto kommpot::buffered_writer::device_write_count() const -> uint64_t
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_device_write_count;
+}
+
+auto kommpot::buffered_writer::flush_locked() -> void
+{
+    if (m_buffer.empty())
+    {
+        return;
+    }
+
+    m_device_write_count++;
+    if (!m_communication.write(m_configuration, m_buffer.data(), m_buffer.size()))
+    {
+        m_is_failed = true;
+    }
+
+    m_buffer.clear();
+}
+
+auto kommpot::buffered_writer::run() -> void
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (m_is_running)
+    {
+        if (m_buffer.empty())
+        {
+            m_condition.wait(lock, [this]() { return !m_is_running || !m_buffer.empty(); });
+            continue;
+        }
+
+        if (clock::now() < m_deadline)
+        {
+            m_condition.wait_until(lock, m_deadline);
+            continue;
+        }
+
+        flush_locked();
+    }
+}
+
+auto kommpot::crc16(const void *data, size_t size_bytes, uint16_t value) noexcept -> uint16_t
+{
+    return crc::crc16(static_cast<const uint8_t *>(data), size_bytes, value);
+}
+
+auto kommpot::crc32c(const void *data, size_t size_bytes, uint32_t value) noexcept -> uint32_t
+{
+    return crc::crc32c(static_cast<const uint8_t *>(data), size_bytes, value);
+}
+
 auto kommpot::devices(const std::vector<device_identification> &identifications)
     -> std::vector<std::shared_ptr<kommpot::device_communication>>
 {
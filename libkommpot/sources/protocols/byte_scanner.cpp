@@ -0,0 +1,100 @@
+#include <protocols/byte_scanner.h>
+
+#include <cstring>
+
+// clang-format off
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#    define IS_BYTE_SCANNER_SSE2
+#    include <emmintrin.h>
+#    ifdef _MSC_VER
+#        include <intrin.h>
+#    endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#    define IS_BYTE_SCANNER_NEON
+#    include <arm_neon.h>
+#endif
+// clang-format on
+
+auto byte_scanner::find(const uint8_t *data, size_t size_bytes, uint8_t value) -> const uint8_t *
+{
+    size_t offset = 0;
+
+#if defined(IS_BYTE_SCANNER_SSE2)
+    const auto needle = _mm_set1_epi8(static_cast<char>(value));
+    for (; offset + M_VECTOR_SIZE_BYTES <= size_bytes; offset += M_VECTOR_SIZE_BYTES)
+    {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + offset));
+        const auto mask =
+            static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+        if (mask != 0)
+        {
+#    ifdef _MSC_VER
+            unsigned long index = 0;
+            _BitScanForward(&index, mask);
+#    else
+            const auto index = __builtin_ctz(mask);
+#    endif
+            return data + offset + index;
+        }
+    }
+#elif defined(IS_BYTE_SCANNER_NEON)
+    const auto needle = vdupq_n_u8(value);
+    for (; offset + M_VECTOR_SIZE_BYTES <= size_bytes; offset += M_VECTOR_SIZE_BYTES)
+    {
+        const auto matches = vceqq_u8(vld1q_u8(data + offset), needle);
+
+        /**
+         * @attention narrowing shift packs the 16 byte comparison into a 64 bit mask with 4 bits
+         * per byte, NEON has no movemask.
+         */
+        const auto mask = vget_lane_u64(
+            vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+        if (mask != 0)
+        {
+            return data + offset + (__builtin_ctzll(mask) >> 2);
+        }
+    }
+#endif
+
+    return find_scalar(data + offset, size_bytes - offset, value);
+}
+
+auto byte_scanner::search(const uint8_t *data, size_t size_bytes, const uint8_t *pattern,
+    size_t pattern_size_bytes) -> const uint8_t *
+{
+    if (pattern_size_bytes == 0 || pattern_size_bytes > size_bytes)
+    {
+        return nullptr;
+    }
+
+    const auto *end = data + size_bytes;
+    const auto *candidate = data;
+    while (static_cast<size_t>(end - candidate) >= pattern_size_bytes)
+    {
+        candidate = find(candidate, end - candidate - pattern_size_bytes + 1, pattern[0]);
+        if (candidate == nullptr)
+        {
+            return nullptr;
+        }
+
+        if (std::memcmp(candidate + 1, pattern + 1, pattern_size_bytes - 1) == 0)
+        {
+            return candidate;
+        }
+
+        candidate++;
+    }
+
+    return nullptr;
+}
+
+auto byte_scanner::find_scalar(const uint8_t *data, size_t size_bytes, uint8_t value)
+    -> const uint8_t *
+{
+    if (size_bytes == 0)
+    {
+        return nullptr;
+    }
+
+    return static_cast<const uint8_t *>(std::memchr(data, value, size_bytes));
+}
@@ -0,0 +1,35 @@
+#ifndef BYTE_SCANNER_H
+#define BYTE_SCANNER_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief vectorized byte search for delimiter scanning, compares 16 bytes per instruction with
+ * SSE2 on x86-64 and NEON on ARM64, other platforms fall back to memchr().
+ */
+class byte_scanner
+{
+public:
+    /**
+     * @return pointer to the first occurrence of value, nullptr if there is none.
+     */
+    [[nodiscard]] static auto find(const uint8_t *data, size_t size_bytes, uint8_t value)
+        -> const uint8_t *;
+
+    /**
+     * @return pointer to the first complete occurrence of pattern, nullptr if there is none.
+     */
+    [[nodiscard]] static auto search(const uint8_t *data, size_t size_bytes,
+        const uint8_t *pattern, size_t pattern_size_bytes) -> const uint8_t *;
+
+private:
+    static constexpr size_t M_VECTOR_SIZE_BYTES = 16;
+
+    static auto find_scalar(const uint8_t *data, size_t size_bytes, uint8_t value)
+        -> const uint8_t *;
+};
+
+#endif // BYTE_SCANNER_H
@@ -0,0 +1,222 @@
+#include <protocols/crc.h>
+
+#include <array>
+#include <cstring>
+
+// clang-format off
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64)
+#    define IS_CRC_SSE42
+#    include <nmmintrin.h>
+#    ifdef _MSC_VER
+#        include <intrin.h>
+#        define CRC_TARGET_SSE42
+#    else
+#        define CRC_TARGET_SSE42 __attribute__((target("sse4.2")))
+#    endif
+#elif defined(__ARM_FEATURE_CRC32)
+#    define IS_CRC_ARMV8
+#    include <arm_acle.h>
+#endif
+// clang-format on
+
+namespace {
+    constexpr size_t SLICE_COUNT = 8;
+    constexpr uint16_t CRC16_POLYNOMIAL = 0x1021;
+    constexpr uint32_t CRC32C_POLYNOMIAL_REFLECTED = 0x82F63B78;
+
+    using crc16_tables = std::array<std::array<uint16_t, 256>, SLICE_COUNT>;
+    using crc32_tables = std::array<std::array<uint32_t, 256>, SLICE_COUNT>;
+
+    /**
+     * @attention table[n][b] states the remainder of byte b followed by n zero bytes, so 8 bytes
+     * are folded with 8 independent lookups.
+     */
+    constexpr auto make_crc16_tables() -> crc16_tables
+    {
+        crc16_tables tables = {};
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            auto value = static_cast<uint16_t>(i << 8);
+            for (int bit = 0; bit < 8; bit++)
+            {
+                value = static_cast<uint16_t>(
+                    (value & 0x8000) ? (value << 1) ^ CRC16_POLYNOMIAL : value << 1);
+            }
+            tables[0][i] = value;
+        }
+
+        for (size_t slice = 1; slice < SLICE_COUNT; slice++)
+        {
+            for (size_t i = 0; i < 256; i++)
+            {
+                const auto previous = tables[slice - 1][i];
+                tables[slice][i] =
+                    static_cast<uint16_t>((previous << 8) ^ tables[0][previous >> 8]);
+            }
+        }
+
+        return tables;
+    }
+
+    constexpr auto make_crc32c_tables() -> crc32_tables
+    {
+        crc32_tables tables = {};
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            auto value = i;
+            for (int bit = 0; bit < 8; bit++)
+            {
+                value = (value & 1) ? (value >> 1) ^ CRC32C_POLYNOMIAL_REFLECTED : value >> 1;
+            }
+            tables[0][i] = value;
+        }
+
+        for (size_t slice = 1; slice < SLICE_COUNT; slice++)
+        {
+            for (size_t i = 0; i < 256; i++)
+            {
+                const auto previous = tables[slice - 1][i];
+                tables[slice][i] = (previous >> 8) ^ tables[0][previous & 0xFF];
+            }
+        }
+
+        return tables;
+    }
+
+    constexpr auto CRC16_TABLES = make_crc16_tables();
+    constexpr auto CRC32C_TABLES = make_crc32c_tables();
+
+    auto load_le32(const uint8_t *data) -> uint32_t
+    {
+        return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+               (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+    }
+
+#if defined(IS_CRC_SSE42)
+    auto is_sse42_supported() -> bool
+    {
+#    ifdef _MSC_VER
+        int info[4] = {};
+        __cpuid(info, 1);
+        return (info[2] & (1 << 20)) != 0;
+#    else
+        return __builtin_cpu_supports("sse4.2");
+#    endif
+    }
+
+    CRC_TARGET_SSE42 auto crc32c_sse42(const uint8_t *data, size_t size_bytes, uint32_t value)
+        -> uint32_t
+    {
+        uint64_t state = value;
+        for (; size_bytes >= sizeof(uint64_t); size_bytes -= sizeof(uint64_t))
+        {
+            uint64_t word = 0;
+            std::memcpy(&word, data, sizeof(word));
+            state = _mm_crc32_u64(state, word);
+            data += sizeof(word);
+        }
+
+        auto result = static_cast<uint32_t>(state);
+        for (; size_bytes > 0; size_bytes--)
+        {
+            result = _mm_crc32_u8(result, *data++);
+        }
+
+        return result;
+    }
+#endif
+} // namespace
+
+auto crc::crc16(const uint8_t *data, size_t size_bytes, uint16_t value) -> uint16_t
+{
+    const auto &t = CRC16_TABLES;
+
+    for (; size_bytes >= SLICE_COUNT; size_bytes -= SLICE_COUNT)
+    {
+        value = static_cast<uint16_t>(t[7][(value >> 8) ^ data[0]] ^
+                                      t[6][(value & 0xFF) ^ data[1]] ^ t[5][data[2]] ^
+                                      t[4][data[3]] ^ t[3][data[4]] ^ t[2][data[5]] ^
+                                      t[1][data[6]] ^ t[0][data[7]]);
+        data += SLICE_COUNT;
+    }
+
+    for (; size_bytes > 0; size_bytes--)
+    {
+        value = static_cast<uint16_t>((value << 8) ^ t[0][(value >> 8) ^ *data++]);
+    }
+
+    return value;
+}
+
+auto crc::crc32c(const uint8_t *data, size_t size_bytes, uint32_t value) -> uint32_t
+{
+    static const bool is_accelerated = is_crc32c_accelerated();
+
+    if (is_accelerated)
+    {
+        return crc32c_hardware(data, size_bytes, value);
+    }
+
+    return crc32c_software(data, size_bytes, value);
+}
+
+auto crc::crc32c_software(const uint8_t *data, size_t size_bytes, uint32_t value) -> uint32_t
+{
+    const auto &t = CRC32C_TABLES;
+
+    value = ~value;
+
+    for (; size_bytes >= SLICE_COUNT; size_bytes -= SLICE_COUNT)
+    {
+        const auto low = load_le32(data) ^ value;
+        const auto high = load_le32(data + 4);
+
+        value = t[7][low & 0xFF] ^ t[6][(low >> 8) & 0xFF] ^ t[5][(low >> 16) & 0xFF] ^
+                t[4][low >> 24] ^ t[3][high & 0xFF] ^ t[2][(high >> 8) & 0xFF] ^
+                t[1][(high >> 16) & 0xFF] ^ t[0][high >> 24];
+        data += SLICE_COUNT;
+    }
+
+    for (; size_bytes > 0; size_bytes--)
+    {
+        value = (value >> 8) ^ t[0][(value ^ *data++) & 0xFF];
+    }
+
+    return ~value;
+}
+
+auto crc::is_crc32c_accelerated() -> bool
+{
+#if defined(IS_CRC_SSE42)
+    return is_sse42_supported();
+#elif defined(IS_CRC_ARMV8)
+    return true;
+#else
+    return false;
+#endif
+}
+
+auto crc::crc32c_hardware(const uint8_t *data, size_t size_bytes, uint32_t value) -> uint32_t
+{
+#if defined(IS_CRC_SSE42)
+    return ~crc32c_sse42(data, size_bytes, ~value);
+#elif defined(IS_CRC_ARMV8)
+    value = ~value;
+    for (; size_bytes >= sizeof(uint64_t); size_bytes -= sizeof(uint64_t))
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, data, sizeof(word));
+        value = __crc32cd(value, word);
+        data += sizeof(word);
+    }
+
+    for (; size_bytes > 0; size_bytes--)
+    {
+        value = __crc32cb(value, *data++);
+    }
+
+    return ~value;
+#else
+    return crc32c_software(data, size_bytes, value);
+#endif
+}
@@ -0,0 +1,45 @@
+#ifndef CRC_H
+#define CRC_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief CRC-16/CCITT-FALSE and CRC-32C over slicing-by-8 tables generated at compile time,
+ * CRC-32C uses the crc32 instruction of SSE4.2 or ARMv8 where the CPU has it.
+ */
+class crc
+{
+public:
+    static constexpr uint16_t M_CRC16_INITIAL_VALUE = 0xFFFF;
+
+    /**
+     * @brief polynomial 0x1021, not reflected, no final XOR.
+     * @param value result of the previous call to continue over several buffers.
+     */
+    [[nodiscard]] static auto crc16(const uint8_t *data, size_t size_bytes,
+        uint16_t value = M_CRC16_INITIAL_VALUE) -> uint16_t;
+
+    /**
+     * @brief Castagnoli polynomial 0x1EDC6F41, reflected, initial value and final XOR 0xFFFFFFFF.
+     * @param value result of the previous call to continue over several buffers.
+     */
+    [[nodiscard]] static auto crc32c(const uint8_t *data, size_t size_bytes, uint32_t value = 0)
+        -> uint32_t;
+
+    [[nodiscard]] static auto crc32c_software(const uint8_t *data, size_t size_bytes,
+        uint32_t value = 0) -> uint32_t;
+
+    /**
+     * @brief states if crc32c() runs on the crc32 instruction of the CPU.
+     */
+    [[nodiscard]] static auto is_crc32c_accelerated() -> bool;
+
+private:
+    static auto crc32c_hardware(const uint8_t *data, size_t size_bytes, uint32_t value)
+        -> uint32_t;
+};
+
+#endif // CRC_H
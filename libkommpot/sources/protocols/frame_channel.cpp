@@ -0,0 +1,433 @@
+#include "libkommpot.h"
+
+#include <kommpot_core.h>
+#include <protocols/byte_scanner.h>
+#include <protocols/crc.h>
+#include <protocols/frame_codec.h>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace {
+    auto append_be(std::vector<uint8_t> &output, const uint32_t &value, const size_t &size_bytes)
+        -> void
+    {
+        for (size_t i = size_bytes; i > 0; i--)
+        {
+            output.push_back(static_cast<uint8_t>(value >> ((i - 1) * 8)));
+        }
+    }
+
+    auto load_be(const uint8_t *data, const size_t &size_bytes) -> uint32_t
+    {
+        uint32_t value = 0;
+        for (size_t i = 0; i < size_bytes; i++)
+        {
+            value = (value << 8) | data[i];
+        }
+        return value;
+    }
+} // namespace
+
+auto kommpot::buffer_pool::create(size_t max_idle_buffers) -> std::shared_ptr<buffer_pool>
+{
+    return std::shared_ptr<buffer_pool>(new buffer_pool(max_idle_buffers));
+}
+
+kommpot::buffer_pool::buffer_pool(size_t max_idle_buffers)
+    : m_max_idle_buffers(max_idle_buffers)
+{}
+
+auto kommpot::buffer_pool::acquire(size_t size_bytes) -> pooled_buffer
+{
+    std::unique_ptr<std::vector<uint8_t>> buffer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_idle_buffers.empty())
+        {
+            buffer = std::move(m_idle_buffers.back());
+            m_idle_buffers.pop_back();
+        }
+        else
+        {
+            m_allocation_count++;
+        }
+    }
+
+    if (buffer == nullptr)
+    {
+        buffer = std::make_unique<std::vector<uint8_t>>();
+    }
+    buffer->resize(size_bytes);
+
+    /**
+     * @attention buffers may outlive the pool, they are freed instead of recycled then.
+     */
+    std::weak_ptr<buffer_pool> pool = weak_from_this();
+    return pooled_buffer(buffer.release(), [pool](std::vector<uint8_t> *released) {
+        if (auto owner = pool.lock())
+        {
+            owner->release(released);
+            return;
+        }
+        delete released;
+    });
+}
+
+auto kommpot::buffer_pool::idle_count() const -> size_t
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_idle_buffers.size();
+}
+
+auto kommpot::buffer_pool::allocation_count() const -> uint64_t
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_allocation_count;
+}
+
+auto kommpot::buffer_pool::release(std::vector<uint8_t> *buffer) -> void
+{
+    std::unique_ptr<std::vector<uint8_t>> released(buffer);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_idle_buffers.size() < m_max_idle_buffers)
+    {
+        m_idle_buffers.push_back(std::move(released));
+    }
+}
+
+kommpot::frame_channel::frame_channel(device_communication &communication, framing_type type,
+    frame_check_type check, size_t max_frame_size_bytes, std::shared_ptr<buffer_pool> pool,
+    transfer_configuration configuration)
+    : m_communication(communication)
+    , m_configuration(std::move(configuration))
+    , m_type(type)
+    , m_check(check)
+    , m_max_frame_size_bytes(max_frame_size_bytes)
+    , m_pool(pool != nullptr ? std::move(pool) : buffer_pool::create())
+    , m_receive_buffer(M_RECEIVE_SIZE_BYTES)
+{}
+
+auto kommpot::frame_channel::write_frame(const void *data, size_t size_bytes) -> bool
+{
+    if (size_bytes > m_max_frame_size_bytes)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Frame of {} bytes exceeds maximum of {} bytes.",
+            size_bytes, m_max_frame_size_bytes);
+        return false;
+    }
+
+    /**
+     * @attention an empty SLIP frame is two END bytes, which receivers skip as line noise.
+     */
+    if (m_type == framing_type::SLIP && size_bytes + check_size() == 0)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Empty frame cannot be sent over SLIP without check.");
+        return false;
+    }
+
+    const auto *bytes = static_cast<const uint8_t *>(data);
+    m_transmit_buffer.clear();
+
+    if (m_type == framing_type::LENGTH_PREFIXED)
+    {
+        append_be(m_transmit_buffer, static_cast<uint32_t>(size_bytes + check_size()),
+            M_LENGTH_SIZE_BYTES);
+        m_transmit_buffer.insert(std::end(m_transmit_buffer), bytes, bytes + size_bytes);
+        append_check(bytes, size_bytes, m_transmit_buffer);
+    }
+    else if (m_type == framing_type::COBS || m_type == framing_type::SLIP)
+    {
+        /**
+         * @attention the check is stuffed together with the payload, so both have to be
+         * contiguous.
+         */
+        std::vector<uint8_t> payload;
+        if (m_check != frame_check_type::NONE)
+        {
+            payload.reserve(size_bytes + check_size());
+            payload.assign(bytes, bytes + size_bytes);
+            append_check(bytes, size_bytes, payload);
+            bytes = payload.data();
+            size_bytes = payload.size();
+        }
+
+        if (m_type == framing_type::COBS)
+        {
+            frame_codec::cobs_encode(bytes, size_bytes, m_transmit_buffer);
+            m_transmit_buffer.push_back(frame_codec::M_COBS_DELIMITER);
+        }
+        else
+        {
+            m_transmit_buffer.push_back(frame_codec::M_SLIP_END);
+            frame_codec::slip_encode(bytes, size_bytes, m_transmit_buffer);
+            m_transmit_buffer.push_back(frame_codec::M_SLIP_END);
+        }
+    }
+    else
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Framing type {} is not supported.",
+            framing_type_to_string(m_type));
+        return false;
+    }
+
+    return m_communication.write(
+        m_configuration, m_transmit_buffer.data(), m_transmit_buffer.size());
+}
+
+auto kommpot::frame_channel::read_frame(pooled_buffer &frame) -> bool
+{
+    bool is_read = false;
+
+    if (m_type == framing_type::LENGTH_PREFIXED)
+    {
+        is_read = read_length_prefixed(frame);
+    }
+    else if (m_type == framing_type::COBS || m_type == framing_type::SLIP)
+    {
+        is_read = read_delimited(frame);
+    }
+    else
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Framing type {} is not supported.",
+            framing_type_to_string(m_type));
+    }
+
+    return is_read && verify_check(*frame);
+}
+
+auto kommpot::frame_channel::pool() const -> std::shared_ptr<buffer_pool>
+{
+    return m_pool;
+}
+
+auto kommpot::frame_channel::dropped_frame_count() const -> uint64_t
+{
+    return m_dropped_frame_count;
+}
+
+auto kommpot::frame_channel::check_size() const -> size_t
+{
+    switch (m_check)
+    {
+    case frame_check_type::CRC16: {
+        return sizeof(uint16_t);
+    }
+    case frame_check_type::CRC32C: {
+        return sizeof(uint32_t);
+    }
+    default:
+        return 0;
+    }
+}
+
+auto kommpot::frame_channel::append_check(
+    const uint8_t *data, size_t size_bytes, std::vector<uint8_t> &output) const -> void
+{
+    if (m_check == frame_check_type::CRC16)
+    {
+        append_be(output, crc::crc16(data, size_bytes), sizeof(uint16_t));
+    }
+    else if (m_check == frame_check_type::CRC32C)
+    {
+        append_be(output, crc::crc32c(data, size_bytes), sizeof(uint32_t));
+    }
+}
+
+auto kommpot::frame_channel::verify_check(std::vector<uint8_t> &frame) -> bool
+{
+    if (m_check == frame_check_type::NONE)
+    {
+        return true;
+    }
+
+    const auto size_bytes = check_size();
+    if (frame.size() < size_bytes)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Frame of {} bytes is too short for {} check.",
+            frame.size(), frame_check_type_to_string(m_check));
+        m_dropped_frame_count++;
+        return false;
+    }
+
+    const auto payload_size_bytes = frame.size() - size_bytes;
+    const auto expected = load_be(frame.data() + payload_size_bytes, size_bytes);
+    const auto actual = (m_check == frame_check_type::CRC16)
+                            ? crc::crc16(frame.data(), payload_size_bytes)
+                            : crc::crc32c(frame.data(), payload_size_bytes);
+
+    if (actual != expected)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Frame {} check failed, expected {:#x} got {:#x}.",
+            frame_check_type_to_string(m_check), expected, actual);
+        m_dropped_frame_count++;
+        return false;
+    }
+
+    frame.resize(payload_size_bytes);
+
+    return true;
+}
+
+auto kommpot::frame_channel::read_length_prefixed(pooled_buffer &frame) -> bool
+{
+    /**
+     * @attention a read timing out mid-frame keeps the frame received so far, the next call
+     * resumes it so the stream stays in sync.
+     */
+    if (m_partial_frame == nullptr)
+    {
+        while (m_receive_end - m_receive_begin < M_LENGTH_SIZE_BYTES)
+        {
+            if (!fill())
+            {
+                return false;
+            }
+        }
+
+        const size_t length =
+            load_be(m_receive_buffer.data() + m_receive_begin, M_LENGTH_SIZE_BYTES);
+        if (length < check_size() || length - check_size() > m_max_frame_size_bytes)
+        {
+            /**
+             * @attention there is no way to find the next frame, buffered data is dropped.
+             */
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+                "Frame length {} is out of range, stream is lost.", length);
+            m_dropped_frame_count++;
+            m_receive_begin = m_receive_end = 0;
+            return false;
+        }
+        m_receive_begin += M_LENGTH_SIZE_BYTES;
+
+        m_partial_frame = m_pool->acquire(length);
+        m_partial_size_bytes = std::min(length, m_receive_end - m_receive_begin);
+        std::memcpy(m_partial_frame->data(), m_receive_buffer.data() + m_receive_begin,
+            m_partial_size_bytes);
+        m_receive_begin += m_partial_size_bytes;
+    }
+
+    /**
+     * @attention rest of a large frame is read straight into the frame buffer.
+     */
+    const auto length = m_partial_frame->size();
+    while (m_partial_size_bytes < length)
+    {
+        size_t chunk_size_bytes = 0;
+        if (!m_communication.read_some(m_configuration,
+                m_partial_frame->data() + m_partial_size_bytes, length - m_partial_size_bytes,
+                chunk_size_bytes))
+        {
+            return false;
+        }
+        m_partial_size_bytes += chunk_size_bytes;
+    }
+
+    frame = std::move(m_partial_frame);
+    m_partial_frame = nullptr;
+    m_partial_size_bytes = 0;
+
+    return true;
+}
+
+auto kommpot::frame_channel::read_delimited(pooled_buffer &frame) -> bool
+{
+    const auto delimiter =
+        (m_type == framing_type::COBS) ? frame_codec::M_COBS_DELIMITER : frame_codec::M_SLIP_END;
+    const auto max_encoded_size_bytes =
+        frame_codec::max_encoded_size(m_max_frame_size_bytes + check_size());
+
+    while (true)
+    {
+        const auto *begin = m_receive_buffer.data() + m_receive_begin;
+        const auto buffered_size_bytes = m_receive_end - m_receive_begin;
+        const auto *found = byte_scanner::find(begin + m_scanned_size_bytes,
+            buffered_size_bytes - m_scanned_size_bytes, delimiter);
+
+        if (found == nullptr)
+        {
+            m_scanned_size_bytes = buffered_size_bytes;
+
+            /**
+             * @attention bytes of an oversized frame are dropped up to the next delimiter, so the
+             * buffer stays bounded.
+             */
+            if (buffered_size_bytes > max_encoded_size_bytes)
+            {
+                if (!m_is_discarding)
+                {
+                    SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+                        "Frame exceeds {} encoded bytes, dropped up to next delimiter.",
+                        max_encoded_size_bytes);
+                    m_dropped_frame_count++;
+                    m_is_discarding = true;
+                }
+                m_receive_begin = m_receive_end;
+                m_scanned_size_bytes = 0;
+            }
+
+            if (!fill())
+            {
+                return false;
+            }
+            continue;
+        }
+
+        const auto encoded_size_bytes = static_cast<size_t>(found - begin);
+        m_receive_begin += encoded_size_bytes + 1;
+        m_scanned_size_bytes = 0;
+
+        if (std::exchange(m_is_discarding, false) || encoded_size_bytes == 0)
+        {
+            continue;
+        }
+
+        frame = m_pool->acquire(encoded_size_bytes);
+        const auto decoded_size_bytes =
+            (m_type == framing_type::COBS)
+                ? frame_codec::cobs_decode(begin, encoded_size_bytes, frame->data())
+                : frame_codec::slip_decode(begin, encoded_size_bytes, frame->data());
+
+        if (!decoded_size_bytes.has_value() ||
+            *decoded_size_bytes > m_max_frame_size_bytes + check_size())
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "{} frame of {} encoded bytes is malformed.",
+                framing_type_to_string(m_type), encoded_size_bytes);
+            m_dropped_frame_count++;
+            return false;
+        }
+
+        frame->resize(*decoded_size_bytes);
+
+        return true;
+    }
+}
+
+auto kommpot::frame_channel::fill() -> bool
+{
+    if (m_receive_begin > 0)
+    {
+        std::memmove(m_receive_buffer.data(), m_receive_buffer.data() + m_receive_begin,
+            m_receive_end - m_receive_begin);
+        m_receive_end -= m_receive_begin;
+        m_receive_begin = 0;
+    }
+
+    if (m_receive_end == m_receive_buffer.size())
+    {
+        m_receive_buffer.resize(m_receive_buffer.size() * 2);
+    }
+
+    size_t received_size_bytes = 0;
+    if (!m_communication.read_some(m_configuration, m_receive_buffer.data() + m_receive_end,
+            m_receive_buffer.size() - m_receive_end, received_size_bytes))
+    {
+        return false;
+    }
+
+    m_receive_end += received_size_bytes;
+
+    return true;
+}
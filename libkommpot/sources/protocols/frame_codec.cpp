@@ -0,0 +1,144 @@
+#include <protocols/frame_codec.h>
+
+#include <protocols/byte_scanner.h>
+
+#include <algorithm>
+#include <cstring>
+
+auto frame_codec::cobs_encode(const uint8_t *data, size_t size_bytes, std::vector<uint8_t> &output)
+    -> void
+{
+    const auto *end = data + size_bytes;
+
+    /**
+     * @attention every group is a run of up to 254 non-zero bytes, its code byte states run size
+     * plus one. Runs of 254 bytes carry no implied zero.
+     */
+    while (true)
+    {
+        const auto window_size_bytes =
+            std::min(static_cast<size_t>(end - data), M_COBS_MAX_RUN_SIZE_BYTES);
+        const auto *zero = byte_scanner::find(data, window_size_bytes, M_COBS_DELIMITER);
+        const auto run_size_bytes =
+            zero != nullptr ? static_cast<size_t>(zero - data) : window_size_bytes;
+
+        output.push_back(static_cast<uint8_t>(run_size_bytes + 1));
+        output.insert(std::end(output), data, data + run_size_bytes);
+        data += run_size_bytes;
+
+        if (zero != nullptr)
+        {
+            data++;
+            continue;
+        }
+
+        if (data == end)
+        {
+            return;
+        }
+    }
+}
+
+auto frame_codec::cobs_decode(const uint8_t *data, size_t size_bytes, uint8_t *output)
+    -> std::optional<size_t>
+{
+    size_t read_offset = 0;
+    size_t write_offset = 0;
+
+    while (read_offset < size_bytes)
+    {
+        const auto code = data[read_offset++];
+        const size_t run_size_bytes = code - 1;
+
+        if (code == M_COBS_DELIMITER || run_size_bytes > size_bytes - read_offset)
+        {
+            return std::nullopt;
+        }
+
+        /**
+         * @attention memmove as decoding in place lets output trail data by one byte per group.
+         */
+        std::memmove(output + write_offset, data + read_offset, run_size_bytes);
+        read_offset += run_size_bytes;
+        write_offset += run_size_bytes;
+
+        if (code != M_COBS_MAX_RUN_SIZE_BYTES + 1 && read_offset < size_bytes)
+        {
+            output[write_offset++] = 0;
+        }
+    }
+
+    return write_offset;
+}
+
+auto frame_codec::slip_encode(const uint8_t *data, size_t size_bytes, std::vector<uint8_t> &output)
+    -> void
+{
+    output.reserve(output.size() + size_bytes + size_bytes / 8);
+
+    for (size_t i = 0; i < size_bytes; i++)
+    {
+        switch (data[i])
+        {
+        case M_SLIP_END: {
+            output.push_back(M_SLIP_ESC);
+            output.push_back(M_SLIP_ESC_END);
+            break;
+        }
+        case M_SLIP_ESC: {
+            output.push_back(M_SLIP_ESC);
+            output.push_back(M_SLIP_ESC_ESC);
+            break;
+        }
+        default:
+            output.push_back(data[i]);
+        }
+    }
+}
+
+auto frame_codec::slip_decode(const uint8_t *data, size_t size_bytes, uint8_t *output)
+    -> std::optional<size_t>
+{
+    size_t read_offset = 0;
+    size_t write_offset = 0;
+
+    while (read_offset < size_bytes)
+    {
+        const auto *escape =
+            byte_scanner::find(data + read_offset, size_bytes - read_offset, M_SLIP_ESC);
+        const auto run_size_bytes = escape != nullptr
+                                        ? static_cast<size_t>(escape - data) - read_offset
+                                        : size_bytes - read_offset;
+
+        std::memmove(output + write_offset, data + read_offset, run_size_bytes);
+        read_offset += run_size_bytes;
+        write_offset += run_size_bytes;
+
+        if (escape == nullptr)
+        {
+            break;
+        }
+
+        if (read_offset + 1 >= size_bytes)
+        {
+            return std::nullopt;
+        }
+
+        switch (data[read_offset + 1])
+        {
+        case M_SLIP_ESC_END: {
+            output[write_offset++] = M_SLIP_END;
+            break;
+        }
+        case M_SLIP_ESC_ESC: {
+            output[write_offset++] = M_SLIP_ESC;
+            break;
+        }
+        default:
+            return std::nullopt;
+        }
+        read_offset += 2;
+    }
+
+    return write_offset;
+}
@@ -0,0 +1,62 @@
+#ifndef FRAME_CODEC_H
+#define FRAME_CODEC_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/**
+ * @brief byte stuffing of COBS and SLIP (RFC 1055), encoders append to the output and decoders
+ * take one frame without its delimiter.
+ */
+class frame_codec
+{
+public:
+    static constexpr uint8_t M_COBS_DELIMITER = 0x00;
+    static constexpr uint8_t M_SLIP_END = 0xC0;
+    static constexpr uint8_t M_SLIP_ESC = 0xDB;
+    static constexpr uint8_t M_SLIP_ESC_END = 0xDC;
+    static constexpr uint8_t M_SLIP_ESC_ESC = 0xDD;
+
+    /**
+     * @brief appends encoded data without delimiter.
+     */
+    static auto cobs_encode(const uint8_t *data, size_t size_bytes, std::vector<uint8_t> &output)
+        -> void;
+
+    /**
+     * @brief decodes into output, which has to hold size_bytes, may be equal to data.
+     * @return decoded size, std::nullopt if data is malformed.
+     */
+    [[nodiscard]] static auto cobs_decode(const uint8_t *data, size_t size_bytes, uint8_t *output)
+        -> std::optional<size_t>;
+
+    /**
+     * @brief appends escaped data without END bytes.
+     */
+    static auto slip_encode(const uint8_t *data, size_t size_bytes, std::vector<uint8_t> &output)
+        -> void;
+
+    /**
+     * @brief decodes into output, which has to hold size_bytes, may be equal to data.
+     * @return decoded size, std::nullopt if data holds an invalid escape.
+     */
+    [[nodiscard]] static auto slip_decode(const uint8_t *data, size_t size_bytes, uint8_t *output)
+        -> std::optional<size_t>;
+
+    /**
+     * @brief states worst case size of an encoded frame without delimiters.
+     */
+    [[nodiscard]] static constexpr auto max_encoded_size(const size_t &size_bytes) -> size_t
+    {
+        return size_bytes * 2 + 1;
+    }
+
+private:
+    static constexpr size_t M_COBS_MAX_RUN_SIZE_BYTES = 254;
+};
+
+#endif // FRAME_CODEC_H
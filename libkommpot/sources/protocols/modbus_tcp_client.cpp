@@ -0,0 +1,453 @@
+#include "libkommpot.h"
+
+#include <kommpot_core.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <unordered_map>
+
+namespace {
+    constexpr uint8_t EXCEPTION_FLAG = 0x80;
+    constexpr size_t MAX_PDU_SIZE_BYTES = 253;
+
+    auto is_read(const kommpot::modbus_function &function) -> bool
+    {
+        return function == kommpot::modbus_function::READ_HOLDING_REGISTERS ||
+               function == kommpot::modbus_function::READ_INPUT_REGISTERS;
+    }
+
+    auto append(std::vector<uint8_t> &pdu, const uint16_t &value) -> void
+    {
+        pdu.push_back(static_cast<uint8_t>(value >> 8));
+        pdu.push_back(static_cast<uint8_t>(value & 0xFF));
+    }
+
+    auto load(const uint8_t *data) -> uint16_t
+    {
+        return static_cast<uint16_t>((data[0] << 8) | data[1]);
+    }
+
+    auto make_read(const kommpot::modbus_function &function, const uint16_t &address,
+        const uint16_t &count) -> std::vector<uint8_t>
+    {
+        std::vector<uint8_t> pdu = {static_cast<uint8_t>(function)};
+        append(pdu, address);
+        append(pdu, count);
+        return pdu;
+    }
+
+    /**
+     * @brief checks the response PDU of a read and stores its registers.
+     * @return false on exception or malformed response.
+     */
+    auto parse_read(const std::vector<uint8_t> &request, const std::vector<uint8_t> &response,
+        uint16_t *values, uint8_t &exception_code) -> bool
+    {
+        exception_code = 0;
+
+        if (response.size() == 2 && response[0] == (request[0] | EXCEPTION_FLAG))
+        {
+            exception_code = response[1];
+            SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+                "Modbus read of {} registers at {} failed with exception {}.", load(&request[3]),
+                load(&request[1]), exception_code);
+            return false;
+        }
+
+        const auto count = load(&request[3]);
+        if (response.size() < 2 || response[0] != request[0] || response[1] != count * 2 ||
+            response.size() != static_cast<size_t>(response[1]) + 2)
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Modbus read response is malformed.");
+            return false;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            values[i] = load(&response[2 + i * 2]);
+        }
+
+        return true;
+    }
+} // namespace
+
+kommpot::modbus_tcp_client::modbus_tcp_client(device_communication &communication,
+    transfer_configuration configuration, uint8_t unit_id, size_t max_pending_requests)
+    : m_reader(communication, configuration)
+    , m_writer(communication, configuration, buffered_writer::M_DEFAULT_FLUSH_SIZE_BYTES, 0)
+    , m_unit_id(unit_id)
+    , m_max_pending_requests(std::max<size_t>(max_pending_requests, 1))
+{}
+
+auto kommpot::modbus_tcp_client::set_merge_gap(uint16_t merge_gap_registers) -> void
+{
+    m_merge_gap_registers = merge_gap_registers;
+}
+
+auto kommpot::modbus_tcp_client::read(std::vector<modbus_read_request> &requests) -> bool
+{
+    if (read_batch(requests, true))
+    {
+        return true;
+    }
+
+    /**
+     * @attention the device rejects the whole merged PDU if any register in it is invalid, the
+     * requests which were merged are repeated on their own to tell them apart.
+     */
+    std::vector<modbus_read_request> retries;
+    std::vector<size_t> retry_indexes;
+    for (size_t i = 0; i < requests.size(); i++)
+    {
+        if (requests[i].exception_code != 0)
+        {
+            retries.push_back(requests[i]);
+            retry_indexes.push_back(i);
+        }
+    }
+
+    if (retries.empty())
+    {
+        return false;
+    }
+
+    static_cast<void>(read_batch(retries, false));
+    for (size_t i = 0; i < retries.size(); i++)
+    {
+        requests[retry_indexes[i]] = std::move(retries[i]);
+    }
+
+    return std::all_of(requests.begin(), requests.end(),
+        [](const modbus_read_request &request) { return request.is_succeeded; });
+}
+
+auto kommpot::modbus_tcp_client::read_holding_registers(
+    uint16_t address, uint16_t count, std::vector<uint16_t> &values) -> bool
+{
+    std::vector<modbus_read_request> requests(1);
+    requests[0].function = modbus_function::READ_HOLDING_REGISTERS;
+    requests[0].address = address;
+    requests[0].count = count;
+
+    const auto result = read_batch(requests, false);
+    values = std::move(requests[0].values);
+    return result;
+}
+
+auto kommpot::modbus_tcp_client::read_input_registers(
+    uint16_t address, uint16_t count, std::vector<uint16_t> &values) -> bool
+{
+    std::vector<modbus_read_request> requests(1);
+    requests[0].function = modbus_function::READ_INPUT_REGISTERS;
+    requests[0].address = address;
+    requests[0].count = count;
+
+    const auto result = read_batch(requests, false);
+    values = std::move(requests[0].values);
+    return result;
+}
+
+auto kommpot::modbus_tcp_client::write_single_register(uint16_t address, uint16_t value) -> bool
+{
+    std::vector<transaction> transactions(1);
+    transactions[0].request = {static_cast<uint8_t>(modbus_function::WRITE_SINGLE_REGISTER)};
+    append(transactions[0].request, address);
+    append(transactions[0].request, value);
+
+    return execute(transactions) && check_write(transactions[0]);
+}
+
+auto kommpot::modbus_tcp_client::write_multiple_registers(
+    uint16_t address, const std::vector<uint16_t> &values) -> bool
+{
+    if (values.empty() || values.size() > M_MAX_WRITE_REGISTERS)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Modbus write of {} registers is out of range 1-{}.",
+            values.size(), M_MAX_WRITE_REGISTERS);
+        return false;
+    }
+
+    std::vector<transaction> transactions(1);
+    auto &request = transactions[0].request;
+    request = {static_cast<uint8_t>(modbus_function::WRITE_MULTIPLE_REGISTERS)};
+    append(request, address);
+    append(request, static_cast<uint16_t>(values.size()));
+    request.push_back(static_cast<uint8_t>(values.size() * 2));
+    for (const auto value : values)
+    {
+        append(request, value);
+    }
+
+    return execute(transactions) && check_write(transactions[0]);
+}
+
+auto kommpot::modbus_tcp_client::last_exception_code() const -> uint8_t
+{
+    return m_last_exception_code;
+}
+
+auto kommpot::modbus_tcp_client::transaction_count() const -> size_t
+{
+    return m_transaction_count;
+}
+
+auto kommpot::modbus_tcp_client::read_batch(
+    std::vector<modbus_read_request> &requests, const bool &is_merging) -> bool
+{
+    struct span
+    {
+        modbus_function function = modbus_function::READ_HOLDING_REGISTERS;
+        uint32_t begin = 0;
+        uint32_t end = 0;
+        std::vector<size_t> members = {};
+        std::vector<uint16_t> values = {};
+        uint8_t exception_code = 0;
+        bool is_succeeded = true;
+    };
+
+    std::vector<size_t> order;
+    for (size_t i = 0; i < requests.size(); i++)
+    {
+        auto &request = requests[i];
+        request.values.clear();
+        request.exception_code = 0;
+        request.is_succeeded = false;
+
+        if (!is_read(request.function) || request.count == 0 ||
+            request.address + static_cast<uint32_t>(request.count) > 0x10000)
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Modbus read {} of {} registers at {} is invalid.",
+                modbus_function_to_string(request.function), request.count, request.address);
+            continue;
+        }
+        order.push_back(i);
+    }
+
+    std::sort(order.begin(), order.end(), [&requests](const size_t &a, const size_t &b) {
+        return std::make_pair(requests[a].function, requests[a].address) <
+               std::make_pair(requests[b].function, requests[b].address);
+    });
+
+    std::vector<span> spans;
+    for (const auto index : order)
+    {
+        const auto &request = requests[index];
+        const uint32_t end = request.address + static_cast<uint32_t>(request.count);
+
+        if (is_merging && !spans.empty() && spans.back().function == request.function &&
+            request.address <= spans.back().end + m_merge_gap_registers)
+        {
+            spans.back().end = std::max(spans.back().end, end);
+            spans.back().members.push_back(index);
+            continue;
+        }
+
+        span next;
+        next.function = request.function;
+        next.begin = request.address;
+        next.end = end;
+        next.members.push_back(index);
+        spans.push_back(std::move(next));
+    }
+
+    /**
+     * @attention spans beyond M_MAX_READ_REGISTERS are split, the PDUs are pipelined anyway.
+     */
+    std::vector<transaction> transactions;
+    std::vector<std::pair<size_t, uint32_t>> chunks;
+    for (size_t i = 0; i < spans.size(); i++)
+    {
+        auto &current = spans[i];
+        current.values.resize(current.end - current.begin);
+
+        for (auto address = current.begin; address < current.end;
+             address += M_MAX_READ_REGISTERS)
+        {
+            const auto count = std::min<uint32_t>(M_MAX_READ_REGISTERS, current.end - address);
+
+            transaction next;
+            next.request = make_read(current.function, static_cast<uint16_t>(address),
+                static_cast<uint16_t>(count));
+            transactions.push_back(std::move(next));
+            chunks.emplace_back(i, address - current.begin);
+        }
+    }
+
+    if (!execute(transactions))
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < transactions.size(); i++)
+    {
+        auto &current = spans[chunks[i].first];
+        uint8_t exception_code = 0;
+        if (!parse_read(transactions[i].request, transactions[i].response,
+                &current.values[chunks[i].second], exception_code))
+        {
+            current.is_succeeded = false;
+            if (current.exception_code == 0)
+            {
+                current.exception_code = exception_code;
+            }
+        }
+    }
+
+    bool is_succeeded = (order.size() == requests.size());
+    for (const auto &current : spans)
+    {
+        for (const auto index : current.members)
+        {
+            auto &request = requests[index];
+            request.exception_code = current.exception_code;
+            request.is_succeeded = current.is_succeeded;
+
+            if (current.is_succeeded)
+            {
+                const auto offset = request.address - current.begin;
+                request.values.assign(current.values.begin() + offset,
+                    current.values.begin() + offset + request.count);
+            }
+        }
+
+        if (!current.is_succeeded)
+        {
+            is_succeeded = false;
+            m_last_exception_code = current.exception_code;
+        }
+    }
+
+    return is_succeeded;
+}
+
+auto kommpot::modbus_tcp_client::execute(std::vector<transaction> &transactions) -> bool
+{
+    std::unordered_map<uint16_t, size_t> in_flight;
+    size_t sent = 0;
+    size_t completed = 0;
+
+    while (completed < transactions.size())
+    {
+        /**
+         * @attention the window is refilled once half of it was answered, so every flush carries
+         * several requests instead of one per response.
+         */
+        if (in_flight.size() <= m_max_pending_requests / 2 && sent < transactions.size())
+        {
+            while (sent < transactions.size() && in_flight.size() < m_max_pending_requests)
+            {
+                const auto transaction_id = m_next_transaction_id++;
+                if (!send(transaction_id, transactions[sent].request))
+                {
+                    return false;
+                }
+                in_flight[transaction_id] = sent++;
+            }
+
+            if (!m_writer.flush())
+            {
+                return false;
+            }
+        }
+
+        uint16_t transaction_id = 0;
+        uint8_t unit_id = 0;
+        std::vector<uint8_t> pdu;
+        if (!receive(transaction_id, unit_id, pdu))
+        {
+            return false;
+        }
+
+        if (unit_id != m_unit_id)
+        {
+            SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+                "Modbus response of transaction ID {} from unit {} instead of {} dropped.",
+                transaction_id, unit_id, m_unit_id);
+            continue;
+        }
+
+        /**
+         * @attention responses left over by an earlier failed batch carry an unknown ID and are
+         * dropped, so the stream resynchronizes by itself.
+         */
+        const auto it = in_flight.find(transaction_id);
+        if (it == in_flight.end())
+        {
+            SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+                "Modbus response with unknown transaction ID {} dropped.", transaction_id);
+            continue;
+        }
+
+        transactions[it->second].response = std::move(pdu);
+        in_flight.erase(it);
+        completed++;
+    }
+
+    return true;
+}
+
+auto kommpot::modbus_tcp_client::send(
+    const uint16_t &transaction_id, const std::vector<uint8_t> &pdu) -> bool
+{
+    std::array<uint8_t, M_MBAP_HEADER_SIZE_BYTES> header = {};
+    header[0] = static_cast<uint8_t>(transaction_id >> 8);
+    header[1] = static_cast<uint8_t>(transaction_id & 0xFF);
+    header[4] = static_cast<uint8_t>((pdu.size() + 1) >> 8);
+    header[5] = static_cast<uint8_t>((pdu.size() + 1) & 0xFF);
+    header[6] = m_unit_id;
+
+    m_transaction_count++;
+
+    return m_writer.write(header.data(), header.size()) && m_writer.write(pdu.data(), pdu.size());
+}
+
+auto kommpot::modbus_tcp_client::receive(
+    uint16_t &transaction_id, uint8_t &unit_id, std::vector<uint8_t> &pdu) -> bool
+{
+    std::array<uint8_t, M_MBAP_HEADER_SIZE_BYTES> header = {};
+    if (!m_reader.read_exact(header.data(), header.size()))
+    {
+        return false;
+    }
+
+    transaction_id = load(&header[0]);
+    const auto protocol_id = load(&header[2]);
+    const auto length = load(&header[4]);
+    unit_id = header[6];
+
+    if (protocol_id != 0 || length < 2 || length > MAX_PDU_SIZE_BYTES + 1)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "Modbus MBAP header with protocol {} and length {} is invalid.", protocol_id, length);
+        return false;
+    }
+
+    pdu.resize(length - 1);
+    return m_reader.read_exact(pdu.data(), pdu.size());
+}
+
+auto kommpot::modbus_tcp_client::check_write(const transaction &transaction) -> bool
+{
+    const auto &request = transaction.request;
+    const auto &response = transaction.response;
+
+    if (response.size() == 2 && response[0] == (request[0] | EXCEPTION_FLAG))
+    {
+        m_last_exception_code = response[1];
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Modbus write at {} failed with exception {}.",
+            load(&request[1]), m_last_exception_code);
+        return false;
+    }
+
+    /**
+     * @attention both write functions echo function code, address and value or count.
+     */
+    if (response.size() != 5 || !std::equal(response.begin(), response.end(), request.begin()))
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "Modbus write response is malformed.");
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,391 @@
+#include "libkommpot.h"
+
+#include <kommpot_core.h>
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <utility>
+
+namespace {
+    auto store(std::vector<uint8_t> &data, const uint32_t &value) -> void
+    {
+        data.push_back(static_cast<uint8_t>(value >> 24));
+        data.push_back(static_cast<uint8_t>(value >> 16));
+        data.push_back(static_cast<uint8_t>(value >> 8));
+        data.push_back(static_cast<uint8_t>(value));
+    }
+
+    auto load(const uint8_t *data) -> uint32_t
+    {
+        return (static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) |
+               (static_cast<uint32_t>(data[2]) << 8) | static_cast<uint32_t>(data[3]);
+    }
+} // namespace
+
+auto kommpot::length_prefixed_rpc_codec::encode(const uint32_t &request_id,
+    const std::vector<uint8_t> &payload, std::vector<uint8_t> &frame) const -> void
+{
+    store(frame, static_cast<uint32_t>(payload.size() + sizeof(request_id)));
+    store(frame, request_id);
+    frame.insert(std::end(frame), std::begin(payload), std::end(payload));
+}
+
+auto kommpot::length_prefixed_rpc_codec::decode(const uint8_t *data, size_t size_bytes,
+    uint32_t &request_id, std::vector<uint8_t> &payload) const -> std::optional<size_t>
+{
+    if (size_bytes < M_HEADER_SIZE_BYTES)
+    {
+        return 0;
+    }
+
+    const size_t length = load(data);
+    if (length < sizeof(request_id) || length > M_MAX_FRAME_SIZE_BYTES)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "RPC frame length {} is out of range.", length);
+        return std::nullopt;
+    }
+
+    const auto frame_size_bytes = sizeof(uint32_t) + length;
+    if (size_bytes < frame_size_bytes)
+    {
+        return 0;
+    }
+
+    request_id = load(data + sizeof(uint32_t));
+    payload.assign(data + M_HEADER_SIZE_BYTES, data + frame_size_bytes);
+
+    return frame_size_bytes;
+}
+
+kommpot::rpc_multiplexer::rpc_multiplexer(device_communication &communication,
+    std::shared_ptr<const rpc_codec> codec, size_t max_in_flight,
+    transfer_configuration configuration)
+    : m_communication(communication)
+    , m_configuration(configuration)
+    , m_codec(std::move(codec))
+    , m_writer(communication, std::move(configuration))
+{
+    /**
+     * @attention window must not exceed ID space of the codec, else wrapped IDs would collide.
+     */
+    const auto max_ids = static_cast<uint64_t>(m_codec->max_request_id()) + 1;
+    m_max_in_flight = static_cast<size_t>(
+        std::clamp<uint64_t>(static_cast<uint64_t>(max_in_flight), 1, max_ids));
+
+    m_is_running = true;
+    m_receive_thread = std::thread(&rpc_multiplexer::receive, this);
+    m_deadline_thread = std::thread(&rpc_multiplexer::expire, this);
+}
+
+kommpot::rpc_multiplexer::~rpc_multiplexer()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_is_running = false;
+    }
+    m_condition.notify_all();
+
+    /**
+     * @attention a read already running is not interrupted, joining waits up to the transfer
+     * timeout of the communication.
+     */
+    if (m_receive_thread.joinable())
+    {
+        m_receive_thread.join();
+    }
+
+    if (m_deadline_thread.joinable())
+    {
+        m_deadline_thread.join();
+    }
+
+    fail_all(rpc_status::CANCELLED);
+}
+
+auto kommpot::rpc_multiplexer::submit(
+    const std::vector<uint8_t> &request, rpc_callback callback, uint32_t timeout_msecs) -> bool
+{
+    uint32_t request_id = 0;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(
+            lock, [this]() { return !m_is_running || m_pending.size() < m_max_in_flight; });
+
+        if (!m_is_running)
+        {
+            return false;
+        }
+
+        const auto next = [this](const uint32_t &id) -> uint32_t {
+            return id >= m_codec->max_request_id() ? 0 : id + 1;
+        };
+
+        request_id = m_next_request_id;
+        while (m_pending.count(request_id) > 0)
+        {
+            request_id = next(request_id);
+        }
+        m_next_request_id = next(request_id);
+
+        pending_request pending;
+        pending.callback = std::move(callback);
+        pending.deadline = clock::now() + std::chrono::milliseconds(timeout_msecs);
+        m_pending.emplace(request_id, std::move(pending));
+    }
+    m_condition.notify_all();
+
+    std::vector<uint8_t> frame;
+    m_codec->encode(request_id, request, frame);
+
+    if (m_writer.write(frame.data(), frame.size()))
+    {
+        return true;
+    }
+
+    SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "RPC request {} could not be sent.", request_id);
+
+    /**
+     * @attention the request may have been completed by a failing receive meanwhile, its callback
+     * was called then.
+     */
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto is_erased = m_pending.erase(request_id) > 0;
+    m_condition.notify_all();
+
+    return !is_erased;
+}
+
+auto kommpot::rpc_multiplexer::call(const std::vector<uint8_t> &request,
+    std::vector<uint8_t> &response, uint32_t timeout_msecs) -> rpc_status
+{
+    auto result = std::make_shared<std::promise<std::pair<rpc_status, std::vector<uint8_t>>>>();
+    auto future = result->get_future();
+
+    if (!submit(
+            request,
+            [result](rpc_status status, std::vector<uint8_t> reply) {
+                result->set_value(std::make_pair(status, std::move(reply)));
+            },
+            timeout_msecs))
+    {
+        return rpc_status::FAILED;
+    }
+
+    static_cast<void>(flush());
+
+    auto completion = future.get();
+    response = std::move(completion.second);
+
+    return completion.first;
+}
+
+auto kommpot::rpc_multiplexer::flush() -> bool
+{
+    if (m_writer.flush())
+    {
+        return true;
+    }
+
+    SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "RPC requests could not be sent.");
+    fail_all(rpc_status::FAILED);
+
+    return false;
+}
+
+auto kommpot::rpc_multiplexer::in_flight() const -> size_t
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pending.size();
+}
+
+auto kommpot::rpc_multiplexer::receive() -> void
+{
+    std::vector<uint8_t> buffer(M_RECEIVE_SIZE_BYTES);
+    size_t used_size_bytes = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return !m_is_running || !m_pending.empty(); });
+
+            if (!m_is_running)
+            {
+                return;
+            }
+        }
+
+        /**
+         * @attention frames larger than the buffer are collected by growing it, the codec limits
+         * the frame size.
+         */
+        if (used_size_bytes == buffer.size())
+        {
+            buffer.resize(buffer.size() * 2);
+        }
+
+        size_t received_size_bytes = 0;
+        if (!m_communication.read_some(m_configuration, buffer.data() + used_size_bytes,
+                buffer.size() - used_size_bytes, received_size_bytes))
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_is_running)
+                {
+                    return;
+                }
+            }
+
+            /**
+             * @attention a read timing out only means the link is idle, the deadline thread
+             * expires the requests and a partially received reply is kept for the next read.
+             */
+            if (m_communication.is_alive())
+            {
+                continue;
+            }
+
+            SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "RPC link lost, outstanding requests fail.");
+            fail_all(rpc_status::FAILED);
+            used_size_bytes = 0;
+            continue;
+        }
+
+        used_size_bytes += received_size_bytes;
+
+        size_t offset = 0;
+        while (offset < used_size_bytes)
+        {
+            uint32_t request_id = 0;
+            std::vector<uint8_t> response;
+            const auto consumed_size_bytes = m_codec->decode(
+                buffer.data() + offset, used_size_bytes - offset, request_id, response);
+
+            /**
+             * @attention a malformed frame leaves no way to find the next one, the received data
+             * is dropped and the outstanding requests fail.
+             */
+            if (!consumed_size_bytes.has_value())
+            {
+                SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+                    "RPC reply is malformed, {} received bytes dropped.", used_size_bytes - offset);
+                fail_all(rpc_status::FAILED);
+                offset = used_size_bytes;
+                break;
+            }
+
+            if (*consumed_size_bytes == 0)
+            {
+                break;
+            }
+
+            offset += *consumed_size_bytes;
+            complete(request_id, std::move(response));
+        }
+
+        used_size_bytes -= offset;
+        if (used_size_bytes > 0 && offset > 0)
+        {
+            std::memmove(buffer.data(), buffer.data() + offset, used_size_bytes);
+        }
+    }
+}
+
+auto kommpot::rpc_multiplexer::expire() -> void
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (m_is_running)
+    {
+        if (m_pending.empty())
+        {
+            m_condition.wait(lock);
+            continue;
+        }
+
+        const auto now = clock::now();
+        auto earliest = clock::time_point::max();
+        std::vector<rpc_callback> expired;
+
+        for (auto it = m_pending.begin(); it != m_pending.end();)
+        {
+            if (it->second.deadline <= now)
+            {
+                SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER, "RPC request {} timed out.", it->first);
+                expired.push_back(std::move(it->second.callback));
+                it = m_pending.erase(it);
+                continue;
+            }
+
+            earliest = std::min(earliest, it->second.deadline);
+            ++it;
+        }
+
+        if (expired.empty())
+        {
+            m_condition.wait_until(lock, earliest);
+            continue;
+        }
+
+        lock.unlock();
+        m_condition.notify_all();
+
+        for (auto &callback : expired)
+        {
+            if (callback)
+            {
+                callback(rpc_status::TIMED_OUT, {});
+            }
+        }
+
+        lock.lock();
+    }
+}
+
+auto kommpot::rpc_multiplexer::complete(const uint32_t &request_id, std::vector<uint8_t> &&response)
+    -> void
+{
+    rpc_callback callback = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        /**
+         * @attention replies arriving after their deadline carry an unknown ID and are dropped.
+         */
+        const auto it = m_pending.find(request_id);
+        if (it == m_pending.end())
+        {
+            SPDLOG_LOGGER_DEBUG(KOMMPOT_LOGGER,
+                "RPC reply with unknown request ID {} dropped.", request_id);
+            return;
+        }
+
+        callback = std::move(it->second.callback);
+        m_pending.erase(it);
+    }
+    m_condition.notify_all();
+
+    if (callback)
+    {
+        callback(rpc_status::SUCCEEDED, std::move(response));
+    }
+}
+
+auto kommpot::rpc_multiplexer::fail_all(const rpc_status &status) -> void
+{
+    std::unordered_map<uint32_t, pending_request> pending;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        pending.swap(m_pending);
+    }
+    m_condition.notify_all();
+
+    for (auto &[request_id, request] : pending)
+    {
+        if (request.callback)
+        {
+            request.callback(status, {});
+        }
+    }
+}
@@ -0,0 +1,304 @@
+#include "libkommpot.h"
+
+#include <kommpot_core.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+
+kommpot::scpi_session::scpi_session(device_communication &communication,
+    transfer_configuration configuration, size_t max_pipeline_depth)
+    : m_reader(communication, configuration)
+    , m_writer(communication, configuration, buffered_writer::M_DEFAULT_FLUSH_SIZE_BYTES, 0)
+    , m_max_pipeline_depth(std::max<size_t>(max_pipeline_depth, 1))
+{}
+
+auto kommpot::scpi_session::command(const std::string &command) -> bool
+{
+    return send_line(command);
+}
+
+auto kommpot::scpi_session::send_query(const std::string &query) -> bool
+{
+    if (m_pending_responses >= m_max_pipeline_depth)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+            "SCPI pipeline is full with {} pending responses, read them first.",
+            m_pending_responses);
+        return false;
+    }
+
+    if (!send_line(query))
+    {
+        return false;
+    }
+
+    m_pending_responses++;
+
+    return true;
+}
+
+auto kommpot::scpi_session::read_response(std::string &response) -> bool
+{
+    if (!flush())
+    {
+        return false;
+    }
+
+    std::array<char, 2> prefix = {};
+    if (!m_reader.peek(prefix.data(), 1))
+    {
+        return false;
+    }
+
+    /**
+     * @attention non-decimal numbers like #HFF start with '#' as well, only a digit makes a block.
+     */
+    if (prefix[0] == '#' && m_reader.peek(prefix.data(), prefix.size()) &&
+        std::isdigit(static_cast<unsigned char>(prefix[1])))
+    {
+        size_t block_size_bytes = 0;
+        bool is_indefinite = false;
+        if (!read_block_header(block_size_bytes, is_indefinite))
+        {
+            return false;
+        }
+
+        if (!is_indefinite)
+        {
+            response.resize(block_size_bytes);
+            if (block_size_bytes > 0 && !m_reader.read_exact(response.data(), block_size_bytes))
+            {
+                return false;
+            }
+
+            complete_response();
+            return read_terminator();
+        }
+    }
+
+    if (!m_reader.read_until("\n", response, M_MAX_RESPONSE_SIZE_BYTES))
+    {
+        return false;
+    }
+
+    response.pop_back();
+    if (!response.empty() && response.back() == '\r')
+    {
+        response.pop_back();
+    }
+
+    complete_response();
+
+    return true;
+}
+
+auto kommpot::scpi_session::read_block(void *data, size_t size_bytes, size_t &block_size_bytes)
+    -> bool
+{
+    block_size_bytes = 0;
+
+    if (!flush())
+    {
+        return false;
+    }
+
+    bool is_indefinite = false;
+    if (!read_block_header(block_size_bytes, is_indefinite))
+    {
+        return false;
+    }
+
+    if (is_indefinite)
+    {
+        std::string payload;
+        if (!m_reader.read_until("\n", payload, M_MAX_RESPONSE_SIZE_BYTES))
+        {
+            return false;
+        }
+        complete_response();
+
+        payload.pop_back();
+        block_size_bytes = payload.size();
+        if (payload.size() > size_bytes)
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER,
+                "SCPI block of {} bytes exceeds buffer of {} bytes.", payload.size(), size_bytes);
+            return false;
+        }
+
+        std::memcpy(data, payload.data(), payload.size());
+        return true;
+    }
+
+    if (block_size_bytes > size_bytes)
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "SCPI block of {} bytes exceeds buffer of {} bytes.",
+            block_size_bytes, size_bytes);
+
+        /**
+         * @attention the payload is drained, so the following responses stay readable.
+         */
+        complete_response();
+        (void)(skip(block_size_bytes) && read_terminator());
+        return false;
+    }
+
+    if (block_size_bytes > 0 && !m_reader.read_exact(data, block_size_bytes))
+    {
+        return false;
+    }
+
+    complete_response();
+
+    return read_terminator();
+}
+
+auto kommpot::scpi_session::query(const std::string &query, std::string &response) -> bool
+{
+    return send_query(query) && read_response(response);
+}
+
+auto kommpot::scpi_session::query(
+    const std::vector<std::string> &queries, std::vector<std::string> &responses) -> bool
+{
+    responses.clear();
+    responses.resize(queries.size());
+
+    size_t sent = 0;
+    for (auto &response : responses)
+    {
+        /**
+         * @attention the window is refilled once half of it was answered, so every flush carries
+         * several queries instead of one per response.
+         */
+        if (m_pending_responses <= m_max_pipeline_depth / 2)
+        {
+            while (sent < queries.size() && m_pending_responses < m_max_pipeline_depth)
+            {
+                if (!send_query(queries[sent++]))
+                {
+                    return false;
+                }
+            }
+        }
+
+        if (!read_response(response))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+auto kommpot::scpi_session::query_block(
+    const std::string &query, void *data, size_t size_bytes, size_t &block_size_bytes) -> bool
+{
+    return send_query(query) && read_block(data, size_bytes, block_size_bytes);
+}
+
+auto kommpot::scpi_session::flush() -> bool
+{
+    return m_writer.flush();
+}
+
+auto kommpot::scpi_session::pending_responses() const -> size_t
+{
+    return m_pending_responses;
+}
+
+auto kommpot::scpi_session::send_line(const std::string &line) -> bool
+{
+    if (!m_writer.write(line.data(), line.size()))
+    {
+        return false;
+    }
+
+    if (line.empty() || line.back() != '\n')
+    {
+        return m_writer.write("\n", 1);
+    }
+
+    return true;
+}
+
+auto kommpot::scpi_session::read_block_header(size_t &block_size_bytes, bool &is_indefinite)
+    -> bool
+{
+    std::array<char, 2> prefix = {};
+    if (!m_reader.peek(prefix.data(), prefix.size()))
+    {
+        return false;
+    }
+
+    if (prefix[0] != '#' || !std::isdigit(static_cast<unsigned char>(prefix[1])))
+    {
+        SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "SCPI response is no IEEE 488.2 block.");
+        return false;
+    }
+
+    const auto digit_count = static_cast<size_t>(prefix[1] - '0');
+    is_indefinite = (digit_count == 0);
+
+    std::array<char, 11> header = {};
+    if (!m_reader.peek(header.data(), prefix.size() + digit_count))
+    {
+        return false;
+    }
+
+    block_size_bytes = 0;
+    for (size_t i = 0; i < digit_count; i++)
+    {
+        const auto digit = header[prefix.size() + i];
+        if (!std::isdigit(static_cast<unsigned char>(digit)))
+        {
+            SPDLOG_LOGGER_ERROR(KOMMPOT_LOGGER, "SCPI block header has invalid length digits.");
+            return false;
+        }
+        block_size_bytes = block_size_bytes * 10 + static_cast<size_t>(digit - '0');
+    }
+
+    return m_reader.read_exact(header.data(), prefix.size() + digit_count);
+}
+
+auto kommpot::scpi_session::read_terminator() -> bool
+{
+    char terminator = 0;
+    if (!m_reader.read_exact(&terminator, sizeof(terminator)))
+    {
+        return false;
+    }
+
+    if (terminator == '\r' && !m_reader.read_exact(&terminator, sizeof(terminator)))
+    {
+        return false;
+    }
+
+    return terminator == '\n';
+}
+
+auto kommpot::scpi_session::skip(size_t size_bytes) -> bool
+{
+    std::array<uint8_t, 4096> scratch = {};
+    while (size_bytes > 0)
+    {
+        const auto chunk_size_bytes = std::min(size_bytes, scratch.size());
+        if (!m_reader.read_exact(scratch.data(), chunk_size_bytes))
+        {
+            return false;
+        }
+        size_bytes -= chunk_size_bytes;
+    }
+
+    return true;
+}
+
+auto kommpot::scpi_session::complete_response() -> void
+{
+    if (m_pending_responses > 0)
+    {
+        m_pending_responses--;
+    }
+}
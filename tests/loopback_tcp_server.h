@@ -0,0 +1,246 @@
+#ifndef LOOPBACK_TCP_SERVER_H
+#define LOOPBACK_TCP_SERVER_H
+
+#pragma once
+
+// clazy:skip
+// NOLINTBEGIN
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+// clang-format off
+#    include <winsock2.h>
+#    include <ws2tcpip.h>
+// clang-format on
+#else
+#    include <arpa/inet.h>
+#    include <netinet/in.h>
+#    include <sys/select.h>
+#    include <sys/socket.h>
+#    include <unistd.h>
+#endif
+
+/**
+ * @brief minimal TCP server bound to 127.0.0.1 on an ephemeral port, every accepted connection is
+ * passed to the handler on the server thread.
+ */
+class loopback_tcp_server
+{
+public:
+#ifdef _WIN32
+    using handle_type = SOCKET;
+    static constexpr handle_type M_INVALID_HANDLE = INVALID_SOCKET;
+#else
+    using handle_type = int;
+    static constexpr handle_type M_INVALID_HANDLE = -1;
+#endif
+
+    using handler_type = std::function<void(handle_type)>;
+
+    loopback_tcp_server() = default;
+    ~loopback_tcp_server()
+    {
+        stop();
+    }
+
+    loopback_tcp_server(const loopback_tcp_server &obj) = delete;
+    auto operator=(const loopback_tcp_server &obj) -> loopback_tcp_server & = delete;
+
+    auto start(handler_type handler) -> bool
+    {
+#ifdef _WIN32
+        WSADATA wsa_data = {};
+        WSAStartup(MAKEWORD(2, 2), &wsa_data);
+#endif
+        m_handle = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (m_handle == M_INVALID_HANDLE)
+        {
+            return false;
+        }
+
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = 0;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        if (bind(m_handle, (const sockaddr *)&address, sizeof(address)) != 0 ||
+            listen(m_handle, 64) != 0)
+        {
+            close_handle(m_handle);
+            return false;
+        }
+
+        socklen_t address_length_bytes = sizeof(address);
+        getsockname(m_handle, (sockaddr *)&address, &address_length_bytes);
+        m_port = ntohs(address.sin_port);
+
+        m_handler = std::move(handler);
+        m_is_running = true;
+        m_thread = std::thread(&loopback_tcp_server::run, this);
+
+        return true;
+    }
+
+    auto stop() -> void
+    {
+        m_is_running = false;
+
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+
+        close_handle(m_handle);
+    }
+
+    auto port() const -> uint16_t
+    {
+        return m_port;
+    }
+
+    auto accepted_count() const -> uint32_t
+    {
+        return m_accepted_count;
+    }
+
+    /**
+     * @brief waits until the server thread has accepted the given number of connections, accept()
+     * runs asynchronously to connect() of the client.
+     */
+    auto wait_for_accepted(const uint32_t count, const uint32_t timeout_msecs = 1000) const -> bool
+    {
+        const auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_msecs);
+        while (m_accepted_count < count)
+        {
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    static auto receive_all(handle_type handle, void *data, size_t size_bytes) -> bool
+    {
+        auto *bytes = static_cast<char *>(data);
+        while (size_bytes > 0)
+        {
+            const auto result = recv(handle, bytes, static_cast<int>(size_bytes), 0);
+            if (result <= 0)
+            {
+                return false;
+            }
+            bytes += result;
+            size_bytes -= static_cast<size_t>(result);
+        }
+        return true;
+    }
+
+    static auto send_all(handle_type handle, const void *data, size_t size_bytes) -> bool
+    {
+        const auto *bytes = static_cast<const char *>(data);
+        while (size_bytes > 0)
+        {
+            const auto result = send(handle, bytes, static_cast<int>(size_bytes), 0);
+            if (result <= 0)
+            {
+                return false;
+            }
+            bytes += result;
+            size_bytes -= static_cast<size_t>(result);
+        }
+        return true;
+    }
+
+    /**
+     * @brief handler that echoes every received byte until the peer closes the connection.
+     */
+    static auto echo(handle_type handle) -> void
+    {
+        char buffer[4096];
+        while (true)
+        {
+            const auto result = recv(handle, buffer, sizeof(buffer), 0);
+            if (result <= 0 || !send_all(handle, buffer, static_cast<size_t>(result)))
+            {
+                return;
+            }
+        }
+    }
+
+    static auto close_handle(handle_type &handle) -> void
+    {
+        if (handle == M_INVALID_HANDLE)
+        {
+            return;
+        }
+#ifdef _WIN32
+        closesocket(handle);
+#else
+        close(handle);
+#endif
+        handle = M_INVALID_HANDLE;
+    }
+
+private:
+    handle_type m_handle = M_INVALID_HANDLE;
+    uint16_t m_port = 0;
+    handler_type m_handler;
+    std::atomic_bool m_is_running = false;
+    std::atomic<uint32_t> m_accepted_count = 0;
+    std::thread m_thread;
+    std::vector<std::thread> m_connections;
+
+    auto run() -> void
+    {
+        while (m_is_running)
+        {
+            fd_set read_set;
+            FD_ZERO(&read_set);
+            FD_SET(m_handle, &read_set);
+
+            timeval timeout = {};
+            timeout.tv_usec = 20 * 1000;
+
+            if (select(static_cast<int>(m_handle) + 1, &read_set, nullptr, nullptr, &timeout) <= 0)
+            {
+                continue;
+            }
+
+            handle_type client = accept(m_handle, nullptr, nullptr);
+            if (client == M_INVALID_HANDLE)
+            {
+                continue;
+            }
+
+            m_accepted_count++;
+
+            m_connections.emplace_back([this, client]() mutable {
+                if (m_handler)
+                {
+                    m_handler(client);
+                }
+                close_handle(client);
+            });
+        }
+
+        for (auto &connection : m_connections)
+        {
+            connection.join();
+        }
+        m_connections.clear();
+    }
+};
+
+// NOLINTEND
+
+#endif // LOOPBACK_TCP_SERVER_H
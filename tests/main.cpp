@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
-#include <spdlog/sinks/msvc_sink.h>
+#ifdef _WIN32
+#    include <spdlog/sinks/msvc_sink.h>
+#else
+#    include <spdlog/sinks/null_sink.h>
+#endif
 #include <spdlog/spdlog.h>
 
 auto main(int argc, char *argv[]) -> int
@@ -9,11 +13,15 @@ auto main(int argc, char *argv[]) -> int
     // does not return nullptr when factory error paths are exercised.
     if (!spdlog::get("kommpot"))
     {
+#ifdef _WIN32
         auto sink = std::make_shared<spdlog::sinks::msvc_sink_mt>();
+#else
+        auto sink = std::make_shared<spdlog::sinks::null_sink_mt>();
+#endif
         auto logger = std::make_shared<spdlog::logger>("kommpot", sink);
         spdlog::register_logger(logger);
     }
 
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
-}
\ No newline at end of file
+}
@@ -0,0 +1,302 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/communication_ethernet.h>
+
+#include "loopback_tcp_server.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * Helper classes.
+ *
+ *******************************************************************************/
+
+/**
+ * @brief serves a fixed byte stream in chunks of at most chunk_size_bytes per read_some().
+ */
+class fake_stream_communication : public kommpot::device_communication
+{
+public:
+    fake_stream_communication(std::string stream, size_t chunk_size_bytes)
+        : device_communication(kommpot::ethernet_device_identification())
+        , m_stream(std::move(stream))
+        , m_chunk_size_bytes(chunk_size_bytes)
+    {}
+
+    auto open() -> bool override
+    {
+        return true;
+    }
+
+    auto is_open() -> bool override
+    {
+        return true;
+    }
+
+    void close() override {}
+
+    auto endpoints() -> std::vector<kommpot::endpoint_information> override
+    {
+        return {};
+    }
+
+    auto read(const kommpot::transfer_configuration &configuration, void *data,
+        size_t size_bytes) -> bool override
+    {
+        read_count++;
+        if (m_stream.size() - m_position < size_bytes)
+        {
+            return false;
+        }
+        std::memcpy(data, m_stream.data() + m_position, size_bytes);
+        m_position += size_bytes;
+        return true;
+    }
+
+    auto read_some(const kommpot::transfer_configuration &configuration, void *data,
+        size_t size_bytes, size_t &received_size_bytes) -> bool override
+    {
+        read_count++;
+        received_size_bytes =
+            std::min({size_bytes, m_chunk_size_bytes, m_stream.size() - m_position});
+        std::memcpy(data, m_stream.data() + m_position, received_size_bytes);
+        m_position += received_size_bytes;
+        return received_size_bytes > 0;
+    }
+
+    auto write(const kommpot::transfer_configuration &configuration, void *data,
+        size_t size_bytes) -> bool override
+    {
+        return false;
+    }
+
+    auto get_error_string(const uint32_t &native_error_code) const -> std::string override
+    {
+        return "";
+    }
+
+    auto native_handle() const -> void * override
+    {
+        return nullptr;
+    }
+
+    uint64_t read_count = 0;
+
+private:
+    std::string m_stream;
+    size_t m_chunk_size_bytes = 0;
+    size_t m_position = 0;
+};
+
+/*******************************************************************************
+ *
+ * buffered_reader — read_until.
+ *
+ *******************************************************************************/
+TEST(buffered_reader, read_until_splits_lines)
+{
+    fake_stream_communication communication("first\nsecond\nthird\n", 64);
+    kommpot::buffered_reader reader(communication);
+
+    std::string line;
+    ASSERT_TRUE(reader.read_until("\n", line));
+    EXPECT_EQ(line, "first\n");
+    ASSERT_TRUE(reader.read_until("\n", line));
+    EXPECT_EQ(line, "second\n");
+    ASSERT_TRUE(reader.read_until("\n", line));
+    EXPECT_EQ(line, "third\n");
+
+    EXPECT_EQ(communication.read_count, 1u);
+    EXPECT_FALSE(reader.read_until("\n", line));
+}
+
+TEST(buffered_reader, read_until_finds_delimiter_split_across_reads)
+{
+    fake_stream_communication communication("ab\r\ncd\r\n", 3);
+    kommpot::buffered_reader reader(communication);
+
+    std::string line;
+    ASSERT_TRUE(reader.read_until("\r\n", line));
+    EXPECT_EQ(line, "ab\r\n");
+    ASSERT_TRUE(reader.read_until("\r\n", line));
+    EXPECT_EQ(line, "cd\r\n");
+}
+
+TEST(buffered_reader, read_until_rejects_overlong_line_and_keeps_data)
+{
+    fake_stream_communication communication("0123456789\n", 64);
+    kommpot::buffered_reader reader(communication);
+
+    std::string line;
+    EXPECT_FALSE(reader.read_until("\n", line, 5));
+    EXPECT_EQ(reader.buffered_size(), 11u);
+
+    ASSERT_TRUE(reader.read_until("\n", line));
+    EXPECT_EQ(line, "0123456789\n");
+}
+
+TEST(buffered_reader, read_until_grows_beyond_read_ahead_size)
+{
+    const std::string payload(100, 'x');
+    fake_stream_communication communication(payload + "\n", 7);
+    kommpot::buffered_reader reader(communication, {}, 16);
+
+    std::string line;
+    ASSERT_TRUE(reader.read_until("\n", line));
+    EXPECT_EQ(line, payload + "\n");
+}
+
+/*******************************************************************************
+ *
+ * buffered_reader — peek / read_exact.
+ *
+ *******************************************************************************/
+TEST(buffered_reader, peek_does_not_consume)
+{
+    fake_stream_communication communication("#15hello", 64);
+    kommpot::buffered_reader reader(communication);
+
+    char header[3] = {};
+    ASSERT_TRUE(reader.peek(header, sizeof(header)));
+    EXPECT_EQ(std::string(header, sizeof(header)), "#15");
+
+    char data[8] = {};
+    ASSERT_TRUE(reader.read_exact(data, sizeof(data)));
+    EXPECT_EQ(std::string(data, sizeof(data)), "#15hello");
+    EXPECT_EQ(reader.buffered_size(), 0u);
+}
+
+TEST(buffered_reader, read_exact_serves_small_reads_from_buffer)
+{
+    fake_stream_communication communication(std::string(256, 'a'), 1024);
+    kommpot::buffered_reader reader(communication);
+
+    for (size_t i = 0; i < 64; i++)
+    {
+        char field[4] = {};
+        ASSERT_TRUE(reader.read_exact(field, sizeof(field)));
+    }
+
+    EXPECT_EQ(communication.read_count, 1u);
+}
+
+TEST(buffered_reader, read_exact_large_read_bypasses_buffer)
+{
+    std::string stream = "head";
+    stream += std::string(1000, 'b');
+    fake_stream_communication communication(stream, 4);
+    kommpot::buffered_reader reader(communication, {}, 16);
+
+    char head[2] = {};
+    ASSERT_TRUE(reader.read_exact(head, sizeof(head)));
+
+    std::string rest(stream.size() - sizeof(head), '\0');
+    ASSERT_TRUE(reader.read_exact(rest.data(), rest.size()));
+    EXPECT_EQ(rest, stream.substr(sizeof(head)));
+
+    /**
+     * @attention one read_some() filled the buffer, one read() fetched the remainder directly.
+     */
+    EXPECT_EQ(communication.read_count, 2u);
+}
+
+TEST(buffered_reader, read_exact_fails_on_missing_data)
+{
+    fake_stream_communication communication("abc", 64);
+    kommpot::buffered_reader reader(communication);
+
+    char data[4] = {};
+    EXPECT_FALSE(reader.read_exact(data, sizeof(data)));
+    EXPECT_EQ(reader.buffered_size(), 3u);
+}
+
+TEST(buffered_reader, discard_drops_buffered_bytes)
+{
+    fake_stream_communication communication("abc\ndef\n", 64);
+    kommpot::buffered_reader reader(communication);
+
+    std::string line;
+    ASSERT_TRUE(reader.read_until("\n", line));
+    reader.discard();
+
+    EXPECT_EQ(reader.buffered_size(), 0u);
+    EXPECT_FALSE(reader.read_until("\n", line));
+}
+
+/*******************************************************************************
+ *
+ * buffered_reader — device reads per parsed message.
+ *
+ *******************************************************************************/
+TEST(buffered_reader, device_reads_drop_at_least_tenfold)
+{
+    static constexpr size_t MESSAGES = 1000;
+
+    std::string stream;
+    for (size_t i = 0; i < MESSAGES; i++)
+    {
+        stream += "+1.234567E+00\n";
+    }
+
+    /**
+     * @attention chunks of one TCP segment, unbuffered parsing needs one read per message at best.
+     */
+    fake_stream_communication communication(stream, 1460);
+    kommpot::buffered_reader reader(communication);
+
+    std::string line;
+    for (size_t i = 0; i < MESSAGES; i++)
+    {
+        ASSERT_TRUE(reader.read_until("\n", line));
+    }
+
+    EXPECT_EQ(reader.device_read_count(), communication.read_count);
+    EXPECT_LE(communication.read_count * 10, MESSAGES);
+}
+
+/*******************************************************************************
+ *
+ * buffered_reader — communication_ethernet on loopback.
+ *
+ *******************************************************************************/
+TEST(buffered_reader, reads_lines_from_communication_ethernet)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start([](loopback_tcp_server::handle_type handle) {
+        const std::string responses = "KOMMPOT,SIM,0,1.0\n+4.2E+00\n";
+        loopback_tcp_server::send_all(handle, responses.data(), responses.size());
+        char byte = 0;
+        loopback_tcp_server::receive_all(handle, &byte, sizeof(byte));
+    }));
+
+    kommpot::ethernet_device_identification identification;
+    identification.ip = "127.0.0.1";
+    identification.port = server.port();
+    identification.protocol = kommpot::ethernet_protocol_type::TCP;
+
+    communication_ethernet communication(identification);
+    ASSERT_TRUE(communication.open());
+
+    kommpot::buffered_reader reader(communication);
+
+    std::string line;
+    ASSERT_TRUE(reader.read_until("\n", line));
+    EXPECT_EQ(line, "KOMMPOT,SIM,0,1.0\n");
+    ASSERT_TRUE(reader.read_until("\n", line));
+    EXPECT_EQ(line, "+4.2E+00\n");
+
+    communication.close();
+}
+
+// NOLINTEND
@@ -0,0 +1,276 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/communication_ethernet.h>
+
+#include "loopback_tcp_server.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * Helper classes.
+ *
+ *******************************************************************************/
+
+/**
+ * @brief records every write() as one device write.
+ */
+class fake_sink_communication : public kommpot::device_communication
+{
+public:
+    fake_sink_communication()
+        : device_communication(kommpot::ethernet_device_identification())
+    {}
+
+    auto open() -> bool override
+    {
+        return true;
+    }
+
+    auto is_open() -> bool override
+    {
+        return true;
+    }
+
+    void close() override {}
+
+    auto endpoints() -> std::vector<kommpot::endpoint_information> override
+    {
+        return {};
+    }
+
+    auto read(const kommpot::transfer_configuration &configuration, void *data,
+        size_t size_bytes) -> bool override
+    {
+        return false;
+    }
+
+    auto write(const kommpot::transfer_configuration &configuration, void *data,
+        size_t size_bytes) -> bool override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_writes.emplace_back(static_cast<const char *>(data), size_bytes);
+        return is_failing == false;
+    }
+
+    auto get_error_string(const uint32_t &native_error_code) const -> std::string override
+    {
+        return "";
+    }
+
+    auto native_handle() const -> void * override
+    {
+        return nullptr;
+    }
+
+    auto writes() -> std::vector<std::string>
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_writes;
+    }
+
+    std::atomic_bool is_failing = false;
+
+private:
+    std::mutex m_mutex;
+    std::vector<std::string> m_writes;
+};
+
+static bool wait_for_writes(fake_sink_communication &communication, const size_t count)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (communication.writes().size() < count)
+    {
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+/*******************************************************************************
+ *
+ * buffered_writer — coalescing.
+ *
+ *******************************************************************************/
+TEST(buffered_writer, small_writes_are_coalesced_until_flush)
+{
+    fake_sink_communication communication;
+    kommpot::buffered_writer writer(communication, {}, 1024, 0);
+
+    ASSERT_TRUE(writer.write("VOLT 1\n", 7));
+    ASSERT_TRUE(writer.write("CURR 2\n", 7));
+    ASSERT_TRUE(writer.write("OUTP ON\n", 8));
+
+    EXPECT_TRUE(communication.writes().empty());
+    EXPECT_EQ(writer.buffered_size(), 22u);
+
+    ASSERT_TRUE(writer.flush());
+
+    const std::vector<std::string> expected = {"VOLT 1\nCURR 2\nOUTP ON\n"};
+    EXPECT_EQ(communication.writes(), expected);
+    EXPECT_EQ(writer.device_write_count(), 1u);
+    EXPECT_EQ(writer.buffered_size(), 0u);
+}
+
+TEST(buffered_writer, size_threshold_triggers_write)
+{
+    fake_sink_communication communication;
+    kommpot::buffered_writer writer(communication, {}, 8, 0);
+
+    ASSERT_TRUE(writer.write("abcd", 4));
+    EXPECT_TRUE(communication.writes().empty());
+    ASSERT_TRUE(writer.write("efgh", 4));
+
+    const std::vector<std::string> expected = {"abcdefgh"};
+    EXPECT_EQ(communication.writes(), expected);
+}
+
+TEST(buffered_writer, large_write_bypasses_buffer_in_order)
+{
+    fake_sink_communication communication;
+    kommpot::buffered_writer writer(communication, {}, 8, 0);
+
+    const std::string block(32, 'x');
+    ASSERT_TRUE(writer.write("ab", 2));
+    ASSERT_TRUE(writer.write(block.data(), block.size()));
+
+    const std::vector<std::string> expected = {"ab", block};
+    EXPECT_EQ(communication.writes(), expected);
+}
+
+TEST(buffered_writer, deadline_flushes_without_further_writes)
+{
+    fake_sink_communication communication;
+    kommpot::buffered_writer writer(communication, {}, 1024, 500);
+
+    ASSERT_TRUE(writer.write("*TRG\n", 5));
+    ASSERT_TRUE(wait_for_writes(communication, 1));
+
+    const std::vector<std::string> expected = {"*TRG\n"};
+    EXPECT_EQ(communication.writes(), expected);
+}
+
+TEST(buffered_writer, destructor_flushes_remaining_bytes)
+{
+    fake_sink_communication communication;
+    {
+        kommpot::buffered_writer writer(communication, {}, 1024, 0);
+        ASSERT_TRUE(writer.write("*RST\n", 5));
+    }
+
+    const std::vector<std::string> expected = {"*RST\n"};
+    EXPECT_EQ(communication.writes(), expected);
+}
+
+TEST(buffered_writer, failed_background_flush_is_reported_once)
+{
+    fake_sink_communication communication;
+    communication.is_failing = true;
+
+    kommpot::buffered_writer writer(communication, {}, 1024, 100);
+    ASSERT_TRUE(writer.write("*CLS\n", 5));
+    ASSERT_TRUE(wait_for_writes(communication, 1));
+
+    communication.is_failing = false;
+    EXPECT_FALSE(writer.flush());
+    EXPECT_TRUE(writer.flush());
+}
+
+/*******************************************************************************
+ *
+ * buffered_writer — small message throughput on loopback.
+ *
+ *******************************************************************************/
+TEST(buffered_writer, small_message_throughput_on_loopback)
+{
+    static constexpr size_t MESSAGES = 20000;
+    static const std::string message = "SOUR:VOLT 1.25\n";
+
+    std::atomic<size_t> received_size_bytes = 0;
+
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start([&received_size_bytes](loopback_tcp_server::handle_type handle) {
+        char buffer[65536];
+        while (true)
+        {
+            const auto result = recv(handle, buffer, sizeof(buffer), 0);
+            if (result <= 0)
+            {
+                return;
+            }
+            received_size_bytes += static_cast<size_t>(result);
+        }
+    }));
+
+    kommpot::ethernet_device_identification identification;
+    identification.ip = "127.0.0.1";
+    identification.port = server.port();
+    identification.protocol = kommpot::ethernet_protocol_type::TCP;
+
+    communication_ethernet communication(identification);
+    ASSERT_TRUE(communication.open());
+
+    auto wait_for_received = [&received_size_bytes](const size_t size_bytes) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (received_size_bytes < size_bytes && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        return received_size_bytes == size_bytes;
+    };
+
+    auto data = message;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < MESSAGES; i++)
+    {
+        ASSERT_TRUE(communication.write({}, data.data(), data.size()));
+    }
+    ASSERT_TRUE(wait_for_received(MESSAGES * message.size()));
+    const auto direct = std::chrono::steady_clock::now() - start;
+
+    uint64_t device_write_count = 0;
+    start = std::chrono::steady_clock::now();
+    {
+        kommpot::buffered_writer writer(communication);
+        for (size_t i = 0; i < MESSAGES; i++)
+        {
+            ASSERT_TRUE(writer.write(message.data(), message.size()));
+        }
+        ASSERT_TRUE(writer.flush());
+        device_write_count = writer.device_write_count();
+    }
+    ASSERT_TRUE(wait_for_received(2 * MESSAGES * message.size()));
+    const auto coalesced = std::chrono::steady_clock::now() - start;
+
+    EXPECT_LE(device_write_count * 100, MESSAGES);
+
+    const auto to_msecs = [](const auto duration) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(duration).count() / 1000.0;
+    };
+    RecordProperty("direct_msecs", std::to_string(to_msecs(direct)));
+    RecordProperty("coalesced_msecs", std::to_string(to_msecs(coalesced)));
+    std::printf("[ WRITES   ] %zu messages: direct %.1f ms, coalesced %.1f ms (%llu writes)\n",
+        MESSAGES, to_msecs(direct), to_msecs(coalesced),
+        static_cast<unsigned long long>(device_write_count));
+
+    communication.close();
+}
+
+// NOLINTEND
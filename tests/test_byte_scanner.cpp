@@ -0,0 +1,108 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <protocols/byte_scanner.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * byte_scanner — find.
+ *
+ *******************************************************************************/
+TEST(byte_scanner, find_empty_returns_nullptr)
+{
+    const uint8_t data[1] = {'\n'};
+    EXPECT_EQ(byte_scanner::find(data, 0, '\n'), nullptr);
+}
+
+TEST(byte_scanner, find_matches_memchr_at_every_offset_and_length)
+{
+    std::vector<uint8_t> data(100, 'a');
+
+    for (size_t length = 0; length <= data.size(); length++)
+    {
+        for (size_t position = 0; position < data.size(); position++)
+        {
+            data[position] = '\n';
+
+            const auto *expected = length == 0 ? nullptr
+                                               : static_cast<const uint8_t *>(
+                                                     std::memchr(data.data(), '\n', length));
+            ASSERT_EQ(byte_scanner::find(data.data(), length, '\n'), expected)
+                << "length " << length << ", position " << position;
+
+            data[position] = 'a';
+        }
+    }
+}
+
+TEST(byte_scanner, find_returns_first_of_several_matches)
+{
+    const std::string data = "0123456789abcdef0123\n56789\nabcdef";
+    const auto *bytes = reinterpret_cast<const uint8_t *>(data.data());
+
+    EXPECT_EQ(byte_scanner::find(bytes, data.size(), '\n'), bytes + 20);
+}
+
+TEST(byte_scanner, find_random_data_matches_memchr)
+{
+    std::mt19937 generator(5025);
+    std::uniform_int_distribution<int> distribution(0, 255);
+
+    std::vector<uint8_t> data(4096);
+    for (auto &byte : data)
+    {
+        byte = static_cast<uint8_t>(distribution(generator));
+    }
+
+    for (int value = 0; value < 256; value++)
+    {
+        EXPECT_EQ(byte_scanner::find(data.data(), data.size(), static_cast<uint8_t>(value)),
+            std::memchr(data.data(), value, data.size()));
+    }
+}
+
+/*******************************************************************************
+ *
+ * byte_scanner — search.
+ *
+ *******************************************************************************/
+TEST(byte_scanner, search_finds_multi_byte_pattern)
+{
+    const std::string data = "line one\rline two\r\nrest";
+    const std::string pattern = "\r\n";
+    const auto *bytes = reinterpret_cast<const uint8_t *>(data.data());
+
+    EXPECT_EQ(byte_scanner::search(bytes, data.size(),
+                  reinterpret_cast<const uint8_t *>(pattern.data()), pattern.size()),
+        bytes + 17);
+}
+
+TEST(byte_scanner, search_ignores_partial_pattern_at_end)
+{
+    const std::string data = "abc\r";
+    const std::string pattern = "\r\n";
+
+    EXPECT_EQ(byte_scanner::search(reinterpret_cast<const uint8_t *>(data.data()), data.size(),
+                  reinterpret_cast<const uint8_t *>(pattern.data()), pattern.size()),
+        nullptr);
+}
+
+TEST(byte_scanner, search_empty_pattern_returns_nullptr)
+{
+    const std::string data = "abc";
+
+    EXPECT_EQ(byte_scanner::search(
+                  reinterpret_cast<const uint8_t *>(data.data()), data.size(), nullptr, 0),
+        nullptr);
+}
+
+// NOLINTEND
@@ -0,0 +1,249 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/communication_ethernet.h>
+#include <communications/ethernet/ethernet_connection_pool.h>
+
+#include "loopback_tcp_server.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * communication_ethernet — search ports.
+ *
+ *******************************************************************************/
+TEST(communication_ethernet, search_ports_default_is_empty)
+{
+    kommpot::ethernet_device_identification identification;
+
+    EXPECT_TRUE(communication_ethernet::search_ports(identification).empty());
+}
+
+TEST(communication_ethernet, search_ports_keeps_order_and_drops_duplicates)
+{
+    kommpot::ethernet_device_identification identification;
+    identification.port = 5025;
+    identification.ports = {502, 0, 5025, 4880, 502};
+
+    const auto ports = communication_ethernet::search_ports(identification);
+
+    EXPECT_EQ(ports, (std::vector<uint16_t>{5025, 502, 4880}));
+}
+
+TEST(communication_ethernet, search_ports_expands_range)
+{
+    kommpot::ethernet_device_identification identification;
+    identification.port = 8001;
+    identification.port_range = {8000, 8003};
+
+    const auto ports = communication_ethernet::search_ports(identification);
+
+    EXPECT_EQ(ports, (std::vector<uint16_t>{8001, 8000, 8002, 8003}));
+}
+
+TEST(communication_ethernet, search_ports_range_up_to_last_port)
+{
+    kommpot::ethernet_device_identification identification;
+    identification.port_range = {65534, 65535};
+
+    const auto ports = communication_ethernet::search_ports(identification);
+
+    EXPECT_EQ(ports, (std::vector<uint16_t>{65534, 65535}));
+}
+
+TEST(communication_ethernet, search_ports_inverted_range_is_empty)
+{
+    kommpot::ethernet_device_identification identification;
+    identification.port_range = {9000, 8000};
+
+    EXPECT_TRUE(communication_ethernet::search_ports(identification).empty());
+}
+
+/*******************************************************************************
+ *
+ * communication_ethernet — multiple ports per host.
+ *
+ *******************************************************************************/
+TEST(communication_ethernet, devices_reports_every_responding_port)
+{
+    loopback_tcp_server first;
+    loopback_tcp_server second;
+    loopback_tcp_server closed;
+    ASSERT_TRUE(first.start(loopback_tcp_server::echo));
+    ASSERT_TRUE(second.start(loopback_tcp_server::echo));
+    ASSERT_TRUE(closed.start(loopback_tcp_server::echo));
+
+    const auto closed_port = closed.port();
+    closed.stop();
+
+    kommpot::ethernet_device_identification identification;
+    identification.ip = "127.0.0.1";
+    identification.port = first.port();
+    identification.ports = {closed_port, second.port()};
+
+    const auto devices = communication_ethernet::devices({identification});
+    if (devices.empty())
+    {
+        GTEST_SKIP() << "no Ethernet interface available";
+    }
+
+    std::set<uint16_t> found_ports;
+    for (const auto &device : devices)
+    {
+        const auto device_id =
+            std::get<kommpot::ethernet_device_identification>(device->identification());
+        EXPECT_EQ(device_id.ip, "127.0.0.1");
+        found_ports.insert(device_id.port);
+    }
+
+    EXPECT_EQ(found_ports, (std::set<uint16_t>{first.port(), second.port()}));
+}
+
+/*******************************************************************************
+ *
+ * communication_ethernet — probe payload.
+ *
+ *******************************************************************************/
+static void identify(loopback_tcp_server::handle_type handle)
+{
+    char request[6] = {};
+    if (!loopback_tcp_server::receive_all(handle, request, sizeof(request)))
+    {
+        return;
+    }
+
+    const std::string response = "ACME,DMM-1,1234,1.0\n";
+    loopback_tcp_server::send_all(handle, response.data(), response.size());
+
+    /**
+     * @brief keeps the connection open until the client closes it.
+     */
+    loopback_tcp_server::receive_all(handle, request, 1);
+}
+
+static std::set<uint16_t> found_ports(const kommpot::ethernet_device_identification &search_id)
+{
+    std::set<uint16_t> ports;
+    for (const auto &device : communication_ethernet::devices({search_id}))
+    {
+        const auto device_id =
+            std::get<kommpot::ethernet_device_identification>(device->identification());
+        ports.insert(device_id.port);
+    }
+    return ports;
+}
+
+TEST(communication_ethernet, devices_reports_only_hosts_answering_probe)
+{
+    loopback_tcp_server matching;
+    loopback_tcp_server echoing;
+    ASSERT_TRUE(matching.start(identify));
+    ASSERT_TRUE(echoing.start(loopback_tcp_server::echo));
+
+    kommpot::ethernet_device_identification identification;
+    identification.ip = "127.0.0.1";
+    identification.port = matching.port();
+    identification.ports = {echoing.port()};
+    identification.probe.payload = "*IDN?\n";
+    identification.probe.response_prefix = "ACME,";
+
+    const auto ports = found_ports(identification);
+    if (ports.empty())
+    {
+        GTEST_SKIP() << "no Ethernet interface available";
+    }
+
+    EXPECT_EQ(ports, (std::set<uint16_t>{matching.port()}));
+}
+
+TEST(communication_ethernet, devices_drops_hosts_not_answering_probe_in_time)
+{
+    loopback_tcp_server silent;
+    ASSERT_TRUE(silent.start([](loopback_tcp_server::handle_type handle) {
+        char byte = 0;
+        while (loopback_tcp_server::receive_all(handle, &byte, 1))
+        {
+        }
+    }));
+
+    kommpot::ethernet_device_identification identification;
+    identification.ip = "127.0.0.1";
+    identification.port = silent.port();
+    identification.probe.payload = "*IDN?\n";
+    identification.probe.response_timeout_msecs = 50;
+
+    EXPECT_TRUE(found_ports(identification).empty());
+}
+
+/**
+ * @brief answers the probe in two segments and any other request with "DATA\n".
+ */
+static void identify_in_segments(loopback_tcp_server::handle_type handle)
+{
+    char request[6] = {};
+    if (!loopback_tcp_server::receive_all(handle, request, sizeof(request)))
+    {
+        return;
+    }
+
+    if (std::string(request, sizeof(request)) != "*IDN?\n")
+    {
+        loopback_tcp_server::send_all(handle, "DATA\n", 5);
+        return;
+    }
+
+    loopback_tcp_server::send_all(handle, "ACME,", 5);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    loopback_tcp_server::send_all(handle, "DMM-1\n", 6);
+
+    loopback_tcp_server::receive_all(handle, request, 1);
+}
+
+TEST(communication_ethernet, probe_response_rest_is_not_read_after_open)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(identify_in_segments));
+
+    kommpot::ethernet_device_identification identification;
+    identification.ip = "127.0.0.1";
+    identification.port = server.port();
+    identification.probe.payload = "*IDN?\n";
+    identification.probe.response_prefix = "ACME,";
+    identification.scan.is_connection_reuse_enabled = true;
+
+    const auto devices = communication_ethernet::devices({identification});
+    if (devices.empty())
+    {
+        GTEST_SKIP() << "no Ethernet interface available";
+    }
+    ASSERT_EQ(devices.size(), 1u);
+
+    auto &device = *devices.front();
+    ASSERT_TRUE(device.open());
+
+    std::string request = "READ?\n";
+    ASSERT_TRUE(device.write({}, request.data(), request.size()));
+
+    std::string response(5, '\0');
+    ASSERT_TRUE(device.read({}, response.data(), response.size()));
+    EXPECT_EQ(response, "DATA\n");
+
+    device.close();
+    ethernet_connection_pool::instance().clear();
+}
+
+// NOLINTEND
@@ -0,0 +1,147 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <protocols/crc.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+static const std::string CHECK_INPUT = "123456789";
+
+static std::vector<uint8_t> make_random(const size_t size_bytes, const uint32_t seed)
+{
+    std::mt19937 generator(seed);
+    std::vector<uint8_t> data(size_bytes);
+    for (auto &value : data)
+    {
+        value = static_cast<uint8_t>(generator());
+    }
+    return data;
+}
+
+static uint16_t crc16_bitwise(const uint8_t *data, const size_t size_bytes)
+{
+    uint16_t value = 0xFFFF;
+    for (size_t i = 0; i < size_bytes; i++)
+    {
+        value ^= static_cast<uint16_t>(data[i] << 8);
+        for (int bit = 0; bit < 8; bit++)
+        {
+            value = static_cast<uint16_t>((value & 0x8000) ? (value << 1) ^ 0x1021 : value << 1);
+        }
+    }
+    return value;
+}
+
+/*******************************************************************************
+ *
+ * crc — check values.
+ *
+ *******************************************************************************/
+TEST(crc, crc16_check_value)
+{
+    EXPECT_EQ(kommpot::crc16(CHECK_INPUT.data(), CHECK_INPUT.size()), 0x29B1);
+    EXPECT_EQ(kommpot::crc16(nullptr, 0), 0xFFFF);
+}
+
+TEST(crc, crc32c_check_value)
+{
+    EXPECT_EQ(kommpot::crc32c(CHECK_INPUT.data(), CHECK_INPUT.size()), 0xE3069283u);
+    EXPECT_EQ(crc::crc32c_software(reinterpret_cast<const uint8_t *>(CHECK_INPUT.data()),
+                  CHECK_INPUT.size()),
+        0xE3069283u);
+    EXPECT_EQ(kommpot::crc32c(nullptr, 0), 0u);
+}
+
+TEST(crc, crc16_matches_bitwise_reference)
+{
+    const auto data = make_random(4096, 1);
+    for (size_t offset = 0; offset < 16; offset++)
+    {
+        for (const size_t size_bytes : {0, 1, 7, 8, 9, 63, 64, 1000, 4000})
+        {
+            EXPECT_EQ(crc::crc16(data.data() + offset, size_bytes),
+                crc16_bitwise(data.data() + offset, size_bytes))
+                << offset << " " << size_bytes;
+        }
+    }
+}
+
+TEST(crc, crc32c_hardware_matches_software)
+{
+    const auto data = make_random(4096, 2);
+    for (size_t offset = 0; offset < 16; offset++)
+    {
+        for (size_t size_bytes = 0; size_bytes < 80; size_bytes++)
+        {
+            EXPECT_EQ(crc::crc32c(data.data() + offset, size_bytes),
+                crc::crc32c_software(data.data() + offset, size_bytes))
+                << offset << " " << size_bytes;
+        }
+    }
+}
+
+TEST(crc, incremental_equals_one_shot)
+{
+    const auto data = make_random(1000, 3);
+
+    const auto crc16 = kommpot::crc16(data.data() + 333, 667, kommpot::crc16(data.data(), 333));
+    EXPECT_EQ(crc16, kommpot::crc16(data.data(), data.size()));
+
+    const auto crc32c =
+        kommpot::crc32c(data.data() + 333, 667, kommpot::crc32c(data.data(), 333));
+    EXPECT_EQ(crc32c, kommpot::crc32c(data.data(), data.size()));
+}
+
+/*******************************************************************************
+ *
+ * crc — throughput.
+ *
+ *******************************************************************************/
+TEST(crc, throughput)
+{
+    static constexpr size_t ROUNDS = 64;
+
+    const auto data = make_random(1024 * 1024, 4);
+
+    const auto measure = [&data](const auto &function) {
+        uint32_t sink = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < ROUNDS; i++)
+        {
+            sink ^= function(data.data(), data.size());
+        }
+        const auto usecs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start)
+                               .count();
+        EXPECT_NE(sink, 0xFFFFFFFFu);
+        return ROUNDS * static_cast<double>(data.size()) / std::max<int64_t>(usecs, 1);
+    };
+
+    const auto crc16 = measure([](const uint8_t *d, size_t s) { return crc::crc16(d, s); });
+    const auto software =
+        measure([](const uint8_t *d, size_t s) { return crc::crc32c_software(d, s); });
+    const auto crc32c = measure([](const uint8_t *d, size_t s) { return crc::crc32c(d, s); });
+
+    RecordProperty("crc16_mb_per_second", std::to_string(crc16));
+    RecordProperty("crc32c_software_mb_per_second", std::to_string(software));
+    RecordProperty("crc32c_mb_per_second", std::to_string(crc32c));
+    std::printf("[ CRC      ] crc16 %.0f MB/s, crc32c table %.0f MB/s, crc32c %s %.0f MB/s\n",
+        crc16, software, crc::is_crc32c_accelerated() ? "instruction" : "table", crc32c);
+}
+
+// NOLINTEND
@@ -602,6 +602,155 @@ TEST(factory_calculate_base_address, ipv6_address_with_ipv4_mask_returns_false)
     EXPECT_FALSE(ethernet_address_factory::calculate_base_address(ip, mask).has_value());
 }
 
+/*******************************************************************************
+ *
+ * calculate_broadcast_address.
+ *
+ *******************************************************************************/
+TEST(factory_calculate_broadcast_address, ipv4_class_c_mask)
+{
+    auto ip = make_shared_ipv4("192.168.1.100");
+    auto mask = make_shared_ipv4_from_uint32(0xFFFFFF00u);
+
+    auto broadcast = ethernet_address_factory::calculate_broadcast_address(ip, mask);
+    ASSERT_TRUE(broadcast.has_value());
+    EXPECT_EQ((*broadcast)->to_string(), "192.168.1.255");
+}
+
+TEST(factory_calculate_broadcast_address, ipv4_slash_20_mask)
+{
+    auto ip = make_shared_ipv4("10.1.17.5");
+    auto mask = make_shared_ipv4_from_uint32(0xFFFFF000u);
+
+    auto broadcast = ethernet_address_factory::calculate_broadcast_address(ip, mask);
+    ASSERT_TRUE(broadcast.has_value());
+    EXPECT_EQ((*broadcast)->to_string(), "10.1.31.255");
+}
+
+TEST(factory_calculate_broadcast_address, ipv4_loopback_network)
+{
+    auto ip = make_shared_ipv4("127.0.0.1");
+    auto mask = make_shared_ipv4_from_uint32(0xFF000000u);
+
+    auto broadcast = ethernet_address_factory::calculate_broadcast_address(ip, mask);
+    ASSERT_TRUE(broadcast.has_value());
+    EXPECT_EQ((*broadcast)->to_string(), "127.255.255.255");
+}
+
+TEST(factory_calculate_broadcast_address, ipv4_host_mask_returns_same)
+{
+    auto ip = make_shared_ipv4("192.168.1.42");
+    auto mask = make_shared_ipv4_from_uint32(0xFFFFFFFFu);
+
+    auto broadcast = ethernet_address_factory::calculate_broadcast_address(ip, mask);
+    ASSERT_TRUE(broadcast.has_value());
+    EXPECT_EQ((*broadcast)->to_string(), "192.168.1.42");
+}
+
+TEST(factory_calculate_broadcast_address, ipv6_returns_false)
+{
+    auto ip = make_shared_ipv6("2001:db8::1");
+    auto mask = make_shared_ipv6("ffff:ffff:ffff:ffff::");
+
+    EXPECT_FALSE(ethernet_address_factory::calculate_broadcast_address(ip, mask).has_value());
+}
+
+TEST(factory_calculate_broadcast_address, ipv4_address_with_ipv6_mask_returns_false)
+{
+    auto ip = make_shared_ipv4("192.168.1.1");
+    auto mask = make_shared_ipv6("ffff:ffff:ffff:ffff::");
+
+    EXPECT_FALSE(ethernet_address_factory::calculate_broadcast_address(ip, mask).has_value());
+}
+
+TEST(factory_calculate_broadcast_address, nullptr_returns_false)
+{
+    auto ip = make_shared_ipv4("192.168.1.1");
+
+    EXPECT_FALSE(ethernet_address_factory::calculate_broadcast_address(nullptr, ip).has_value());
+    EXPECT_FALSE(ethernet_address_factory::calculate_broadcast_address(ip, nullptr).has_value());
+}
+
+/*******************************************************************************
+ *
+ * calculate_host_index.
+ *
+ *******************************************************************************/
+TEST(factory_calculate_host_index, ipv4_offset_within_network)
+{
+    auto base = make_shared_ipv4("192.168.1.0");
+    auto ip = make_shared_ipv4("192.168.1.42");
+
+    auto index = ethernet_address_factory::calculate_host_index(base, ip);
+    ASSERT_TRUE(index.has_value());
+    EXPECT_EQ(*index, 42u);
+}
+
+TEST(factory_calculate_host_index, ipv4_offset_across_octets)
+{
+    auto base = make_shared_ipv4("10.0.0.0");
+    auto ip = make_shared_ipv4("10.0.1.2");
+
+    auto index = ethernet_address_factory::calculate_host_index(base, ip);
+    ASSERT_TRUE(index.has_value());
+    EXPECT_EQ(*index, 258u);
+}
+
+TEST(factory_calculate_host_index, ipv4_round_trip_with_calculate_new_address)
+{
+    auto base = make_shared_ipv4("172.16.0.0");
+
+    auto ip = ethernet_address_factory::calculate_new_address(base, 4097);
+    ASSERT_TRUE(ip.has_value());
+
+    auto index = ethernet_address_factory::calculate_host_index(base, *ip);
+    ASSERT_TRUE(index.has_value());
+    EXPECT_EQ(*index, 4097u);
+}
+
+TEST(factory_calculate_host_index, ipv4_below_base_returns_false)
+{
+    auto base = make_shared_ipv4("192.168.1.0");
+    auto ip = make_shared_ipv4("192.168.0.255");
+
+    EXPECT_FALSE(ethernet_address_factory::calculate_host_index(base, ip).has_value());
+}
+
+TEST(factory_calculate_host_index, ipv6_offset_within_network)
+{
+    auto base = make_shared_ipv6("fe80::");
+    auto ip = make_shared_ipv6("fe80::1:2");
+
+    auto index = ethernet_address_factory::calculate_host_index(base, ip);
+    ASSERT_TRUE(index.has_value());
+    EXPECT_EQ(*index, 0x10002u);
+}
+
+TEST(factory_calculate_host_index, ipv6_different_prefix_returns_false)
+{
+    auto base = make_shared_ipv6("fe80::");
+    auto ip = make_shared_ipv6("2001:db8::1");
+
+    EXPECT_FALSE(ethernet_address_factory::calculate_host_index(base, ip).has_value());
+}
+
+TEST(factory_calculate_host_index, mixed_families_return_false)
+{
+    auto base = make_shared_ipv4("192.168.1.0");
+    auto ip = make_shared_ipv6("fe80::1");
+
+    EXPECT_FALSE(ethernet_address_factory::calculate_host_index(base, ip).has_value());
+    EXPECT_FALSE(ethernet_address_factory::calculate_host_index(ip, base).has_value());
+}
+
+TEST(factory_calculate_host_index, nullptr_returns_false)
+{
+    auto base = make_shared_ipv4("192.168.1.0");
+
+    EXPECT_FALSE(ethernet_address_factory::calculate_host_index(nullptr, base).has_value());
+    EXPECT_FALSE(ethernet_address_factory::calculate_host_index(base, nullptr).has_value());
+}
+
 /*******************************************************************************
  *
  * calculate_new_address — IPv4.
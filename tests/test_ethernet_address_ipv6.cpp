@@ -1430,6 +1430,56 @@ TEST(ethernet_ipv6_address, invalid_ipv6_with_numeric_scope_id)
     EXPECT_FALSE(ethernet_address_factory::from_string("fe80::1%1").has_value());
 }
 
+TEST(ethernet_ipv6_address, scope_id_is_taken_from_sockaddr)
+{
+    sockaddr_in6 sa6 = {};
+    sa6.sin6_family = AF_INET6;
+    sa6.sin6_scope_id = 7;
+    inet_pton(AF_INET6, "fe80::1", &sa6.sin6_addr);
+
+    auto addr =
+        ethernet_address_factory::from_sockaddr_in(reinterpret_cast<const sockaddr *>(&sa6));
+    ASSERT_TRUE(addr.has_value());
+
+    auto *ipv6 = dynamic_cast<ethernet_ipv6_address *>((*addr).get());
+    ASSERT_NE(ipv6, nullptr);
+    EXPECT_EQ(ipv6->scope_id(), 7u);
+    EXPECT_TRUE(ipv6->is_link_local());
+    EXPECT_EQ(ipv6->to_string(), "fe80:0:0:0:0:0:0:1");
+}
+
+TEST(ethernet_ipv6_address, with_scope_id_copies_address)
+{
+    auto addr = ethernet_address_factory::from_string("fe80::1");
+    ASSERT_TRUE(addr.has_value());
+
+    auto scoped = ethernet_address_factory::with_scope_id(*addr, 3);
+    ASSERT_TRUE(scoped.has_value());
+
+    auto *ipv6 = dynamic_cast<ethernet_ipv6_address *>((*addr).get());
+    auto *scoped_ipv6 = dynamic_cast<ethernet_ipv6_address *>((*scoped).get());
+    ASSERT_NE(scoped_ipv6, nullptr);
+    EXPECT_EQ(ipv6->scope_id(), 0u);
+    EXPECT_EQ(scoped_ipv6->scope_id(), 3u);
+    EXPECT_TRUE(*ipv6 == *scoped_ipv6);
+}
+
+TEST(ethernet_ipv6_address, with_scope_id_rejects_ipv4)
+{
+    auto addr = ethernet_address_factory::from_string("192.168.1.1");
+    ASSERT_TRUE(addr.has_value());
+
+    EXPECT_FALSE(ethernet_address_factory::with_scope_id(*addr, 3).has_value());
+}
+
+TEST(ethernet_ipv6_address, global_address_is_not_link_local)
+{
+    auto addr = ethernet_address_factory::from_string("2001:db8::1");
+    ASSERT_TRUE(addr.has_value());
+
+    EXPECT_FALSE(dynamic_cast<ethernet_ipv6_address *>((*addr).get())->is_link_local());
+}
+
 /*******************************************************************************
  *
  * Edge case: very long input strings.
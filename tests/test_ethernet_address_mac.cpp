@@ -811,4 +811,37 @@ TEST(ethernet_mac_address, construct_from_array_with_length_5)
     EXPECT_FALSE(result.has_value());
 }
 
+/*******************************************************************************
+ *
+ * Construction from string.
+ *
+ *******************************************************************************/
+TEST(ethernet_mac_address, construct_from_string_round_trips)
+{
+    auto result = ethernet_address_factory::mac_from_string("12:34:56:78:9A:bc");
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->to_string(), "12:34:56:78:9A:BC");
+    EXPECT_EQ(*result, make_mac(0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC));
+}
+
+TEST(ethernet_mac_address, construct_from_string_with_dashes)
+{
+    auto result = ethernet_address_factory::mac_from_string("02-00-00-00-00-01");
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->data()[0], 0x02);
+    EXPECT_EQ(result->data()[5], 0x01);
+}
+
+TEST(ethernet_mac_address, construct_from_string_rejects_malformed)
+{
+    EXPECT_FALSE(ethernet_address_factory::mac_from_string("").has_value());
+    EXPECT_FALSE(ethernet_address_factory::mac_from_string("*").has_value());
+    EXPECT_FALSE(ethernet_address_factory::mac_from_string("12:34:56:78:9A").has_value());
+    EXPECT_FALSE(ethernet_address_factory::mac_from_string("12:34:56:78:9A:BG").has_value());
+    EXPECT_FALSE(ethernet_address_factory::mac_from_string("12.34.56.78.9A.BC").has_value());
+    EXPECT_FALSE(ethernet_address_factory::mac_from_string("+1:34:56:78:9A:BC").has_value());
+}
+
 // NOLINTEND
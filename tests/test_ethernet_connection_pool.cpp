@@ -0,0 +1,160 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/communication_ethernet.h>
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_connection_pool.h>
+#include <communications/ethernet/ethernet_socket.h>
+
+#include "loopback_tcp_server.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+static std::unique_ptr<ethernet_socket> make_connection(const uint16_t port)
+{
+    auto address = ethernet_address_factory::from_string("127.0.0.1");
+    EXPECT_TRUE(address.has_value());
+
+    auto socket = std::make_unique<ethernet_socket>();
+    EXPECT_TRUE(socket->initialize(*address, port, kommpot::ethernet_protocol_type::TCP));
+    EXPECT_TRUE(socket->set_timeout(1000));
+    EXPECT_TRUE(socket->connect());
+
+    return socket;
+}
+
+/*******************************************************************************
+ *
+ * ethernet_connection_pool — insert / take.
+ *
+ *******************************************************************************/
+TEST(ethernet_connection_pool, take_returns_parked_connection)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    auto &pool = ethernet_connection_pool::instance();
+    pool.clear();
+
+    pool.insert("127.0.0.1", server.port(), kommpot::ethernet_protocol_type::TCP,
+        make_connection(server.port()));
+    EXPECT_EQ(pool.size(), 1u);
+
+    auto socket = pool.take("127.0.0.1", server.port(), kommpot::ethernet_protocol_type::TCP);
+    ASSERT_NE(socket, nullptr);
+    EXPECT_TRUE(socket->is_connected());
+    EXPECT_EQ(pool.size(), 0u);
+
+    EXPECT_TRUE(socket->disconnect());
+}
+
+TEST(ethernet_connection_pool, take_unknown_endpoint_returns_nullptr)
+{
+    auto &pool = ethernet_connection_pool::instance();
+    pool.clear();
+
+    EXPECT_EQ(pool.take("127.0.0.1", 1, kommpot::ethernet_protocol_type::TCP), nullptr);
+}
+
+TEST(ethernet_connection_pool, take_drops_connection_closed_by_peer)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start([](loopback_tcp_server::handle_type) {}));
+
+    auto &pool = ethernet_connection_pool::instance();
+    pool.clear();
+
+    pool.insert("127.0.0.1", server.port(), kommpot::ethernet_protocol_type::TCP,
+        make_connection(server.port()));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_EQ(pool.take("127.0.0.1", server.port(), kommpot::ethernet_protocol_type::TCP), nullptr);
+}
+
+TEST(ethernet_connection_pool, insert_ignores_unconnected_socket)
+{
+    auto &pool = ethernet_connection_pool::instance();
+    pool.clear();
+
+    pool.insert("127.0.0.1", 1, kommpot::ethernet_protocol_type::TCP,
+        std::make_unique<ethernet_socket>());
+    EXPECT_EQ(pool.size(), 0u);
+}
+
+/*******************************************************************************
+ *
+ * communication_ethernet — open() adopts parked connection.
+ *
+ *******************************************************************************/
+TEST(communication_ethernet, open_adopts_parked_connection)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    auto &pool = ethernet_connection_pool::instance();
+    pool.clear();
+
+    pool.insert("127.0.0.1", server.port(), kommpot::ethernet_protocol_type::TCP,
+        make_connection(server.port()));
+
+    kommpot::ethernet_device_identification identification;
+    identification.ip = "127.0.0.1";
+    identification.port = server.port();
+    identification.protocol = kommpot::ethernet_protocol_type::TCP;
+
+    communication_ethernet device(identification);
+    ASSERT_TRUE(device.open());
+
+    std::string request = "MEAS?\n";
+    ASSERT_TRUE(
+        device.write(kommpot::bulk_transfer_configuration{}, request.data(), request.size()));
+
+    std::string response(request.size(), '\0');
+    ASSERT_TRUE(
+        device.read(kommpot::bulk_transfer_configuration{}, response.data(), response.size()));
+    EXPECT_EQ(response, request);
+
+    /**
+     * @attention the echo reply proves the connection works, only one was ever accepted.
+     */
+    EXPECT_TRUE(server.wait_for_accepted(1));
+    EXPECT_EQ(server.accepted_count(), 1u);
+
+    device.close();
+}
+
+TEST(communication_ethernet, open_connects_without_parked_connection)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    ethernet_connection_pool::instance().clear();
+
+    kommpot::ethernet_device_identification identification;
+    identification.ip = "127.0.0.1";
+    identification.port = server.port();
+    identification.protocol = kommpot::ethernet_protocol_type::TCP;
+
+    communication_ethernet device(identification);
+    ASSERT_TRUE(device.open());
+    EXPECT_TRUE(device.is_open());
+
+    device.close();
+}
+
+// NOLINTEND
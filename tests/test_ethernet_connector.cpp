@@ -0,0 +1,218 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_connector.h>
+#include <communications/ethernet/ethernet_socket.h>
+
+#include "loopback_tcp_server.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+static std::shared_ptr<ethernet_ip_address> make_address(const std::string &value)
+{
+    auto addr = ethernet_address_factory::from_string(value);
+
+    EXPECT_TRUE(addr.has_value());
+
+    if (!addr.has_value())
+    {
+        return nullptr;
+    }
+
+    return *addr;
+}
+
+static std::vector<std::string> to_strings(
+    const std::vector<std::shared_ptr<ethernet_ip_address>> &addresses)
+{
+    std::vector<std::string> values;
+    for (const auto &address : addresses)
+    {
+        values.push_back(address->to_string());
+    }
+    return values;
+}
+
+/*******************************************************************************
+ *
+ * ethernet_connector — candidate order.
+ *
+ *******************************************************************************/
+TEST(ethernet_connector, interleave_alternates_families)
+{
+    const auto interleaved = ethernet_connector::interleave({make_address("2001:db8::1"),
+        make_address("2001:db8::2"), make_address("2001:db8::3"), make_address("192.0.2.1"),
+        make_address("192.0.2.2")});
+
+    const std::vector<std::string> expected = {"2001:db8:0:0:0:0:0:1", "192.0.2.1",
+        "2001:db8:0:0:0:0:0:2", "192.0.2.2", "2001:db8:0:0:0:0:0:3"};
+    EXPECT_EQ(to_strings(interleaved), expected);
+}
+
+TEST(ethernet_connector, interleave_starts_with_family_of_first_address)
+{
+    const auto interleaved = ethernet_connector::interleave(
+        {make_address("192.0.2.1"), make_address("192.0.2.2"), make_address("2001:db8::1")});
+
+    const std::vector<std::string> expected = {"192.0.2.1", "2001:db8:0:0:0:0:0:1", "192.0.2.2"};
+    EXPECT_EQ(to_strings(interleaved), expected);
+}
+
+TEST(ethernet_connector, interleave_empty_is_empty)
+{
+    EXPECT_TRUE(ethernet_connector::interleave({}).empty());
+}
+
+TEST(ethernet_connector, resolve_numeric_address)
+{
+    const auto addresses = ethernet_connector::resolve("127.0.0.1");
+
+    ASSERT_EQ(addresses.size(), 1u);
+    EXPECT_EQ(addresses.front()->to_string(), "127.0.0.1");
+}
+
+TEST(ethernet_connector, resolve_invalid_host_is_empty)
+{
+    EXPECT_TRUE(ethernet_connector::resolve("invalid host name").empty());
+}
+
+/*******************************************************************************
+ *
+ * ethernet_connector — racing connects.
+ *
+ *******************************************************************************/
+TEST(ethernet_connector, refused_candidate_hands_over_immediately)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    const auto start = std::chrono::steady_clock::now();
+
+    ethernet_socket socket;
+    ASSERT_TRUE(ethernet_connector::connect(
+        {make_address("::1"), make_address("127.0.0.1")}, server.port(), 2000, 1000, socket));
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_LT(elapsed, std::chrono::milliseconds(500));
+
+    EXPECT_TRUE(socket.is_connected());
+    EXPECT_EQ(socket.to_string().rfind("127.0.0.1:", 0), 0u);
+
+    std::string request = "*IDN?\n";
+    ASSERT_TRUE(socket.write(request.data(), request.size()));
+
+    std::string response(request.size(), '\0');
+    ASSERT_TRUE(socket.read(response.data(), response.size()));
+    EXPECT_EQ(response, request);
+}
+
+TEST(ethernet_connector, all_candidates_refused_fails)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(nullptr));
+    const auto port = server.port();
+    server.stop();
+
+    ethernet_socket socket;
+    EXPECT_FALSE(ethernet_connector::connect(
+        {make_address("::1"), make_address("127.0.0.1")}, port, 1000, 50, socket));
+    EXPECT_FALSE(socket.is_connected());
+}
+
+TEST(ethernet_connector, zero_timeout_is_rejected)
+{
+    ethernet_socket socket;
+    EXPECT_FALSE(ethernet_connector::connect({make_address("127.0.0.1")}, 1, 0, 50, socket));
+}
+
+#ifdef __linux__
+TEST(ethernet_connector, stalled_candidate_is_overtaken_after_attempt_delay)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    /**
+     * @attention a listener with a full accept queue drops further SYNs, a connect to it stalls
+     * just like one to an unreachable host.
+     */
+    auto stalled = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    ASSERT_GE(stalled, 0);
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(server.port());
+    inet_pton(AF_INET, "127.0.0.2", &address.sin_addr);
+    ASSERT_EQ(bind(stalled, (const sockaddr *)&address, sizeof(address)), 0);
+    ASSERT_EQ(listen(stalled, 0), 0);
+
+    std::vector<loopback_tcp_server::handle_type> fillers;
+    for (int i = 0; i < 2; i++)
+    {
+        auto filler = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, IPPROTO_TCP);
+        ::connect(filler, (const sockaddr *)&address, sizeof(address));
+        fillers.push_back(filler);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    const auto start = std::chrono::steady_clock::now();
+
+    ethernet_socket socket;
+    EXPECT_TRUE(ethernet_connector::connect(
+        {make_address("127.0.0.2"), make_address("127.0.0.1")}, server.port(), 2000, 100,
+        socket));
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_GE(elapsed, std::chrono::milliseconds(90));
+    EXPECT_LT(elapsed, std::chrono::milliseconds(1000));
+    EXPECT_EQ(socket.to_string().rfind("127.0.0.1:", 0), 0u);
+
+    for (auto &filler : fillers)
+    {
+        loopback_tcp_server::close_handle(filler);
+    }
+    loopback_tcp_server::close_handle(stalled);
+}
+
+/*******************************************************************************
+ *
+ * ethernet_socket — TCP Fast Open.
+ *
+ *******************************************************************************/
+TEST(ethernet_connector, fast_open_connect_transfers_data)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    ethernet_socket socket;
+    ASSERT_TRUE(socket.initialize(
+        make_address("127.0.0.1"), server.port(), kommpot::ethernet_protocol_type::TCP));
+    ASSERT_TRUE(socket.set_timeout(1000));
+    EXPECT_TRUE(socket.set_fast_open(true));
+    ASSERT_TRUE(socket.connect());
+
+    std::string request = "*IDN?\n";
+    ASSERT_TRUE(socket.write(request.data(), request.size()));
+
+    std::string response(request.size(), '\0');
+    ASSERT_TRUE(socket.read(response.data(), response.size()));
+    EXPECT_EQ(response, request);
+}
+#endif
+
+// NOLINTEND
@@ -0,0 +1,637 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/communication_ethernet.h>
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_socket.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#    include <arpa/inet.h>
+#    include <netinet/in.h>
+#    include <netinet/udp.h>
+#    include <sys/socket.h>
+#    include <unistd.h>
+#endif
+
+using namespace testing;
+
+#ifndef _WIN32
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+static std::shared_ptr<ethernet_ip_address> make_address(const std::string &value)
+{
+    auto addr = ethernet_address_factory::from_string(value);
+
+    EXPECT_TRUE(addr.has_value());
+
+    if (!addr.has_value())
+    {
+        return nullptr;
+    }
+
+    return *addr;
+}
+
+/**
+ * @brief datagram of size_bytes whose bytes all carry the index, so reordering or glued
+ * datagrams are detected.
+ */
+static std::vector<uint8_t> make_datagram(const size_t index, const size_t size_bytes)
+{
+    return std::vector<uint8_t>(size_bytes, static_cast<uint8_t>(index));
+}
+
+static auto local_port(const int handle) -> uint16_t
+{
+    sockaddr_in address = {};
+    socklen_t address_size_bytes = sizeof(address);
+    if (getsockname(handle, (sockaddr *)&address, &address_size_bytes) != 0)
+    {
+        return 0;
+    }
+    return ntohs(address.sin_port);
+}
+
+static auto native_handle(const ethernet_socket &socket) -> int
+{
+    return static_cast<int>(*static_cast<uint64_t *>(socket.native_handle()));
+}
+
+/**
+ * @brief plain UDP socket bound to 127.0.0.1 on an ephemeral port, the other end of the tests.
+ */
+class udp_peer
+{
+public:
+    udp_peer()
+    {
+        m_handle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(m_handle, (const sockaddr *)&address, sizeof(address));
+
+        const int size_bytes = 8 * 1024 * 1024;
+        setsockopt(m_handle, SOL_SOCKET, SO_RCVBUF, &size_bytes, sizeof(size_bytes));
+
+        timeval timeout = {};
+        timeout.tv_sec = 2;
+        setsockopt(m_handle, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    }
+
+    ~udp_peer()
+    {
+        close(m_handle);
+    }
+
+    udp_peer(const udp_peer &obj) = delete;
+    auto operator=(const udp_peer &obj) -> udp_peer & = delete;
+
+    auto port() const -> uint16_t
+    {
+        return local_port(m_handle);
+    }
+
+    auto connect_to(const uint16_t port) -> bool
+    {
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = htons(port);
+        return connect(m_handle, (const sockaddr *)&address, sizeof(address)) == 0;
+    }
+
+    auto send_datagram(const std::vector<uint8_t> &data) -> bool
+    {
+        return send(m_handle, data.data(), data.size(), 0) == static_cast<ssize_t>(data.size());
+    }
+
+    /**
+     * @brief sends data as one UDP_SEGMENT buffer the OS splits into segment_size_bytes datagrams.
+     */
+    auto send_segmented(const std::vector<uint8_t> &data, const uint16_t segment_size_bytes)
+        -> bool
+    {
+#    ifdef UDP_SEGMENT
+        char control[CMSG_SPACE(sizeof(uint16_t))] = {};
+        iovec vector = {const_cast<uint8_t *>(data.data()), data.size()};
+
+        msghdr header = {};
+        header.msg_iov = &vector;
+        header.msg_iovlen = 1;
+        header.msg_control = control;
+        header.msg_controllen = sizeof(control);
+
+        auto *segment = CMSG_FIRSTHDR(&header);
+        segment->cmsg_level = IPPROTO_UDP;
+        segment->cmsg_type = UDP_SEGMENT;
+        segment->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+        std::memcpy(CMSG_DATA(segment), &segment_size_bytes, sizeof(segment_size_bytes));
+
+        return sendmsg(m_handle, &header, 0) == static_cast<ssize_t>(data.size());
+#    else
+        return false;
+#    endif
+    }
+
+    auto receive_datagram(std::vector<uint8_t> &data) -> bool
+    {
+        data.resize(64 * 1024);
+        const auto result = recv(m_handle, data.data(), data.size(), 0);
+        if (result < 0)
+        {
+            return false;
+        }
+        data.resize(static_cast<size_t>(result));
+        return true;
+    }
+
+private:
+    int m_handle = -1;
+};
+
+/**
+ * @brief connects the socket to the peer and the peer back to the socket's local port.
+ */
+static void connect_pair(ethernet_socket &socket, udp_peer &peer)
+{
+    ASSERT_TRUE(socket.initialize(
+        make_address("127.0.0.1"), peer.port(), kommpot::ethernet_protocol_type::UDP));
+    ASSERT_TRUE(socket.set_timeout(2000));
+    ASSERT_TRUE(socket.connect());
+    ASSERT_TRUE(peer.connect_to(local_port(native_handle(socket))));
+}
+
+/**
+ * @brief capacity_bytes sized receive buffers with messages pointing at them.
+ */
+struct message_batch
+{
+    std::vector<std::vector<uint8_t>> buffers;
+    std::vector<kommpot::message_buffer> messages;
+
+    message_batch(const size_t count, const size_t capacity_bytes)
+        : buffers(count, std::vector<uint8_t>(capacity_bytes)),
+          messages(count)
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            messages[index].data = buffers[index].data();
+            messages[index].size_bytes = capacity_bytes;
+        }
+    }
+};
+
+/*******************************************************************************
+ *
+ * ethernet_socket — datagram boundaries.
+ *
+ *******************************************************************************/
+TEST(ethernet_datagram, read_receives_one_datagram)
+{
+    udp_peer peer;
+    ethernet_socket socket;
+    connect_pair(socket, peer);
+
+    ASSERT_TRUE(peer.send_datagram(make_datagram(1, 3)));
+    ASSERT_TRUE(peer.send_datagram(make_datagram(2, 5)));
+    ASSERT_TRUE(peer.send_datagram(make_datagram(3, 4)));
+
+    std::vector<uint8_t> buffer(8);
+    ASSERT_TRUE(socket.read(buffer.data(), 3));
+    EXPECT_EQ(std::vector<uint8_t>(buffer.begin(), buffer.begin() + 3), make_datagram(1, 3));
+
+    ASSERT_TRUE(socket.read(buffer.data(), 5));
+    EXPECT_EQ(std::vector<uint8_t>(buffer.begin(), buffer.begin() + 5), make_datagram(2, 5));
+
+    /**
+     * @attention a datagram shorter than the buffer is not glued to the next one.
+     */
+    EXPECT_FALSE(socket.read(buffer.data(), 8));
+}
+
+TEST(ethernet_datagram, read_messages_receives_batch)
+{
+    constexpr size_t M_DATAGRAM_COUNT = 100;
+
+    udp_peer peer;
+    ethernet_socket socket;
+    connect_pair(socket, peer);
+
+    for (size_t index = 0; index < M_DATAGRAM_COUNT; ++index)
+    {
+        ASSERT_TRUE(peer.send_datagram(make_datagram(index, 10 + index)));
+    }
+
+    message_batch batch(64, 2048);
+    size_t received_total = 0;
+    while (received_total < M_DATAGRAM_COUNT)
+    {
+        size_t received_count = 0;
+        ASSERT_TRUE(socket.read_messages(batch.messages, received_count, 2000));
+        ASSERT_LE(received_count, batch.messages.size());
+
+        for (size_t index = 0; index < received_count; ++index)
+        {
+            const auto &message = batch.messages[index];
+            const auto expected_index = received_total + index;
+            EXPECT_FALSE(message.is_truncated);
+            ASSERT_EQ(message.received_size_bytes, 10 + expected_index);
+            EXPECT_EQ(std::vector<uint8_t>(batch.buffers[index].begin(),
+                          batch.buffers[index].begin() + message.received_size_bytes),
+                make_datagram(expected_index, 10 + expected_index));
+        }
+        received_total += received_count;
+    }
+
+    EXPECT_EQ(received_total, M_DATAGRAM_COUNT);
+}
+
+TEST(ethernet_datagram, read_messages_reports_truncation)
+{
+    udp_peer peer;
+    ethernet_socket socket;
+    connect_pair(socket, peer);
+
+    ASSERT_TRUE(peer.send_datagram(make_datagram(7, 100)));
+
+    message_batch batch(4, 10);
+    size_t received_count = 0;
+    ASSERT_TRUE(socket.read_messages(batch.messages, received_count, 2000));
+
+    ASSERT_EQ(received_count, 1u);
+    EXPECT_TRUE(batch.messages[0].is_truncated);
+    EXPECT_EQ(batch.messages[0].received_size_bytes, 10u);
+}
+
+TEST(ethernet_datagram, read_messages_times_out)
+{
+    udp_peer peer;
+    ethernet_socket socket;
+    connect_pair(socket, peer);
+
+    message_batch batch(4, 64);
+    size_t received_count = 0;
+    EXPECT_FALSE(socket.read_messages(batch.messages, received_count, 50));
+    EXPECT_EQ(received_count, 0u);
+}
+
+TEST(ethernet_datagram, write_messages_keeps_boundaries)
+{
+    constexpr size_t M_DATAGRAM_COUNT = 150;
+
+    udp_peer peer;
+    ethernet_socket socket;
+    connect_pair(socket, peer);
+
+    std::vector<std::vector<uint8_t>> datagrams;
+    std::vector<kommpot::message_buffer> messages;
+    for (size_t index = 0; index < M_DATAGRAM_COUNT; ++index)
+    {
+        datagrams.push_back(make_datagram(index, 1 + index % 37));
+    }
+    for (auto &datagram : datagrams)
+    {
+        messages.push_back({datagram.data(), datagram.size()});
+    }
+
+    ASSERT_TRUE(socket.write_messages(messages));
+
+    std::vector<uint8_t> received;
+    for (size_t index = 0; index < M_DATAGRAM_COUNT; ++index)
+    {
+        ASSERT_TRUE(peer.receive_datagram(received));
+        EXPECT_EQ(received, datagrams[index]);
+    }
+}
+
+/*******************************************************************************
+ *
+ * ethernet_socket — UDP segmentation and receive offload.
+ *
+ *******************************************************************************/
+TEST(ethernet_datagram, segmentation_sends_equal_runs)
+{
+    udp_peer peer;
+    ethernet_socket socket;
+    connect_pair(socket, peer);
+    if (!socket.set_udp_segmentation(true))
+    {
+        GTEST_SKIP() << "UDP segmentation is not supported";
+    }
+
+    /**
+     * @attention runs break at the shorter datagrams and after M_MAX_SEGMENTS datagrams.
+     */
+    std::vector<std::vector<uint8_t>> datagrams;
+    for (size_t index = 0; index < 100; ++index)
+    {
+        datagrams.push_back(make_datagram(index, 1000));
+    }
+    datagrams.push_back(make_datagram(100, 300));
+    datagrams.push_back(make_datagram(101, 1200));
+    datagrams.push_back(make_datagram(102, 1200));
+
+    std::vector<kommpot::message_buffer> messages;
+    for (auto &datagram : datagrams)
+    {
+        messages.push_back({datagram.data(), datagram.size()});
+    }
+
+    ASSERT_TRUE(socket.write_messages(messages));
+
+    std::vector<uint8_t> received;
+    for (const auto &datagram : datagrams)
+    {
+        ASSERT_TRUE(peer.receive_datagram(received));
+        EXPECT_EQ(received, datagram);
+    }
+}
+
+TEST(ethernet_datagram, gro_splits_coalesced_receives)
+{
+    constexpr size_t M_SEGMENT_SIZE_BYTES = 1000;
+    constexpr size_t M_DATAGRAM_COUNT = 40;
+
+    udp_peer peer;
+    ethernet_socket socket;
+    connect_pair(socket, peer);
+    if (!socket.set_udp_gro(true))
+    {
+        GTEST_SKIP() << "UDP receive offload is not supported";
+    }
+
+    std::vector<uint8_t> data;
+    for (size_t index = 0; index < M_DATAGRAM_COUNT; ++index)
+    {
+        const auto datagram = make_datagram(index, M_SEGMENT_SIZE_BYTES);
+        data.insert(data.end(), datagram.begin(), datagram.end());
+    }
+    data.resize(data.size() - 200);
+
+    if (!peer.send_segmented(data, M_SEGMENT_SIZE_BYTES))
+    {
+        GTEST_SKIP() << "UDP segmentation is not supported";
+    }
+
+    message_batch batch(16, 2048);
+    size_t received_total = 0;
+    while (received_total < M_DATAGRAM_COUNT)
+    {
+        size_t received_count = 0;
+        ASSERT_TRUE(socket.read_messages(batch.messages, received_count, 2000));
+
+        for (size_t index = 0; index < received_count; ++index)
+        {
+            const auto expected_index = received_total + index;
+            const auto expected_size_bytes = (expected_index == M_DATAGRAM_COUNT - 1)
+                                                 ? M_SEGMENT_SIZE_BYTES - 200
+                                                 : M_SEGMENT_SIZE_BYTES;
+            ASSERT_EQ(batch.messages[index].received_size_bytes, expected_size_bytes);
+            EXPECT_EQ(batch.buffers[index][0], static_cast<uint8_t>(expected_index));
+            EXPECT_EQ(batch.buffers[index][expected_size_bytes - 1],
+                static_cast<uint8_t>(expected_index));
+        }
+        received_total += received_count;
+    }
+
+    EXPECT_EQ(received_total, M_DATAGRAM_COUNT);
+}
+
+/*******************************************************************************
+ *
+ * communication_ethernet — datagram batches.
+ *
+ *******************************************************************************/
+TEST(ethernet_datagram, device_exchanges_messages)
+{
+    constexpr size_t M_DATAGRAM_COUNT = 20;
+
+    udp_peer peer;
+
+    kommpot::ethernet_device_identification identification;
+    identification.ip = "127.0.0.1";
+    identification.port = peer.port();
+    identification.protocol = kommpot::ethernet_protocol_type::UDP;
+
+    kommpot::communication_configuration configuration;
+    configuration.is_udp_offload_enabled = true;
+
+    communication_ethernet device(identification);
+    device.set_configuration(configuration);
+    ASSERT_TRUE(device.open());
+    ASSERT_TRUE(peer.connect_to(
+        local_port(static_cast<int>(*static_cast<uint64_t *>(device.native_handle())))));
+
+    std::vector<std::vector<uint8_t>> datagrams;
+    std::vector<kommpot::message_buffer> messages;
+    for (size_t index = 0; index < M_DATAGRAM_COUNT; ++index)
+    {
+        datagrams.push_back(make_datagram(index, 512));
+    }
+    for (auto &datagram : datagrams)
+    {
+        messages.push_back({datagram.data(), datagram.size()});
+    }
+
+    ASSERT_TRUE(device.write_messages({}, messages));
+
+    /**
+     * @brief the peer echoes every datagram back.
+     */
+    std::vector<uint8_t> received;
+    for (size_t index = 0; index < M_DATAGRAM_COUNT; ++index)
+    {
+        ASSERT_TRUE(peer.receive_datagram(received));
+        EXPECT_EQ(received, datagrams[index]);
+        ASSERT_TRUE(peer.send_datagram(received));
+    }
+
+    message_batch batch(M_DATAGRAM_COUNT, 1024);
+    size_t received_total = 0;
+    while (received_total < M_DATAGRAM_COUNT)
+    {
+        std::vector<kommpot::message_buffer> remaining(
+            batch.messages.begin() + received_total, batch.messages.end());
+        size_t received_count = 0;
+        ASSERT_TRUE(device.read_messages({}, remaining, received_count));
+        for (size_t index = 0; index < received_count; ++index)
+        {
+            EXPECT_EQ(remaining[index].received_size_bytes, 512u);
+        }
+        received_total += received_count;
+    }
+
+    for (size_t index = 0; index < M_DATAGRAM_COUNT; ++index)
+    {
+        EXPECT_EQ(std::vector<uint8_t>(batch.buffers[index].begin(),
+                      batch.buffers[index].begin() + 512),
+            datagrams[index]);
+    }
+
+    device.close();
+}
+
+/*******************************************************************************
+ *
+ * ethernet_datagram — packet rates of single, batched and offloaded datagram I/O on loopback.
+ *
+ *******************************************************************************/
+TEST(ethernet_datagram, benchmark_writes)
+{
+    constexpr size_t M_DATAGRAM_SIZE_BYTES = 1200;
+    constexpr size_t M_BATCH_COUNT = 64;
+    constexpr size_t M_TOTAL_COUNT = 200 * 1024;
+
+    message_batch batch(M_BATCH_COUNT, M_DATAGRAM_SIZE_BYTES);
+
+    for (const char *name : {"SINGLE", "BATCHED", "GSO"})
+    {
+        const std::string mode = name;
+
+        udp_peer peer;
+        ethernet_socket socket;
+        connect_pair(socket, peer);
+        if (mode == "GSO" && !socket.set_udp_segmentation(true))
+        {
+            GTEST_SKIP() << "UDP segmentation is not supported";
+        }
+
+        /**
+         * @attention the peer does not read, datagrams overflowing its buffer are dropped by the
+         * OS without slowing down the sender.
+         */
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t sent_count = 0; sent_count < M_TOTAL_COUNT; sent_count += M_BATCH_COUNT)
+        {
+            if (mode == "SINGLE")
+            {
+                for (auto &message : batch.messages)
+                {
+                    ASSERT_TRUE(socket.write(message.data, message.size_bytes));
+                }
+            }
+            else
+            {
+                ASSERT_TRUE(socket.write_messages(batch.messages));
+            }
+        }
+
+        const auto elapsed_usecs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start)
+                                       .count();
+        const auto packets_per_second =
+            static_cast<double>(M_TOTAL_COUNT) * 1e6 / static_cast<double>(elapsed_usecs);
+
+        printf("[ %-8s ] %.0f datagrams/s sent\n", name, packets_per_second);
+        RecordProperty(mode + "_write_datagrams_per_second", static_cast<int>(packets_per_second));
+    }
+}
+
+TEST(ethernet_datagram, benchmark_reads)
+{
+    constexpr size_t M_DATAGRAM_SIZE_BYTES = 1200;
+    constexpr size_t M_BATCH_COUNT = 64;
+    constexpr size_t M_TOTAL_COUNT = 200 * 1024;
+
+    for (const char *name : {"SINGLE", "BATCHED", "GRO"})
+    {
+        const std::string mode = name;
+
+        udp_peer peer;
+        ethernet_socket socket;
+        connect_pair(socket, peer);
+        if (mode == "GRO" && !socket.set_udp_gro(true))
+        {
+            GTEST_SKIP() << "UDP receive offload is not supported";
+        }
+
+        const int buffer_size_bytes = 32 * 1024 * 1024;
+        setsockopt(native_handle(socket), SOL_SOCKET, SO_RCVBUF, &buffer_size_bytes,
+            sizeof(buffer_size_bytes));
+
+        /**
+         * @attention the sender segments 32 datagrams per send, so the peer is faster than any
+         * receiver and datagrams the receiver falls behind on are dropped and not counted.
+         */
+        std::atomic_bool is_sent = false;
+        std::thread sender([&peer, &is_sent]() {
+            std::vector<uint8_t> data(32 * M_DATAGRAM_SIZE_BYTES, 0x5A);
+            for (size_t sent_count = 0; sent_count < M_TOTAL_COUNT; sent_count += 32)
+            {
+                if (!peer.send_segmented(data, M_DATAGRAM_SIZE_BYTES))
+                {
+                    for (size_t index = 0; index < 32; ++index)
+                    {
+                        peer.send_datagram(std::vector<uint8_t>(M_DATAGRAM_SIZE_BYTES, 0x5A));
+                    }
+                }
+            }
+            is_sent = true;
+        });
+
+        message_batch batch(M_BATCH_COUNT, M_DATAGRAM_SIZE_BYTES);
+        size_t received_total = 0;
+        const auto start = std::chrono::steady_clock::now();
+        auto last_receive = start;
+
+        while (received_total < M_TOTAL_COUNT)
+        {
+            size_t received_count = 0;
+            const uint32_t timeout_msecs = is_sent ? 100 : 1000;
+            if (mode == "SINGLE")
+            {
+                size_t received_size_bytes = 0;
+                if (!socket.read_some(batch.messages[0].data, M_DATAGRAM_SIZE_BYTES,
+                        received_size_bytes, timeout_msecs))
+                {
+                    break;
+                }
+                received_count = 1;
+            }
+            else if (!socket.read_messages(batch.messages, received_count, timeout_msecs))
+            {
+                break;
+            }
+
+            received_total += received_count;
+            last_receive = std::chrono::steady_clock::now();
+        }
+
+        sender.join();
+
+        const auto elapsed_usecs =
+            std::chrono::duration_cast<std::chrono::microseconds>(last_receive - start).count();
+        const auto packets_per_second = static_cast<double>(received_total) * 1e6 /
+                                        static_cast<double>(std::max<int64_t>(elapsed_usecs, 1));
+
+        EXPECT_GT(received_total, 0u);
+
+        printf("[ %-8s ] %.0f datagrams/s received, %zu of %zu datagrams\n", name,
+            packets_per_second, received_total, M_TOTAL_COUNT);
+        RecordProperty(mode + "_read_datagrams_per_second", static_cast<int>(packets_per_second));
+    }
+}
+
+#endif
+
+// NOLINTEND
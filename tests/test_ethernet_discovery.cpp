@@ -0,0 +1,286 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_discovery.h>
+#include <communications/ethernet/ethernet_discovery_protocol.h>
+#include <kommpot_responder.h>
+
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+static std::shared_ptr<ethernet_ip_address> make_address(const std::string &value)
+{
+    auto addr = ethernet_address_factory::from_string(value);
+
+    EXPECT_TRUE(addr.has_value());
+
+    if (!addr.has_value())
+    {
+        return nullptr;
+    }
+
+    return *addr;
+}
+
+static kommpot::discovery_responder_configuration make_responder_configuration()
+{
+    kommpot::discovery_responder_configuration configuration;
+    configuration.name = "simulated-instrument";
+    configuration.mac = "02:00:00:00:00:01";
+    configuration.protocol = kommpot::ethernet_protocol_type::TCP;
+    configuration.port = 5025;
+
+    /**
+     * @attention ephemeral port keeps parallel test runs from colliding.
+     */
+    configuration.discovery_port = 0;
+
+    return configuration;
+}
+
+/*******************************************************************************
+ *
+ * ethernet_discovery_protocol — encode / decode.
+ *
+ *******************************************************************************/
+TEST(ethernet_discovery_protocol, probe_round_trip)
+{
+    ethernet_discovery_message probe;
+    probe.type = ethernet_discovery_message_type::PROBE;
+    probe.transaction_id = 0xBEEF;
+
+    const auto bytes = ethernet_discovery_protocol::encode(probe);
+    EXPECT_EQ(bytes.size(), ethernet_discovery_protocol::HEADER_SIZE_BYTES);
+
+    const auto decoded = ethernet_discovery_protocol::decode(bytes.data(), bytes.size());
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->type, ethernet_discovery_message_type::PROBE);
+    EXPECT_EQ(decoded->transaction_id, 0xBEEF);
+}
+
+TEST(ethernet_discovery_protocol, reply_round_trip)
+{
+    ethernet_discovery_message reply;
+    reply.type = ethernet_discovery_message_type::REPLY;
+    reply.transaction_id = 0x1234;
+    reply.name = "device";
+    reply.mac = "AA:BB:CC:DD:EE:FF";
+    reply.port = 502;
+    reply.protocol = static_cast<uint8_t>(kommpot::ethernet_protocol_type::TCP);
+
+    const auto bytes = ethernet_discovery_protocol::encode(reply);
+    const auto decoded = ethernet_discovery_protocol::decode(bytes.data(), bytes.size());
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->type, ethernet_discovery_message_type::REPLY);
+    EXPECT_EQ(decoded->transaction_id, 0x1234);
+    EXPECT_EQ(decoded->name, "device");
+    EXPECT_EQ(decoded->mac, "AA:BB:CC:DD:EE:FF");
+    EXPECT_EQ(decoded->port, 502);
+    EXPECT_EQ(decoded->protocol, static_cast<uint8_t>(kommpot::ethernet_protocol_type::TCP));
+}
+
+TEST(ethernet_discovery_protocol, long_name_is_truncated)
+{
+    ethernet_discovery_message reply;
+    reply.type = ethernet_discovery_message_type::REPLY;
+    reply.name = std::string(400, 'x');
+
+    const auto bytes = ethernet_discovery_protocol::encode(reply);
+    const auto decoded = ethernet_discovery_protocol::decode(bytes.data(), bytes.size());
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->name.size(), 255u);
+}
+
+TEST(ethernet_discovery_protocol, unknown_tag_is_skipped)
+{
+    ethernet_discovery_message reply;
+    reply.type = ethernet_discovery_message_type::REPLY;
+    reply.port = 80;
+
+    auto bytes = ethernet_discovery_protocol::encode(reply);
+    bytes.insert(bytes.end(), {0xF0, 0x02, 0x01, 0x02});
+
+    const auto decoded = ethernet_discovery_protocol::decode(bytes.data(), bytes.size());
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->port, 80);
+}
+
+TEST(ethernet_discovery_protocol, decode_rejects_nullptr)
+{
+    EXPECT_FALSE(ethernet_discovery_protocol::decode(nullptr, 16).has_value());
+}
+
+TEST(ethernet_discovery_protocol, decode_rejects_short_header)
+{
+    const uint8_t bytes[] = {'K', 'M', 'P', 'D', 1, 1, 0};
+    EXPECT_FALSE(ethernet_discovery_protocol::decode(bytes, sizeof(bytes)).has_value());
+}
+
+TEST(ethernet_discovery_protocol, decode_rejects_wrong_magic)
+{
+    const uint8_t bytes[] = {'K', 'M', 'P', 'X', 1, 1, 0, 0};
+    EXPECT_FALSE(ethernet_discovery_protocol::decode(bytes, sizeof(bytes)).has_value());
+}
+
+TEST(ethernet_discovery_protocol, decode_rejects_wrong_version)
+{
+    const uint8_t bytes[] = {'K', 'M', 'P', 'D', 9, 1, 0, 0};
+    EXPECT_FALSE(ethernet_discovery_protocol::decode(bytes, sizeof(bytes)).has_value());
+}
+
+TEST(ethernet_discovery_protocol, decode_rejects_unknown_type)
+{
+    const uint8_t bytes[] = {'K', 'M', 'P', 'D', 1, 7, 0, 0};
+    EXPECT_FALSE(ethernet_discovery_protocol::decode(bytes, sizeof(bytes)).has_value());
+}
+
+TEST(ethernet_discovery_protocol, decode_rejects_truncated_field)
+{
+    const uint8_t bytes[] = {'K', 'M', 'P', 'D', 1, 2, 0, 0, 1, 10, 'a', 'b'};
+    EXPECT_FALSE(ethernet_discovery_protocol::decode(bytes, sizeof(bytes)).has_value());
+}
+
+TEST(ethernet_discovery_protocol, decode_rejects_invalid_port_length)
+{
+    const uint8_t bytes[] = {'K', 'M', 'P', 'D', 1, 2, 0, 0, 3, 1, 80};
+    EXPECT_FALSE(ethernet_discovery_protocol::decode(bytes, sizeof(bytes)).has_value());
+}
+
+/*******************************************************************************
+ *
+ * discovery_responder — datagram handling without sockets.
+ *
+ *******************************************************************************/
+TEST(discovery_responder, handle_datagram_answers_probe)
+{
+    kommpot::discovery_responder responder(make_responder_configuration());
+
+    ethernet_discovery_message probe;
+    probe.type = ethernet_discovery_message_type::PROBE;
+    probe.transaction_id = 42;
+    const auto probe_bytes = ethernet_discovery_protocol::encode(probe);
+
+    std::vector<uint8_t> reply_bytes;
+    ASSERT_TRUE(responder.handle_datagram(probe_bytes.data(), probe_bytes.size(), reply_bytes));
+
+    const auto reply = ethernet_discovery_protocol::decode(reply_bytes.data(), reply_bytes.size());
+    ASSERT_TRUE(reply.has_value());
+    EXPECT_EQ(reply->type, ethernet_discovery_message_type::REPLY);
+    EXPECT_EQ(reply->transaction_id, 42);
+    EXPECT_EQ(reply->name, "simulated-instrument");
+    EXPECT_EQ(reply->port, 5025);
+}
+
+TEST(discovery_responder, handle_datagram_ignores_reply)
+{
+    kommpot::discovery_responder responder(make_responder_configuration());
+
+    ethernet_discovery_message reply;
+    reply.type = ethernet_discovery_message_type::REPLY;
+    const auto reply_bytes = ethernet_discovery_protocol::encode(reply);
+
+    std::vector<uint8_t> output;
+    EXPECT_FALSE(responder.handle_datagram(reply_bytes.data(), reply_bytes.size(), output));
+}
+
+TEST(discovery_responder, port_is_zero_when_not_running)
+{
+    kommpot::discovery_responder responder(make_responder_configuration());
+    EXPECT_FALSE(responder.is_running());
+    EXPECT_EQ(responder.port(), 0);
+}
+
+/*******************************************************************************
+ *
+ * ethernet_discovery — end to end on loopback.
+ *
+ *******************************************************************************/
+TEST(ethernet_discovery, query_unicast_loopback_finds_responder)
+{
+    kommpot::discovery_responder responder(make_responder_configuration());
+    ASSERT_TRUE(responder.start());
+    ASSERT_NE(responder.port(), 0);
+
+    const auto replies = ethernet_discovery::query(make_address("127.0.0.1"), responder.port(), 300);
+    ASSERT_EQ(replies.size(), 1u);
+    EXPECT_EQ(replies[0].ip, "127.0.0.1");
+    EXPECT_EQ(replies[0].name, "simulated-instrument");
+    EXPECT_EQ(replies[0].mac, "02:00:00:00:00:01");
+    EXPECT_EQ(replies[0].port, 5025);
+    EXPECT_EQ(replies[0].protocol, kommpot::ethernet_protocol_type::TCP);
+    EXPECT_EQ(replies[0].discovery, kommpot::ethernet_discovery_type::UDP_BROADCAST);
+
+    responder.stop();
+}
+
+TEST(ethernet_discovery, query_broadcast_loopback_finds_responder)
+{
+    kommpot::discovery_responder responder(make_responder_configuration());
+    ASSERT_TRUE(responder.start());
+
+    auto base = make_address("127.0.0.1");
+    auto mask = ethernet_address_factory::from_uint32_t(0xFF000000u);
+    ASSERT_TRUE(mask.has_value());
+    auto broadcast = ethernet_address_factory::calculate_broadcast_address(base, *mask);
+    ASSERT_TRUE(broadcast.has_value());
+
+    const auto replies = ethernet_discovery::query(*broadcast, responder.port(), 300);
+    ASSERT_EQ(replies.size(), 1u);
+    EXPECT_EQ(replies[0].name, "simulated-instrument");
+    EXPECT_EQ(replies[0].port, 5025);
+}
+
+TEST(ethernet_discovery, query_without_responder_returns_empty)
+{
+    kommpot::discovery_responder responder(make_responder_configuration());
+    ASSERT_TRUE(responder.start());
+    const auto unused_port = responder.port();
+    responder.stop();
+
+    const auto replies = ethernet_discovery::query(make_address("127.0.0.1"), unused_port, 100);
+    EXPECT_TRUE(replies.empty());
+}
+
+TEST(ethernet_discovery, query_broadcast_collects_multiple_responders)
+{
+    kommpot::discovery_responder first(make_responder_configuration());
+    ASSERT_TRUE(first.start());
+
+    /**
+     * @attention SO_REUSEADDR lets the second responder share the port, broadcasts are delivered
+     * to every socket bound to it.
+     */
+    auto second_configuration = make_responder_configuration();
+    second_configuration.name = "second-instrument";
+    second_configuration.port = 502;
+    second_configuration.discovery_port = first.port();
+    kommpot::discovery_responder second(second_configuration);
+    ASSERT_TRUE(second.start());
+
+    const auto replies = ethernet_discovery::query(make_address("127.255.255.255"), first.port(), 300);
+    ASSERT_EQ(replies.size(), 2u);
+
+    std::vector<std::string> names = {replies[0].name, replies[1].name};
+    EXPECT_THAT(names, UnorderedElementsAre("simulated-instrument", "second-instrument"));
+}
+
+TEST(ethernet_discovery, query_rejects_nullptr_destination)
+{
+    EXPECT_TRUE(ethernet_discovery::query(nullptr, 1234, 10).empty());
+}
+
+// NOLINTEND
@@ -0,0 +1,69 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <communications/ethernet/ethernet_hostname_resolver.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * ethernet_hostname_resolver — resolve / cached.
+ *
+ *******************************************************************************/
+TEST(ethernet_hostname_resolver, resolve_loopback)
+{
+    auto &resolver = ethernet_hostname_resolver::instance();
+    resolver.clear();
+
+    const auto hostname = resolver.resolve("127.0.0.1", 5000);
+    ASSERT_TRUE(hostname.has_value());
+    EXPECT_FALSE(hostname->empty());
+}
+
+TEST(ethernet_hostname_resolver, cached_does_not_start_lookup)
+{
+    auto &resolver = ethernet_hostname_resolver::instance();
+    resolver.clear();
+
+    EXPECT_FALSE(resolver.cached("127.0.0.1").has_value());
+}
+
+TEST(ethernet_hostname_resolver, cached_returns_resolved_hostname)
+{
+    auto &resolver = ethernet_hostname_resolver::instance();
+    resolver.clear();
+
+    const auto hostname = resolver.resolve("127.0.0.1", 5000);
+    ASSERT_TRUE(hostname.has_value());
+
+    const auto cached = resolver.cached("127.0.0.1");
+    ASSERT_TRUE(cached.has_value());
+    EXPECT_EQ(*cached, *hostname);
+}
+
+TEST(ethernet_hostname_resolver, resolve_rejects_invalid_address)
+{
+    auto &resolver = ethernet_hostname_resolver::instance();
+
+    EXPECT_FALSE(resolver.resolve("not-an-address", 1000).has_value());
+}
+
+TEST(ethernet_hostname_resolver, cache_is_bounded)
+{
+    auto &resolver = ethernet_hostname_resolver::instance();
+    resolver.clear();
+
+    for (size_t i = 0; i < ethernet_hostname_resolver::M_MAX_ENTRIES + 16; i++)
+    {
+        static_cast<void>(resolver.resolve("invalid-" + std::to_string(i), 1000));
+    }
+
+    EXPECT_EQ(resolver.size(), ethernet_hostname_resolver::M_MAX_ENTRIES);
+    resolver.clear();
+}
+
+// NOLINTEND
@@ -0,0 +1,387 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/communication_ethernet.h>
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_multicast_hub.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#    include <arpa/inet.h>
+#    include <netinet/in.h>
+#    include <sys/socket.h>
+#    include <unistd.h>
+#endif
+
+using namespace testing;
+
+#ifndef _WIN32
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+static std::shared_ptr<ethernet_ip_address> make_address(const std::string &value)
+{
+    auto addr = ethernet_address_factory::from_string(value);
+
+    EXPECT_TRUE(addr.has_value());
+
+    if (!addr.has_value())
+    {
+        return nullptr;
+    }
+
+    return *addr;
+}
+
+static std::vector<uint8_t> make_datagram(const size_t index, const size_t size_bytes)
+{
+    return std::vector<uint8_t>(size_bytes, static_cast<uint8_t>(index));
+}
+
+/**
+ * @brief UDP port no socket of the machine is bound to right now.
+ */
+static auto free_port() -> uint16_t
+{
+    const int handle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    bind(handle, (const sockaddr *)&address, sizeof(address));
+
+    socklen_t address_size_bytes = sizeof(address);
+    getsockname(handle, (sockaddr *)&address, &address_size_bytes);
+    close(handle);
+
+    return ntohs(address.sin_port);
+}
+
+/**
+ * @brief plain UDP socket sending to a multicast group with loopback enabled, so members on this
+ * machine receive its datagrams.
+ */
+class multicast_sender
+{
+public:
+    multicast_sender(const std::string &group, const uint16_t port)
+    {
+        sockaddr_storage address = {};
+        socklen_t address_size_bytes = 0;
+
+        auto *address_v4 = reinterpret_cast<sockaddr_in *>(&address);
+        auto *address_v6 = reinterpret_cast<sockaddr_in6 *>(&address);
+        const int loop = 1;
+
+        if (inet_pton(AF_INET, group.c_str(), &address_v4->sin_addr) == 1)
+        {
+            address_v4->sin_family = AF_INET;
+            address_v4->sin_port = htons(port);
+            address_size_bytes = sizeof(sockaddr_in);
+
+            m_handle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+            setsockopt(m_handle, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop));
+        }
+        else if (inet_pton(AF_INET6, group.c_str(), &address_v6->sin6_addr) == 1)
+        {
+            address_v6->sin6_family = AF_INET6;
+            address_v6->sin6_port = htons(port);
+            address_size_bytes = sizeof(sockaddr_in6);
+
+            m_handle = socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
+            setsockopt(m_handle, IPPROTO_IPV6, IPV6_MULTICAST_LOOP, &loop, sizeof(loop));
+        }
+
+        m_is_connected =
+            m_handle >= 0 && connect(m_handle, (const sockaddr *)&address, address_size_bytes) == 0;
+    }
+
+    ~multicast_sender()
+    {
+        if (m_handle >= 0)
+        {
+            close(m_handle);
+        }
+    }
+
+    multicast_sender(const multicast_sender &obj) = delete;
+    auto operator=(const multicast_sender &obj) -> multicast_sender & = delete;
+
+    /**
+     * @brief states whether the machine has a route to the group at all.
+     */
+    auto is_connected() const -> bool
+    {
+        return m_is_connected;
+    }
+
+    /**
+     * @brief address the datagrams are sent from, the source of a source-specific subscription.
+     */
+    auto source() const -> std::string
+    {
+        sockaddr_storage address = {};
+        socklen_t address_size_bytes = sizeof(address);
+        getsockname(m_handle, (sockaddr *)&address, &address_size_bytes);
+
+        char text[INET6_ADDRSTRLEN] = {};
+        if (address.ss_family == AF_INET)
+        {
+            inet_ntop(AF_INET, &reinterpret_cast<sockaddr_in *>(&address)->sin_addr, text,
+                sizeof(text));
+        }
+        else
+        {
+            inet_ntop(AF_INET6, &reinterpret_cast<sockaddr_in6 *>(&address)->sin6_addr, text,
+                sizeof(text));
+        }
+        return text;
+    }
+
+    auto send_datagram(const std::vector<uint8_t> &data) -> bool
+    {
+        return send(m_handle, data.data(), data.size(), 0) == static_cast<ssize_t>(data.size());
+    }
+
+private:
+    int m_handle = -1;
+    bool m_is_connected = false;
+};
+
+static auto make_identification(const std::string &group, const uint16_t port,
+    const std::string &source = "") -> kommpot::ethernet_device_identification
+{
+    kommpot::ethernet_device_identification identification;
+    identification.port = port;
+    identification.protocol = kommpot::ethernet_protocol_type::UDP;
+    identification.multicast_group = group;
+    identification.multicast_source = source;
+    return identification;
+}
+
+/**
+ * @brief sends count datagrams of size_bytes to the group and reads them back from the device.
+ */
+static void expect_group_received(const std::string &group, const std::string &source = "")
+{
+    constexpr size_t M_DATAGRAM_COUNT = 16;
+
+    const auto port = free_port();
+    multicast_sender sender(group, port);
+    if (!sender.is_connected())
+    {
+        GTEST_SKIP() << "No route to multicast group " << group << ".";
+    }
+
+    communication_ethernet device(make_identification(
+        group, port, source == "sender" ? sender.source() : source));
+    ASSERT_TRUE(device.open());
+
+    for (size_t index = 0; index < M_DATAGRAM_COUNT; ++index)
+    {
+        ASSERT_TRUE(sender.send_datagram(make_datagram(index, 256)));
+    }
+
+    for (size_t index = 0; index < M_DATAGRAM_COUNT; ++index)
+    {
+        std::vector<uint8_t> received(256);
+        ASSERT_TRUE(device.read({}, received.data(), received.size()));
+        EXPECT_EQ(received, make_datagram(index, 256));
+    }
+
+    device.close();
+    EXPECT_FALSE(device.is_open());
+}
+
+/*******************************************************************************
+ *
+ * communication_ethernet — multicast receive.
+ *
+ *******************************************************************************/
+TEST(ethernet_multicast, receives_ipv4_group)
+{
+    expect_group_received("239.255.42.1");
+}
+
+TEST(ethernet_multicast, receives_ipv6_group)
+{
+    expect_group_received("ff15::4242");
+}
+
+TEST(ethernet_multicast, receives_ipv4_source_specific)
+{
+    expect_group_received("232.1.42.1", "sender");
+}
+
+TEST(ethernet_multicast, receives_ipv6_source_specific)
+{
+    expect_group_received("ff35::4242", "sender");
+}
+
+TEST(ethernet_multicast, ignores_other_source)
+{
+    const auto port = free_port();
+    multicast_sender sender("232.1.42.2", port);
+    if (!sender.is_connected())
+    {
+        GTEST_SKIP() << "No route to multicast group.";
+    }
+
+    communication_ethernet device(make_identification("232.1.42.2", port, "198.51.100.7"));
+    ASSERT_TRUE(device.open());
+
+    ASSERT_TRUE(sender.send_datagram(make_datagram(1, 64)));
+
+    std::vector<uint8_t> received(64);
+    size_t received_size_bytes = 0;
+    EXPECT_FALSE(device.read_some({}, received.data(), received.size(), received_size_bytes));
+    EXPECT_EQ(received_size_bytes, 0u);
+}
+
+TEST(ethernet_multicast, devices_share_one_socket)
+{
+    constexpr size_t M_DATAGRAM_COUNT = 32;
+
+    const auto port = free_port();
+    multicast_sender sender("239.255.42.3", port);
+    if (!sender.is_connected())
+    {
+        GTEST_SKIP() << "No route to multicast group.";
+    }
+
+    const auto channels_before = ethernet_multicast_hub::instance().channel_count();
+
+    communication_ethernet first(make_identification("239.255.42.3", port));
+    communication_ethernet second(make_identification("239.255.42.3", port));
+    ASSERT_TRUE(first.open());
+    ASSERT_TRUE(second.open());
+    EXPECT_EQ(ethernet_multicast_hub::instance().channel_count(), channels_before + 1);
+
+    for (size_t index = 0; index < M_DATAGRAM_COUNT; ++index)
+    {
+        ASSERT_TRUE(sender.send_datagram(make_datagram(index, 128)));
+    }
+
+    for (auto *device : {&first, &second})
+    {
+        std::vector<std::vector<uint8_t>> buffers(M_DATAGRAM_COUNT, std::vector<uint8_t>(256));
+        std::vector<kommpot::message_buffer> messages;
+        for (auto &buffer : buffers)
+        {
+            messages.push_back({buffer.data(), buffer.size()});
+        }
+
+        size_t received_total = 0;
+        while (received_total < M_DATAGRAM_COUNT)
+        {
+            std::vector<kommpot::message_buffer> remaining(
+                messages.begin() + received_total, messages.end());
+            size_t received_count = 0;
+            ASSERT_TRUE(device->read_messages({}, remaining, received_count));
+            for (size_t index = 0; index < received_count; ++index)
+            {
+                EXPECT_EQ(remaining[index].received_size_bytes, 128u);
+                EXPECT_FALSE(remaining[index].is_truncated);
+                EXPECT_EQ(buffers[received_total + index][0],
+                    static_cast<uint8_t>(received_total + index));
+            }
+            received_total += received_count;
+        }
+    }
+
+    first.close();
+    EXPECT_EQ(ethernet_multicast_hub::instance().channel_count(), channels_before + 1);
+    second.close();
+    EXPECT_EQ(ethernet_multicast_hub::instance().channel_count(), channels_before);
+}
+
+TEST(ethernet_multicast, read_view_shares_datagram)
+{
+    const auto port = free_port();
+    multicast_sender sender("239.255.42.4", port);
+    if (!sender.is_connected())
+    {
+        GTEST_SKIP() << "No route to multicast group.";
+    }
+
+    communication_ethernet device(make_identification("239.255.42.4", port));
+    ASSERT_TRUE(device.open());
+
+    const auto datagram = make_datagram(7, 1000);
+    ASSERT_TRUE(sender.send_datagram(datagram));
+
+    kommpot::received_view view;
+    ASSERT_TRUE(device.read_view({}, 4096, view));
+    ASSERT_EQ(view.size(), datagram.size());
+    EXPECT_EQ(std::memcmp(view.data(), datagram.data(), datagram.size()), 0);
+}
+
+TEST(ethernet_multicast, full_queue_drops_oldest)
+{
+    constexpr size_t M_QUEUE_DATAGRAMS = 4;
+    constexpr size_t M_DATAGRAM_COUNT = 10;
+
+    const auto port = free_port();
+    multicast_sender sender("239.255.42.5", port);
+    if (!sender.is_connected())
+    {
+        GTEST_SKIP() << "No route to multicast group.";
+    }
+
+    auto subscription = ethernet_multicast_hub::instance().subscribe(
+        make_address("239.255.42.5"), port, nullptr, 0, M_QUEUE_DATAGRAMS);
+    ASSERT_NE(subscription, nullptr);
+
+    for (size_t index = 0; index < M_DATAGRAM_COUNT; ++index)
+    {
+        ASSERT_TRUE(sender.send_datagram(make_datagram(index, 32)));
+    }
+
+    /**
+     * @brief lets the receive thread queue all datagrams before the first is taken.
+     */
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (subscription->dropped_count() < M_DATAGRAM_COUNT - M_QUEUE_DATAGRAMS &&
+           std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(subscription->dropped_count(), M_DATAGRAM_COUNT - M_QUEUE_DATAGRAMS);
+
+    for (size_t index = M_DATAGRAM_COUNT - M_QUEUE_DATAGRAMS; index < M_DATAGRAM_COUNT; ++index)
+    {
+        kommpot::pooled_buffer datagram = nullptr;
+        ASSERT_TRUE(subscription->try_pop(datagram));
+        EXPECT_EQ(*datagram, make_datagram(index, 32));
+    }
+
+    kommpot::pooled_buffer datagram = nullptr;
+    EXPECT_FALSE(subscription->try_pop(datagram));
+}
+
+TEST(ethernet_multicast, rejects_tcp)
+{
+    auto identification = make_identification("239.255.42.6", 4242);
+    identification.protocol = kommpot::ethernet_protocol_type::TCP;
+
+    communication_ethernet device(identification);
+    EXPECT_FALSE(device.open());
+    EXPECT_FALSE(device.is_open());
+}
+
+#endif
+
+// NOLINTEND
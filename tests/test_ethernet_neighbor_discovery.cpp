@@ -0,0 +1,298 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/communication_ethernet.h>
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_neighbor_discovery.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <variant>
+
+#ifdef __linux__
+#    include <arpa/inet.h>
+#    include <fcntl.h>
+#    include <net/if.h>
+#    include <netinet/in.h>
+#    include <sched.h>
+#    include <sys/select.h>
+#    include <sys/socket.h>
+#    include <unistd.h>
+#endif
+
+using namespace testing;
+
+#ifdef __linux__
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+
+/**
+ * @brief veth pair with one end in a separate network namespace, each end has a static link-local
+ * address without duplicate address detection, so the link is usable right away.
+ */
+class veth_link : public Test
+{
+protected:
+    static constexpr const char *M_NAMESPACE = "kommpot_nd";
+    static constexpr const char *M_LOCAL_INTERFACE = "ethkpnd0";
+    static constexpr const char *M_PEER_INTERFACE = "kpnd1";
+    static constexpr const char *M_PEER_ADDRESS = "fe80::2";
+
+    uint32_t m_interface_index = 0;
+
+    void SetUp() override
+    {
+        if (geteuid() != 0)
+        {
+            GTEST_SKIP() << "creating a network namespace needs root";
+        }
+
+        remove_link();
+
+        const std::string commands =
+            std::string("ip netns add ") + M_NAMESPACE + " && ip link add " + M_LOCAL_INTERFACE +
+            " type veth peer name " + M_PEER_INTERFACE + " && ip link set " + M_PEER_INTERFACE +
+            " netns " + M_NAMESPACE + " && ip link set " + M_LOCAL_INTERFACE +
+            " addrgenmode none && ip -n " + M_NAMESPACE + " link set " + M_PEER_INTERFACE +
+            " addrgenmode none && ip addr add fe80::1/64 dev " + M_LOCAL_INTERFACE +
+            " nodad && ip -n " + M_NAMESPACE + " addr add " + M_PEER_ADDRESS + "/64 dev " +
+            M_PEER_INTERFACE + " nodad && ip link set " + M_LOCAL_INTERFACE + " up && ip -n " +
+            M_NAMESPACE + " link set " + M_PEER_INTERFACE + " up";
+
+        if (std::system((commands + " > /dev/null 2>&1").c_str()) != 0)
+        {
+            remove_link();
+            GTEST_SKIP() << "veth pair could not be created";
+        }
+
+        m_interface_index = if_nametoindex(M_LOCAL_INTERFACE);
+        ASSERT_NE(m_interface_index, 0u);
+        ASSERT_TRUE(wait_for_carrier(2000));
+    }
+
+    void TearDown() override
+    {
+        remove_link();
+    }
+
+    static void remove_link()
+    {
+        const std::string commands = std::string("ip link del ") + M_LOCAL_INTERFACE +
+                                     " > /dev/null 2>&1; ip netns del " + M_NAMESPACE +
+                                     " > /dev/null 2>&1";
+        static_cast<void>(std::system(commands.c_str()));
+    }
+
+    /**
+     * @brief waits until both ends of the pair are up, probes sent before the carrier is reported
+     * are dropped by the kernel.
+     */
+    static auto wait_for_carrier(const uint32_t timeout_msecs) -> bool
+    {
+        const auto path = std::string("/sys/class/net/") + M_LOCAL_INTERFACE + "/operstate";
+        const auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_msecs);
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            std::ifstream file(path);
+            std::string state;
+            if (file >> state && state == "up")
+            {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return false;
+    }
+
+    static auto peer_address_string() -> std::string
+    {
+        auto address = ethernet_address_factory::from_string(M_PEER_ADDRESS);
+        EXPECT_TRUE(address.has_value());
+        return address ? (*address)->to_string() : "";
+    }
+};
+
+/**
+ * @brief IPv6 TCP server living in the namespace of the peer, accepted connections stay open until
+ * the server stops.
+ */
+class namespace_tcp_server
+{
+public:
+    ~namespace_tcp_server()
+    {
+        stop();
+    }
+
+    auto start(const std::string &namespace_name) -> uint16_t
+    {
+        std::promise<uint16_t> port_promise;
+        auto port_future = port_promise.get_future();
+
+        m_is_running = true;
+        m_thread = std::thread([this, namespace_name, &port_promise]() {
+            const auto path = "/var/run/netns/" + namespace_name;
+            const int namespace_handle = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (namespace_handle < 0 || setns(namespace_handle, CLONE_NEWNET) != 0)
+            {
+                port_promise.set_value(0);
+                return;
+            }
+            close(namespace_handle);
+
+            const int handle = socket(AF_INET6, SOCK_STREAM, IPPROTO_TCP);
+
+            sockaddr_in6 address = {};
+            address.sin6_family = AF_INET6;
+            address.sin6_addr = in6addr_any;
+            socklen_t address_size_bytes = sizeof(address);
+
+            if (handle < 0 || bind(handle, (const sockaddr *)&address, sizeof(address)) != 0 ||
+                listen(handle, 16) != 0 ||
+                getsockname(handle, (sockaddr *)&address, &address_size_bytes) != 0)
+            {
+                port_promise.set_value(0);
+                return;
+            }
+
+            port_promise.set_value(ntohs(address.sin6_port));
+
+            std::vector<int> clients;
+            while (m_is_running)
+            {
+                fd_set read_set;
+                FD_ZERO(&read_set);
+                FD_SET(handle, &read_set);
+
+                timeval timeout = {};
+                timeout.tv_usec = 20 * 1000;
+
+                if (select(handle + 1, &read_set, nullptr, nullptr, &timeout) > 0)
+                {
+                    const int client = accept(handle, nullptr, nullptr);
+                    if (client >= 0)
+                    {
+                        clients.push_back(client);
+                    }
+                }
+            }
+
+            for (const auto client : clients)
+            {
+                close(client);
+            }
+            close(handle);
+        });
+
+        return port_future.get();
+    }
+
+    auto stop() -> void
+    {
+        m_is_running = false;
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+private:
+    std::atomic_bool m_is_running = false;
+    std::thread m_thread;
+};
+
+/*******************************************************************************
+ *
+ * ethernet_neighbor_discovery — enumeration over veth.
+ *
+ *******************************************************************************/
+TEST_F(veth_link, enumerate_finds_peer_with_mac_and_scope)
+{
+    const auto neighbors = ethernet_neighbor_discovery::enumerate(m_interface_index, 500);
+
+    const auto expected = peer_address_string();
+
+    bool is_found = false;
+    for (const auto &neighbor : neighbors)
+    {
+        if (neighbor.ip_address->to_string() != expected)
+        {
+            continue;
+        }
+
+        is_found = true;
+
+        const auto *ipv6 = dynamic_cast<ethernet_ipv6_address *>(neighbor.ip_address.get());
+        ASSERT_NE(ipv6, nullptr);
+        EXPECT_EQ(ipv6->scope_id(), m_interface_index);
+        EXPECT_EQ(neighbor.interface_index, m_interface_index);
+        EXPECT_FALSE(neighbor.mac_address.empty());
+    }
+
+    EXPECT_TRUE(is_found);
+}
+
+TEST_F(veth_link, enumerate_unknown_interface_is_empty)
+{
+    EXPECT_TRUE(ethernet_neighbor_discovery::enumerate(0xFFFFFF, 50).empty());
+}
+
+/*******************************************************************************
+ *
+ * communication_ethernet — IPv6 neighbor discovery search.
+ *
+ *******************************************************************************/
+TEST_F(veth_link, devices_finds_link_local_host_and_opens_it)
+{
+    namespace_tcp_server server;
+    const auto port = server.start(M_NAMESPACE);
+    ASSERT_NE(port, 0);
+
+    kommpot::ethernet_device_identification identification;
+    identification.port = port;
+    identification.discovery = kommpot::ethernet_discovery_type::IPV6_NEIGHBOR_DISCOVERY;
+
+    const auto devices = communication_ethernet::devices({identification});
+
+    std::shared_ptr<kommpot::device_communication> peer = nullptr;
+    for (const auto &device : devices)
+    {
+        const auto device_id =
+            std::get<kommpot::ethernet_device_identification>(device->identification());
+        if (device_id.ip == peer_address_string())
+        {
+            EXPECT_EQ(device_id.scope_id, m_interface_index);
+            EXPECT_EQ(device_id.port, port);
+            EXPECT_EQ(
+                device_id.discovery, kommpot::ethernet_discovery_type::IPV6_NEIGHBOR_DISCOVERY);
+            peer = device;
+        }
+    }
+
+    ASSERT_NE(peer, nullptr);
+
+    /**
+     * @attention a link-local address is only reachable with its scope.
+     */
+    EXPECT_TRUE(peer->open());
+    peer->close();
+}
+
+#endif
+
+// NOLINTEND
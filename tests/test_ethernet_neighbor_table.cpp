@@ -0,0 +1,143 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_neighbor_cache.h>
+#include <communications/ethernet/ethernet_neighbor_table.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+static std::shared_ptr<ethernet_ip_address> make_address(const std::string &value)
+{
+    auto addr = ethernet_address_factory::from_string(value);
+
+    EXPECT_TRUE(addr.has_value());
+
+    if (!addr.has_value())
+    {
+        return nullptr;
+    }
+
+    return *addr;
+}
+
+static ethernet_mac_address make_mac(const uint8_t last_byte)
+{
+    const uint8_t bytes[6] = {0x02, 0x00, 0x00, 0x00, 0x00, last_byte};
+
+    auto mac = ethernet_address_factory::from_array(bytes, sizeof(bytes));
+
+    EXPECT_TRUE(mac.has_value());
+
+    if (!mac.has_value())
+    {
+        return {};
+    }
+
+    return *mac;
+}
+
+/*******************************************************************************
+ *
+ * ethernet_neighbor_table — add / find.
+ *
+ *******************************************************************************/
+TEST(ethernet_neighbor_table, default_is_empty)
+{
+    ethernet_neighbor_table table;
+
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.size(), 0u);
+    EXPECT_FALSE(table.find("192.168.1.1").has_value());
+}
+
+TEST(ethernet_neighbor_table, add_and_find)
+{
+    ethernet_neighbor_table table;
+    table.add(make_address("192.168.1.10"), make_mac(0x10));
+    table.add(make_address("192.168.1.20"), make_mac(0x20));
+
+    EXPECT_EQ(table.size(), 2u);
+
+    const auto mac = table.find("192.168.1.20");
+    ASSERT_TRUE(mac.has_value());
+    EXPECT_EQ(*mac, make_mac(0x20));
+
+    EXPECT_FALSE(table.find("192.168.1.30").has_value());
+}
+
+TEST(ethernet_neighbor_table, add_same_address_updates_entry)
+{
+    ethernet_neighbor_table table;
+    table.add(make_address("10.0.0.1"), make_mac(0x01));
+    table.add(make_address("10.0.0.1"), make_mac(0x02));
+
+    EXPECT_EQ(table.size(), 1u);
+    EXPECT_EQ(table.entries()[0].mac_address, make_mac(0x02));
+}
+
+TEST(ethernet_neighbor_table, add_ignores_nullptr_and_empty_mac)
+{
+    ethernet_neighbor_table table;
+    table.add(nullptr, make_mac(0x01));
+    table.add(make_address("10.0.0.1"), ethernet_mac_address());
+
+    EXPECT_TRUE(table.empty());
+}
+
+TEST(ethernet_neighbor_table, snapshot_contains_only_resolved_entries)
+{
+    const auto table = ethernet_neighbor_table::snapshot();
+
+    for (const auto &entry : table.entries())
+    {
+        ASSERT_NE(entry.ip_address, nullptr);
+        EXPECT_FALSE(entry.mac_address.empty());
+    }
+}
+
+/*******************************************************************************
+ *
+ * ethernet_neighbor_cache — snapshot reuse.
+ *
+ *******************************************************************************/
+TEST(ethernet_neighbor_cache, snapshot_is_reused_within_ttl)
+{
+    auto &cache = ethernet_neighbor_cache::instance();
+    cache.invalidate();
+
+    const auto first = cache.snapshot();
+    const auto second = cache.snapshot();
+
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+}
+
+TEST(ethernet_neighbor_cache, invalidate_forces_new_snapshot)
+{
+    auto &cache = ethernet_neighbor_cache::instance();
+
+    const auto first = cache.snapshot();
+    cache.invalidate();
+    const auto second = cache.snapshot();
+
+    ASSERT_NE(second, nullptr);
+    EXPECT_NE(first, second);
+}
+
+TEST(ethernet_neighbor_cache, find_unknown_address_returns_nullopt)
+{
+    EXPECT_FALSE(ethernet_neighbor_cache::instance().find("127.0.0.1").has_value());
+}
+
+// NOLINTEND
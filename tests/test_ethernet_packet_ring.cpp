@@ -0,0 +1,447 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/communication_ethernet.h>
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_packet_ring.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#    include <arpa/inet.h>
+#    include <linux/if_packet.h>
+#    include <net/if.h>
+#    include <sys/socket.h>
+#    include <unistd.h>
+#endif
+
+using namespace testing;
+
+#ifdef __linux__
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+
+/**
+ * @brief veth pair with fixed MAC addresses and no IPv6 address generation, so the only frames on
+ * the link are the ones of the test.
+ */
+class veth_pair : public Test
+{
+protected:
+    static constexpr const char *M_INTERFACE_A = "ethkpraw0";
+    static constexpr const char *M_INTERFACE_B = "ethkpraw1";
+    static constexpr const char *M_MAC_A = "02:00:00:00:00:0A";
+    static constexpr const char *M_MAC_B = "02:00:00:00:00:0B";
+    static constexpr uint16_t M_ETHER_TYPE = 0x88B5;
+
+    void SetUp() override
+    {
+        if (geteuid() != 0)
+        {
+            GTEST_SKIP() << "creating a veth pair and AF_PACKET sockets needs root";
+        }
+
+        remove_link();
+
+        const std::string commands = std::string("ip link add ") + M_INTERFACE_A + " address " +
+                                     M_MAC_A + " type veth peer name " + M_INTERFACE_B +
+                                     " address " + M_MAC_B + " && ip link set " + M_INTERFACE_A +
+                                     " addrgenmode none && ip link set " + M_INTERFACE_B +
+                                     " addrgenmode none && ip link set " + M_INTERFACE_A +
+                                     " up && ip link set " + M_INTERFACE_B + " up";
+
+        if (std::system((commands + " > /dev/null 2>&1").c_str()) != 0)
+        {
+            remove_link();
+            GTEST_SKIP() << "veth pair could not be created";
+        }
+
+        ASSERT_TRUE(wait_for_carrier(M_INTERFACE_A, 2000));
+        ASSERT_TRUE(wait_for_carrier(M_INTERFACE_B, 2000));
+    }
+
+    void TearDown() override
+    {
+        remove_link();
+    }
+
+    static void remove_link()
+    {
+        const std::string command =
+            std::string("ip link del ") + M_INTERFACE_A + " > /dev/null 2>&1";
+        static_cast<void>(std::system(command.c_str()));
+    }
+
+    static auto wait_for_carrier(const char *interface_name, const uint32_t timeout_msecs)
+        -> bool
+    {
+        const auto path = std::string("/sys/class/net/") + interface_name + "/operstate";
+        const auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_msecs);
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            std::ifstream file(path);
+            std::string state;
+            if (file >> state && state == "up")
+            {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return false;
+    }
+
+    static auto make_mac(const std::string &value) -> ethernet_mac_address
+    {
+        auto mac = ethernet_address_factory::mac_from_string(value);
+        EXPECT_TRUE(mac.has_value());
+        return mac.value_or(ethernet_mac_address());
+    }
+
+    static auto make_identification(const char *interface_name, const std::string &peer_mac,
+        const uint16_t ether_type = M_ETHER_TYPE) -> kommpot::ethernet_device_identification
+    {
+        kommpot::ethernet_device_identification identification;
+        identification.protocol = kommpot::ethernet_protocol_type::RAW;
+        identification.raw_interface = interface_name;
+        identification.ether_type = ether_type;
+        identification.mac = peer_mac;
+        return identification;
+    }
+};
+
+/**
+ * @brief frames in test memory, filled ones carry their index in every payload byte.
+ */
+struct frame_batch
+{
+    std::vector<std::vector<uint8_t>> buffers;
+    std::vector<kommpot::message_buffer> messages;
+
+    frame_batch(const size_t count, const size_t size_bytes, const bool is_filled)
+        : buffers(count),
+          messages(count)
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            buffers[index].assign(size_bytes, is_filled ? static_cast<uint8_t>(index) : 0);
+            messages[index].data = buffers[index].data();
+            messages[index].size_bytes = size_bytes;
+        }
+    }
+};
+
+/**
+ * @brief reads until count frames arrived or a read times out.
+ */
+static auto read_frames(ethernet_packet_ring &ring, frame_batch &batch, const size_t count)
+    -> size_t
+{
+    size_t received_total = 0;
+    while (received_total < count)
+    {
+        std::vector<kommpot::message_buffer> remaining(
+            batch.messages.begin() + received_total, batch.messages.begin() + count);
+        size_t received_count = 0;
+        if (!ring.read_messages(remaining, received_count, 500))
+        {
+            break;
+        }
+        for (size_t index = 0; index < received_count; ++index)
+        {
+            batch.messages[received_total + index] = remaining[index];
+        }
+        received_total += received_count;
+    }
+    return received_total;
+}
+
+/*******************************************************************************
+ *
+ * ethernet_packet_ring — frame exchange.
+ *
+ *******************************************************************************/
+TEST_F(veth_pair, ring_reads_interface_addresses)
+{
+    auto ring = ethernet_packet_ring::create(M_INTERFACE_A, M_ETHER_TYPE, std::nullopt);
+    ASSERT_NE(ring, nullptr);
+
+    EXPECT_EQ(ring->mac_address().to_string(), M_MAC_A);
+    EXPECT_EQ(ring->interface_index(), if_nametoindex(M_INTERFACE_A));
+    EXPECT_EQ(ring->max_payload_size(), 1500u);
+    EXPECT_NE(ring->native_handle(), nullptr);
+}
+
+TEST_F(veth_pair, ring_exchanges_frame_batches)
+{
+    constexpr size_t M_FRAME_COUNT = 300;
+
+    auto ring_a = ethernet_packet_ring::create(M_INTERFACE_A, M_ETHER_TYPE, make_mac(M_MAC_B));
+    auto ring_b = ethernet_packet_ring::create(M_INTERFACE_B, M_ETHER_TYPE, make_mac(M_MAC_A));
+    ASSERT_NE(ring_a, nullptr);
+    ASSERT_NE(ring_b, nullptr);
+
+    /**
+     * @attention more frames than transmit ring slots, so the ring wraps.
+     */
+    frame_batch sent(M_FRAME_COUNT, 200, true);
+    ASSERT_TRUE(ring_a->write_messages(sent.messages, 2000));
+
+    frame_batch received(M_FRAME_COUNT, 1500, false);
+    ASSERT_EQ(read_frames(*ring_b, received, M_FRAME_COUNT), M_FRAME_COUNT);
+    for (size_t index = 0; index < M_FRAME_COUNT; ++index)
+    {
+        const auto &message = received.messages[index];
+        ASSERT_EQ(message.received_size_bytes, 200u);
+        EXPECT_FALSE(message.is_truncated);
+        EXPECT_EQ(received.buffers[index][0], static_cast<uint8_t>(index));
+        EXPECT_EQ(received.buffers[index][199], static_cast<uint8_t>(index));
+    }
+
+    frame_batch reply(1, 64, true);
+    ASSERT_TRUE(ring_b->write_messages(reply.messages, 2000));
+    frame_batch reply_received(1, 64, false);
+    EXPECT_EQ(read_frames(*ring_a, reply_received, 1), 1u);
+}
+
+TEST_F(veth_pair, ring_reports_truncated_frames)
+{
+    auto ring_a = ethernet_packet_ring::create(M_INTERFACE_A, M_ETHER_TYPE, std::nullopt);
+    auto ring_b = ethernet_packet_ring::create(M_INTERFACE_B, M_ETHER_TYPE, std::nullopt);
+    ASSERT_NE(ring_a, nullptr);
+    ASSERT_NE(ring_b, nullptr);
+
+    frame_batch sent(1, 1000, true);
+    ASSERT_TRUE(ring_a->write_messages(sent.messages, 2000));
+
+    frame_batch received(1, 100, false);
+    ASSERT_EQ(read_frames(*ring_b, received, 1), 1u);
+    EXPECT_EQ(received.messages[0].received_size_bytes, 100u);
+    EXPECT_TRUE(received.messages[0].is_truncated);
+}
+
+TEST_F(veth_pair, ring_rejects_oversized_payload)
+{
+    auto ring = ethernet_packet_ring::create(M_INTERFACE_A, M_ETHER_TYPE, std::nullopt);
+    ASSERT_NE(ring, nullptr);
+
+    frame_batch sent(1, ring->max_payload_size() + 1, true);
+    EXPECT_FALSE(ring->write_messages(sent.messages, 2000));
+}
+
+/*******************************************************************************
+ *
+ * ethernet_packet_ring — kernel filter.
+ *
+ *******************************************************************************/
+TEST_F(veth_pair, filter_drops_other_ether_type)
+{
+    auto sender_other = ethernet_packet_ring::create(M_INTERFACE_A, 0x88B6, std::nullopt);
+    auto sender = ethernet_packet_ring::create(M_INTERFACE_A, M_ETHER_TYPE, std::nullopt);
+    auto receiver = ethernet_packet_ring::create(M_INTERFACE_B, M_ETHER_TYPE, std::nullopt);
+    ASSERT_NE(sender_other, nullptr);
+    ASSERT_NE(sender, nullptr);
+    ASSERT_NE(receiver, nullptr);
+
+    frame_batch other(1, 64, true);
+    other.buffers[0].assign(64, 0xEE);
+    ASSERT_TRUE(sender_other->write_messages(other.messages, 2000));
+
+    frame_batch expected(1, 64, true);
+    ASSERT_TRUE(sender->write_messages(expected.messages, 2000));
+
+    frame_batch received(2, 64, false);
+    ASSERT_EQ(read_frames(*receiver, received, 2), 1u);
+    EXPECT_EQ(received.buffers[0], expected.buffers[0]);
+}
+
+TEST_F(veth_pair, filter_drops_other_source)
+{
+    auto sender = ethernet_packet_ring::create(M_INTERFACE_A, M_ETHER_TYPE, std::nullopt);
+    auto receiver_other =
+        ethernet_packet_ring::create(M_INTERFACE_B, M_ETHER_TYPE, make_mac("02:00:00:00:00:99"));
+    auto receiver = ethernet_packet_ring::create(M_INTERFACE_B, M_ETHER_TYPE, make_mac(M_MAC_A));
+    ASSERT_NE(sender, nullptr);
+    ASSERT_NE(receiver_other, nullptr);
+    ASSERT_NE(receiver, nullptr);
+
+    frame_batch sent(4, 64, true);
+    ASSERT_TRUE(sender->write_messages(sent.messages, 2000));
+
+    frame_batch received(4, 64, false);
+    EXPECT_EQ(read_frames(*receiver, received, 4), 4u);
+
+    frame_batch received_other(4, 64, false);
+    size_t received_count = 0;
+    EXPECT_FALSE(receiver_other->read_messages(received_other.messages, received_count, 100));
+    EXPECT_EQ(received_count, 0u);
+}
+
+TEST_F(veth_pair, ring_rejects_invalid_parameters)
+{
+    EXPECT_EQ(ethernet_packet_ring::create("ethkpmissing", M_ETHER_TYPE, std::nullopt), nullptr);
+    EXPECT_EQ(ethernet_packet_ring::create(M_INTERFACE_A, 0x05DC, std::nullopt), nullptr);
+}
+
+/*******************************************************************************
+ *
+ * communication_ethernet — RAW protocol.
+ *
+ *******************************************************************************/
+TEST_F(veth_pair, device_exchanges_frames)
+{
+    communication_ethernet device_a(make_identification(M_INTERFACE_A, M_MAC_B));
+    communication_ethernet device_b(make_identification(M_INTERFACE_B, M_MAC_A));
+    ASSERT_TRUE(device_a.open());
+    ASSERT_TRUE(device_b.open());
+    EXPECT_TRUE(device_a.is_open());
+
+    std::vector<uint8_t> request(512, 0x42);
+    ASSERT_TRUE(device_a.write({}, request.data(), request.size()));
+
+    std::vector<uint8_t> received(512, 0);
+    ASSERT_TRUE(device_b.read({}, received.data(), received.size()));
+    EXPECT_EQ(received, request);
+
+    /**
+     * @attention frames shorter than the Ethernet minimum may arrive padded, the read still
+     * succeeds.
+     */
+    std::vector<uint8_t> reply = {0x01, 0x02, 0x03};
+    ASSERT_TRUE(device_b.write({}, reply.data(), reply.size()));
+
+    std::vector<uint8_t> reply_received(3, 0);
+    ASSERT_TRUE(device_a.read({}, reply_received.data(), reply_received.size()));
+    EXPECT_EQ(reply_received, reply);
+
+    kommpot::received_view view;
+    ASSERT_TRUE(device_a.write({}, request.data(), request.size()));
+    ASSERT_TRUE(device_b.read_view({}, 2048, view));
+    EXPECT_EQ(view.size(), request.size());
+
+    device_a.close();
+    EXPECT_FALSE(device_a.is_open());
+}
+
+TEST_F(veth_pair, device_broadcasts_without_peer)
+{
+    communication_ethernet sender(make_identification(M_INTERFACE_A, "*"));
+    communication_ethernet receiver(make_identification(M_INTERFACE_B, "*"));
+    ASSERT_TRUE(sender.open());
+    ASSERT_TRUE(receiver.open());
+
+    std::vector<uint8_t> data(100, 0x17);
+    ASSERT_TRUE(sender.write({}, data.data(), data.size()));
+
+    std::vector<uint8_t> received(1500, 0);
+    size_t received_size_bytes = 0;
+    ASSERT_TRUE(receiver.read_some({}, received.data(), received.size(), received_size_bytes));
+    EXPECT_EQ(received_size_bytes, data.size());
+}
+
+TEST_F(veth_pair, device_rejects_malformed_peer)
+{
+    communication_ethernet device(make_identification(M_INTERFACE_A, "02:00:00:00:0A"));
+    EXPECT_FALSE(device.open());
+    EXPECT_FALSE(device.is_open());
+}
+
+TEST_F(veth_pair, devices_lists_raw_identification)
+{
+    auto devices = communication_ethernet::devices({make_identification(M_INTERFACE_A, "*")});
+    ASSERT_EQ(devices.size(), 1u);
+    EXPECT_TRUE(devices.front()->open());
+}
+
+/*******************************************************************************
+ *
+ * ethernet_packet_ring — benchmark.
+ *
+ *******************************************************************************/
+TEST_F(veth_pair, benchmark_writes)
+{
+    constexpr size_t M_FRAME_SIZE_BYTES = 1000;
+    constexpr size_t M_BATCH_COUNT = 64;
+    constexpr size_t M_TOTAL_COUNT = 100 * 1024;
+
+    frame_batch batch(M_BATCH_COUNT, M_FRAME_SIZE_BYTES, true);
+
+    for (const char *name : {"SEND", "RING"})
+    {
+        const std::string mode = name;
+
+        /**
+         * @brief plain AF_PACKET socket copying every frame with its own send().
+         */
+        const int handle = socket(AF_PACKET, SOCK_RAW, htons(M_ETHER_TYPE));
+        ASSERT_GE(handle, 0);
+        sockaddr_ll address = {};
+        address.sll_family = AF_PACKET;
+        address.sll_protocol = htons(M_ETHER_TYPE);
+        address.sll_ifindex = static_cast<int>(if_nametoindex(M_INTERFACE_A));
+        address.sll_halen = 6;
+        std::memcpy(address.sll_addr, make_mac(M_MAC_B).data(), 6);
+
+        std::vector<uint8_t> frame(14 + M_FRAME_SIZE_BYTES, 0x5A);
+        std::memcpy(frame.data(), make_mac(M_MAC_B).data(), 6);
+        std::memcpy(frame.data() + 6, make_mac(M_MAC_A).data(), 6);
+        frame[12] = M_ETHER_TYPE >> 8;
+        frame[13] = M_ETHER_TYPE & 0xFF;
+
+        auto ring = ethernet_packet_ring::create(M_INTERFACE_A, M_ETHER_TYPE, make_mac(M_MAC_B));
+        ASSERT_NE(ring, nullptr);
+
+        /**
+         * @attention nobody reads on the other end, the kernel drops the frames there.
+         */
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t sent_count = 0; sent_count < M_TOTAL_COUNT; sent_count += M_BATCH_COUNT)
+        {
+            if (mode == "SEND")
+            {
+                for (size_t index = 0; index < M_BATCH_COUNT; ++index)
+                {
+                    ASSERT_EQ(sendto(handle, frame.data(), frame.size(), 0,
+                                  (const sockaddr *)&address, sizeof(address)),
+                        static_cast<ssize_t>(frame.size()));
+                }
+            }
+            else
+            {
+                ASSERT_TRUE(ring->write_messages(batch.messages, 2000));
+            }
+        }
+
+        const auto elapsed_usecs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start)
+                                       .count();
+        const auto frames_per_second =
+            static_cast<double>(M_TOTAL_COUNT) * 1e6 / static_cast<double>(elapsed_usecs);
+
+        close(handle);
+
+        printf("[ %-8s ] %.0f frames/s sent\n", name, frames_per_second);
+        RecordProperty(mode + "_write_frames_per_second", static_cast<int>(frames_per_second));
+    }
+}
+
+#endif
+
+// NOLINTEND
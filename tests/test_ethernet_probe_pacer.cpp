@@ -0,0 +1,89 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <communications/ethernet/ethernet_probe_pacer.h>
+#include <communications/ethernet/ethernet_tools.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * ethernet_probe_pacer — rate limiting.
+ *
+ *******************************************************************************/
+TEST(ethernet_probe_pacer, zero_rate_does_not_block)
+{
+    ethernet_probe_pacer pacer(0);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 1000; i++)
+    {
+        pacer.wait();
+    }
+
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+}
+
+TEST(ethernet_probe_pacer, spreads_probes_over_time)
+{
+    ethernet_probe_pacer pacer(100);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 6; i++)
+    {
+        pacer.wait();
+    }
+
+    /**
+     * @attention first probe is sent immediately, the other five wait 10 ms each.
+     */
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(45));
+}
+
+TEST(ethernet_probe_pacer, rate_is_shared_between_threads)
+{
+    ethernet_probe_pacer pacer(200);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < 4; i++)
+    {
+        workers.emplace_back([&pacer]() {
+            for (int j = 0; j < 3; j++)
+            {
+                pacer.wait();
+            }
+        });
+    }
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    /**
+     * @attention 12 probes at 5 ms each, the first one is free.
+     */
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+}
+
+/*******************************************************************************
+ *
+ * ethernet_tools — ephemeral port range.
+ *
+ *******************************************************************************/
+TEST(ethernet_tools, ephemeral_port_count_is_positive)
+{
+    const auto count = ethernet_tools::get_ephemeral_port_count();
+
+    EXPECT_GT(count, 0u);
+    EXPECT_LE(count, 65536u);
+}
+
+// NOLINTEND
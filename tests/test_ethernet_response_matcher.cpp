@@ -0,0 +1,112 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/ethernet_response_matcher.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * ethernet_response_matcher — single matchers.
+ *
+ *******************************************************************************/
+TEST(ethernet_response_matcher, empty_configuration_accepts_any_response)
+{
+    ethernet_response_matcher matcher(kommpot::ethernet_probe_configuration{});
+
+    EXPECT_TRUE(matcher.is_valid());
+    EXPECT_TRUE(matcher.is_match(""));
+    EXPECT_TRUE(matcher.is_match("anything"));
+    EXPECT_FALSE(matcher.is_rejected("anything"));
+}
+
+TEST(ethernet_response_matcher, prefix)
+{
+    kommpot::ethernet_probe_configuration configuration;
+    configuration.response_prefix = "ACME,";
+
+    ethernet_response_matcher matcher(configuration);
+
+    EXPECT_TRUE(matcher.is_match("ACME,DMM-1,1234,1.0\n"));
+    EXPECT_FALSE(matcher.is_match("ACM"));
+    EXPECT_FALSE(matcher.is_match("OTHER,DMM-1\n"));
+}
+
+TEST(ethernet_response_matcher, prefix_rejects_early)
+{
+    kommpot::ethernet_probe_configuration configuration;
+    configuration.response_prefix = "ACME,";
+
+    ethernet_response_matcher matcher(configuration);
+
+    EXPECT_FALSE(matcher.is_rejected("AC"));
+    EXPECT_TRUE(matcher.is_rejected("AX"));
+    EXPECT_FALSE(matcher.is_rejected("ACME,DMM"));
+}
+
+TEST(ethernet_response_matcher, regex_is_searched)
+{
+    kommpot::ethernet_probe_configuration configuration;
+    configuration.response_regex = "DMM-[0-9]+";
+
+    ethernet_response_matcher matcher(configuration);
+
+    ASSERT_TRUE(matcher.is_valid());
+    EXPECT_TRUE(matcher.is_match("ACME,DMM-42,1234\n"));
+    EXPECT_FALSE(matcher.is_match("ACME,PSU-42,1234\n"));
+}
+
+TEST(ethernet_response_matcher, invalid_regex_accepts_nothing)
+{
+    kommpot::ethernet_probe_configuration configuration;
+    configuration.response_regex = "DMM-[0-9";
+
+    ethernet_response_matcher matcher(configuration);
+
+    EXPECT_FALSE(matcher.is_valid());
+    EXPECT_FALSE(matcher.is_match("DMM-1"));
+    EXPECT_TRUE(matcher.is_rejected("DMM-1"));
+}
+
+TEST(ethernet_response_matcher, callback)
+{
+    kommpot::ethernet_probe_configuration configuration;
+    configuration.response_callback = [](const std::string &response) {
+        return response.find("1234") != std::string::npos;
+    };
+
+    ethernet_response_matcher matcher(configuration);
+
+    EXPECT_TRUE(matcher.is_match("ACME,DMM-1,1234\n"));
+    EXPECT_FALSE(matcher.is_match("ACME,DMM-1,5678\n"));
+}
+
+/*******************************************************************************
+ *
+ * ethernet_response_matcher — combined matchers.
+ *
+ *******************************************************************************/
+TEST(ethernet_response_matcher, all_matchers_have_to_accept)
+{
+    kommpot::ethernet_probe_configuration configuration;
+    configuration.response_prefix = "ACME,";
+    configuration.response_regex = ",DMM-";
+    configuration.response_callback = [](const std::string &response) {
+        return !response.empty() && response.back() == '\n';
+    };
+
+    ethernet_response_matcher matcher(configuration);
+
+    EXPECT_TRUE(matcher.is_match("ACME,DMM-1,1234\n"));
+    EXPECT_FALSE(matcher.is_match("ACME,DMM-1,1234"));
+    EXPECT_FALSE(matcher.is_match("ACME,PSU-1,1234\n"));
+    EXPECT_FALSE(matcher.is_match("OTHER,DMM-1,1234\n"));
+}
+
+// NOLINTEND
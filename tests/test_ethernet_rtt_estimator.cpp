@@ -0,0 +1,92 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <communications/ethernet/ethernet_rtt_estimator.h>
+
+#include <gtest/gtest.h>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * ethernet_rtt_estimator — timeout derivation.
+ *
+ *******************************************************************************/
+TEST(ethernet_rtt_estimator, uses_max_timeout_without_samples)
+{
+    ethernet_rtt_estimator estimator(2000);
+
+    EXPECT_EQ(estimator.timeout_msecs(4, 50), 2000u);
+}
+
+TEST(ethernet_rtt_estimator, uses_max_timeout_below_minimal_sample_count)
+{
+    ethernet_rtt_estimator estimator(2000);
+    estimator.add_sample(1000);
+    estimator.add_sample(1000);
+
+    EXPECT_EQ(estimator.timeout_msecs(4, 1), 2000u);
+}
+
+TEST(ethernet_rtt_estimator, scales_percentile_by_multiplier)
+{
+    ethernet_rtt_estimator estimator(2000);
+    for (int i = 0; i < 20; ++i)
+    {
+        estimator.add_sample(10000);
+    }
+
+    EXPECT_EQ(estimator.timeout_msecs(4, 1), 40u);
+    EXPECT_EQ(estimator.sample_count(), 20u);
+}
+
+TEST(ethernet_rtt_estimator, ignores_few_outliers_above_percentile)
+{
+    ethernet_rtt_estimator estimator(2000);
+    for (int i = 0; i < 99; ++i)
+    {
+        estimator.add_sample(2000);
+    }
+    estimator.add_sample(900000);
+
+    EXPECT_EQ(estimator.timeout_msecs(4, 1), 8u);
+}
+
+TEST(ethernet_rtt_estimator, clamps_to_min_timeout)
+{
+    ethernet_rtt_estimator estimator(2000);
+    for (int i = 0; i < 10; ++i)
+    {
+        estimator.add_sample(100);
+    }
+
+    EXPECT_EQ(estimator.timeout_msecs(4, 50), 50u);
+}
+
+TEST(ethernet_rtt_estimator, clamps_to_max_timeout)
+{
+    ethernet_rtt_estimator estimator(2000);
+    for (int i = 0; i < 10; ++i)
+    {
+        estimator.add_sample(1500000);
+    }
+
+    EXPECT_EQ(estimator.timeout_msecs(4, 50), 2000u);
+}
+
+TEST(ethernet_rtt_estimator, keeps_only_latest_samples)
+{
+    ethernet_rtt_estimator estimator(2000);
+    for (int i = 0; i < 256; ++i)
+    {
+        estimator.add_sample(400000);
+    }
+    for (int i = 0; i < 256; ++i)
+    {
+        estimator.add_sample(1000);
+    }
+
+    EXPECT_EQ(estimator.timeout_msecs(4, 1), 4u);
+}
+
+// NOLINTEND
@@ -0,0 +1,254 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_socket.h>
+
+#include "loopback_tcp_server.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <sys/resource.h>
+#    include <sys/select.h>
+#    include <unistd.h>
+#endif
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+static std::shared_ptr<ethernet_ip_address> make_address(const std::string &value)
+{
+    auto addr = ethernet_address_factory::from_string(value);
+
+    EXPECT_TRUE(addr.has_value());
+
+    if (!addr.has_value())
+    {
+        return nullptr;
+    }
+
+    return *addr;
+}
+
+/*******************************************************************************
+ *
+ * ethernet_socket — TCP on loopback.
+ *
+ *******************************************************************************/
+TEST(ethernet_socket, connect_to_loopback_without_neighbor_entry)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    ethernet_socket socket;
+    ASSERT_TRUE(socket.initialize(
+        make_address("127.0.0.1"), server.port(), kommpot::ethernet_protocol_type::TCP));
+    ASSERT_TRUE(socket.set_timeout(1000));
+    ASSERT_TRUE(socket.connect());
+
+    /**
+     * @attention loopback has no neighbor entry, MAC address stays empty.
+     */
+    EXPECT_TRUE(socket.mac_address().empty());
+
+    EXPECT_TRUE(socket.disconnect());
+}
+
+TEST(ethernet_socket, write_and_read_echo)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    ethernet_socket socket;
+    ASSERT_TRUE(socket.initialize(
+        make_address("127.0.0.1"), server.port(), kommpot::ethernet_protocol_type::TCP));
+    ASSERT_TRUE(socket.set_timeout(1000));
+    ASSERT_TRUE(socket.connect());
+
+    std::string request = "*IDN?\n";
+    ASSERT_TRUE(socket.write(request.data(), request.size()));
+
+    std::string response(request.size(), '\0');
+    ASSERT_TRUE(socket.read(response.data(), response.size()));
+    EXPECT_EQ(response, request);
+
+    EXPECT_TRUE(socket.disconnect());
+}
+
+TEST(ethernet_socket, connect_to_closed_port_fails)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+    const auto unused_port = server.port();
+    server.stop();
+
+    ethernet_socket socket;
+    ASSERT_TRUE(socket.initialize(
+        make_address("127.0.0.1"), unused_port, kommpot::ethernet_protocol_type::TCP));
+    ASSERT_TRUE(socket.set_timeout(500));
+    EXPECT_FALSE(socket.connect());
+    EXPECT_FALSE(socket.is_connected());
+
+    /**
+     * @attention a refused connection is an answer of the peer, its duration is an RTT sample.
+     */
+    EXPECT_TRUE(socket.connect_rtt_usecs().has_value());
+}
+
+TEST(ethernet_socket, connect_measures_rtt)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    ethernet_socket socket;
+    ASSERT_TRUE(socket.initialize(
+        make_address("127.0.0.1"), server.port(), kommpot::ethernet_protocol_type::TCP));
+    ASSERT_TRUE(socket.set_timeout(1000));
+    ASSERT_TRUE(socket.connect());
+
+    ASSERT_TRUE(socket.connect_rtt_usecs().has_value());
+    EXPECT_LT(*socket.connect_rtt_usecs(), 1000000u);
+
+    EXPECT_TRUE(socket.disconnect());
+}
+
+TEST(ethernet_socket, read_some_returns_available_bytes)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    ethernet_socket socket;
+    ASSERT_TRUE(socket.initialize(
+        make_address("127.0.0.1"), server.port(), kommpot::ethernet_protocol_type::TCP));
+    ASSERT_TRUE(socket.set_timeout(1000));
+    ASSERT_TRUE(socket.connect());
+
+    size_t received_size_bytes = 0;
+    char buffer[64] = {};
+    EXPECT_FALSE(socket.read_some(buffer, sizeof(buffer), received_size_bytes, 20));
+    EXPECT_EQ(received_size_bytes, 0u);
+
+    std::string request = "PING";
+    ASSERT_TRUE(socket.write(request.data(), request.size()));
+
+    std::string response;
+    while (response.size() < request.size())
+    {
+        ASSERT_TRUE(socket.read_some(buffer, sizeof(buffer), received_size_bytes, 1000));
+        response.append(buffer, received_size_bytes);
+    }
+    EXPECT_EQ(response, request);
+
+    EXPECT_TRUE(socket.disconnect());
+}
+
+TEST(ethernet_socket, abortive_close_resets_connection)
+{
+    std::atomic<int> peer_result = 1;
+
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start([&peer_result](loopback_tcp_server::handle_type handle) {
+        char byte = 0;
+        peer_result = static_cast<int>(recv(handle, &byte, sizeof(byte), 0));
+    }));
+
+    ethernet_socket socket;
+    ASSERT_TRUE(socket.initialize(
+        make_address("127.0.0.1"), server.port(), kommpot::ethernet_protocol_type::TCP));
+    ASSERT_TRUE(socket.set_timeout(1000));
+    ASSERT_TRUE(socket.connect());
+    ASSERT_TRUE(server.wait_for_accepted(1));
+
+    ASSERT_TRUE(socket.set_abortive_close(true));
+    EXPECT_TRUE(socket.disconnect());
+
+    server.stop();
+
+    /**
+     * @attention graceful close is reported as 0, a reset as error.
+     */
+    EXPECT_LT(peer_result.load(), 0);
+}
+
+#ifndef _WIN32
+
+/*******************************************************************************
+ *
+ * ethernet_socket — handles beyond FD_SETSIZE.
+ *
+ *******************************************************************************/
+TEST(ethernet_socket, connect_and_read_with_handle_above_fd_setsize)
+{
+    rlimit limit = {};
+    ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &limit), 0);
+    if (limit.rlim_max < FD_SETSIZE + 64)
+    {
+        GTEST_SKIP() << "descriptor limit too low";
+    }
+
+    const auto previous_limit = limit;
+    limit.rlim_cur = std::max<rlim_t>(limit.rlim_cur, FD_SETSIZE + 64);
+    ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &limit), 0);
+
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    /**
+     * @brief occupies the lower handles, so the socket gets one select() cannot take.
+     */
+    std::vector<int> fillers;
+    while (fillers.empty() || fillers.back() < FD_SETSIZE)
+    {
+        const auto handle = open("/dev/null", O_RDONLY);
+        ASSERT_GE(handle, 0);
+        fillers.push_back(handle);
+    }
+
+    {
+        ethernet_socket socket;
+        ASSERT_TRUE(socket.initialize(
+            make_address("127.0.0.1"), server.port(), kommpot::ethernet_protocol_type::TCP));
+        ASSERT_TRUE(socket.set_timeout(1000));
+        ASSERT_TRUE(socket.connect());
+        EXPECT_GE(static_cast<int>(*static_cast<uint64_t *>(socket.native_handle())), FD_SETSIZE);
+
+        std::string request = "PING";
+        ASSERT_TRUE(socket.write(request.data(), request.size()));
+
+        std::string response;
+        char buffer[64] = {};
+        size_t received_size_bytes = 0;
+        while (response.size() < request.size())
+        {
+            ASSERT_TRUE(socket.read_some(buffer, sizeof(buffer), received_size_bytes, 1000));
+            response.append(buffer, received_size_bytes);
+        }
+        EXPECT_EQ(response, request);
+
+        EXPECT_TRUE(socket.disconnect());
+    }
+
+    for (const auto handle : fillers)
+    {
+        close(handle);
+    }
+    setrlimit(RLIMIT_NOFILE, &previous_limit);
+}
+
+#endif
+
+// NOLINTEND
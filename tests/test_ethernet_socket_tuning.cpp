@@ -0,0 +1,217 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_socket.h>
+#include <communications/ethernet/ethernet_socket_tuning.h>
+
+#include "loopback_tcp_server.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#    include <netinet/tcp.h>
+#endif
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+static std::shared_ptr<ethernet_ip_address> make_address(const std::string &value)
+{
+    auto addr = ethernet_address_factory::from_string(value);
+
+    EXPECT_TRUE(addr.has_value());
+
+    if (!addr.has_value())
+    {
+        return nullptr;
+    }
+
+    return *addr;
+}
+
+static int get_option(ethernet_socket &socket, const int level, const int name)
+{
+    int value = 0;
+    socklen_t value_size = sizeof(value);
+    const auto handle = static_cast<loopback_tcp_server::handle_type>(
+        *static_cast<const uint64_t *>(socket.native_handle()));
+    EXPECT_EQ(getsockopt(handle, level, name, (char *)&value, &value_size), 0);
+    return value;
+}
+
+/*******************************************************************************
+ *
+ * ethernet_socket_tuning — profile contents.
+ *
+ *******************************************************************************/
+TEST(ethernet_socket_tuning, default_profile_keeps_os_defaults)
+{
+    const auto tuning =
+        ethernet_socket_tuning::from_profile(kommpot::ethernet_socket_profile::DEFAULT);
+
+    EXPECT_FALSE(tuning.is_no_delay_enabled);
+    EXPECT_FALSE(tuning.is_quick_ack_enabled);
+    EXPECT_EQ(tuning.buffer_size_bytes, 0u);
+    EXPECT_EQ(tuning.busy_poll_usecs, 0u);
+    EXPECT_EQ(tuning.dscp, 0u);
+    EXPECT_EQ(tuning.keepalive_idle_secs, 0u);
+}
+
+TEST(ethernet_socket_tuning, low_latency_profile_disables_nagle)
+{
+    const auto tuning =
+        ethernet_socket_tuning::from_profile(kommpot::ethernet_socket_profile::LOW_LATENCY);
+
+    EXPECT_TRUE(tuning.is_no_delay_enabled);
+    EXPECT_TRUE(tuning.is_quick_ack_enabled);
+    EXPECT_GT(tuning.busy_poll_usecs, 0u);
+    EXPECT_EQ(tuning.dscp, 46u);
+    EXPECT_EQ(tuning.buffer_size_bytes, 0u);
+}
+
+TEST(ethernet_socket_tuning, bulk_throughput_profile_enlarges_buffers)
+{
+    const auto tuning =
+        ethernet_socket_tuning::from_profile(kommpot::ethernet_socket_profile::BULK_THROUGHPUT);
+
+    EXPECT_FALSE(tuning.is_no_delay_enabled);
+    EXPECT_GT(tuning.buffer_size_bytes, 0u);
+    EXPECT_EQ(tuning.dscp, 10u);
+}
+
+TEST(ethernet_socket_tuning, profile_to_string)
+{
+    EXPECT_EQ(kommpot::ethernet_socket_profile_to_string(kommpot::ethernet_socket_profile::DEFAULT),
+        "DEFAULT");
+    EXPECT_EQ(kommpot::ethernet_socket_profile_to_string(
+                  kommpot::ethernet_socket_profile::LOW_LATENCY),
+        "LOW_LATENCY");
+    EXPECT_EQ(kommpot::ethernet_socket_profile_to_string(
+                  kommpot::ethernet_socket_profile::BULK_THROUGHPUT),
+        "BULK_THROUGHPUT");
+}
+
+#ifndef _WIN32
+/*******************************************************************************
+ *
+ * ethernet_socket — applying profiles.
+ *
+ *******************************************************************************/
+TEST(ethernet_socket_tuning, low_latency_profile_sets_no_delay)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    ethernet_socket socket;
+    ASSERT_TRUE(socket.initialize(
+        make_address("127.0.0.1"), server.port(), kommpot::ethernet_protocol_type::TCP));
+    ASSERT_TRUE(socket.set_timeout(1000));
+
+    /**
+     * @attention SO_BUSY_POLL may be refused without CAP_NET_ADMIN, so the result is not checked.
+     */
+    (void)socket.set_profile(kommpot::ethernet_socket_profile::LOW_LATENCY);
+    ASSERT_TRUE(socket.connect());
+
+    EXPECT_EQ(socket.profile(), kommpot::ethernet_socket_profile::LOW_LATENCY);
+    EXPECT_NE(get_option(socket, IPPROTO_TCP, TCP_NODELAY), 0);
+    EXPECT_NE(get_option(socket, SOL_SOCKET, SO_KEEPALIVE), 0);
+    EXPECT_EQ(get_option(socket, IPPROTO_IP, IP_TOS), 46 << 2);
+}
+
+TEST(ethernet_socket_tuning, bulk_throughput_profile_enlarges_buffers_of_socket)
+{
+    ethernet_socket reference;
+    ASSERT_TRUE(reference.initialize(
+        make_address("127.0.0.1"), 1, kommpot::ethernet_protocol_type::TCP));
+
+    ethernet_socket socket;
+    ASSERT_TRUE(
+        socket.initialize(make_address("127.0.0.1"), 1, kommpot::ethernet_protocol_type::TCP));
+    EXPECT_TRUE(socket.set_profile(kommpot::ethernet_socket_profile::BULK_THROUGHPUT));
+
+    EXPECT_GT(get_option(socket, SOL_SOCKET, SO_RCVBUF),
+        get_option(reference, SOL_SOCKET, SO_RCVBUF));
+    EXPECT_EQ(get_option(socket, IPPROTO_TCP, TCP_NODELAY), 0);
+}
+
+TEST(ethernet_socket_tuning, default_profile_changes_nothing)
+{
+    ethernet_socket socket;
+    ASSERT_TRUE(
+        socket.initialize(make_address("127.0.0.1"), 1, kommpot::ethernet_protocol_type::TCP));
+    EXPECT_TRUE(socket.set_profile(kommpot::ethernet_socket_profile::DEFAULT));
+
+    EXPECT_EQ(get_option(socket, IPPROTO_TCP, TCP_NODELAY), 0);
+    EXPECT_EQ(get_option(socket, IPPROTO_IP, IP_TOS), 0);
+}
+#endif
+
+/*******************************************************************************
+ *
+ * ethernet_socket — loopback round trip benchmark per profile.
+ *
+ *******************************************************************************/
+TEST(ethernet_socket_tuning, loopback_round_trip_per_profile)
+{
+    static constexpr size_t ROUND_TRIPS = 500;
+
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    for (const auto profile :
+        {kommpot::ethernet_socket_profile::DEFAULT, kommpot::ethernet_socket_profile::LOW_LATENCY,
+            kommpot::ethernet_socket_profile::BULK_THROUGHPUT})
+    {
+        ethernet_socket socket;
+        ASSERT_TRUE(socket.initialize(
+            make_address("127.0.0.1"), server.port(), kommpot::ethernet_protocol_type::TCP));
+        ASSERT_TRUE(socket.set_timeout(1000));
+        (void)socket.set_profile(profile);
+        ASSERT_TRUE(socket.connect());
+
+        std::string request = "MEAS:VOLT:DC?\n";
+        std::string response(request.size(), '\0');
+
+        std::vector<int64_t> round_trips_usecs;
+        round_trips_usecs.reserve(ROUND_TRIPS);
+
+        for (size_t i = 0; i < ROUND_TRIPS; i++)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            ASSERT_TRUE(socket.write(request.data(), request.size()));
+            ASSERT_TRUE(socket.read(response.data(), response.size()));
+            round_trips_usecs.push_back(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start)
+                                            .count());
+        }
+
+        EXPECT_EQ(response, request);
+
+        std::sort(std::begin(round_trips_usecs), std::end(round_trips_usecs));
+        const auto median = round_trips_usecs[ROUND_TRIPS / 2];
+        const auto p99 = round_trips_usecs[ROUND_TRIPS * 99 / 100];
+
+        const auto name = kommpot::ethernet_socket_profile_to_string(profile);
+        RecordProperty(name + "_median_usecs", std::to_string(median));
+        RecordProperty(name + "_p99_usecs", std::to_string(p99));
+        std::printf("[ PROFILE  ] %-16s median %5lld us, p99 %5lld us\n", name.c_str(),
+            static_cast<long long>(median), static_cast<long long>(p99));
+    }
+}
+
+// NOLINTEND
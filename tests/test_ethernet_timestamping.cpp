@@ -0,0 +1,545 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/communication_ethernet.h>
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_socket.h>
+
+#include "loopback_tcp_server.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#    include <arpa/inet.h>
+#    include <netinet/in.h>
+#    include <sys/socket.h>
+#    include <unistd.h>
+#endif
+
+using namespace testing;
+
+#ifdef __linux__
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+static std::shared_ptr<ethernet_ip_address> make_address(const std::string &value)
+{
+    auto addr = ethernet_address_factory::from_string(value);
+
+    EXPECT_TRUE(addr.has_value());
+
+    if (!addr.has_value())
+    {
+        return nullptr;
+    }
+
+    return *addr;
+}
+
+/**
+ * @brief wall clock in nanoseconds, software timestamps of the OS use the same clock.
+ */
+static auto realtime_nsecs() -> uint64_t
+{
+    timespec now = {};
+    clock_gettime(CLOCK_REALTIME, &now);
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<uint64_t>(now.tv_nsec);
+}
+
+static void connect_socket(ethernet_socket &socket, const uint16_t port,
+    const kommpot::ethernet_protocol_type protocol = kommpot::ethernet_protocol_type::TCP)
+{
+    ASSERT_TRUE(socket.initialize(make_address("127.0.0.1"), port, protocol));
+    ASSERT_TRUE(socket.set_timeout(2000));
+    ASSERT_TRUE(socket.connect());
+}
+
+/**
+ * @brief receives until the peer closes and discards everything.
+ */
+static void discard(loopback_tcp_server::handle_type handle)
+{
+    std::vector<uint8_t> buffer(256 * 1024);
+    while (recv(handle, buffer.data(), buffer.size(), 0) > 0)
+    {}
+}
+
+/**
+ * @brief UDP socket on 127.0.0.1 echoing every datagram back to its sender until stopped.
+ */
+class udp_echo
+{
+public:
+    udp_echo()
+    {
+        m_handle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(m_handle, (const sockaddr *)&address, sizeof(address));
+
+        timeval timeout = {};
+        timeout.tv_usec = 50 * 1000;
+        setsockopt(m_handle, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+        m_thread = std::thread([this]() {
+            uint8_t buffer[2048];
+            while (m_is_running)
+            {
+                sockaddr_in sender = {};
+                socklen_t sender_size_bytes = sizeof(sender);
+                const auto result = recvfrom(m_handle, buffer, sizeof(buffer), 0,
+                    (sockaddr *)&sender, &sender_size_bytes);
+                if (result > 0)
+                {
+                    sendto(m_handle, buffer, static_cast<size_t>(result), 0,
+                        (const sockaddr *)&sender, sender_size_bytes);
+                }
+            }
+        });
+    }
+
+    ~udp_echo()
+    {
+        m_is_running = false;
+        m_thread.join();
+        close(m_handle);
+    }
+
+    udp_echo(const udp_echo &obj) = delete;
+    auto operator=(const udp_echo &obj) -> udp_echo & = delete;
+
+    auto port() const -> uint16_t
+    {
+        sockaddr_in address = {};
+        socklen_t address_size_bytes = sizeof(address);
+        getsockname(m_handle, (sockaddr *)&address, &address_size_bytes);
+        return ntohs(address.sin_port);
+    }
+
+private:
+    int m_handle = -1;
+    std::atomic_bool m_is_running = true;
+    std::thread m_thread;
+};
+
+/*******************************************************************************
+ *
+ * ethernet_socket — transmit timestamps.
+ *
+ *******************************************************************************/
+TEST(ethernet_timestamping, write_reports_software_timestamp)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(discard));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+    ASSERT_TRUE(socket.set_timestamping(true, false));
+
+    std::vector<uint8_t> data(1024, 0x5A);
+    kommpot::transfer_timestamps timestamps;
+
+    const auto before_nsecs = realtime_nsecs();
+    ASSERT_TRUE(socket.write_timestamped(data.data(), data.size(), timestamps, 2000));
+    const auto after_nsecs = realtime_nsecs();
+
+    ASSERT_TRUE(timestamps.software_nsecs.has_value());
+    EXPECT_GE(*timestamps.software_nsecs, before_nsecs);
+    EXPECT_LE(*timestamps.software_nsecs, after_nsecs);
+    EXPECT_FALSE(timestamps.hardware_nsecs.has_value());
+
+    EXPECT_TRUE(socket.disconnect());
+}
+
+TEST(ethernet_timestamping, consecutive_writes_report_own_timestamps)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(discard));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+    ASSERT_TRUE(socket.set_timestamping(true, false));
+
+    std::vector<uint8_t> data(512, 0x11);
+    uint64_t previous_nsecs = 0;
+    for (size_t index = 0; index < 32; ++index)
+    {
+        const auto before_nsecs = realtime_nsecs();
+        kommpot::transfer_timestamps timestamps;
+        ASSERT_TRUE(socket.write_timestamped(data.data(), data.size(), timestamps, 2000));
+
+        ASSERT_TRUE(timestamps.software_nsecs.has_value());
+        EXPECT_GE(*timestamps.software_nsecs, before_nsecs);
+        EXPECT_GT(*timestamps.software_nsecs, previous_nsecs);
+        previous_nsecs = *timestamps.software_nsecs;
+    }
+
+    EXPECT_TRUE(socket.disconnect());
+}
+
+TEST(ethernet_timestamping, large_write_reports_timestamp_of_last_byte)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(discard));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+    ASSERT_TRUE(socket.set_timestamping(true, false));
+
+    std::vector<uint8_t> data(16 * 1024 * 1024, 0x3C);
+    kommpot::transfer_timestamps timestamps;
+
+    const auto before_nsecs = realtime_nsecs();
+    ASSERT_TRUE(socket.write_timestamped(data.data(), data.size(), timestamps, 2000));
+    const auto after_nsecs = realtime_nsecs();
+
+    ASSERT_TRUE(timestamps.software_nsecs.has_value());
+    EXPECT_GE(*timestamps.software_nsecs, before_nsecs);
+    EXPECT_LE(*timestamps.software_nsecs, after_nsecs);
+
+    EXPECT_TRUE(socket.disconnect());
+}
+
+TEST(ethernet_timestamping, write_after_plain_writes_reports_timestamp_in_time)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(discard));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+    ASSERT_TRUE(socket.set_timestamping(true, false));
+
+    std::vector<uint8_t> data(4096, 0x66);
+    for (size_t index = 0; index < 8; ++index)
+    {
+        ASSERT_TRUE(socket.write(data.data(), data.size()));
+
+        kommpot::transfer_timestamps timestamps;
+        const auto start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(socket.write_timestamped(data.data(), data.size(), timestamps, 2000));
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        EXPECT_TRUE(timestamps.software_nsecs.has_value());
+        EXPECT_LT(elapsed, std::chrono::milliseconds(1000));
+    }
+
+    EXPECT_TRUE(socket.disconnect());
+}
+
+TEST(ethernet_timestamping, disabled_socket_reports_no_timestamps)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+
+    std::vector<uint8_t> data(64, 0x42);
+    kommpot::transfer_timestamps timestamps;
+    ASSERT_TRUE(socket.write_timestamped(data.data(), data.size(), timestamps, 2000));
+    EXPECT_FALSE(timestamps.software_nsecs.has_value());
+    EXPECT_FALSE(timestamps.hardware_nsecs.has_value());
+
+    std::vector<uint8_t> received(data.size());
+    size_t received_size_bytes = 0;
+    ASSERT_TRUE(socket.read_timestamped(
+        received.data(), received.size(), received_size_bytes, timestamps, 2000));
+    EXPECT_GT(received_size_bytes, 0u);
+    EXPECT_FALSE(timestamps.software_nsecs.has_value());
+
+    EXPECT_TRUE(socket.disconnect());
+}
+
+TEST(ethernet_timestamping, hardware_request_falls_back_to_software)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(discard));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+
+    /**
+     * @attention loopback has no hardware clock, so the write must not wait for hardware
+     * timestamps that never come.
+     */
+    ASSERT_TRUE(socket.set_timestamping(true, true));
+    EXPECT_FALSE(socket.is_hardware_timestamping_enabled());
+
+    std::vector<uint8_t> data(256, 0x24);
+    kommpot::transfer_timestamps timestamps;
+
+    const auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(socket.write_timestamped(data.data(), data.size(), timestamps, 2000));
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_TRUE(timestamps.software_nsecs.has_value());
+    EXPECT_FALSE(timestamps.hardware_nsecs.has_value());
+    EXPECT_LT(elapsed, std::chrono::milliseconds(500));
+
+    EXPECT_TRUE(socket.disconnect());
+}
+
+TEST(ethernet_timestamping, zero_copy_completions_survive_timestamped_writes)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(discard));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+    ASSERT_TRUE(socket.set_timestamping(true, false));
+    if (!socket.set_zero_copy(true))
+    {
+        GTEST_SKIP() << "zero-copy send is not supported";
+    }
+
+    std::vector<uint8_t> zero_copy_data(1024 * 1024, 0x77);
+    std::atomic_bool is_completed = false;
+    ASSERT_TRUE(socket.write_zero_copy(zero_copy_data.data(), zero_copy_data.size(),
+        [&is_completed]() { is_completed = true; }));
+
+    std::vector<uint8_t> data(256, 0x78);
+    kommpot::transfer_timestamps timestamps;
+    ASSERT_TRUE(socket.write_timestamped(data.data(), data.size(), timestamps, 2000));
+    EXPECT_TRUE(timestamps.software_nsecs.has_value());
+
+    ASSERT_TRUE(socket.flush_zero_copy(2000));
+    EXPECT_TRUE(is_completed);
+
+    EXPECT_TRUE(socket.disconnect());
+}
+
+/*******************************************************************************
+ *
+ * ethernet_socket — receive timestamps.
+ *
+ *******************************************************************************/
+TEST(ethernet_timestamping, read_reports_software_timestamp)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+    ASSERT_TRUE(socket.set_timestamping(true, false));
+
+    std::vector<uint8_t> data(128, 0x61);
+    kommpot::transfer_timestamps write_timestamps;
+    ASSERT_TRUE(socket.write_timestamped(data.data(), data.size(), write_timestamps, 2000));
+
+    std::vector<uint8_t> received(data.size());
+    size_t received_size_bytes = 0;
+    kommpot::transfer_timestamps read_timestamps;
+    ASSERT_TRUE(socket.read_timestamped(
+        received.data(), received.size(), received_size_bytes, read_timestamps, 2000));
+    const auto after_nsecs = realtime_nsecs();
+
+    EXPECT_GT(received_size_bytes, 0u);
+    EXPECT_TRUE(std::equal(received.begin(), received.begin() + received_size_bytes, data.begin()));
+
+    ASSERT_TRUE(write_timestamps.software_nsecs.has_value());
+    ASSERT_TRUE(read_timestamps.software_nsecs.has_value());
+    EXPECT_GE(*read_timestamps.software_nsecs, *write_timestamps.software_nsecs);
+    EXPECT_LE(*read_timestamps.software_nsecs, after_nsecs);
+
+    EXPECT_TRUE(socket.disconnect());
+}
+
+TEST(ethernet_timestamping, udp_round_trip_is_ordered)
+{
+    udp_echo echo;
+
+    ethernet_socket socket;
+    connect_socket(socket, echo.port(), kommpot::ethernet_protocol_type::UDP);
+    ASSERT_TRUE(socket.set_timestamping(true, false));
+
+    for (size_t index = 0; index < 8; ++index)
+    {
+        std::vector<uint8_t> data(200, static_cast<uint8_t>(index));
+        kommpot::transfer_timestamps write_timestamps;
+        ASSERT_TRUE(socket.write_timestamped(data.data(), data.size(), write_timestamps, 2000));
+
+        std::vector<uint8_t> received(2048);
+        size_t received_size_bytes = 0;
+        kommpot::transfer_timestamps read_timestamps;
+        ASSERT_TRUE(socket.read_timestamped(
+            received.data(), received.size(), received_size_bytes, read_timestamps, 2000));
+
+        EXPECT_EQ(received_size_bytes, data.size());
+        ASSERT_TRUE(write_timestamps.software_nsecs.has_value());
+        ASSERT_TRUE(read_timestamps.software_nsecs.has_value());
+        EXPECT_LT(*write_timestamps.software_nsecs, *read_timestamps.software_nsecs);
+    }
+
+    EXPECT_TRUE(socket.disconnect());
+}
+
+TEST(ethernet_timestamping, read_times_out_without_data)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(discard));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+    ASSERT_TRUE(socket.set_timestamping(true, false));
+
+    std::vector<uint8_t> received(64);
+    size_t received_size_bytes = 0;
+    kommpot::transfer_timestamps timestamps;
+    EXPECT_FALSE(socket.read_timestamped(
+        received.data(), received.size(), received_size_bytes, timestamps, 20));
+    EXPECT_EQ(received_size_bytes, 0u);
+    EXPECT_FALSE(timestamps.software_nsecs.has_value());
+
+    EXPECT_TRUE(socket.disconnect());
+}
+
+/*******************************************************************************
+ *
+ * communication_ethernet — timestamped transfers.
+ *
+ *******************************************************************************/
+TEST(ethernet_timestamping, device_reports_timestamps_if_configured)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    kommpot::ethernet_device_identification identification;
+    identification.ip = "127.0.0.1";
+    identification.port = server.port();
+    identification.protocol = kommpot::ethernet_protocol_type::TCP;
+
+    kommpot::communication_configuration configuration;
+    configuration.is_timestamping_enabled = true;
+
+    communication_ethernet device(identification);
+    device.set_configuration(configuration);
+    ASSERT_TRUE(device.open());
+
+    std::vector<uint8_t> data(100, 0x33);
+    kommpot::transfer_result write_result;
+    ASSERT_TRUE(device.write_timestamped({}, data.data(), data.size(), write_result));
+    EXPECT_EQ(write_result.size_bytes, data.size());
+    ASSERT_TRUE(write_result.timestamps.software_nsecs.has_value());
+
+    std::vector<uint8_t> received(data.size());
+    kommpot::transfer_result read_result;
+    ASSERT_TRUE(device.read_timestamped({}, received.data(), received.size(), read_result));
+    EXPECT_GT(read_result.size_bytes, 0u);
+    ASSERT_TRUE(read_result.timestamps.software_nsecs.has_value());
+    EXPECT_GE(*read_result.timestamps.software_nsecs, *write_result.timestamps.software_nsecs);
+
+    device.close();
+}
+
+TEST(ethernet_timestamping, device_without_configuration_reports_none)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    kommpot::ethernet_device_identification identification;
+    identification.ip = "127.0.0.1";
+    identification.port = server.port();
+    identification.protocol = kommpot::ethernet_protocol_type::TCP;
+
+    communication_ethernet device(identification);
+    ASSERT_TRUE(device.open());
+
+    std::vector<uint8_t> data(100, 0x34);
+    kommpot::transfer_result write_result;
+    ASSERT_TRUE(device.write_timestamped({}, data.data(), data.size(), write_result));
+    EXPECT_EQ(write_result.size_bytes, data.size());
+    EXPECT_FALSE(write_result.timestamps.software_nsecs.has_value());
+
+    std::vector<uint8_t> received(data.size());
+    kommpot::transfer_result read_result;
+    ASSERT_TRUE(device.read_timestamped({}, received.data(), received.size(), read_result));
+    EXPECT_GT(read_result.size_bytes, 0u);
+    EXPECT_FALSE(read_result.timestamps.software_nsecs.has_value());
+
+    device.close();
+}
+
+/*******************************************************************************
+ *
+ * ethernet_timestamping — one-way latency on loopback as seen by the OS.
+ *
+ *******************************************************************************/
+TEST(ethernet_timestamping, benchmark_one_way_latency)
+{
+    constexpr size_t M_ROUND_TRIP_COUNT = 2000;
+
+    udp_echo echo;
+
+    ethernet_socket socket;
+    connect_socket(socket, echo.port(), kommpot::ethernet_protocol_type::UDP);
+    ASSERT_TRUE(socket.set_timestamping(true, false));
+
+    std::vector<uint64_t> stack_nsecs;
+    std::vector<uint64_t> application_nsecs;
+    stack_nsecs.reserve(M_ROUND_TRIP_COUNT);
+    application_nsecs.reserve(M_ROUND_TRIP_COUNT);
+
+    std::vector<uint8_t> data(64, 0x55);
+    std::vector<uint8_t> received(2048);
+    for (size_t index = 0; index < M_ROUND_TRIP_COUNT; ++index)
+    {
+        const auto before_nsecs = realtime_nsecs();
+        kommpot::transfer_timestamps write_timestamps;
+        ASSERT_TRUE(socket.write_timestamped(data.data(), data.size(), write_timestamps, 2000));
+
+        size_t received_size_bytes = 0;
+        kommpot::transfer_timestamps read_timestamps;
+        ASSERT_TRUE(socket.read_timestamped(
+            received.data(), received.size(), received_size_bytes, read_timestamps, 2000));
+        const auto after_nsecs = realtime_nsecs();
+
+        if (write_timestamps.software_nsecs && read_timestamps.software_nsecs)
+        {
+            stack_nsecs.push_back(
+                (*read_timestamps.software_nsecs - *write_timestamps.software_nsecs) / 2);
+        }
+        application_nsecs.push_back((after_nsecs - before_nsecs) / 2);
+    }
+
+    ASSERT_EQ(stack_nsecs.size(), M_ROUND_TRIP_COUNT);
+
+    std::sort(stack_nsecs.begin(), stack_nsecs.end());
+    std::sort(application_nsecs.begin(), application_nsecs.end());
+
+    for (const auto &[name, values] :
+        {std::pair<const char *, const std::vector<uint64_t> &>{"STACK", stack_nsecs},
+            std::pair<const char *, const std::vector<uint64_t> &>{"APP", application_nsecs}})
+    {
+        const auto median_nsecs = values[values.size() / 2];
+        const auto p99_nsecs = values[values.size() * 99 / 100];
+
+        printf("[ %-8s ] one-way median %.1f us, p99 %.1f us\n", name,
+            static_cast<double>(median_nsecs) / 1000.0, static_cast<double>(p99_nsecs) / 1000.0);
+        RecordProperty(std::string(name) + "_one_way_median_nsecs", static_cast<int>(median_nsecs));
+    }
+
+    EXPECT_TRUE(socket.disconnect());
+}
+
+#endif
+
+// NOLINTEND
@@ -0,0 +1,81 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_tools.h>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * ethernet_tools — default gateways of the route tables.
+ *
+ *******************************************************************************/
+
+/**
+ * @attention /proc/net/route prints addresses as host integers, the tables below are the ones of
+ * a little-endian host.
+ */
+TEST(ethernet_tools, parses_ipv4_default_gateway)
+{
+    std::istringstream table(
+        "Iface\tDestination\tGateway \tFlags\tRefCnt\tUse\tMetric\tMask\t\tMTU\tWindow\tIRTT\n"
+        "eth0\t00000000\t010200C0\t0003\t0\t0\t100\t00000000\t0\t0\t0\n"
+        "eth0\t000200C0\t00000000\t0001\t0\t0\t100\t00FFFFFF\t0\t0\t0\n"
+        "eth1\t0000A8C0\t00000000\t0001\t0\t0\t0\t00FFFFFF\t0\t0\t0\n");
+
+    const auto gateways = ethernet_tools::parse_default_gateways(table, false);
+
+    ASSERT_EQ(gateways.size(), 1u);
+    EXPECT_EQ(gateways.at("eth0"), "192.0.2.1");
+}
+
+TEST(ethernet_tools, lowest_metric_gateway_wins)
+{
+    std::istringstream table(
+        "Iface\tDestination\tGateway \tFlags\tRefCnt\tUse\tMetric\tMask\t\tMTU\tWindow\tIRTT\n"
+        "eth0\t00000000\t010200C0\t0003\t0\t0\t600\t00000000\t0\t0\t0\n"
+        "eth0\t00000000\t020200C0\t0003\t0\t0\t100\t00000000\t0\t0\t0\n");
+
+    const auto gateways = ethernet_tools::parse_default_gateways(table, false);
+
+    ASSERT_EQ(gateways.count("eth0"), 1u);
+    EXPECT_EQ(gateways.at("eth0"), "192.0.2.2");
+}
+
+TEST(ethernet_tools, parses_ipv6_default_gateway)
+{
+    std::istringstream table(
+        "fd000000000000000000000000000000 40 00000000000000000000000000000000 00 "
+        "00000000000000000000000000000000 00000100 00000001 00000000 00000001     eth0\n"
+        "00000000000000000000000000000000 00 00000000000000000000000000000000 00 "
+        "fd000000000000000000000000000001 00000400 00000001 00000000 00000003     eth0\n"
+        "00000000000000000000000000000001 80 00000000000000000000000000000000 00 "
+        "00000000000000000000000000000000 00000000 00000003 00000000 80200001       lo\n");
+
+    const auto gateways = ethernet_tools::parse_default_gateways(table, true);
+
+    ASSERT_EQ(gateways.size(), 1u);
+
+    auto gateway = ethernet_address_factory::from_string(gateways.at("eth0"));
+    auto expected = ethernet_address_factory::from_string("fd00::1");
+    ASSERT_TRUE(gateway.has_value());
+    ASSERT_TRUE(expected.has_value());
+    EXPECT_EQ((*gateway)->to_string(), (*expected)->to_string());
+}
+
+TEST(ethernet_tools, table_without_default_route_has_no_gateway)
+{
+    std::istringstream table(
+        "Iface\tDestination\tGateway \tFlags\tRefCnt\tUse\tMetric\tMask\t\tMTU\tWindow\tIRTT\n"
+        "eth0\t000200C0\t00000000\t0001\t0\t0\t0\t00FFFFFF\t0\t0\t0\n");
+
+    EXPECT_TRUE(ethernet_tools::parse_default_gateways(table, false).empty());
+}
+
+// NOLINTEND
@@ -0,0 +1,448 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/communication_ethernet.h>
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_socket.h>
+#include <communications/ethernet/ethernet_uring.h>
+
+#include "loopback_tcp_server.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#endif
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+static std::shared_ptr<ethernet_ip_address> make_address(const std::string &value)
+{
+    auto addr = ethernet_address_factory::from_string(value);
+
+    EXPECT_TRUE(addr.has_value());
+
+    if (!addr.has_value())
+    {
+        return nullptr;
+    }
+
+    return *addr;
+}
+
+static sockaddr_in make_loopback(const uint16_t port)
+{
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    return address;
+}
+
+static void connect_socket(ethernet_socket &socket, const uint16_t port, const bool is_io_uring)
+{
+    ASSERT_TRUE(socket.initialize(
+        make_address("127.0.0.1"), port, kommpot::ethernet_protocol_type::TCP));
+    ASSERT_TRUE(socket.set_timeout(1000));
+    ASSERT_EQ(socket.set_io_uring(is_io_uring), !is_io_uring || ethernet_uring::is_supported());
+    ASSERT_TRUE(socket.connect());
+}
+
+/**
+ * @brief keeps the connection open without ever answering.
+ */
+static void silent(loopback_tcp_server::handle_type handle)
+{
+    char byte = 0;
+    loopback_tcp_server::receive_all(handle, &byte, 1);
+}
+
+/**
+ * @brief counts system calls entered by the calling thread, needs tracefs and perf permissions.
+ */
+class syscall_counter
+{
+public:
+    syscall_counter()
+    {
+#ifdef __linux__
+        std::ifstream id_file("/sys/kernel/tracing/events/raw_syscalls/sys_enter/id");
+        uint64_t id = 0;
+        if (!(id_file >> id))
+        {
+            return;
+        }
+
+        perf_event_attr attributes = {};
+        attributes.type = PERF_TYPE_TRACEPOINT;
+        attributes.size = sizeof(attributes);
+        attributes.config = id;
+        attributes.disabled = 1;
+        m_handle = static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+#endif
+    }
+
+    ~syscall_counter()
+    {
+#ifdef __linux__
+        if (m_handle >= 0)
+        {
+            close(m_handle);
+        }
+#endif
+    }
+
+    auto is_available() const -> bool
+    {
+        return m_handle >= 0;
+    }
+
+    auto start() -> void
+    {
+#ifdef __linux__
+        ioctl(m_handle, PERF_EVENT_IOC_RESET, 0);
+        ioctl(m_handle, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+
+    auto stop() -> uint64_t
+    {
+        uint64_t count = 0;
+#ifdef __linux__
+        ioctl(m_handle, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(m_handle, &count, sizeof(count)) != sizeof(count))
+        {
+            return 0;
+        }
+#endif
+        return count;
+    }
+
+private:
+    int m_handle = -1;
+};
+
+/*******************************************************************************
+ *
+ * ethernet_uring — ring.
+ *
+ *******************************************************************************/
+TEST(ethernet_uring, thread_instance_matches_support)
+{
+    EXPECT_EQ(ethernet_uring::thread_instance() != nullptr, ethernet_uring::is_supported());
+    EXPECT_EQ(ethernet_uring::thread_instance(), ethernet_uring::thread_instance());
+}
+
+TEST(ethernet_uring, batch_larger_than_ring_is_split)
+{
+    auto ring = ethernet_uring::create(4);
+    if (ring == nullptr)
+    {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(silent));
+    const auto address = make_loopback(server.port());
+
+    std::vector<loopback_tcp_server::handle_type> handles(10);
+    std::vector<ethernet_uring::operation> operations(handles.size());
+    for (size_t index = 0; index < handles.size(); ++index)
+    {
+        handles[index] = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        ASSERT_NE(handles[index], loopback_tcp_server::M_INVALID_HANDLE);
+
+        operations[index].type = ethernet_uring::operation_type::CONNECT;
+        operations[index].handle = static_cast<int>(handles[index]);
+        operations[index].data = const_cast<sockaddr_in *>(&address);
+        operations[index].size_bytes = sizeof(address);
+        operations[index].timeout_msecs = 1000;
+    }
+
+    ASSERT_TRUE(ring->execute(operations));
+
+    for (const auto &operation : operations)
+    {
+        EXPECT_EQ(operation.result, 0);
+        EXPECT_FALSE(operation.is_timed_out);
+    }
+
+    /**
+     * @attention a ring of 4 entries holds 2 operations with their timeouts.
+     */
+    EXPECT_GE(ring->enter_count(), 5u);
+
+    for (auto &handle : handles)
+    {
+        loopback_tcp_server::close_handle(handle);
+    }
+}
+
+TEST(ethernet_uring, receive_times_out)
+{
+    auto ring = ethernet_uring::create();
+    if (ring == nullptr)
+    {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(silent));
+    const auto address = make_loopback(server.port());
+
+    auto handle = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    ASSERT_EQ(connect(handle, (const sockaddr *)&address, sizeof(address)), 0);
+
+    char buffer[16] = {};
+    std::vector<ethernet_uring::operation> operations(1);
+    operations[0].type = ethernet_uring::operation_type::RECEIVE;
+    operations[0].handle = static_cast<int>(handle);
+    operations[0].data = buffer;
+    operations[0].size_bytes = sizeof(buffer);
+    operations[0].timeout_msecs = 50;
+
+    const auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(ring->execute(operations));
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_TRUE(operations[0].is_timed_out);
+    EXPECT_EQ(operations[0].result, -ECANCELED);
+    EXPECT_GE(elapsed, std::chrono::milliseconds(40));
+
+    loopback_tcp_server::close_handle(handle);
+}
+
+/*******************************************************************************
+ *
+ * ethernet_socket — io_uring transfers.
+ *
+ *******************************************************************************/
+TEST(ethernet_uring, socket_write_read_and_read_some)
+{
+    if (!ethernet_uring::is_supported())
+    {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port(), true);
+    EXPECT_TRUE(socket.is_io_uring_enabled());
+    ASSERT_TRUE(socket.connect_rtt_usecs().has_value());
+
+    std::string request = "*IDN?\n";
+    ASSERT_TRUE(socket.write(request.data(), request.size()));
+
+    std::string response(request.size(), '\0');
+    ASSERT_TRUE(socket.read(response.data(), response.size()));
+    EXPECT_EQ(response, request);
+
+    ASSERT_TRUE(socket.write(request.data(), request.size()));
+
+    std::string partial(64, '\0');
+    size_t received_size_bytes = 0;
+    size_t total_size_bytes = 0;
+    while (total_size_bytes < request.size() &&
+           socket.read_some(partial.data() + total_size_bytes,
+               partial.size() - total_size_bytes, received_size_bytes, 1000))
+    {
+        total_size_bytes += received_size_bytes;
+    }
+    EXPECT_EQ(partial.substr(0, total_size_bytes), request);
+
+    /**
+     * @attention nothing is pending, a zero timeout returns at once.
+     */
+    EXPECT_FALSE(socket.read_some(partial.data(), partial.size(), received_size_bytes, 0));
+
+    EXPECT_TRUE(socket.disconnect());
+}
+
+TEST(ethernet_uring, socket_read_times_out)
+{
+    if (!ethernet_uring::is_supported())
+    {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(silent));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port(), true);
+    ASSERT_TRUE(socket.set_timeout(50));
+
+    char buffer[4] = {};
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(socket.read(buffer, sizeof(buffer)));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(40));
+
+    size_t received_size_bytes = 0;
+    EXPECT_FALSE(socket.read_some(buffer, sizeof(buffer), received_size_bytes, 50));
+}
+
+TEST(ethernet_uring, connect_all_reports_each_socket)
+{
+    loopback_tcp_server open_server;
+    loopback_tcp_server closed_server;
+    ASSERT_TRUE(open_server.start(loopback_tcp_server::echo));
+    ASSERT_TRUE(closed_server.start(loopback_tcp_server::echo));
+    const auto closed_port = closed_server.port();
+    closed_server.stop();
+
+    std::vector<std::unique_ptr<ethernet_socket>> sockets;
+    std::vector<ethernet_socket *> pointers;
+    for (const auto port : {open_server.port(), closed_port, open_server.port()})
+    {
+        auto socket = std::make_unique<ethernet_socket>();
+        ASSERT_TRUE(socket->initialize(
+            make_address("127.0.0.1"), port, kommpot::ethernet_protocol_type::TCP));
+        ASSERT_TRUE(socket->set_timeout(500));
+        static_cast<void>(socket->set_io_uring(true));
+        pointers.push_back(socket.get());
+        sockets.push_back(std::move(socket));
+    }
+
+    const auto results = ethernet_socket::connect_all(pointers);
+
+    EXPECT_EQ(results, (std::vector<bool>{true, false, true}));
+    EXPECT_TRUE(sockets[0]->is_connected());
+    EXPECT_FALSE(sockets[1]->is_connected());
+
+    /**
+     * @attention a refused connection is an answer of the peer, its duration is an RTT sample.
+     */
+    EXPECT_TRUE(sockets[1]->connect_rtt_usecs().has_value());
+}
+
+TEST(ethernet_uring, devices_reports_every_responding_port)
+{
+    loopback_tcp_server first;
+    loopback_tcp_server second;
+    loopback_tcp_server closed;
+    ASSERT_TRUE(first.start(loopback_tcp_server::echo));
+    ASSERT_TRUE(second.start(loopback_tcp_server::echo));
+    ASSERT_TRUE(closed.start(loopback_tcp_server::echo));
+
+    const auto closed_port = closed.port();
+    closed.stop();
+
+    kommpot::ethernet_device_identification identification;
+    identification.ip = "127.0.0.1";
+    identification.port = first.port();
+    identification.ports = {closed_port, second.port()};
+    identification.scan.is_io_uring_enabled = true;
+
+    const auto devices = communication_ethernet::devices({identification});
+    if (devices.empty())
+    {
+        GTEST_SKIP() << "no Ethernet interface available";
+    }
+
+    std::vector<uint16_t> ports;
+    for (const auto &device : devices)
+    {
+        ports.push_back(
+            std::get<kommpot::ethernet_device_identification>(device->identification()).port);
+    }
+    std::sort(ports.begin(), ports.end());
+
+    std::vector<uint16_t> expected = {first.port(), second.port()};
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(ports, expected);
+}
+
+/*******************************************************************************
+ *
+ * ethernet_uring — syscalls and latency per transfer on loopback.
+ *
+ *******************************************************************************/
+TEST(ethernet_uring, benchmark_round_trip)
+{
+    if (!ethernet_uring::is_supported())
+    {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+
+    constexpr size_t M_ROUND_TRIPS = 5000;
+
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    syscall_counter counter;
+
+    for (const bool is_io_uring : {false, true})
+    {
+        ethernet_socket socket;
+        connect_socket(socket, server.port(), is_io_uring);
+
+        std::string request(64, 'x');
+        std::string response(request.size(), '\0');
+
+        const auto start = std::chrono::steady_clock::now();
+        if (counter.is_available())
+        {
+            counter.start();
+        }
+
+        for (size_t round_trip = 0; round_trip < M_ROUND_TRIPS; ++round_trip)
+        {
+            ASSERT_TRUE(socket.write(request.data(), request.size()));
+
+            size_t total_size_bytes = 0;
+            size_t received_size_bytes = 0;
+            while (total_size_bytes < response.size())
+            {
+                ASSERT_TRUE(socket.read_some(response.data() + total_size_bytes,
+                    response.size() - total_size_bytes, received_size_bytes, 1000));
+                total_size_bytes += received_size_bytes;
+            }
+        }
+
+        const auto syscalls = counter.is_available() ? counter.stop() : 0;
+        const auto elapsed_usecs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start)
+                                       .count();
+
+        const auto usecs_per_round_trip = static_cast<double>(elapsed_usecs) / M_ROUND_TRIPS;
+        const auto syscalls_per_round_trip = static_cast<double>(syscalls) / M_ROUND_TRIPS;
+        const char *name = is_io_uring ? "io_uring" : "plain";
+
+        if (counter.is_available())
+        {
+            printf("[ %-8s ] %.2f us, %.2f syscalls per round trip\n", name, usecs_per_round_trip,
+                syscalls_per_round_trip);
+            RecordProperty(std::string(name) + "_syscalls_per_round_trip_x100",
+                static_cast<int>(syscalls_per_round_trip * 100));
+        }
+        else
+        {
+            printf("[ %-8s ] %.2f us per round trip\n", name, usecs_per_round_trip);
+        }
+        RecordProperty(std::string(name) + "_nsecs_per_round_trip",
+            static_cast<int>(usecs_per_round_trip * 1000));
+    }
+}
+
+// NOLINTEND
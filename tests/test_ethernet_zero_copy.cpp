@@ -0,0 +1,667 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/communication_ethernet.h>
+#include <communications/ethernet/ethernet_address_factory.h>
+#include <communications/ethernet/ethernet_receive_region.h>
+#include <communications/ethernet/ethernet_socket.h>
+
+#include "loopback_tcp_server.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+static std::shared_ptr<ethernet_ip_address> make_address(const std::string &value)
+{
+    auto addr = ethernet_address_factory::from_string(value);
+
+    EXPECT_TRUE(addr.has_value());
+
+    if (!addr.has_value())
+    {
+        return nullptr;
+    }
+
+    return *addr;
+}
+
+static std::vector<uint8_t> make_pattern(const size_t size_bytes, const uint8_t seed)
+{
+    std::vector<uint8_t> data(size_bytes);
+    for (size_t index = 0; index < data.size(); ++index)
+    {
+        data[index] = static_cast<uint8_t>(index * 31 + seed);
+    }
+    return data;
+}
+
+static uint64_t fnv1a(const uint8_t *data, const size_t size_bytes, uint64_t hash)
+{
+    for (size_t index = 0; index < size_bytes; ++index)
+    {
+        hash = (hash ^ data[index]) * 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+static constexpr uint64_t M_FNV_OFFSET = 0xCBF29CE484222325ULL;
+
+/**
+ * @brief receives until the peer closes, counting and hashing every byte.
+ */
+struct drain_state
+{
+    std::atomic<uint64_t> size_bytes = 0;
+    std::atomic<uint64_t> hash = M_FNV_OFFSET;
+    std::atomic_bool is_closed = false;
+};
+
+static loopback_tcp_server::handler_type make_drain(drain_state &state)
+{
+    return [&state](loopback_tcp_server::handle_type handle) {
+        std::vector<uint8_t> buffer(256 * 1024);
+        uint64_t hash = M_FNV_OFFSET;
+        while (true)
+        {
+            const auto result = recv(handle, (char *)buffer.data(), (int)buffer.size(), 0);
+            if (result <= 0)
+            {
+                break;
+            }
+            hash = fnv1a(buffer.data(), static_cast<size_t>(result), hash);
+            state.size_bytes += static_cast<uint64_t>(result);
+            state.hash = hash;
+        }
+        state.is_closed = true;
+    };
+}
+
+static auto wait_for(const std::atomic_bool &flag) -> bool
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!flag && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return flag;
+}
+
+/**
+ * @brief sends size_bytes of a page-aligned 1 MiB pattern, with MSG_ZEROCOPY where supported, so
+ * the payload lands page-aligned in the receive queue on loopback.
+ */
+static const std::vector<uint8_t> &stream_pattern()
+{
+    static const auto pattern = make_pattern(1024 * 1024, 8);
+    return pattern;
+}
+
+static loopback_tcp_server::handler_type make_stream(const size_t size_bytes)
+{
+    return [size_bytes](loopback_tcp_server::handle_type handle) {
+        const auto &pattern = stream_pattern();
+        auto *buffer = static_cast<uint8_t *>(std::aligned_alloc(4096, pattern.size()));
+        std::memcpy(buffer, pattern.data(), pattern.size());
+
+        int flags = 0;
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+        const int value = 1;
+        if (setsockopt(handle, SOL_SOCKET, SO_ZEROCOPY, &value, sizeof(value)) == 0)
+        {
+            flags = MSG_ZEROCOPY;
+        }
+#endif
+
+        size_t sent_size_bytes = 0;
+        while (sent_size_bytes < size_bytes)
+        {
+            const auto offset = sent_size_bytes % pattern.size();
+            const auto chunk_size_bytes =
+                std::min(pattern.size() - offset, size_bytes - sent_size_bytes);
+            const auto result = send(handle, buffer + offset, chunk_size_bytes, flags);
+            if (result <= 0)
+            {
+                break;
+            }
+            sent_size_bytes += static_cast<size_t>(result);
+        }
+
+        /**
+         * @attention the pages stay referenced by the OS until received, so freeing is safe.
+         */
+        std::free(buffer);
+    };
+}
+
+static auto stream_hash(const size_t size_bytes) -> uint64_t
+{
+    const auto &pattern = stream_pattern();
+    uint64_t hash = M_FNV_OFFSET;
+    for (size_t offset = 0; offset < size_bytes; offset += pattern.size())
+    {
+        hash = fnv1a(pattern.data(), std::min(pattern.size(), size_bytes - offset), hash);
+    }
+    return hash;
+}
+
+static void connect_socket(ethernet_socket &socket, const uint16_t port)
+{
+    ASSERT_TRUE(socket.initialize(
+        make_address("127.0.0.1"), port, kommpot::ethernet_protocol_type::TCP));
+    ASSERT_TRUE(socket.set_timeout(2000));
+    ASSERT_TRUE(socket.connect());
+}
+
+/*******************************************************************************
+ *
+ * ethernet_socket — zero-copy writes.
+ *
+ *******************************************************************************/
+TEST(ethernet_zero_copy, disabled_socket_completes_right_away)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(loopback_tcp_server::echo));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+
+    auto data = make_pattern(64 * 1024, 1);
+    bool is_completed = false;
+    ASSERT_TRUE(socket.write_zero_copy(
+        data.data(), data.size(), [&is_completed]() { is_completed = true; }));
+
+    EXPECT_TRUE(is_completed);
+    EXPECT_EQ(socket.zero_copy_pending_count(), 0u);
+}
+
+TEST(ethernet_zero_copy, small_write_below_threshold_is_copied)
+{
+    drain_state state;
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(make_drain(state)));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+    if (!socket.set_zero_copy(true))
+    {
+        GTEST_SKIP() << "zero-copy send is not supported";
+    }
+    socket.set_zero_copy_threshold(16 * 1024);
+
+    auto data = make_pattern(1024, 2);
+    bool is_completed = false;
+    ASSERT_TRUE(socket.write_zero_copy(
+        data.data(), data.size(), [&is_completed]() { is_completed = true; }));
+
+    EXPECT_TRUE(is_completed);
+    EXPECT_EQ(socket.zero_copy_pending_count(), 0u);
+}
+
+TEST(ethernet_zero_copy, large_write_completes_with_intact_data)
+{
+    drain_state state;
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(make_drain(state)));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+    if (!socket.set_zero_copy(true))
+    {
+        GTEST_SKIP() << "zero-copy send is not supported";
+    }
+
+    auto data = make_pattern(4 * 1024 * 1024, 3);
+    std::atomic_bool is_completed = false;
+    ASSERT_TRUE(socket.write_zero_copy(
+        data.data(), data.size(), [&is_completed]() { is_completed = true; }));
+
+    ASSERT_TRUE(socket.flush_zero_copy(2000));
+    EXPECT_TRUE(is_completed);
+    EXPECT_EQ(socket.zero_copy_pending_count(), 0u);
+
+    EXPECT_TRUE(socket.disconnect());
+    ASSERT_TRUE(wait_for(state.is_closed));
+    EXPECT_EQ(state.size_bytes.load(), data.size());
+    EXPECT_EQ(state.hash.load(), fnv1a(data.data(), data.size(), M_FNV_OFFSET));
+}
+
+TEST(ethernet_zero_copy, callbacks_are_called_in_write_order)
+{
+    drain_state state;
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(make_drain(state)));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+    if (!socket.set_zero_copy(true))
+    {
+        GTEST_SKIP() << "zero-copy send is not supported";
+    }
+
+    std::vector<std::vector<uint8_t>> buffers;
+    for (uint8_t index = 0; index < 4; ++index)
+    {
+        buffers.push_back(make_pattern(256 * 1024, index));
+    }
+
+    std::vector<size_t> order;
+    for (size_t index = 0; index < buffers.size(); ++index)
+    {
+        ASSERT_TRUE(socket.write_zero_copy(buffers[index].data(), buffers[index].size(),
+            [&order, index]() { order.push_back(index); }));
+    }
+
+    ASSERT_TRUE(socket.flush_zero_copy(2000));
+    EXPECT_EQ(order, (std::vector<size_t>{0, 1, 2, 3}));
+}
+
+TEST(ethernet_zero_copy, copied_write_completes_after_pending_writes)
+{
+    drain_state state;
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(make_drain(state)));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+    if (!socket.set_zero_copy(true))
+    {
+        GTEST_SKIP() << "zero-copy send is not supported";
+    }
+    socket.set_zero_copy_threshold(16 * 1024);
+
+    auto large = make_pattern(1024 * 1024, 5);
+    auto small = make_pattern(1024, 6);
+    std::vector<size_t> order;
+    ASSERT_TRUE(socket.write_zero_copy(
+        large.data(), large.size(), [&order]() { order.push_back(0); }));
+    ASSERT_TRUE(socket.write_zero_copy(
+        small.data(), small.size(), [&order]() { order.push_back(1); }));
+
+    ASSERT_TRUE(socket.flush_zero_copy(2000));
+    EXPECT_EQ(order, (std::vector<size_t>{0, 1}));
+    EXPECT_EQ(socket.zero_copy_pending_count(), 0u);
+}
+
+TEST(ethernet_zero_copy, disconnect_calls_pending_callbacks)
+{
+    drain_state state;
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(make_drain(state)));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+    if (!socket.set_zero_copy(true))
+    {
+        GTEST_SKIP() << "zero-copy send is not supported";
+    }
+
+    auto data = make_pattern(1024 * 1024, 4);
+    bool is_completed = false;
+    ASSERT_TRUE(socket.write_zero_copy(
+        data.data(), data.size(), [&is_completed]() { is_completed = true; }));
+
+    EXPECT_TRUE(socket.disconnect());
+    EXPECT_TRUE(is_completed);
+    EXPECT_EQ(socket.zero_copy_pending_count(), 0u);
+}
+
+/*******************************************************************************
+ *
+ * communication_ethernet — zero-copy writes.
+ *
+ *******************************************************************************/
+TEST(ethernet_zero_copy, device_writes_without_copy)
+{
+    drain_state state;
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(make_drain(state)));
+
+    kommpot::ethernet_device_identification identification;
+    identification.ip = "127.0.0.1";
+    identification.port = server.port();
+    identification.protocol = kommpot::ethernet_protocol_type::TCP;
+
+    communication_ethernet device(identification);
+    ASSERT_TRUE(device.open());
+
+    auto data = make_pattern(2 * 1024 * 1024, 5);
+    std::atomic_bool is_completed = false;
+    ASSERT_TRUE(device.write_zero_copy(
+        {}, data.data(), data.size(), [&is_completed]() { is_completed = true; }));
+    ASSERT_TRUE(device.flush_zero_copy(2000));
+    EXPECT_TRUE(is_completed);
+
+    device.close();
+    ASSERT_TRUE(wait_for(state.is_closed));
+    EXPECT_EQ(state.size_bytes.load(), data.size());
+    EXPECT_EQ(state.hash.load(), fnv1a(data.data(), data.size(), M_FNV_OFFSET));
+}
+
+/*******************************************************************************
+ *
+ * ethernet_socket — zero-copy receive.
+ *
+ *******************************************************************************/
+TEST(ethernet_zero_copy, received_view_releases_once)
+{
+    size_t release_count = 0;
+    const uint8_t data[4] = {1, 2, 3, 4};
+
+    kommpot::received_view view(data, sizeof(data), [&release_count]() { release_count++; });
+    kommpot::received_view moved = std::move(view);
+
+    EXPECT_TRUE(view.empty());
+    EXPECT_EQ(moved.size(), sizeof(data));
+    EXPECT_EQ(moved.data(), data);
+
+    moved.release();
+    moved.release();
+    EXPECT_TRUE(moved.empty());
+    EXPECT_EQ(release_count, 1u);
+}
+
+TEST(ethernet_zero_copy, disabled_receive_copies_into_view)
+{
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start([](loopback_tcp_server::handle_type handle) {
+        loopback_tcp_server::send_all(handle, "hello", 5);
+    }));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+
+    kommpot::received_view view;
+    ASSERT_TRUE(socket.read_view(1024, view, 2000));
+    EXPECT_EQ(std::string(reinterpret_cast<const char *>(view.data()), view.size()), "hello");
+    EXPECT_EQ(socket.zero_copy_mapped_bytes(), 0u);
+    EXPECT_EQ(socket.zero_copy_received_copied_bytes(), 5u);
+}
+
+TEST(ethernet_zero_copy, receive_maps_aligned_payload)
+{
+    constexpr size_t M_TOTAL_SIZE_BYTES = 32 * 1024 * 1024;
+
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(make_stream(M_TOTAL_SIZE_BYTES)));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+    if (!socket.set_zero_copy_receive(true))
+    {
+        GTEST_SKIP() << "zero-copy receive is not supported";
+    }
+
+    size_t received_size_bytes = 0;
+    uint64_t hash = M_FNV_OFFSET;
+    kommpot::received_view view;
+    while (received_size_bytes < M_TOTAL_SIZE_BYTES)
+    {
+        ASSERT_TRUE(
+            socket.read_view(ethernet_receive_region::M_DEFAULT_SLOT_SIZE_BYTES, view, 2000));
+        hash = fnv1a(view.data(), view.size(), hash);
+        received_size_bytes += view.size();
+    }
+
+    EXPECT_EQ(received_size_bytes, M_TOTAL_SIZE_BYTES);
+    EXPECT_EQ(hash, stream_hash(M_TOTAL_SIZE_BYTES));
+    EXPECT_GT(socket.zero_copy_mapped_bytes(), 0u);
+    EXPECT_EQ(socket.zero_copy_mapped_bytes() + socket.zero_copy_received_copied_bytes(),
+        M_TOTAL_SIZE_BYTES);
+}
+
+TEST(ethernet_zero_copy, held_views_fall_back_to_copying)
+{
+    constexpr size_t M_TOTAL_SIZE_BYTES = 16 * 1024 * 1024;
+
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(make_stream(M_TOTAL_SIZE_BYTES)));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+    if (!socket.set_zero_copy_receive(true))
+    {
+        GTEST_SKIP() << "zero-copy receive is not supported";
+    }
+
+    /**
+     * @attention every view is kept, so mapping stops once all slots are held.
+     */
+    size_t received_size_bytes = 0;
+    std::vector<kommpot::received_view> views;
+    while (received_size_bytes < M_TOTAL_SIZE_BYTES)
+    {
+        kommpot::received_view view;
+        ASSERT_TRUE(socket.read_view(256 * 1024, view, 2000));
+        received_size_bytes += view.size();
+        views.push_back(std::move(view));
+    }
+
+    uint64_t hash = M_FNV_OFFSET;
+    for (const auto &view : views)
+    {
+        hash = fnv1a(view.data(), view.size(), hash);
+    }
+
+    EXPECT_EQ(received_size_bytes, M_TOTAL_SIZE_BYTES);
+    EXPECT_EQ(hash, stream_hash(M_TOTAL_SIZE_BYTES));
+    EXPECT_GT(socket.zero_copy_received_copied_bytes(), 0u);
+}
+
+TEST(ethernet_zero_copy, views_outlive_disconnect)
+{
+    constexpr size_t M_TOTAL_SIZE_BYTES = 4 * 1024 * 1024;
+
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(make_stream(M_TOTAL_SIZE_BYTES)));
+
+    ethernet_socket socket;
+    connect_socket(socket, server.port());
+    if (!socket.set_zero_copy_receive(true))
+    {
+        GTEST_SKIP() << "zero-copy receive is not supported";
+    }
+
+    kommpot::received_view view;
+    ASSERT_TRUE(socket.read_view(1024 * 1024, view, 2000));
+    const auto expected = fnv1a(stream_pattern().data(), view.size(), M_FNV_OFFSET);
+
+    EXPECT_TRUE(socket.disconnect());
+    EXPECT_EQ(fnv1a(view.data(), view.size(), M_FNV_OFFSET), expected);
+    view.release();
+}
+
+/*******************************************************************************
+ *
+ * communication_ethernet — zero-copy receive.
+ *
+ *******************************************************************************/
+TEST(ethernet_zero_copy, device_reads_views)
+{
+    constexpr size_t M_TOTAL_SIZE_BYTES = 8 * 1024 * 1024;
+
+    loopback_tcp_server server;
+    ASSERT_TRUE(server.start(make_stream(M_TOTAL_SIZE_BYTES)));
+
+    kommpot::ethernet_device_identification identification;
+    identification.ip = "127.0.0.1";
+    identification.port = server.port();
+    identification.protocol = kommpot::ethernet_protocol_type::TCP;
+
+    kommpot::communication_configuration configuration;
+    configuration.is_zero_copy_receive_enabled = true;
+
+    communication_ethernet device(identification);
+    device.set_configuration(configuration);
+    ASSERT_TRUE(device.open());
+
+    size_t received_size_bytes = 0;
+    uint64_t hash = M_FNV_OFFSET;
+    kommpot::received_view view;
+    while (received_size_bytes < M_TOTAL_SIZE_BYTES)
+    {
+        ASSERT_TRUE(device.read_view({}, 1024 * 1024, view));
+        hash = fnv1a(view.data(), view.size(), hash);
+        received_size_bytes += view.size();
+    }
+
+    EXPECT_EQ(received_size_bytes, M_TOTAL_SIZE_BYTES);
+    EXPECT_EQ(hash, stream_hash(M_TOTAL_SIZE_BYTES));
+
+    view.release();
+    device.close();
+}
+
+/*******************************************************************************
+ *
+ * ethernet_zero_copy — throughput of copied and zero-copy writes on loopback.
+ *
+ *******************************************************************************/
+TEST(ethernet_zero_copy, benchmark_large_writes)
+{
+    constexpr size_t M_CHUNK_SIZE_BYTES = 1024 * 1024;
+    constexpr size_t M_TOTAL_SIZE_BYTES = 64 * M_CHUNK_SIZE_BYTES;
+
+    /**
+     * @brief the buffers are never modified, so they are reused before their completion.
+     */
+    std::vector<std::vector<uint8_t>> buffers = {
+        make_pattern(M_CHUNK_SIZE_BYTES, 6), make_pattern(M_CHUNK_SIZE_BYTES, 7)};
+
+    for (const bool is_zero_copy : {false, true})
+    {
+        drain_state state;
+        loopback_tcp_server server;
+        ASSERT_TRUE(server.start(make_drain(state)));
+
+        ethernet_socket socket;
+        connect_socket(socket, server.port());
+        if (is_zero_copy && !socket.set_zero_copy(true))
+        {
+            GTEST_SKIP() << "zero-copy send is not supported";
+        }
+
+        std::atomic<size_t> completed_count = 0;
+        const auto start = std::chrono::steady_clock::now();
+
+        for (size_t offset = 0, index = 0; offset < M_TOTAL_SIZE_BYTES;
+             offset += M_CHUNK_SIZE_BYTES, ++index)
+        {
+            auto &buffer = buffers[index % buffers.size()];
+            ASSERT_TRUE(socket.write_zero_copy(buffer.data(), buffer.size(),
+                [&completed_count]() { completed_count++; }));
+        }
+        ASSERT_TRUE(socket.flush_zero_copy(5000));
+        EXPECT_TRUE(socket.disconnect());
+        ASSERT_TRUE(wait_for(state.is_closed));
+
+        const auto elapsed_usecs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start)
+                                       .count();
+        const auto megabytes_per_second =
+            static_cast<double>(M_TOTAL_SIZE_BYTES) / static_cast<double>(elapsed_usecs);
+        const char *name = is_zero_copy ? "ZEROCOPY" : "COPY";
+
+        EXPECT_EQ(completed_count.load(), M_TOTAL_SIZE_BYTES / M_CHUNK_SIZE_BYTES);
+        EXPECT_EQ(state.size_bytes.load(), M_TOTAL_SIZE_BYTES);
+
+        printf("[ %-8s ] %.0f MB/s, %llu completions copied by the OS\n", name,
+            megabytes_per_second, (unsigned long long)socket.zero_copy_copied_count());
+        RecordProperty(std::string(name) + "_megabytes_per_second",
+            static_cast<int>(megabytes_per_second));
+    }
+}
+
+/*******************************************************************************
+ *
+ * ethernet_zero_copy — throughput of copied and mapped reads on loopback.
+ *
+ *******************************************************************************/
+TEST(ethernet_zero_copy, benchmark_large_reads)
+{
+    constexpr size_t M_READ_SIZE_BYTES = 2 * 1024 * 1024;
+    constexpr size_t M_TOTAL_SIZE_BYTES = 256 * 1024 * 1024;
+
+    for (const bool is_zero_copy : {false, true})
+    {
+        loopback_tcp_server server;
+        ASSERT_TRUE(server.start(make_stream(M_TOTAL_SIZE_BYTES)));
+
+        ethernet_socket socket;
+        connect_socket(socket, server.port());
+        if (is_zero_copy && !socket.set_zero_copy_receive(true))
+        {
+            GTEST_SKIP() << "zero-copy receive is not supported";
+        }
+
+        std::vector<uint8_t> buffer(M_READ_SIZE_BYTES);
+        size_t received_size_bytes = 0;
+        uint64_t checksum = 0;
+        const auto start = std::chrono::steady_clock::now();
+
+        /**
+         * @attention one byte per page is touched, so both modes pay for bringing data to the CPU.
+         */
+        while (received_size_bytes < M_TOTAL_SIZE_BYTES)
+        {
+            const uint8_t *data = nullptr;
+            size_t size_bytes = 0;
+            kommpot::received_view view;
+            if (is_zero_copy)
+            {
+                ASSERT_TRUE(socket.read_view(M_READ_SIZE_BYTES, view, 2000));
+                data = view.data();
+                size_bytes = view.size();
+            }
+            else
+            {
+                ASSERT_TRUE(socket.read_some(buffer.data(), buffer.size(), size_bytes, 2000));
+                data = buffer.data();
+            }
+
+            for (size_t offset = 0; offset < size_bytes; offset += 4096)
+            {
+                checksum += data[offset];
+            }
+            received_size_bytes += size_bytes;
+        }
+
+        const auto elapsed_usecs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start)
+                                       .count();
+        const auto megabytes_per_second =
+            static_cast<double>(M_TOTAL_SIZE_BYTES) / static_cast<double>(elapsed_usecs);
+        const auto mapped_percent = 100.0 * static_cast<double>(socket.zero_copy_mapped_bytes()) /
+                                    static_cast<double>(M_TOTAL_SIZE_BYTES);
+        const char *name = is_zero_copy ? "MAPPED" : "COPY";
+
+        EXPECT_EQ(received_size_bytes, M_TOTAL_SIZE_BYTES);
+        EXPECT_GT(checksum, 0u);
+
+        printf("[ %-8s ] %.0f MB/s, %.0f%% of the bytes mapped\n", name, megabytes_per_second,
+            mapped_percent);
+        RecordProperty(std::string(name) + "_megabytes_per_second",
+            static_cast<int>(megabytes_per_second));
+    }
+}
+
+// NOLINTEND
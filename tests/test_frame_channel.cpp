@@ -0,0 +1,456 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <protocols/frame_codec.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * Helper classes.
+ *
+ *******************************************************************************/
+
+/**
+ * @brief in-memory pipe, written bytes are served by read_some() in chunks of at most
+ * chunk_size_bytes.
+ */
+class fake_pipe_communication : public kommpot::device_communication
+{
+public:
+    explicit fake_pipe_communication(size_t chunk_size_bytes = SIZE_MAX)
+        : device_communication(kommpot::ethernet_device_identification())
+        , m_chunk_size_bytes(chunk_size_bytes)
+    {}
+
+    std::vector<uint8_t> stream;
+    size_t position = 0;
+
+    auto open() -> bool override
+    {
+        return true;
+    }
+
+    auto is_open() -> bool override
+    {
+        return true;
+    }
+
+    void close() override {}
+
+    auto endpoints() -> std::vector<kommpot::endpoint_information> override
+    {
+        return {};
+    }
+
+    auto read(const kommpot::transfer_configuration &configuration, void *data,
+        size_t size_bytes) -> bool override
+    {
+        if (stream.size() - position < size_bytes)
+        {
+            return false;
+        }
+        std::memcpy(data, stream.data() + position, size_bytes);
+        position += size_bytes;
+        return true;
+    }
+
+    auto read_some(const kommpot::transfer_configuration &configuration, void *data,
+        size_t size_bytes, size_t &received_size_bytes) -> bool override
+    {
+        received_size_bytes = std::min({size_bytes, m_chunk_size_bytes, stream.size() - position});
+        std::memcpy(data, stream.data() + position, received_size_bytes);
+        position += received_size_bytes;
+        return received_size_bytes > 0;
+    }
+
+    auto write(const kommpot::transfer_configuration &configuration, void *data,
+        size_t size_bytes) -> bool override
+    {
+        const auto *bytes = static_cast<const uint8_t *>(data);
+        stream.insert(stream.end(), bytes, bytes + size_bytes);
+        return true;
+    }
+
+    auto get_error_string(const uint32_t &native_error_code) const -> std::string override
+    {
+        return "";
+    }
+
+    auto native_handle() const -> void * override
+    {
+        return nullptr;
+    }
+
+private:
+    size_t m_chunk_size_bytes = SIZE_MAX;
+};
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+static std::vector<uint8_t> make_random(const size_t size_bytes, const uint32_t seed)
+{
+    std::mt19937 generator(seed);
+    std::vector<uint8_t> data(size_bytes);
+    for (auto &value : data)
+    {
+        value = static_cast<uint8_t>(generator() % 4 == 0 ? generator() % 2 * 0xC0 : generator());
+    }
+    return data;
+}
+
+static std::vector<uint8_t> cobs_encode(const std::vector<uint8_t> &data)
+{
+    std::vector<uint8_t> output;
+    frame_codec::cobs_encode(data.data(), data.size(), output);
+    return output;
+}
+
+static std::vector<uint8_t> cobs_decode(const std::vector<uint8_t> &data)
+{
+    std::vector<uint8_t> output(data.size());
+    const auto size_bytes = frame_codec::cobs_decode(data.data(), data.size(), output.data());
+    EXPECT_TRUE(size_bytes.has_value());
+    output.resize(size_bytes.value_or(0));
+    return output;
+}
+
+/*******************************************************************************
+ *
+ * frame_codec — COBS.
+ *
+ *******************************************************************************/
+TEST(frame_codec, cobs_reference_vectors)
+{
+    using bytes = std::vector<uint8_t>;
+
+    EXPECT_EQ(cobs_encode({}), (bytes{0x01}));
+    EXPECT_EQ(cobs_encode({0x00}), (bytes{0x01, 0x01}));
+    EXPECT_EQ(cobs_encode({0x00, 0x00}), (bytes{0x01, 0x01, 0x01}));
+    EXPECT_EQ(cobs_encode({0x11, 0x22, 0x00, 0x33}), (bytes{0x03, 0x11, 0x22, 0x02, 0x33}));
+    EXPECT_EQ(cobs_encode({0x11, 0x00, 0x00, 0x00}), (bytes{0x02, 0x11, 0x01, 0x01, 0x01}));
+
+    bytes run(254);
+    std::iota(run.begin(), run.end(), 1);
+    auto expected = run;
+    expected.insert(expected.begin(), 0xFF);
+    EXPECT_EQ(cobs_encode(run), expected);
+
+    run.push_back(0xFF);
+    expected.push_back(0x02);
+    expected.push_back(0xFF);
+    EXPECT_EQ(cobs_encode(run), expected);
+}
+
+TEST(frame_codec, cobs_round_trip)
+{
+    for (const size_t size_bytes : {0, 1, 253, 254, 255, 508, 1000, 5000})
+    {
+        auto data = make_random(size_bytes, static_cast<uint32_t>(size_bytes));
+        EXPECT_EQ(cobs_decode(cobs_encode(data)), data) << size_bytes;
+
+        std::fill(data.begin(), data.end(), 0);
+        EXPECT_EQ(cobs_decode(cobs_encode(data)), data) << size_bytes;
+
+        std::fill(data.begin(), data.end(), 0x55);
+        const auto encoded = cobs_encode(data);
+        EXPECT_EQ(std::count(encoded.begin(), encoded.end(), 0), 0);
+        EXPECT_EQ(cobs_decode(encoded), data) << size_bytes;
+    }
+}
+
+TEST(frame_codec, cobs_rejects_malformed)
+{
+    std::vector<uint8_t> output(8);
+    const std::vector<uint8_t> zero_code = {0x02, 0x11, 0x00};
+    const std::vector<uint8_t> truncated = {0x05, 0x11, 0x22};
+
+    EXPECT_FALSE(frame_codec::cobs_decode(zero_code.data(), zero_code.size(), output.data()));
+    EXPECT_FALSE(frame_codec::cobs_decode(truncated.data(), truncated.size(), output.data()));
+}
+
+/*******************************************************************************
+ *
+ * frame_codec — SLIP.
+ *
+ *******************************************************************************/
+TEST(frame_codec, slip_escapes_end_and_esc)
+{
+    const std::vector<uint8_t> data = {0x01, 0xC0, 0x02, 0xDB, 0x03};
+
+    std::vector<uint8_t> encoded;
+    frame_codec::slip_encode(data.data(), data.size(), encoded);
+    EXPECT_EQ(encoded, (std::vector<uint8_t>{0x01, 0xDB, 0xDC, 0x02, 0xDB, 0xDD, 0x03}));
+
+    std::vector<uint8_t> decoded(encoded.size());
+    const auto size_bytes =
+        frame_codec::slip_decode(encoded.data(), encoded.size(), decoded.data());
+    ASSERT_TRUE(size_bytes.has_value());
+    decoded.resize(*size_bytes);
+    EXPECT_EQ(decoded, data);
+}
+
+TEST(frame_codec, slip_rejects_invalid_escape)
+{
+    std::vector<uint8_t> output(8);
+    const std::vector<uint8_t> invalid = {0x01, 0xDB, 0x01};
+    const std::vector<uint8_t> trailing = {0x01, 0xDB};
+
+    EXPECT_FALSE(frame_codec::slip_decode(invalid.data(), invalid.size(), output.data()));
+    EXPECT_FALSE(frame_codec::slip_decode(trailing.data(), trailing.size(), output.data()));
+}
+
+/*******************************************************************************
+ *
+ * buffer_pool — recycling.
+ *
+ *******************************************************************************/
+TEST(buffer_pool, released_buffers_are_reused)
+{
+    auto pool = kommpot::buffer_pool::create(2);
+
+    for (size_t i = 0; i < 100; i++)
+    {
+        auto buffer = pool->acquire(1000);
+        EXPECT_EQ(buffer->size(), 1000u);
+    }
+    EXPECT_EQ(pool->allocation_count(), 1u);
+    EXPECT_EQ(pool->idle_count(), 1u);
+
+    {
+        auto first = pool->acquire(1);
+        auto second = pool->acquire(1);
+        auto third = pool->acquire(1);
+    }
+    EXPECT_EQ(pool->allocation_count(), 3u);
+    EXPECT_EQ(pool->idle_count(), 2u);
+}
+
+TEST(buffer_pool, buffer_may_outlive_pool)
+{
+    auto pool = kommpot::buffer_pool::create();
+    auto buffer = pool->acquire(16);
+    pool.reset();
+
+    buffer->at(15) = 1;
+    buffer.reset();
+}
+
+/*******************************************************************************
+ *
+ * frame_channel — round trips.
+ *
+ *******************************************************************************/
+class frame_channel_round_trip
+    : public TestWithParam<std::tuple<kommpot::framing_type, kommpot::frame_check_type>>
+{};
+
+TEST_P(frame_channel_round_trip, frames_survive_any_chunking)
+{
+    const auto [type, check] = GetParam();
+
+    for (const size_t chunk_size_bytes : {size_t(1), size_t(7), size_t(4096), SIZE_MAX})
+    {
+        fake_pipe_communication pipe(chunk_size_bytes);
+        kommpot::frame_channel channel(pipe, type, check);
+
+        std::vector<std::vector<uint8_t>> frames;
+        for (const size_t size_bytes : {0, 1, 2, 100, 254, 255, 3000, 35000})
+        {
+            if (size_bytes == 0 && type == kommpot::framing_type::SLIP &&
+                check == kommpot::frame_check_type::NONE)
+            {
+                EXPECT_FALSE(channel.write_frame(nullptr, 0));
+                continue;
+            }
+
+            frames.push_back(make_random(size_bytes, static_cast<uint32_t>(size_bytes)));
+            ASSERT_TRUE(channel.write_frame(frames.back().data(), frames.back().size()));
+        }
+
+        for (const auto &expected : frames)
+        {
+            kommpot::pooled_buffer frame;
+            ASSERT_TRUE(channel.read_frame(frame)) << chunk_size_bytes;
+            EXPECT_EQ(*frame, expected) << chunk_size_bytes << " " << expected.size();
+        }
+
+        kommpot::pooled_buffer frame;
+        EXPECT_FALSE(channel.read_frame(frame));
+        EXPECT_EQ(channel.dropped_frame_count(), 0u);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(frame_channel, frame_channel_round_trip,
+    Combine(Values(kommpot::framing_type::LENGTH_PREFIXED, kommpot::framing_type::COBS,
+                kommpot::framing_type::SLIP),
+        Values(kommpot::frame_check_type::NONE, kommpot::frame_check_type::CRC16,
+            kommpot::frame_check_type::CRC32C)));
+
+/*******************************************************************************
+ *
+ * frame_channel — failures.
+ *
+ *******************************************************************************/
+TEST(frame_channel, corrupted_frame_is_dropped_and_stream_stays_in_sync)
+{
+    for (const auto type : {kommpot::framing_type::LENGTH_PREFIXED, kommpot::framing_type::COBS,
+             kommpot::framing_type::SLIP})
+    {
+        fake_pipe_communication pipe;
+        kommpot::frame_channel channel(pipe, type, kommpot::frame_check_type::CRC32C);
+
+        const std::vector<uint8_t> first = {1, 2, 3, 4, 5, 6, 7, 8};
+        const std::vector<uint8_t> second = {9, 10, 11};
+        ASSERT_TRUE(channel.write_frame(first.data(), first.size()));
+        ASSERT_TRUE(channel.write_frame(second.data(), second.size()));
+
+        pipe.stream[6] ^= 0x01;
+
+        kommpot::pooled_buffer frame;
+        EXPECT_FALSE(channel.read_frame(frame));
+        EXPECT_EQ(channel.dropped_frame_count(), 1u);
+
+        ASSERT_TRUE(channel.read_frame(frame)) << kommpot::framing_type_to_string(type);
+        EXPECT_EQ(*frame, second);
+    }
+}
+
+TEST(frame_channel, stalled_length_prefixed_frame_is_resumed)
+{
+    fake_pipe_communication pipe(100);
+    kommpot::frame_channel channel(
+        pipe, kommpot::framing_type::LENGTH_PREFIXED, kommpot::frame_check_type::CRC16);
+
+    const auto first = make_random(1000, 7);
+    const std::vector<uint8_t> second = {1, 2, 3};
+    ASSERT_TRUE(channel.write_frame(first.data(), first.size()));
+    ASSERT_TRUE(channel.write_frame(second.data(), second.size()));
+
+    const std::vector<uint8_t> rest(pipe.stream.begin() + 500, pipe.stream.end());
+    pipe.stream.resize(500);
+
+    kommpot::pooled_buffer frame;
+    EXPECT_FALSE(channel.read_frame(frame));
+
+    pipe.stream.insert(pipe.stream.end(), rest.begin(), rest.end());
+
+    ASSERT_TRUE(channel.read_frame(frame));
+    EXPECT_EQ(*frame, first);
+    ASSERT_TRUE(channel.read_frame(frame));
+    EXPECT_EQ(*frame, second);
+    EXPECT_EQ(channel.dropped_frame_count(), 0u);
+}
+
+TEST(frame_channel, oversized_frames_are_rejected)
+{
+    fake_pipe_communication pipe;
+    kommpot::frame_channel channel(pipe, kommpot::framing_type::COBS,
+        kommpot::frame_check_type::NONE, 16);
+
+    const std::vector<uint8_t> large(17, 0x42);
+    EXPECT_FALSE(channel.write_frame(large.data(), large.size()));
+
+    kommpot::frame_channel large_channel(pipe, kommpot::framing_type::COBS,
+        kommpot::frame_check_type::NONE, 1000000);
+    const std::vector<uint8_t> huge(200000, 0x42);
+    const std::vector<uint8_t> small = {1, 2, 3};
+    ASSERT_TRUE(large_channel.write_frame(huge.data(), huge.size()));
+    ASSERT_TRUE(large_channel.write_frame(small.data(), small.size()));
+
+    kommpot::pooled_buffer frame;
+    ASSERT_TRUE(channel.read_frame(frame));
+    EXPECT_EQ(*frame, small);
+    EXPECT_EQ(channel.dropped_frame_count(), 1u);
+}
+
+TEST(frame_channel, slip_skips_empty_frames)
+{
+    fake_pipe_communication pipe;
+    pipe.stream = {0xC0, 0xC0, 0xC0, 0x01, 0x02, 0xC0};
+    kommpot::frame_channel channel(pipe, kommpot::framing_type::SLIP);
+
+    kommpot::pooled_buffer frame;
+    ASSERT_TRUE(channel.read_frame(frame));
+    EXPECT_EQ(*frame, (std::vector<uint8_t>{0x01, 0x02}));
+}
+
+TEST(frame_channel, frames_use_pooled_buffers)
+{
+    fake_pipe_communication pipe;
+    kommpot::frame_channel channel(pipe, kommpot::framing_type::COBS,
+        kommpot::frame_check_type::CRC16);
+
+    const auto data = make_random(512, 5);
+    for (size_t i = 0; i < 1000; i++)
+    {
+        ASSERT_TRUE(channel.write_frame(data.data(), data.size()));
+    }
+
+    for (size_t i = 0; i < 1000; i++)
+    {
+        kommpot::pooled_buffer frame;
+        ASSERT_TRUE(channel.read_frame(frame));
+    }
+    EXPECT_EQ(channel.pool()->allocation_count(), 1u);
+}
+
+/*******************************************************************************
+ *
+ * frame_channel — decoding throughput.
+ *
+ *******************************************************************************/
+TEST(frame_channel, decoding_throughput)
+{
+    static constexpr size_t FRAMES = 20000;
+    static constexpr size_t FRAME_SIZE_BYTES = 1024;
+
+    const auto data = make_random(FRAME_SIZE_BYTES, 6);
+
+    for (const auto type : {kommpot::framing_type::LENGTH_PREFIXED, kommpot::framing_type::COBS,
+             kommpot::framing_type::SLIP})
+    {
+        fake_pipe_communication pipe;
+        kommpot::frame_channel channel(pipe, type, kommpot::frame_check_type::CRC32C);
+        for (size_t i = 0; i < FRAMES; i++)
+        {
+            ASSERT_TRUE(channel.write_frame(data.data(), data.size()));
+        }
+
+        kommpot::pooled_buffer frame;
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < FRAMES; i++)
+        {
+            ASSERT_TRUE(channel.read_frame(frame));
+            frame.reset();
+        }
+        const auto usecs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start)
+                               .count();
+
+        const auto rate =
+            FRAMES * static_cast<double>(FRAME_SIZE_BYTES) / std::max<int64_t>(usecs, 1);
+        RecordProperty(kommpot::framing_type_to_string(type) + "_mb_per_second",
+            std::to_string(rate));
+        std::printf("[ FRAMING  ] %s + CRC32C: %.0f MB/s decoded\n",
+            kommpot::framing_type_to_string(type).c_str(), rate);
+    }
+}
+
+// NOLINTEND
@@ -0,0 +1,492 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/communication_ethernet.h>
+
+#include "loopback_tcp_server.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+
+/**
+ * @brief Modbus/TCP simulator with 1000 holding and 1000 input registers, all requests received
+ * in one segment are answered in reverse order to exercise matching by transaction ID. Every
+ * single register write is preceded by a stale response with an unknown transaction ID. With
+ * is_answering_as_other_unit, every read response is preceded by a copy from another unit with
+ * the same transaction ID and inverted registers.
+ */
+class modbus_simulator
+{
+public:
+    static constexpr uint16_t M_REGISTER_COUNT = 1000;
+
+    std::array<uint16_t, M_REGISTER_COUNT> holding_registers = {};
+    std::atomic<uint32_t> request_count = 0;
+    std::atomic<uint32_t> reordered_count = 0;
+    std::atomic<bool> is_answering_as_other_unit = false;
+
+    modbus_simulator()
+    {
+        for (uint16_t i = 0; i < M_REGISTER_COUNT; i++)
+        {
+            holding_registers[i] = static_cast<uint16_t>(i * 3);
+        }
+    }
+
+    static uint16_t input_register(const uint32_t address)
+    {
+        return static_cast<uint16_t>(address ^ 0xA5A5);
+    }
+
+    void serve(loopback_tcp_server::handle_type handle)
+    {
+        std::vector<uint8_t> pending;
+        std::array<uint8_t, 4096> buffer = {};
+
+        while (true)
+        {
+            const auto result = recv(handle, reinterpret_cast<char *>(buffer.data()),
+                static_cast<int>(buffer.size()), 0);
+            if (result <= 0)
+            {
+                return;
+            }
+            pending.insert(pending.end(), buffer.begin(), buffer.begin() + result);
+
+            std::vector<std::vector<uint8_t>> responses;
+            while (pending.size() >= 7)
+            {
+                const size_t frame_size_bytes = 6 + ((pending[4] << 8) | pending[5]);
+                if (pending.size() < frame_size_bytes)
+                {
+                    break;
+                }
+
+                const std::vector<uint8_t> frame(
+                    pending.begin(), pending.begin() + frame_size_bytes);
+                pending.erase(pending.begin(), pending.begin() + frame_size_bytes);
+                request_count++;
+                handle_frame(frame, responses);
+            }
+
+            if (responses.size() > 1)
+            {
+                reordered_count++;
+            }
+
+            std::vector<uint8_t> reply;
+            for (auto it = responses.rbegin(); it != responses.rend(); ++it)
+            {
+                if (is_answering_as_other_unit && ((*it)[7] == 0x03 || (*it)[7] == 0x04))
+                {
+                    auto other = *it;
+                    other[6] ^= 0x01;
+                    for (size_t i = 9; i < other.size(); i++)
+                    {
+                        other[i] ^= 0xFF;
+                    }
+                    reply.insert(reply.end(), other.begin(), other.end());
+                }
+                reply.insert(reply.end(), it->begin(), it->end());
+            }
+
+            if (!reply.empty() &&
+                !loopback_tcp_server::send_all(handle, reply.data(), reply.size()))
+            {
+                return;
+            }
+        }
+    }
+
+private:
+    std::mutex m_mutex;
+
+    static uint16_t load(const uint8_t *data)
+    {
+        return static_cast<uint16_t>((data[0] << 8) | data[1]);
+    }
+
+    static void append(std::vector<uint8_t> &data, const uint16_t value)
+    {
+        data.push_back(static_cast<uint8_t>(value >> 8));
+        data.push_back(static_cast<uint8_t>(value & 0xFF));
+    }
+
+    static std::vector<uint8_t> make_frame(const std::vector<uint8_t> &request,
+        const std::vector<uint8_t> &pdu)
+    {
+        std::vector<uint8_t> frame(request.begin(), request.begin() + 4);
+        append(frame, static_cast<uint16_t>(pdu.size() + 1));
+        frame.push_back(request[6]);
+        frame.insert(frame.end(), pdu.begin(), pdu.end());
+        return frame;
+    }
+
+    void handle_frame(const std::vector<uint8_t> &frame,
+        std::vector<std::vector<uint8_t>> &responses)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        const uint8_t function = frame[7];
+        const uint16_t address = load(&frame[8]);
+        const uint16_t value = load(&frame[10]);
+        const std::vector<uint8_t> exception = {static_cast<uint8_t>(function | 0x80), 0x02};
+
+        std::vector<uint8_t> pdu = {function};
+        switch (function)
+        {
+        case 0x03:
+        case 0x04: {
+            if (address + value > M_REGISTER_COUNT)
+            {
+                pdu = exception;
+                break;
+            }
+            pdu.push_back(static_cast<uint8_t>(value * 2));
+            for (uint32_t i = address; i < address + value; i++)
+            {
+                append(pdu, function == 0x03 ? holding_registers[i] : input_register(i));
+            }
+            break;
+        }
+        case 0x06: {
+            if (address >= M_REGISTER_COUNT)
+            {
+                pdu = exception;
+                break;
+            }
+            holding_registers[address] = value;
+            pdu.insert(pdu.end(), frame.begin() + 8, frame.begin() + 12);
+
+            auto stale = frame;
+            stale[0] ^= 0x80;
+            responses.push_back(make_frame(stale, pdu));
+            break;
+        }
+        case 0x10: {
+            if (address + value > M_REGISTER_COUNT)
+            {
+                pdu = exception;
+                break;
+            }
+            for (uint16_t i = 0; i < value; i++)
+            {
+                holding_registers[address + i] = load(&frame[13 + i * 2]);
+            }
+            pdu.insert(pdu.end(), frame.begin() + 8, frame.begin() + 12);
+            break;
+        }
+        default:
+            pdu = {static_cast<uint8_t>(function | 0x80), 0x01};
+        }
+
+        /**
+         * @attention responses are sent in reverse order, the real one goes before the stale one
+         * so the stale one arrives first.
+         */
+        if (function == 0x06 && pdu[0] == function)
+        {
+            responses.insert(responses.end() - 1, make_frame(frame, pdu));
+            return;
+        }
+
+        responses.push_back(make_frame(frame, pdu));
+    }
+};
+
+class modbus_tcp_client_test : public Test
+{
+protected:
+    modbus_simulator simulator;
+    loopback_tcp_server server;
+    std::unique_ptr<communication_ethernet> communication;
+
+    void SetUp() override
+    {
+        ASSERT_TRUE(server.start(
+            [this](loopback_tcp_server::handle_type handle) { simulator.serve(handle); }));
+
+        kommpot::ethernet_device_identification identification;
+        identification.ip = "127.0.0.1";
+        identification.port = server.port();
+        identification.protocol = kommpot::ethernet_protocol_type::TCP;
+
+        communication = std::make_unique<communication_ethernet>(identification);
+        ASSERT_TRUE(communication->open());
+    }
+
+    void TearDown() override
+    {
+        communication->close();
+    }
+
+    static kommpot::modbus_read_request make_request(const uint16_t address, const uint16_t count,
+        const kommpot::modbus_function function = kommpot::modbus_function::READ_HOLDING_REGISTERS)
+    {
+        kommpot::modbus_read_request request;
+        request.function = function;
+        request.address = address;
+        request.count = count;
+        return request;
+    }
+
+    static bool is_holding(const kommpot::modbus_read_request &request)
+    {
+        for (uint16_t i = 0; i < request.count; i++)
+        {
+            if (request.values[i] != static_cast<uint16_t>((request.address + i) * 3))
+            {
+                return false;
+            }
+        }
+        return request.values.size() == request.count;
+    }
+};
+
+/*******************************************************************************
+ *
+ * modbus_tcp_client — single transactions.
+ *
+ *******************************************************************************/
+TEST_F(modbus_tcp_client_test, read_holding_registers)
+{
+    kommpot::modbus_tcp_client client(*communication);
+
+    std::vector<uint16_t> values;
+    ASSERT_TRUE(client.read_holding_registers(10, 4, values));
+    EXPECT_EQ(values, (std::vector<uint16_t>{30, 33, 36, 39}));
+}
+
+TEST_F(modbus_tcp_client_test, read_input_registers)
+{
+    kommpot::modbus_tcp_client client(*communication);
+
+    std::vector<uint16_t> values;
+    ASSERT_TRUE(client.read_input_registers(7, 2, values));
+    EXPECT_EQ(values, (std::vector<uint16_t>{modbus_simulator::input_register(7),
+                          modbus_simulator::input_register(8)}));
+}
+
+TEST_F(modbus_tcp_client_test, exception_is_reported)
+{
+    kommpot::modbus_tcp_client client(*communication);
+
+    std::vector<uint16_t> values;
+    EXPECT_FALSE(client.read_holding_registers(998, 4, values));
+    EXPECT_EQ(client.last_exception_code(), 0x02);
+    EXPECT_TRUE(values.empty());
+}
+
+TEST_F(modbus_tcp_client_test, write_single_register_drops_stale_response)
+{
+    kommpot::modbus_tcp_client client(*communication);
+
+    ASSERT_TRUE(client.write_single_register(5, 0xBEEF));
+
+    std::vector<uint16_t> values;
+    ASSERT_TRUE(client.read_holding_registers(5, 1, values));
+    EXPECT_EQ(values[0], 0xBEEF);
+}
+
+TEST_F(modbus_tcp_client_test, response_from_other_unit_is_dropped)
+{
+    simulator.is_answering_as_other_unit = true;
+    kommpot::modbus_tcp_client client(*communication);
+
+    std::vector<uint16_t> values;
+    ASSERT_TRUE(client.read_holding_registers(10, 4, values));
+    ASSERT_EQ(values.size(), 4u);
+    for (uint16_t i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(values[i], static_cast<uint16_t>((10 + i) * 3));
+    }
+}
+
+TEST_F(modbus_tcp_client_test, write_multiple_registers)
+{
+    kommpot::modbus_tcp_client client(*communication);
+
+    ASSERT_TRUE(client.write_multiple_registers(100, {1, 2, 3}));
+
+    std::vector<uint16_t> values;
+    ASSERT_TRUE(client.read_holding_registers(99, 5, values));
+    EXPECT_EQ(values, (std::vector<uint16_t>{297, 1, 2, 3, 309}));
+
+    EXPECT_FALSE(client.write_multiple_registers(0, {}));
+    EXPECT_FALSE(client.write_multiple_registers(0, std::vector<uint16_t>(124, 0)));
+    EXPECT_FALSE(client.write_multiple_registers(999, {1, 2}));
+    EXPECT_EQ(client.last_exception_code(), 0x02);
+}
+
+/*******************************************************************************
+ *
+ * modbus_tcp_client — batched reads.
+ *
+ *******************************************************************************/
+TEST_F(modbus_tcp_client_test, responses_out_of_order_are_matched)
+{
+    kommpot::modbus_tcp_client client(*communication);
+
+    std::vector<kommpot::modbus_read_request> requests;
+    for (uint16_t i = 0; i < 40; i++)
+    {
+        requests.push_back(make_request(static_cast<uint16_t>(i * 20), 2));
+    }
+
+    ASSERT_TRUE(client.read(requests));
+    for (const auto &request : requests)
+    {
+        EXPECT_TRUE(request.is_succeeded);
+        EXPECT_TRUE(is_holding(request));
+    }
+    EXPECT_EQ(client.transaction_count(), requests.size());
+    EXPECT_GT(simulator.reordered_count, 0u);
+}
+
+TEST_F(modbus_tcp_client_test, adjacent_reads_are_merged)
+{
+    kommpot::modbus_tcp_client client(*communication);
+
+    std::vector<kommpot::modbus_read_request> requests = {make_request(20, 5), make_request(0, 10),
+        make_request(10, 10), make_request(15, 2), make_request(0, 4,
+        kommpot::modbus_function::READ_INPUT_REGISTERS), make_request(500, 1)};
+
+    ASSERT_TRUE(client.read(requests));
+    EXPECT_EQ(client.transaction_count(), 3u);
+    EXPECT_EQ(simulator.request_count, 3u);
+
+    for (size_t i = 0; i < requests.size(); i++)
+    {
+        if (i != 4)
+        {
+            EXPECT_TRUE(is_holding(requests[i])) << i;
+        }
+    }
+    EXPECT_EQ(requests[4].values[3], modbus_simulator::input_register(3));
+}
+
+TEST_F(modbus_tcp_client_test, merge_gap_reads_across_holes)
+{
+    kommpot::modbus_tcp_client client(*communication);
+
+    std::vector<kommpot::modbus_read_request> requests = {make_request(0, 2),
+        make_request(6, 2), make_request(20, 2)};
+
+    client.set_merge_gap(4);
+    ASSERT_TRUE(client.read(requests));
+    EXPECT_EQ(client.transaction_count(), 2u);
+    for (const auto &request : requests)
+    {
+        EXPECT_TRUE(is_holding(request));
+    }
+}
+
+TEST_F(modbus_tcp_client_test, large_read_is_split)
+{
+    kommpot::modbus_tcp_client client(*communication);
+
+    std::vector<kommpot::modbus_read_request> requests = {make_request(0, 900)};
+
+    ASSERT_TRUE(client.read(requests));
+    EXPECT_EQ(client.transaction_count(), 8u);
+    EXPECT_TRUE(is_holding(requests[0]));
+}
+
+TEST_F(modbus_tcp_client_test, rejected_merge_is_repeated_per_request)
+{
+    kommpot::modbus_tcp_client client(*communication);
+
+    std::vector<kommpot::modbus_read_request> requests = {make_request(990, 10),
+        make_request(1000, 2), make_request(0, 1)};
+
+    EXPECT_FALSE(client.read(requests));
+
+    EXPECT_TRUE(requests[0].is_succeeded);
+    EXPECT_TRUE(is_holding(requests[0]));
+    EXPECT_FALSE(requests[1].is_succeeded);
+    EXPECT_EQ(requests[1].exception_code, 0x02);
+    EXPECT_TRUE(requests[2].is_succeeded);
+}
+
+TEST_F(modbus_tcp_client_test, invalid_request_is_not_sent)
+{
+    kommpot::modbus_tcp_client client(*communication);
+
+    std::vector<kommpot::modbus_read_request> requests = {make_request(0, 0), make_request(0, 1,
+        kommpot::modbus_function::WRITE_SINGLE_REGISTER), make_request(1, 1)};
+
+    EXPECT_FALSE(client.read(requests));
+    EXPECT_FALSE(requests[0].is_succeeded);
+    EXPECT_FALSE(requests[1].is_succeeded);
+    EXPECT_TRUE(requests[2].is_succeeded);
+    EXPECT_EQ(client.transaction_count(), 1u);
+}
+
+/*******************************************************************************
+ *
+ * modbus_tcp_client — pipelined read throughput against the simulator.
+ *
+ *******************************************************************************/
+TEST_F(modbus_tcp_client_test, pipelined_read_throughput)
+{
+    static constexpr uint16_t READS = 500;
+
+    kommpot::modbus_tcp_client client(*communication);
+
+    std::vector<uint16_t> values;
+    auto start = std::chrono::steady_clock::now();
+    for (uint16_t i = 0; i < READS; i++)
+    {
+        ASSERT_TRUE(client.read_holding_registers(static_cast<uint16_t>((i * 2) % 990), 1, values));
+    }
+    const auto sequential = std::chrono::steady_clock::now() - start;
+
+    std::vector<kommpot::modbus_read_request> requests;
+    for (uint16_t i = 0; i < READS; i++)
+    {
+        requests.push_back(make_request(static_cast<uint16_t>((i * 2) % 990), 1));
+    }
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(client.read(requests));
+    const auto pipelined = std::chrono::steady_clock::now() - start;
+
+    requests.clear();
+    for (uint16_t i = 0; i < READS; i++)
+    {
+        requests.push_back(make_request(static_cast<uint16_t>(i % 990), 1));
+    }
+    const auto transactions = client.transaction_count();
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(client.read(requests));
+    const auto merged = std::chrono::steady_clock::now() - start;
+    EXPECT_LT(client.transaction_count() - transactions, 5u);
+
+    const auto to_usecs = [](const auto duration) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    };
+    RecordProperty("sequential_usecs", std::to_string(to_usecs(sequential)));
+    RecordProperty("pipelined_usecs", std::to_string(to_usecs(pipelined)));
+    RecordProperty("merged_usecs", std::to_string(to_usecs(merged)));
+    std::printf("[ MODBUS   ] %u reads: sequential %lld us, pipelined %lld us, merged %lld us\n",
+        READS, static_cast<long long>(to_usecs(sequential)),
+        static_cast<long long>(to_usecs(pipelined)), static_cast<long long>(to_usecs(merged)));
+}
+
+// NOLINTEND
@@ -0,0 +1,439 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/communication_ethernet.h>
+
+#include "loopback_tcp_server.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+static std::vector<uint8_t> to_bytes(const std::string &value)
+{
+    return std::vector<uint8_t>(value.begin(), value.end());
+}
+
+static std::string to_string(const std::vector<uint8_t> &value)
+{
+    return std::string(value.begin(), value.end());
+}
+
+/**
+ * @brief length-prefixed device answering with the reversed payload, all requests received in
+ * one segment are answered in reverse order. Payload "drop" is never answered, "late" is answered
+ * after 100 ms, "slow" is answered after 3 s with the first bytes of the reply sent right away and
+ * "garbage" gets an invalid frame.
+ */
+static void device(loopback_tcp_server::handle_type handle)
+{
+    const kommpot::length_prefixed_rpc_codec codec;
+    std::vector<uint8_t> pending;
+    std::vector<uint8_t> buffer(64 * 1024);
+
+    while (true)
+    {
+        const auto result = recv(handle, reinterpret_cast<char *>(buffer.data()),
+            static_cast<int>(buffer.size()), 0);
+        if (result <= 0)
+        {
+            return;
+        }
+        pending.insert(pending.end(), buffer.begin(), buffer.begin() + result);
+
+        std::vector<std::vector<uint8_t>> replies;
+        size_t offset = 0;
+        while (true)
+        {
+            uint32_t request_id = 0;
+            std::vector<uint8_t> payload;
+            const auto consumed = codec.decode(
+                pending.data() + offset, pending.size() - offset, request_id, payload);
+            if (!consumed.has_value() || *consumed == 0)
+            {
+                break;
+            }
+            offset += *consumed;
+
+            const auto command = to_string(payload);
+            if (command == "drop")
+            {
+                continue;
+            }
+            if (command == "late")
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+            if (command == "slow")
+            {
+                std::reverse(payload.begin(), payload.end());
+                std::vector<uint8_t> frame;
+                codec.encode(request_id, payload, frame);
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                if (!loopback_tcp_server::send_all(handle, frame.data(), 4))
+                {
+                    return;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(2900));
+                if (!loopback_tcp_server::send_all(handle, frame.data() + 4, frame.size() - 4))
+                {
+                    return;
+                }
+                continue;
+            }
+            if (command == "garbage")
+            {
+                replies.push_back(std::vector<uint8_t>(8, 0xFF));
+                continue;
+            }
+
+            std::reverse(payload.begin(), payload.end());
+            replies.emplace_back();
+            codec.encode(request_id, payload, replies.back());
+        }
+        pending.erase(pending.begin(), pending.begin() + offset);
+
+        std::vector<uint8_t> reply;
+        for (auto it = replies.rbegin(); it != replies.rend(); ++it)
+        {
+            reply.insert(reply.end(), it->begin(), it->end());
+        }
+
+        if (!reply.empty() &&
+            !loopback_tcp_server::send_all(handle, reply.data(), reply.size()))
+        {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief codec with 2-bit request IDs to exercise wrapping.
+ */
+class narrow_rpc_codec : public kommpot::length_prefixed_rpc_codec
+{
+public:
+    auto max_request_id() const -> uint32_t override
+    {
+        return 3;
+    }
+};
+
+class rpc_multiplexer_test : public Test
+{
+protected:
+    loopback_tcp_server server;
+    std::unique_ptr<communication_ethernet> communication;
+
+    void SetUp() override
+    {
+        ASSERT_TRUE(server.start(device));
+
+        kommpot::ethernet_device_identification identification;
+        identification.ip = "127.0.0.1";
+        identification.port = server.port();
+        identification.protocol = kommpot::ethernet_protocol_type::TCP;
+
+        communication = std::make_unique<communication_ethernet>(identification);
+        ASSERT_TRUE(communication->open());
+    }
+
+    void TearDown() override
+    {
+        communication->close();
+    }
+
+    auto make_multiplexer(const size_t max_in_flight = 64)
+        -> std::unique_ptr<kommpot::rpc_multiplexer>
+    {
+        return std::make_unique<kommpot::rpc_multiplexer>(*communication,
+            std::make_shared<kommpot::length_prefixed_rpc_codec>(), max_in_flight);
+    }
+};
+
+/*******************************************************************************
+ *
+ * length_prefixed_rpc_codec — encode / decode.
+ *
+ *******************************************************************************/
+TEST(length_prefixed_rpc_codec, round_trip)
+{
+    const kommpot::length_prefixed_rpc_codec codec;
+
+    std::vector<uint8_t> frame;
+    codec.encode(0x01020304, to_bytes("abc"), frame);
+    EXPECT_EQ(frame, (std::vector<uint8_t>{0, 0, 0, 7, 1, 2, 3, 4, 'a', 'b', 'c'}));
+
+    uint32_t request_id = 0;
+    std::vector<uint8_t> payload;
+    const auto consumed = codec.decode(frame.data(), frame.size(), request_id, payload);
+    ASSERT_TRUE(consumed.has_value());
+    EXPECT_EQ(*consumed, frame.size());
+    EXPECT_EQ(request_id, 0x01020304u);
+    EXPECT_EQ(to_string(payload), "abc");
+}
+
+TEST(length_prefixed_rpc_codec, incomplete_frame_needs_more_data)
+{
+    const kommpot::length_prefixed_rpc_codec codec;
+
+    std::vector<uint8_t> frame;
+    codec.encode(1, to_bytes("abc"), frame);
+
+    uint32_t request_id = 0;
+    std::vector<uint8_t> payload;
+    for (size_t size_bytes = 0; size_bytes < frame.size(); size_bytes++)
+    {
+        const auto consumed = codec.decode(frame.data(), size_bytes, request_id, payload);
+        ASSERT_TRUE(consumed.has_value());
+        EXPECT_EQ(*consumed, 0u);
+    }
+}
+
+TEST(length_prefixed_rpc_codec, invalid_length_is_malformed)
+{
+    const kommpot::length_prefixed_rpc_codec codec;
+
+    const std::vector<uint8_t> short_frame = {0, 0, 0, 3, 0, 0, 0, 0};
+    const std::vector<uint8_t> long_frame = {0xFF, 0xFF, 0xFF, 0xFF, 0, 0, 0, 0};
+
+    uint32_t request_id = 0;
+    std::vector<uint8_t> payload;
+    EXPECT_FALSE(codec.decode(short_frame.data(), short_frame.size(), request_id, payload));
+    EXPECT_FALSE(codec.decode(long_frame.data(), long_frame.size(), request_id, payload));
+}
+
+/*******************************************************************************
+ *
+ * rpc_multiplexer — completion.
+ *
+ *******************************************************************************/
+TEST_F(rpc_multiplexer_test, call_returns_reply)
+{
+    auto multiplexer = make_multiplexer();
+
+    std::vector<uint8_t> response;
+    EXPECT_EQ(multiplexer->call(to_bytes("hello"), response), kommpot::rpc_status::SUCCEEDED);
+    EXPECT_EQ(to_string(response), "olleh");
+    EXPECT_EQ(multiplexer->in_flight(), 0u);
+}
+
+TEST_F(rpc_multiplexer_test, replies_out_of_order_reach_their_callbacks)
+{
+    static constexpr size_t REQUESTS = 1000;
+
+    auto multiplexer = make_multiplexer();
+
+    std::atomic<size_t> matched = 0;
+    std::atomic<size_t> completed = 0;
+    std::promise<void> done;
+
+    for (size_t i = 0; i < REQUESTS; i++)
+    {
+        const auto payload = "request " + std::to_string(i);
+        auto expected = payload;
+        std::reverse(expected.begin(), expected.end());
+
+        ASSERT_TRUE(multiplexer->submit(to_bytes(payload),
+            [&, expected](kommpot::rpc_status status, std::vector<uint8_t> reply) {
+                if (status == kommpot::rpc_status::SUCCEEDED && to_string(reply) == expected)
+                {
+                    matched++;
+                }
+                if (++completed == REQUESTS)
+                {
+                    done.set_value();
+                }
+            }));
+    }
+
+    ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(matched, REQUESTS);
+}
+
+TEST_F(rpc_multiplexer_test, window_limits_outstanding_requests)
+{
+    auto multiplexer = make_multiplexer(4);
+
+    std::atomic<size_t> completed = 0;
+    for (size_t i = 0; i < 100; i++)
+    {
+        ASSERT_TRUE(multiplexer->submit(
+            to_bytes("x"), [&](kommpot::rpc_status, std::vector<uint8_t>) { completed++; }));
+        EXPECT_LE(multiplexer->in_flight(), 4u);
+    }
+    ASSERT_TRUE(multiplexer->flush());
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (completed < 100 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(completed, 100u);
+}
+
+TEST_F(rpc_multiplexer_test, request_ids_wrap_within_codec_range)
+{
+    kommpot::rpc_multiplexer multiplexer(*communication, std::make_shared<narrow_rpc_codec>());
+
+    std::vector<std::future<bool>> results;
+    for (size_t i = 0; i < 50; i++)
+    {
+        auto result = std::make_shared<std::promise<bool>>();
+        results.push_back(result->get_future());
+        ASSERT_TRUE(multiplexer.submit(to_bytes("ab" + std::to_string(i)),
+            [result, i](kommpot::rpc_status status, std::vector<uint8_t> reply) {
+                auto expected = "ab" + std::to_string(i);
+                std::reverse(expected.begin(), expected.end());
+                result->set_value(
+                    status == kommpot::rpc_status::SUCCEEDED && to_string(reply) == expected);
+            }));
+        EXPECT_LE(multiplexer.in_flight(), 4u);
+    }
+    ASSERT_TRUE(multiplexer.flush());
+
+    for (auto &result : results)
+    {
+        EXPECT_TRUE(result.get());
+    }
+}
+
+/*******************************************************************************
+ *
+ * rpc_multiplexer — deadlines and failures.
+ *
+ *******************************************************************************/
+TEST_F(rpc_multiplexer_test, unanswered_request_times_out)
+{
+    auto multiplexer = make_multiplexer();
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<uint8_t> response;
+    EXPECT_EQ(multiplexer->call(to_bytes("drop"), response, 50), kommpot::rpc_status::TIMED_OUT);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_GE(elapsed, std::chrono::milliseconds(50));
+    EXPECT_LT(elapsed, std::chrono::milliseconds(1000));
+    EXPECT_EQ(multiplexer->in_flight(), 0u);
+}
+
+TEST_F(rpc_multiplexer_test, late_reply_is_dropped)
+{
+    auto multiplexer = make_multiplexer();
+
+    std::vector<uint8_t> response;
+    EXPECT_EQ(multiplexer->call(to_bytes("late"), response, 20), kommpot::rpc_status::TIMED_OUT);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+
+    EXPECT_EQ(multiplexer->call(to_bytes("abc"), response), kommpot::rpc_status::SUCCEEDED);
+    EXPECT_EQ(to_string(response), "cba");
+}
+
+/**
+ * @attention the reply arrives after the 2 s transfer timeout of communication_ethernet, split
+ * around it.
+ */
+TEST_F(rpc_multiplexer_test, reply_after_read_timeout_meets_deadline)
+{
+    auto multiplexer = make_multiplexer();
+
+    std::vector<uint8_t> response;
+    EXPECT_EQ(multiplexer->call(to_bytes("slow"), response, 5000),
+        kommpot::rpc_status::SUCCEEDED);
+    EXPECT_EQ(to_string(response), "wols");
+}
+
+TEST_F(rpc_multiplexer_test, malformed_reply_fails_outstanding_requests)
+{
+    auto multiplexer = make_multiplexer();
+
+    std::vector<uint8_t> response;
+    EXPECT_EQ(multiplexer->call(to_bytes("garbage"), response), kommpot::rpc_status::FAILED);
+
+    EXPECT_EQ(multiplexer->call(to_bytes("abc"), response), kommpot::rpc_status::SUCCEEDED);
+    EXPECT_EQ(to_string(response), "cba");
+}
+
+TEST_F(rpc_multiplexer_test, closed_link_fails_request)
+{
+    auto multiplexer = make_multiplexer();
+
+    communication->close();
+
+    std::vector<uint8_t> response;
+    EXPECT_EQ(multiplexer->call(to_bytes("abc"), response), kommpot::rpc_status::FAILED);
+}
+
+/*******************************************************************************
+ *
+ * rpc_multiplexer — pipelined request throughput against the simulator.
+ *
+ *******************************************************************************/
+TEST_F(rpc_multiplexer_test, pipelined_request_throughput)
+{
+    static constexpr size_t REQUESTS = 20000;
+
+    auto multiplexer = make_multiplexer();
+    const auto payload = to_bytes(std::string(32, 'p'));
+
+    std::vector<uint8_t> response;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < REQUESTS / 10; i++)
+    {
+        ASSERT_EQ(multiplexer->call(payload, response), kommpot::rpc_status::SUCCEEDED);
+    }
+    const auto sequential = std::chrono::steady_clock::now() - start;
+
+    std::atomic<size_t> succeeded = 0;
+    std::atomic<size_t> completed = 0;
+    std::promise<void> done;
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < REQUESTS; i++)
+    {
+        ASSERT_TRUE(
+            multiplexer->submit(payload, [&](kommpot::rpc_status status, std::vector<uint8_t>) {
+                if (status == kommpot::rpc_status::SUCCEEDED)
+                {
+                    succeeded++;
+                }
+                if (++completed == REQUESTS)
+                {
+                    done.set_value();
+                }
+            }));
+    }
+    ASSERT_TRUE(multiplexer->flush());
+    ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    const auto pipelined = std::chrono::steady_clock::now() - start;
+    EXPECT_EQ(succeeded, REQUESTS);
+
+    const auto to_rate = [](const auto duration, const size_t count) {
+        const auto usecs = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+        return count * 1e6 / static_cast<double>(std::max<int64_t>(usecs, 1));
+    };
+    RecordProperty("sequential_requests_per_second",
+        std::to_string(to_rate(sequential, REQUESTS / 10)));
+    RecordProperty("pipelined_requests_per_second", std::to_string(to_rate(pipelined, REQUESTS)));
+    std::printf("[ RPC      ] sequential %.0f/s, pipelined %.0f/s\n",
+        to_rate(sequential, REQUESTS / 10), to_rate(pipelined, REQUESTS));
+}
+
+// NOLINTEND
@@ -0,0 +1,296 @@
+// clazy:skip
+// NOLINTBEGIN
+
+#include <libkommpot.h>
+
+#include <communications/ethernet/communication_ethernet.h>
+
+#include "loopback_tcp_server.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace testing;
+
+/*******************************************************************************
+ *
+ * Helper functions.
+ *
+ *******************************************************************************/
+static const std::string IDENTIFICATION = "KOMMPOT,SIMULATOR,0,1.0";
+
+static std::string make_curve(const size_t size_bytes)
+{
+    std::string curve(size_bytes, '\0');
+    for (size_t i = 0; i < size_bytes; i++)
+    {
+        curve[i] = static_cast<char>(i % 251);
+    }
+    return curve;
+}
+
+static std::string make_block(const std::string &payload)
+{
+    const auto length = std::to_string(payload.size());
+    return "#" + std::to_string(length.size()) + length + payload + "\n";
+}
+
+/**
+ * @brief answers like a line based SCPI instrument on raw TCP, every received line is handled in
+ * order and replies are sent as soon as the query is parsed.
+ */
+static void instrument(loopback_tcp_server::handle_type handle)
+{
+    std::string pending;
+    uint64_t measurement = 0;
+    char buffer[4096];
+
+    while (true)
+    {
+        const auto result = recv(handle, buffer, sizeof(buffer), 0);
+        if (result <= 0)
+        {
+            return;
+        }
+        pending.append(buffer, static_cast<size_t>(result));
+
+        std::string replies;
+        size_t position = 0;
+        while ((position = pending.find('\n')) != std::string::npos)
+        {
+            const auto line = pending.substr(0, position);
+            pending.erase(0, position + 1);
+
+            if (line == "*IDN?")
+            {
+                replies += IDENTIFICATION + "\n";
+            }
+            else if (line == "MEAS:VOLT?")
+            {
+                replies += "+" + std::to_string(measurement++) + ".0E-03\n";
+            }
+            else if (line == "CURV?")
+            {
+                replies += make_block(make_curve(100000));
+            }
+            else if (line == "HEAD?")
+            {
+                replies += make_block("ab\ncd");
+            }
+            else if (line == "INDEF?")
+            {
+                replies += "#0raw bytes\n";
+            }
+            else if (line == "STAT?")
+            {
+                replies += "#H1F\r\n";
+            }
+        }
+
+        if (!replies.empty() &&
+            !loopback_tcp_server::send_all(handle, replies.data(), replies.size()))
+        {
+            return;
+        }
+    }
+}
+
+class scpi_session_test : public Test
+{
+protected:
+    loopback_tcp_server server;
+    std::unique_ptr<communication_ethernet> communication;
+
+    void SetUp() override
+    {
+        ASSERT_TRUE(server.start(instrument));
+
+        kommpot::ethernet_device_identification identification;
+        identification.ip = "127.0.0.1";
+        identification.port = server.port();
+        identification.protocol = kommpot::ethernet_protocol_type::TCP;
+
+        communication = std::make_unique<communication_ethernet>(identification);
+        ASSERT_TRUE(communication->open());
+    }
+
+    void TearDown() override
+    {
+        communication->close();
+    }
+};
+
+/*******************************************************************************
+ *
+ * scpi_session — queries.
+ *
+ *******************************************************************************/
+TEST_F(scpi_session_test, query_returns_response_without_terminator)
+{
+    kommpot::scpi_session session(*communication);
+
+    std::string response;
+    ASSERT_TRUE(session.query("*IDN?", response));
+    EXPECT_EQ(response, IDENTIFICATION);
+    EXPECT_EQ(session.pending_responses(), 0u);
+}
+
+TEST_F(scpi_session_test, commands_do_not_expect_responses)
+{
+    kommpot::scpi_session session(*communication);
+
+    ASSERT_TRUE(session.command("*RST"));
+    ASSERT_TRUE(session.command("VOLT 1.0\n"));
+
+    std::string response;
+    ASSERT_TRUE(session.query("*IDN?", response));
+    EXPECT_EQ(response, IDENTIFICATION);
+}
+
+TEST_F(scpi_session_test, non_decimal_number_is_no_block)
+{
+    kommpot::scpi_session session(*communication);
+
+    std::string response;
+    ASSERT_TRUE(session.query("STAT?", response));
+    EXPECT_EQ(response, "#H1F");
+}
+
+TEST_F(scpi_session_test, pipelined_queries_keep_order)
+{
+    kommpot::scpi_session session(*communication, {}, 8);
+
+    std::vector<std::string> queries(100, "MEAS:VOLT?");
+    queries[50] = "*IDN?";
+
+    std::vector<std::string> responses;
+    ASSERT_TRUE(session.query(queries, responses));
+    ASSERT_EQ(responses.size(), queries.size());
+
+    EXPECT_EQ(responses[0], "+0.0E-03");
+    EXPECT_EQ(responses[49], "+49.0E-03");
+    EXPECT_EQ(responses[50], IDENTIFICATION);
+    EXPECT_EQ(responses[51], "+50.0E-03");
+    EXPECT_EQ(responses[99], "+98.0E-03");
+    EXPECT_EQ(session.pending_responses(), 0u);
+}
+
+TEST_F(scpi_session_test, send_query_rejects_full_pipeline)
+{
+    kommpot::scpi_session session(*communication, {}, 2);
+
+    ASSERT_TRUE(session.send_query("*IDN?"));
+    ASSERT_TRUE(session.send_query("*IDN?"));
+    EXPECT_FALSE(session.send_query("*IDN?"));
+
+    std::string response;
+    ASSERT_TRUE(session.read_response(response));
+    EXPECT_TRUE(session.send_query("*IDN?"));
+}
+
+/*******************************************************************************
+ *
+ * scpi_session — IEEE 488.2 blocks.
+ *
+ *******************************************************************************/
+TEST_F(scpi_session_test, definite_block_is_read_into_caller_buffer)
+{
+    kommpot::scpi_session session(*communication);
+
+    std::vector<char> curve(200000);
+    size_t block_size_bytes = 0;
+    ASSERT_TRUE(session.query_block("CURV?", curve.data(), curve.size(), block_size_bytes));
+    ASSERT_EQ(block_size_bytes, 100000u);
+    EXPECT_EQ(std::string(curve.data(), block_size_bytes), make_curve(100000));
+
+    std::string response;
+    ASSERT_TRUE(session.query("*IDN?", response));
+    EXPECT_EQ(response, IDENTIFICATION);
+}
+
+TEST_F(scpi_session_test, block_payload_may_contain_newlines)
+{
+    kommpot::scpi_session session(*communication);
+
+    std::string response;
+    ASSERT_TRUE(session.query("HEAD?", response));
+    EXPECT_EQ(response, "ab\ncd");
+}
+
+TEST_F(scpi_session_test, indefinite_block_ends_at_newline)
+{
+    kommpot::scpi_session session(*communication);
+
+    char data[64] = {};
+    size_t block_size_bytes = 0;
+    ASSERT_TRUE(session.query_block("INDEF?", data, sizeof(data), block_size_bytes));
+    EXPECT_EQ(std::string(data, block_size_bytes), "raw bytes");
+}
+
+TEST_F(scpi_session_test, oversized_block_is_drained)
+{
+    kommpot::scpi_session session(*communication);
+
+    char data[16] = {};
+    size_t block_size_bytes = 0;
+    EXPECT_FALSE(session.query_block("CURV?", data, sizeof(data), block_size_bytes));
+    EXPECT_EQ(block_size_bytes, 100000u);
+
+    std::string response;
+    ASSERT_TRUE(session.query("*IDN?", response));
+    EXPECT_EQ(response, IDENTIFICATION);
+}
+
+TEST_F(scpi_session_test, read_block_rejects_plain_response)
+{
+    kommpot::scpi_session session(*communication);
+
+    char data[64] = {};
+    size_t block_size_bytes = 0;
+    EXPECT_FALSE(session.query_block("*IDN?", data, sizeof(data), block_size_bytes));
+}
+
+/*******************************************************************************
+ *
+ * scpi_session — pipelined query throughput against the simulator.
+ *
+ *******************************************************************************/
+TEST_F(scpi_session_test, pipelined_query_throughput)
+{
+    static constexpr size_t QUERIES = 2000;
+
+    kommpot::scpi_session session(*communication);
+
+    std::string response;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < QUERIES; i++)
+    {
+        ASSERT_TRUE(session.query("MEAS:VOLT?", response));
+    }
+    const auto sequential = std::chrono::steady_clock::now() - start;
+
+    const std::vector<std::string> queries(QUERIES, "MEAS:VOLT?");
+    std::vector<std::string> responses;
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(session.query(queries, responses));
+    const auto pipelined = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(responses.back(), "+" + std::to_string(2 * QUERIES - 1) + ".0E-03");
+
+    const auto to_rate = [](const auto duration) {
+        const auto usecs = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+        return QUERIES * 1e6 / static_cast<double>(std::max<int64_t>(usecs, 1));
+    };
+    RecordProperty("sequential_queries_per_second", std::to_string(to_rate(sequential)));
+    RecordProperty("pipelined_queries_per_second", std::to_string(to_rate(pipelined)));
+    std::printf("[ SCPI     ] %zu queries: sequential %.0f/s, pipelined %.0f/s\n", QUERIES,
+        to_rate(sequential), to_rate(pipelined));
+}
+
+// NOLINTEND